@@ -35,10 +35,12 @@
  */
 static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
 snapshot_get_global_flags (bool has_regex, /**< regex literal is present */
-                           bool has_class) /**< class literal is present */
+                           bool has_class, /**< class literal is present */
+                           bool has_line_info) /**< line info is present */
 {
   JERRY_UNUSED (has_regex);
   JERRY_UNUSED (has_class);
+  JERRY_UNUSED (has_line_info);
 
   uint32_t flags = 0;
 
@@ -48,6 +50,9 @@ snapshot_get_global_flags (bool has_regex, /**< regex literal is present */
 #ifndef CONFIG_DISABLE_ES2015_CLASS
   flags |= (has_class ? JERRY_SNAPSHOT_HAS_CLASS_LITERAL : 0);
 #endif /* !CONFIG_DISABLE_ES2015_CLASS */
+#ifdef JERRY_ENABLE_LINE_INFO
+  flags |= (has_line_info ? JERRY_SNAPSHOT_HAS_LINE_INFO : 0);
+#endif /* JERRY_ENABLE_LINE_INFO */
 
   return flags;
 } /* snapshot_get_global_flags */
@@ -66,8 +71,11 @@ snapshot_check_global_flags (uint32_t global_flags) /**< global flags */
 #ifndef CONFIG_DISABLE_ES2015_CLASS
   global_flags &= (uint32_t) ~JERRY_SNAPSHOT_HAS_CLASS_LITERAL;
 #endif /* !CONFIG_DISABLE_ES2015_CLASS */
+#ifdef JERRY_ENABLE_LINE_INFO
+  global_flags &= (uint32_t) ~JERRY_SNAPSHOT_HAS_LINE_INFO;
+#endif /* JERRY_ENABLE_LINE_INFO */
 
-  return global_flags == snapshot_get_global_flags (false, false);
+  return global_flags == snapshot_get_global_flags (false, false, false);
 } /* snapshot_check_global_flags */
 
 #endif /* JERRY_ENABLE_SNAPSHOT_SAVE || JERRY_ENABLE_SNAPSHOT_EXEC */
@@ -512,6 +520,23 @@ jerry_snapshot_set_offsets (uint32_t *buffer_p, /**< buffer */
         }
       }
 
+#ifdef JERRY_ENABLE_LINE_INFO
+      if (bytecode_p->status_flags & CBC_CODE_FLAGS_LINE_INFO)
+      {
+        ecma_value_t *resource_name_p = (ecma_value_t *) ecma_compiled_code_get_resource_name_p (bytecode_p);
+        lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
+
+        JERRY_ASSERT (ecma_is_value_string (*resource_name_p));
+
+        while (current_p->literal_id != *resource_name_p)
+        {
+          current_p++;
+        }
+
+        *resource_name_p = current_p->literal_offset;
+      }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
       /* Set reference counter to 1. */
       bytecode_p->refs = 1;
     }
@@ -573,6 +598,7 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
 
   size_t header_size;
   uint32_t argument_end = 0;
+  uint32_t ident_end;
   uint32_t const_literal_end;
   uint32_t literal_end;
 
@@ -586,6 +612,7 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
       argument_end = args_p->argument_end;
     }
 
+    ident_end = args_p->ident_end;
     const_literal_end = (uint32_t) (args_p->const_literal_end - args_p->register_end);
     literal_end = (uint32_t) (args_p->literal_end - args_p->register_end);
     header_size = sizeof (cbc_uint16_arguments_t);
@@ -600,6 +627,7 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
       argument_end = args_p->argument_end;
     }
 
+    ident_end = args_p->ident_end;
     const_literal_end = (uint32_t) (args_p->const_literal_end - args_p->register_end);
     literal_end = (uint32_t) (args_p->literal_end - args_p->register_end);
     header_size = sizeof (cbc_uint8_arguments_t);
@@ -623,11 +651,25 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
     uint8_t *real_bytecode_p = ((uint8_t *) bytecode_p) + start_offset;
     uint32_t new_code_size = (uint32_t) (start_offset + 1 + sizeof (uint8_t *));
 
-    if (argument_end != 0)
+    /* The argument names and the scope info block are stored at the end of the byte code. */
+    uint32_t trailer_size = (uint32_t) (argument_end * sizeof (ecma_value_t));
+
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_SCOPE_INFO)
+    {
+      const uint16_t *scope_info_end_p = (const uint16_t *) (base_addr_p + code_size - trailer_size);
+      trailer_size += (uint32_t) CBC_SCOPE_INFO_SIZE (ident_end - scope_info_end_p[-1]);
+    }
+
+#ifdef JERRY_ENABLE_LINE_INFO
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_LINE_INFO)
     {
-      new_code_size += (uint32_t) (argument_end * sizeof (ecma_value_t));
+      /* The line info block is stored before the scope info block. */
+      const uint32_t *line_info_end_p = (const uint32_t *) (base_addr_p + code_size - trailer_size);
+      trailer_size += (uint32_t) CBC_LINE_INFO_SIZE (line_info_end_p[-2]);
     }
+#endif /* JERRY_ENABLE_LINE_INFO */
 
+    new_code_size += trailer_size;
     new_code_size = JERRY_ALIGNUP (new_code_size, JMEM_ALIGNMENT);
 
     bytecode_p = (ecma_compiled_code_t *) jmem_heap_alloc_block (new_code_size);
@@ -642,12 +684,11 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
 
     uint8_t *byte_p = (uint8_t *) bytecode_p;
 
-    if (argument_end != 0)
+    if (trailer_size != 0)
     {
-      uint32_t argument_size = (uint32_t) (argument_end * sizeof (ecma_value_t));
-      memcpy (byte_p + new_code_size - argument_size,
-              base_addr_p + code_size - argument_size,
-              argument_size);
+      memcpy (byte_p + new_code_size - trailer_size,
+              base_addr_p + code_size - trailer_size,
+              trailer_size);
     }
 
     byte_p[start_offset] = CBC_SET_BYTECODE_PTR;
@@ -708,6 +749,14 @@ snapshot_load_compiled_code (const uint8_t *base_addr_p, /**< base address of th
     }
   }
 
+#ifdef JERRY_ENABLE_LINE_INFO
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_LINE_INFO)
+  {
+    ecma_value_t *resource_name_p = (ecma_value_t *) ecma_compiled_code_get_resource_name_p (bytecode_p);
+    *resource_name_p = ecma_snapshot_get_literal (literal_base_p, *resource_name_p);
+  }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
   return bytecode_p;
 } /* snapshot_load_compiled_code */
 
@@ -734,12 +783,21 @@ jerry_generate_snapshot_with_args (const jerry_char_t *resource_name_p, /**< scr
                                    uint32_t *buffer_p, /**< buffer to save snapshot to */
                                    size_t buffer_size) /**< the buffer's size */
 {
-  /* Currently unused arguments. */
+#ifdef JERRY_ENABLE_LINE_INFO
+  /* Line info is only saved when a resource name is specified. Static snapshots
+   * cannot refer to the resource name, which is stored in the literal storage. */
+  if (resource_name_length == 0 || (generate_snapshot_opts & JERRY_SNAPSHOT_SAVE_STATIC))
+  {
+    JERRY_CONTEXT (resource_name) = ECMA_VALUE_UNDEFINED;
+  }
+  else
+  {
+    JERRY_CONTEXT (resource_name) = ecma_find_or_create_literal_string (resource_name_p,
+                                                                        (lit_utf8_size_t) resource_name_length);
+  }
+#else /* !JERRY_ENABLE_LINE_INFO */
   JERRY_UNUSED (resource_name_p);
   JERRY_UNUSED (resource_name_length);
-
-#ifdef JERRY_ENABLE_LINE_INFO
-  JERRY_CONTEXT (resource_name) = ECMA_VALUE_UNDEFINED;
 #endif /* JERRY_ENABLE_LINE_INFO */
 
   snapshot_globals_t globals;
@@ -785,7 +843,9 @@ jerry_generate_snapshot_with_args (const jerry_char_t *resource_name_p, /**< scr
   jerry_snapshot_header_t header;
   header.magic = JERRY_SNAPSHOT_MAGIC;
   header.version = JERRY_SNAPSHOT_VERSION;
-  header.global_flags = snapshot_get_global_flags (globals.regex_found, globals.class_found);
+  header.global_flags = snapshot_get_global_flags (globals.regex_found,
+                                                   globals.class_found,
+                                                   (bytecode_data_p->status_flags & CBC_CODE_FLAGS_LINE_INFO) != 0);
   header.lit_table_offset = (uint32_t) globals.snapshot_buffer_write_offset;
   header.number_of_funcs = 1;
   header.func_offsets[0] = aligned_header_size;
@@ -1106,6 +1166,15 @@ scan_snapshot_functions (const uint8_t *buffer_p, /**< snapshot buffer start */
           }
         }
       }
+
+#ifdef JERRY_ENABLE_LINE_INFO
+      if (bytecode_p->status_flags & CBC_CODE_FLAGS_LINE_INFO)
+      {
+        const ecma_value_t *resource_name_p = ecma_compiled_code_get_resource_name_p (bytecode_p);
+        ecma_value_t lit_value = ecma_snapshot_get_literal (literal_base_p, *resource_name_p);
+        ecma_save_literals_append_value (lit_value, lit_pool_p);
+      }
+#endif /* JERRY_ENABLE_LINE_INFO */
     }
 
     buffer_p += code_size;
@@ -1191,6 +1260,22 @@ update_literal_offsets (uint8_t *buffer_p, /**< [in,out] snapshot buffer start *
           }
         }
       }
+
+#ifdef JERRY_ENABLE_LINE_INFO
+      if (bytecode_p->status_flags & CBC_CODE_FLAGS_LINE_INFO)
+      {
+        ecma_value_t *resource_name_p = (ecma_value_t *) ecma_compiled_code_get_resource_name_p (bytecode_p);
+        ecma_value_t lit_value = ecma_snapshot_get_literal (literal_base_p, *resource_name_p);
+        const lit_mem_to_snapshot_id_map_entry_t *current_p = lit_map_p;
+
+        while (current_p->literal_id != lit_value)
+        {
+          current_p++;
+        }
+
+        *resource_name_p = current_p->literal_offset;
+      }
+#endif /* JERRY_ENABLE_LINE_INFO */
     }
 
     buffer_p += code_size;
@@ -25,6 +25,8 @@
 #include "ecma-eval.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
+#include "ecma-heap-image.h"
+#include "ecma-heap-snapshot.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
 #include "ecma-lex-env.h"
@@ -32,6 +34,7 @@
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-regexp-object.h"
+#include "ecma-structured-clone.h"
 #include "ecma-promise-object.h"
 #include "ecma-typedarray-object.h"
 #include "jcontext.h"
@@ -204,6 +207,18 @@ jerry_cleanup (void)
     }
   }
 
+#ifdef JERRY_PROFILER
+  vm_profiler_free_stacks ();
+#endif /* JERRY_PROFILER */
+
+#ifdef JERRY_VM_STATS
+  vm_stats_reset ();
+#endif /* JERRY_VM_STATS */
+
+#ifdef JMEM_ALLOC_SITES
+  jmem_alloc_sites_finalize ();
+#endif /* JMEM_ALLOC_SITES */
+
 #ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
   ecma_free_all_enqueued_jobs ();
 #endif /* CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
@@ -877,6 +892,24 @@ jerry_is_feature_enabled (const jerry_feature_t feature) /**< feature to check *
 #ifdef JERRY_VM_EXEC_STOP
           || feature == JERRY_FEATURE_VM_EXEC_STOP
 #endif /* JERRY_VM_EXEC_STOP */
+#ifdef JERRY_PROFILER
+          || feature == JERRY_FEATURE_PROFILER
+#endif /* JERRY_PROFILER */
+#ifdef JERRY_VM_STATS
+          || feature == JERRY_FEATURE_VM_STATS
+#endif /* JERRY_VM_STATS */
+#ifdef JERRY_HEAP_SNAPSHOT
+          || feature == JERRY_FEATURE_HEAP_SNAPSHOT
+#endif /* JERRY_HEAP_SNAPSHOT */
+#ifdef JMEM_ALLOC_SITES
+          || feature == JERRY_FEATURE_MEM_ALLOC_SITES
+#endif /* JMEM_ALLOC_SITES */
+#ifdef JERRY_STRUCTURED_CLONE
+          || feature == JERRY_FEATURE_STRUCTURED_CLONE
+#endif /* JERRY_STRUCTURED_CLONE */
+#ifdef JERRY_HEAP_IMAGE
+          || feature == JERRY_FEATURE_HEAP_IMAGE
+#endif /* JERRY_HEAP_IMAGE */
 #ifndef CONFIG_DISABLE_JSON_BUILTIN
           || feature == JERRY_FEATURE_JSON
 #endif /* !CONFIG_DISABLE_JSON_BUILTIN */
@@ -1405,6 +1438,64 @@ jerry_create_object (void)
   return ecma_make_object_value (ecma_op_create_object_object_noarg ());
 } /* jerry_create_object */
 
+/**
+ * Create new JavaScript object with the given data properties, like an object literal.
+ *
+ * Note:
+ *      - the properties are defined on the object, so the setters of its prototype are not called
+ *      - when a name occurs more than once, the last value is stored
+ *      - returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return value of the created object - if success
+ *         value marked with error flag - otherwise
+ */
+jerry_value_t
+jerry_create_object_from_properties (const jerry_value_t *prop_names_p, /**< property names (string values) */
+                                     const jerry_value_t *values_p, /**< values of the properties */
+                                     jerry_size_t count) /**< number of properties */
+{
+  jerry_assert_api_available ();
+
+  if (count > 0 && (prop_names_p == NULL || values_p == NULL))
+  {
+    return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (wrong_args_msg_p)));
+  }
+
+  for (jerry_size_t i = 0; i < count; i++)
+  {
+    if (!ecma_is_value_string (prop_names_p[i])
+        || ecma_is_value_error_reference (values_p[i]))
+    {
+      return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (wrong_args_msg_p)));
+    }
+  }
+
+  ecma_object_t *object_p = ecma_op_create_object_object_noarg ();
+
+  for (jerry_size_t i = 0; i < count; i++)
+  {
+    ecma_string_t *prop_name_p = ecma_get_string_from_value (prop_names_p[i]);
+    ecma_property_t *property_p = ecma_find_named_property (object_p, prop_name_p);
+    ecma_property_value_t *prop_value_p;
+
+    if (JERRY_LIKELY (property_p == NULL))
+    {
+      prop_value_p = ecma_create_named_data_property (object_p,
+                                                      prop_name_p,
+                                                      ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                      NULL);
+    }
+    else
+    {
+      prop_value_p = ECMA_PROPERTY_VALUE_PTR (property_p);
+    }
+
+    ecma_named_data_property_assign_value (object_p, prop_value_p, values_p[i]);
+  }
+
+  return ecma_make_object_value (object_p);
+} /* jerry_create_object_from_properties */
+
 /**
  * Create an empty Promise object which can be resolve/reject later
  * by calling jerry_resolve_or_reject_promise.
@@ -1493,6 +1584,68 @@ jerry_create_string_sz (const jerry_char_t *str_p, /**< pointer to string */
   return ecma_make_string_value (ecma_str_p);
 } /* jerry_create_string_sz */
 
+/**
+ * Create a property name from a valid CESU-8 string
+ *
+ * The property name is a string value, which is shared with the equal property names
+ * of the parsed source code. Property lookups with the same name value do not create
+ * and hash a new string, so applications should create their frequently used names
+ * once and pass them to the property functions.
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return value of the property name
+ */
+jerry_value_t
+jerry_create_property_name (const jerry_char_t *str_p, /**< pointer to string */
+                            jerry_size_t str_size) /**< string size */
+{
+  jerry_assert_api_available ();
+
+  ecma_value_t name_value = ecma_find_or_create_literal_string ((const lit_utf8_byte_t *) str_p,
+                                                                (lit_utf8_size_t) str_size);
+  return ecma_copy_value (name_value);
+} /* jerry_create_property_name */
+
+/**
+ * Create external string from a valid CESU-8 string
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return value of the created external string
+ */
+jerry_value_t
+jerry_create_external_string (const jerry_char_t *str_p, /**< pointer to string */
+                              jerry_object_native_free_callback_t free_cb) /**< free callback */
+{
+  return jerry_create_external_string_sz (str_p, lit_zt_utf8_string_size ((lit_utf8_byte_t *) str_p), free_cb);
+} /* jerry_create_external_string */
+
+/**
+ * Create external string from a valid CESU-8 string
+ *
+ * Note:
+ *      the characters are not copied, the buffer must be kept alive and unchanged
+ *      until free_cb is called with str_p (free_cb can be NULL).
+ *      returned value must be freed with jerry_release_value when it is no longer needed.
+ *
+ * @return value of the created external string
+ */
+jerry_value_t
+jerry_create_external_string_sz (const jerry_char_t *str_p, /**< pointer to string */
+                                 jerry_size_t str_size, /**< string size */
+                                 jerry_object_native_free_callback_t free_cb) /**< free callback */
+{
+  jerry_assert_api_available ();
+
+  ecma_string_t *ecma_str_p = ecma_new_ecma_external_string_from_cesu8 ((lit_utf8_byte_t *) str_p,
+                                                                        (lit_utf8_size_t) str_size,
+                                                                        (ecma_object_native_free_callback_t) free_cb);
+  return ecma_make_string_value (ecma_str_p);
+} /* jerry_create_external_string_sz */
+
 /**
  * Calculates the size of the given pattern and creates a RegExp object.
  *
@@ -1796,6 +1949,61 @@ jerry_substring_to_utf8_char_buffer (const jerry_value_t value, /**< input strin
                                              buffer_size);
 } /* jerry_substring_to_utf8_char_buffer */
 
+/**
+ * Get the characters of an utf-8 encoded string without copying them if possible.
+ *
+ * Note:
+ *      The '\0' character could occur anywhere in the returned string, and the string
+ *      is not zero terminated.
+ *      The characters are only copied when the string is not stored as a contiguous
+ *      buffer (e.g. numbers) or its internal cesu-8 representation contains surrogate pairs.
+ *      The returned buffer is valid until jerry_string_release_utf8 is called with the
+ *      same value, buffer and size, and the value must not be released before.
+ *      Returns NULL and sets the size to 0, if the value parameter is not a string or
+ *      the characters must be copied and there is not enough memory for the copy.
+ *
+ * @return pointer to the utf-8 characters of the string - if success
+ *         NULL - otherwise
+ */
+const jerry_char_t *
+jerry_string_borrow_utf8 (const jerry_value_t value, /**< input string value */
+                          jerry_size_t *size_p) /**< [out] size of the characters */
+{
+  jerry_assert_api_available ();
+
+  if (!ecma_is_value_string (value))
+  {
+    *size_p = 0;
+    return NULL;
+  }
+
+  lit_utf8_size_t size;
+  const lit_utf8_byte_t *chars_p = ecma_string_borrow_utf8_chars (ecma_get_string_from_value (value), &size);
+
+  *size_p = (jerry_size_t) size;
+  return (const jerry_char_t *) chars_p;
+} /* jerry_string_borrow_utf8 */
+
+/**
+ * Release the characters returned by jerry_string_borrow_utf8.
+ */
+void
+jerry_string_release_utf8 (const jerry_value_t value, /**< input string value */
+                           const jerry_char_t *buffer_p, /**< characters returned by jerry_string_borrow_utf8 */
+                           jerry_size_t size) /**< size returned by jerry_string_borrow_utf8 */
+{
+  jerry_assert_api_available ();
+
+  if (!ecma_is_value_string (value) || buffer_p == NULL)
+  {
+    return;
+  }
+
+  ecma_string_release_utf8_chars (ecma_get_string_from_value (value),
+                                  (const lit_utf8_byte_t *) buffer_p,
+                                  (lit_utf8_size_t) size);
+} /* jerry_string_release_utf8 */
+
 /**
  * Checks whether the object or it's prototype objects have the given property.
  *
@@ -1947,6 +2155,70 @@ jerry_get_property_by_index (const jerry_value_t obj_val, /**< object value */
   return jerry_return (ret_value);
 } /* jerry_get_property_by_index */
 
+/**
+ * Get the values of several properties of the specified object.
+ *
+ * Note:
+ *      the values stored into values_p must be freed with jerry_release_value,
+ *      when they are no longer needed (they are undefined when an error is thrown)
+ *
+ * @return true value - if success
+ *         value marked with error flag - otherwise
+ */
+jerry_value_t
+jerry_get_properties (const jerry_value_t obj_val, /**< object value */
+                      const jerry_value_t *prop_names_p, /**< property names (string values) */
+                      jerry_value_t *values_p, /**< [out] values of the properties */
+                      jerry_size_t count) /**< number of properties */
+{
+  jerry_assert_api_available ();
+
+  if (count > 0 && (prop_names_p == NULL || values_p == NULL))
+  {
+    return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (wrong_args_msg_p)));
+  }
+
+  for (jerry_size_t i = 0; i < count; i++)
+  {
+    values_p[i] = ECMA_VALUE_UNDEFINED;
+  }
+
+  if (!ecma_is_value_object (obj_val))
+  {
+    return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (wrong_args_msg_p)));
+  }
+
+  for (jerry_size_t i = 0; i < count; i++)
+  {
+    if (!ecma_is_value_string (prop_names_p[i]))
+    {
+      return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (wrong_args_msg_p)));
+    }
+  }
+
+  ecma_object_t *object_p = ecma_get_object_from_value (obj_val);
+
+  for (jerry_size_t i = 0; i < count; i++)
+  {
+    ecma_value_t value = ecma_op_object_get (object_p, ecma_get_string_from_value (prop_names_p[i]));
+
+    if (ECMA_IS_VALUE_ERROR (value))
+    {
+      for (jerry_size_t j = 0; j < i; j++)
+      {
+        ecma_free_value (values_p[j]);
+        values_p[j] = ECMA_VALUE_UNDEFINED;
+      }
+
+      return jerry_throw (value);
+    }
+
+    values_p[i] = value;
+  }
+
+  return ECMA_VALUE_TRUE;
+} /* jerry_get_properties */
+
 /**
  * Set a property to the specified object with the given name.
  *
@@ -2726,7 +2998,19 @@ jerry_create_context (uint32_t heap_size, /**< the size of heap */
 
   size_t total_size = sizeof (jerry_context_t) + JMEM_ALIGNMENT;
 
-#ifndef JERRY_SYSTEM_ALLOCATOR
+#ifdef JMEM_HEAP_REGIONS
+  /* The heap is allocated in regions on demand, only the region table is stored in the context. */
+  heap_size = (uint32_t) (heap_size / JMEM_HEAP_REGION_SIZE * JMEM_HEAP_REGION_SIZE);
+
+  if (heap_size == 0)
+  {
+    return NULL;
+  }
+
+  const size_t heap_struct_size = (sizeof (jmem_heap_t)
+                                   + (heap_size / JMEM_HEAP_REGION_SIZE) * sizeof (jmem_heap_region_t));
+  total_size += JERRY_ALIGNUP (heap_struct_size, JMEM_ALIGNMENT);
+#elif !defined (JERRY_SYSTEM_ALLOCATOR)
   heap_size = JERRY_ALIGNUP (heap_size, JMEM_ALIGNMENT);
 
   /* Minimum heap size is 1Kbyte. */
@@ -2736,7 +3020,7 @@ jerry_create_context (uint32_t heap_size, /**< the size of heap */
   }
 
   total_size += heap_size;
-#endif /* !JERRY_SYSTEM_ALLOCATOR */
+#endif /* JMEM_HEAP_REGIONS */
 
   total_size = JERRY_ALIGNUP (total_size, JMEM_ALIGNMENT);
 
@@ -2754,11 +3038,15 @@ jerry_create_context (uint32_t heap_size, /**< the size of heap */
 
   uint8_t *byte_p = (uint8_t *) context_ptr;
 
-#ifndef JERRY_SYSTEM_ALLOCATOR
+#ifdef JMEM_HEAP_REGIONS
+  context_p->heap_p = (jmem_heap_t *) byte_p;
+  context_p->heap_size = heap_size;
+  byte_p += heap_struct_size;
+#elif !defined (JERRY_SYSTEM_ALLOCATOR)
   context_p->heap_p = (jmem_heap_t *) byte_p;
   context_p->heap_size = heap_size;
   byte_p += heap_size;
-#endif /* !JERRY_SYSTEM_ALLOCATOR */
+#endif /* JMEM_HEAP_REGIONS */
 
   JERRY_ASSERT (byte_p <= ((uint8_t *) context_p) + total_size);
 
@@ -2815,6 +3103,387 @@ jerry_get_backtrace (uint32_t max_depth) /**< depth limit of the backtrace */
   return vm_get_backtrace (max_depth);
 } /* jerry_get_backtrace */
 
+/**
+ * Start collecting samples of the executed call stacks.
+ *
+ * If interval is greater than 0, a sample is taken after every interval number
+ * of executed byte code instructions. Otherwise samples are only taken when
+ * requested by jerry_profiler_request_sample (e.g. from a timer signal handler).
+ *
+ * Note:
+ *      the previously collected samples are kept, see jerry_profiler_reset
+ */
+void
+jerry_profiler_start (uint32_t interval) /**< number of instructions between samples, 0 = no periodic sampling */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_PROFILER
+  if (interval == 0)
+  {
+    interval = VM_PROFILER_NO_INTERVAL;
+  }
+
+  JERRY_CONTEXT (profiler_interval) = interval;
+  JERRY_CONTEXT (profiler_countdown) = interval;
+  JERRY_CONTEXT (profiler_is_running) = true;
+#else /* !JERRY_PROFILER */
+  JERRY_UNUSED (interval);
+#endif /* JERRY_PROFILER */
+} /* jerry_profiler_start */
+
+/**
+ * Stop collecting samples. The collected samples are kept.
+ */
+void
+jerry_profiler_stop (void)
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_PROFILER
+  JERRY_CONTEXT (profiler_is_running) = false;
+  JERRY_CONTEXT (profiler_countdown) = VM_PROFILER_NO_INTERVAL;
+#endif /* JERRY_PROFILER */
+} /* jerry_profiler_stop */
+
+/**
+ * Request a sample before the next byte code instruction is executed.
+ *
+ * Note:
+ *      this function only sets a counter, so it can be called from a signal
+ *      handler (e.g. a 1 kHz profiling timer); a request which coincides
+ *      with a periodic sample may be merged into that sample
+ */
+void
+jerry_profiler_request_sample (void)
+{
+#ifdef JERRY_PROFILER
+  if (JERRY_CONTEXT (profiler_is_running))
+  {
+    JERRY_CONTEXT (profiler_countdown) = 1;
+  }
+#endif /* JERRY_PROFILER */
+} /* jerry_profiler_request_sample */
+
+/**
+ * Free the collected samples.
+ */
+void
+jerry_profiler_reset (void)
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_PROFILER
+  vm_profiler_free_stacks ();
+#endif /* JERRY_PROFILER */
+} /* jerry_profiler_reset */
+
+/**
+ * Print the collected samples in the collapsed stack format accepted by
+ * flame graph tools: one line for each unique call stack, which contains
+ * the frames starting from the outermost one separated by semicolons,
+ * followed by a space and the number of samples. Frames are named as
+ * "resource:line" if line info is enabled, and "0x<byte code>:<offset>"
+ * otherwise.
+ *
+ * Note:
+ *      the output is not zero terminated
+ *
+ * @return size of the whole output - if it is greater than buffer_size, the output is truncated
+ *         0 - if the profiler is disabled or there are no samples
+ */
+size_t
+jerry_profiler_get_collapsed_stacks (jerry_char_t *buffer_p, /**< [out] output buffer (can be NULL) */
+                                     size_t buffer_size) /**< size of the output buffer */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_PROFILER
+  return vm_profiler_get_collapsed_stacks ((lit_utf8_byte_t *) buffer_p, buffer_size);
+#else /* !JERRY_PROFILER */
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return 0;
+#endif /* JERRY_PROFILER */
+} /* jerry_profiler_get_collapsed_stacks */
+
+/**
+ * Print the VM execution statistics in JSON format. The result object contains
+ * the total number of executed instructions ("steps"), the execution count of
+ * each opcode ("opcodes") and VM_OC_* group ("groups"), the number of calls and
+ * executed instructions of each compiled code ("functions"), and the lookup and
+ * hit counts of the lcache ("lcache") and property hashmaps ("property_hashmap").
+ *
+ * Note:
+ *      the output is not zero terminated
+ *
+ * @return size of the whole output - if it is greater than buffer_size, the output is truncated
+ *         0 - if the VM statistics feature is disabled
+ */
+size_t
+jerry_get_vm_stats_json (jerry_char_t *buffer_p, /**< [out] output buffer (can be NULL) */
+                         size_t buffer_size) /**< size of the output buffer */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_VM_STATS
+  return vm_stats_to_json ((lit_utf8_byte_t *) buffer_p, buffer_size);
+#else /* !JERRY_VM_STATS */
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return 0;
+#endif /* JERRY_VM_STATS */
+} /* jerry_get_vm_stats_json */
+
+/**
+ * Reset the VM execution statistics.
+ *
+ * Note:
+ *      instructions of the currently running functions are counted as "unknown"
+ */
+void
+jerry_reset_vm_stats (void)
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_VM_STATS
+  vm_stats_reset ();
+#endif /* JERRY_VM_STATS */
+} /* jerry_reset_vm_stats */
+
+/**
+ * Write a snapshot of the object graph through the callback. A garbage
+ * collection is performed first, so only live objects are reported.
+ *
+ * The stream is a text format described in the API reference, and it
+ * can be converted to other formats by tools/heap-snapshot-convert.py
+ *
+ * @return true - if the whole snapshot was passed to the callback,
+ *         false - if the callback aborted it or the heap snapshot feature is disabled
+ */
+bool
+jerry_heap_snapshot (jerry_heap_snapshot_cb_t callback_p, /**< callback receiving the stream */
+                     void *user_p) /**< user pointer passed to the callback */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_HEAP_SNAPSHOT
+  if (callback_p == NULL)
+  {
+    return false;
+  }
+
+  ecma_gc_run (JMEM_FREE_UNUSED_MEMORY_SEVERITY_LOW);
+  return ecma_heap_snapshot ((ecma_heap_snapshot_callback_t) callback_p, user_p);
+#else /* !JERRY_HEAP_SNAPSHOT */
+  JERRY_UNUSED (callback_p);
+  JERRY_UNUSED (user_p);
+
+  return false;
+#endif /* JERRY_HEAP_SNAPSHOT */
+} /* jerry_heap_snapshot */
+
+/**
+ * Save the heap of the current context into a heap image, which can initialize
+ * other contexts by jerry_init_from_heap_image without running the code again.
+ *
+ * Note:
+ *      the image can be saved only when no code is running and no jobs are pending, and
+ *      the values held by the application must be released before: they are not part of
+ *      the image, and their memory is never freed in the restored contexts
+ *
+ * Note:
+ *      the native pointers of the heap (external function handlers, native pointers of
+ *      objects, memory of external ArrayBuffers) are passed to the callback, and the
+ *      returned value is saved instead of them
+ *
+ * @return number value with the size of the image (if it is greater than buffer_size,
+ *                                                  the image is not saved)
+ *         thrown error - if the heap cannot be saved, or the heap image feature is disabled
+ */
+jerry_value_t
+jerry_save_heap_image (uint8_t *buffer_p, /**< [out] output buffer (can be NULL) */
+                       size_t buffer_size, /**< size of the output buffer */
+                       jerry_heap_image_pointer_cb_t pointer_cb, /**< native pointer callback (can be NULL) */
+                       void *user_p) /**< user pointer passed to the callback */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_HEAP_IMAGE
+  return jerry_return (ecma_heap_image_save (buffer_p, buffer_size, pointer_cb, user_p));
+#else /* !JERRY_HEAP_IMAGE */
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+  JERRY_UNUSED (pointer_cb);
+  JERRY_UNUSED (user_p);
+
+  return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG ("Heap image is not supported.")));
+#endif /* JERRY_HEAP_IMAGE */
+} /* jerry_save_heap_image */
+
+/**
+ * Initialize Jerry engine from a heap image saved by jerry_save_heap_image.
+ *
+ * This is the replacement of jerry_init: the heap and the built-in objects are copied
+ * from the image, and the values saved by the native pointer callback are mapped back
+ * to native pointers by the callback.
+ *
+ * Note:
+ *      the image must be saved by the same build of the engine, and the image data
+ *      is not validated beyond its layout
+ *
+ * @return true - if the engine is initialized,
+ *         false - if the image is invalid, or the heap image feature is disabled
+ *                 (the engine is not initialized in this case)
+ */
+bool
+jerry_init_from_heap_image (jerry_init_flag_t flags, /**< combination of Jerry flags */
+                            const uint8_t *image_p, /**< heap image */
+                            size_t image_size, /**< size of the heap image */
+                            jerry_heap_image_pointer_cb_t pointer_cb, /**< native pointer callback (can be NULL) */
+                            void *user_p) /**< user pointer passed to the callback */
+{
+  /* This function cannot be called twice unless jerry_cleanup is called. */
+  JERRY_ASSERT (!(JERRY_CONTEXT (status_flags) & ECMA_STATUS_API_AVAILABLE));
+
+#ifdef JERRY_HEAP_IMAGE
+  if (!ecma_heap_image_is_valid (image_p, image_size))
+  {
+    return false;
+  }
+
+  /* Zero out all non-external members. */
+  memset (&JERRY_CONTEXT (JERRY_CONTEXT_FIRST_MEMBER), 0,
+          sizeof (jerry_context_t) - offsetof (jerry_context_t, JERRY_CONTEXT_FIRST_MEMBER));
+
+  JERRY_CONTEXT (jerry_init_flags) = flags;
+
+  jerry_make_api_available ();
+
+  ecma_heap_image_restore (image_p, pointer_cb, user_p);
+  return true;
+#else /* !JERRY_HEAP_IMAGE */
+  JERRY_UNUSED (flags);
+  JERRY_UNUSED (image_p);
+  JERRY_UNUSED (image_size);
+  JERRY_UNUSED (pointer_cb);
+  JERRY_UNUSED (user_p);
+
+  return false;
+#endif /* JERRY_HEAP_IMAGE */
+} /* jerry_init_from_heap_image */
+
+/**
+ * Print the allocation sites in JSON format. Each site is an engine function
+ * which allocated memory ("engine") and the executed position of the innermost
+ * script function at the time ("script"): "resource:line" with line info, or
+ * "byte code address+offset" without it, or null outside of script code.
+ * The size and number of the live blocks ("live_bytes", "live_blocks") and of
+ * the allocations since the last reset ("allocated_bytes", "allocations") are
+ * reported for each site.
+ *
+ * Note:
+ *      the output is not zero terminated
+ *
+ * @return size of the whole output - if it is greater than buffer_size, the output is truncated
+ *         0 - if the allocation site feature is disabled
+ */
+size_t
+jerry_get_alloc_sites_json (jerry_char_t *buffer_p, /**< [out] output buffer (can be NULL) */
+                            size_t buffer_size) /**< size of the output buffer */
+{
+  jerry_assert_api_available ();
+
+#ifdef JMEM_ALLOC_SITES
+  return jmem_alloc_sites_to_json ((uint8_t *) buffer_p, buffer_size);
+#else /* !JMEM_ALLOC_SITES */
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return 0;
+#endif /* JMEM_ALLOC_SITES */
+} /* jerry_get_alloc_sites_json */
+
+/**
+ * Reset the allocation counters of the allocation sites.
+ *
+ * Note:
+ *      the live blocks are not affected, and the allocation rate of a site
+ *      can be computed from the counters and the time since the last reset
+ */
+void
+jerry_reset_alloc_sites (void)
+{
+  jerry_assert_api_available ();
+
+#ifdef JMEM_ALLOC_SITES
+  jmem_alloc_sites_reset ();
+#endif /* JMEM_ALLOC_SITES */
+} /* jerry_reset_alloc_sites */
+
+/**
+ * Serialize a value into a compact binary form, which can be deserialized in another context.
+ *
+ * Note:
+ *      * objects which are reachable from the value more than once (including cycles)
+ *        are serialized once, and the references are restored by jerry_deserialize.
+ *      * if the serialized data does not fit into the buffer, the content of the buffer
+ *        is unspecified, and the returned size can be used to allocate a large enough buffer.
+ *      * returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return number value with the size of the serialized data - if the value can be cloned
+ *         thrown error - otherwise (e.g. the value contains functions or symbols)
+ */
+jerry_value_t
+jerry_serialize (const jerry_value_t value, /**< value to serialize */
+                 uint8_t *buffer_p, /**< [out] output buffer (can be NULL) */
+                 size_t buffer_size) /**< size of the output buffer */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_STRUCTURED_CLONE
+  if (ecma_is_value_error_reference (value))
+  {
+    return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (error_value_msg_p)));
+  }
+
+  return jerry_return (ecma_structured_clone_serialize (value, buffer_p, buffer_size));
+#else /* !JERRY_STRUCTURED_CLONE */
+  JERRY_UNUSED (value);
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG ("Structured clone is not supported.")));
+#endif /* JERRY_STRUCTURED_CLONE */
+} /* jerry_serialize */
+
+/**
+ * Deserialize a value which was serialized by jerry_serialize.
+ *
+ * Note:
+ *      returned value must be freed with jerry_release_value, when it is no longer needed.
+ *
+ * @return deserialized value - if the data is valid
+ *         thrown error - otherwise
+ */
+jerry_value_t
+jerry_deserialize (const uint8_t *buffer_p, /**< serialized data */
+                   size_t buffer_size) /**< size of the serialized data */
+{
+  jerry_assert_api_available ();
+
+#ifdef JERRY_STRUCTURED_CLONE
+  return jerry_return (ecma_structured_clone_deserialize (buffer_p, buffer_size));
+#else /* !JERRY_STRUCTURED_CLONE */
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+
+  return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG ("Structured clone is not supported.")));
+#endif /* JERRY_STRUCTURED_CLONE */
+} /* jerry_deserialize */
+
 /**
  * Check if the given value is an ArrayBuffer object.
  *
@@ -3026,8 +3695,8 @@ jerry_get_arraybuffer_byte_length (const jerry_value_t value) /**< ArrayBuffer *
  *    * jerry_release_value must be called on the ArrayBuffer when the pointer is no longer needed.
  *
  * @return pointer to the back-buffer of the ArrayBuffer.
- *         pointer is NULL if the parameter is not an ArrayBuffer with external memory
-             or it is not an ArrayBuffer at all.
+ *         pointer is NULL if the parameter is not an ArrayBuffer with external memory,
+ *         its memory has been detached or it is not an ArrayBuffer at all.
  */
 uint8_t *
 jerry_get_arraybuffer_pointer (const jerry_value_t value) /**< Array Buffer to use */
@@ -3040,7 +3709,7 @@ jerry_get_arraybuffer_pointer (const jerry_value_t value) /**< Array Buffer to u
   }
 
   ecma_object_t *buffer_p = ecma_get_object_from_value (value);
-  if (ECMA_ARRAYBUFFER_HAS_EXTERNAL_MEMORY (buffer_p))
+  if (ECMA_ARRAYBUFFER_HAS_EXTERNAL_MEMORY (buffer_p) && !ecma_arraybuffer_is_detached (buffer_p))
   {
     jerry_acquire_value (value);
     lit_utf8_byte_t *mem_buffer_p = ecma_arraybuffer_get_buffer (buffer_p);
@@ -3053,6 +3722,94 @@ jerry_get_arraybuffer_pointer (const jerry_value_t value) /**< Array Buffer to u
   return NULL;
 } /* jerry_get_arraybuffer_pointer */
 
+/**
+ * Check whether the memory of the ArrayBuffer can be detached.
+ *
+ * Note:
+ *     the memory of an ArrayBuffer can only be detached once.
+ *
+ * @return true - if the ArrayBuffer can be detached
+ *         false - otherwise
+ */
+bool
+jerry_is_arraybuffer_detachable (const jerry_value_t value) /**< ArrayBuffer */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+  if (ecma_is_arraybuffer (value))
+  {
+    return ecma_arraybuffer_is_detachable (ecma_get_object_from_value (value));
+  }
+#else /* CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+  JERRY_UNUSED (value);
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+  return false;
+} /* jerry_is_arraybuffer_detachable */
+
+/**
+ * Detach the memory of an ArrayBuffer.
+ *
+ * After detaching, the length of the ArrayBuffer and its TypedArray views become zero.
+ * If contents_p is not NULL, the ownership of the memory is passed to the caller,
+ * otherwise the memory is released by its free callback.
+ *
+ * Note:
+ *     the external memory can be passed to another context by jerry_create_arraybuffer_external
+ *     without copying it. The memory of other ArrayBuffers is copied once into memory allocated
+ *     by jerry_port_alloc_arraybuffer, which does not belong to any context, so it can be passed
+ *     to another context as well.
+ *
+ * @return true value - if the ArrayBuffer is detached
+ *         error - if the value is not a detachable ArrayBuffer, or the memory cannot be allocated
+ *         returned value must be freed with jerry_release_value, when it is no longer needed.
+ */
+jerry_value_t
+jerry_detach_arraybuffer (const jerry_value_t value, /**< ArrayBuffer */
+                          jerry_arraybuffer_contents_t *contents_p) /**< [out] detached memory (can be NULL) */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+  if (!ecma_is_arraybuffer (value))
+  {
+    return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (wrong_args_msg_p)));
+  }
+
+  ecma_object_t *buffer_p = ecma_get_object_from_value (value);
+
+  if (!ecma_arraybuffer_is_detachable (buffer_p))
+  {
+    return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG ("ArrayBuffer is not detachable.")));
+  }
+
+  if (contents_p == NULL)
+  {
+    return ecma_arraybuffer_detach (buffer_p, NULL, NULL);
+  }
+
+  jerry_length_t length = ecma_arraybuffer_get_length (buffer_p);
+  void *detached_buffer_p;
+  ecma_object_native_free_callback_t free_cb;
+  ecma_value_t ret_value = ecma_arraybuffer_detach (buffer_p, &detached_buffer_p, &free_cb);
+
+  if (ECMA_IS_VALUE_ERROR (ret_value))
+  {
+    return jerry_throw (ret_value);
+  }
+
+  contents_p->buffer_p = (uint8_t *) detached_buffer_p;
+  contents_p->length = length;
+  contents_p->free_cb = free_cb;
+
+  return ret_value;
+#else /* CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+  JERRY_UNUSED (value);
+  JERRY_UNUSED (contents_p);
+  return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG ("ArrayBuffer not supported.")));
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+} /* jerry_detach_arraybuffer */
+
 
 /**
  * TypedArray related functions
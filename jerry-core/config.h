@@ -55,6 +55,22 @@
 # define CONFIG_MEM_HEAP_AREA_SIZE (512 * 1024)
 #endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
 
+/**
+ * Size of the heap regions when the heap is allocated in regions (JMEM_HEAP_REGIONS).
+ * The heap starts with one region and grows up to the heap size. It must be a power of two.
+ */
+#ifndef CONFIG_MEM_HEAP_REGION_SIZE
+# define CONFIG_MEM_HEAP_REGION_SIZE (64 * 1024)
+#endif /* !CONFIG_MEM_HEAP_REGION_SIZE */
+
+/**
+ * Size of the pages which are returned to the system after a high severity garbage collection
+ * (JMEM_HEAP_RELEASE_FREE_PAGES). It must be a power of two.
+ */
+#ifndef CONFIG_MEM_HEAP_PAGE_SIZE
+# define CONFIG_MEM_HEAP_PAGE_SIZE (4 * 1024)
+#endif /* !CONFIG_MEM_HEAP_PAGE_SIZE */
+
 /**
  * Max heap usage limit
  */
@@ -90,11 +106,46 @@
  */
 // #define CONFIG_ECMA_LCACHE_DISABLE
 
+/**
+ * Disable the cache of the strings created from non-integer numbers
+ */
+// #define CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE
+
+/**
+ * Disable the cache of the global object properties accessed by identifiers
+ */
+// #define CONFIG_ECMA_GLOBAL_CACHE_DISABLE
+
+/**
+ * Disable the cache of the property names listed by for-in and Object.keys
+ */
+// #define CONFIG_ECMA_ENUM_CACHE_DISABLE
+
+/**
+ * Disable the cache of the compiled code of indirect eval and the Function constructor
+ */
+// #define CONFIG_ECMA_EVAL_CACHE_DISABLE
+
+/**
+ * Maximum number of compiled codes in the cache of indirect eval and the Function constructor
+ * (must be a power of 2)
+ */
+#ifndef CONFIG_ECMA_EVAL_CACHE_SIZE
+# define CONFIG_ECMA_EVAL_CACHE_SIZE 256
+#endif /* !CONFIG_ECMA_EVAL_CACHE_SIZE */
+
 /**
  * Disable ECMA property hashmap
  */
 // #define CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
 
+/**
+ * Maximum number of compiled patterns in the RegExp cache (must be a power of 2)
+ */
+#ifndef CONFIG_REGEXP_CACHE_SIZE
+# define CONFIG_REGEXP_CACHE_SIZE 16
+#endif /* !CONFIG_REGEXP_CACHE_SIZE */
+
 /**
  * Share of newly allocated since last GC objects among all currently allocated objects,
  * after achieving which, GC is started upon low severity try-give-memory-back requests.
@@ -232,7 +232,7 @@ jerry_debugger_send_scope_chain (void)
       buffer_pos = 0;
     }
 
-    if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+    if (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
     {
       if ((lex_env_p->type_flags_refs & ECMA_OBJECT_FLAG_NON_CLOSURE) != 0)
       {
@@ -437,7 +437,7 @@ jerry_debugger_send_scope_variables (const uint8_t *recv_buffer_p) /**< pointer
     }
 
     if ((ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_THIS_OBJECT_BOUND)
-        || (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE))
+        || (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END))
     {
       chain_index--;
     }
@@ -445,7 +445,7 @@ jerry_debugger_send_scope_variables (const uint8_t *recv_buffer_p) /**< pointer
 
   ecma_property_header_t *prop_iter_p;
 
-  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  if (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
   {
     prop_iter_p = ecma_get_property_list (lex_env_p);
   }
@@ -0,0 +1,404 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-enum-cache.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaenumcache Property name enumeration cache
+ * @{
+ */
+
+#ifndef CONFIG_ECMA_ENUM_CACHE_DISABLE
+
+/**
+ * Type of the item which marks the start of the properties of the next prototype.
+ *
+ * Note:
+ *      named properties always have a non-zero type
+ */
+#define ECMA_ENUM_CACHE_PROTOTYPE_ITEM 0
+
+/**
+ * Returned by ecma_enum_cache_walk when the property lists do not match.
+ */
+#define ECMA_ENUM_CACHE_NO_MATCH UINT32_MAX
+
+/**
+ * Operations of ecma_enum_cache_walk.
+ */
+typedef enum
+{
+  ECMA_ENUM_CACHE_COUNT, /**< count the items */
+  ECMA_ENUM_CACHE_STORE, /**< store the items */
+  ECMA_ENUM_CACHE_COMPARE, /**< compare the items with the stored items */
+} ecma_enum_cache_operation_t;
+
+/**
+ * Get the names of an enumeration cache entry.
+ *
+ * @return pointer to the first name
+ */
+#define ECMA_ENUM_CACHE_GET_NAMES(entry_p) ((ecma_value_t *) ((entry_p) + 1))
+
+/**
+ * Get the items of an enumeration cache entry.
+ *
+ * @return pointer to the first item
+ */
+#define ECMA_ENUM_CACHE_GET_ITEMS(entry_p) \
+  ((ecma_enum_cache_item_t *) (ECMA_ENUM_CACHE_GET_NAMES (entry_p) + (entry_p)->name_count))
+
+/**
+ * Get the size of an enumeration cache entry.
+ *
+ * @return size in bytes
+ */
+#define ECMA_ENUM_CACHE_GET_SIZE(name_count, item_count) \
+  (sizeof (ecma_enum_cache_entry_t) + (name_count) * sizeof (ecma_value_t) \
+   + (item_count) * sizeof (ecma_enum_cache_item_t))
+
+/**
+ * Check whether the property names of an object can be cached.
+ *
+ * Note:
+ *      the property names of general objects only depend on the property
+ *      lists of the object and its prototypes (they have no lazy properties)
+ *
+ * @return true - if the property names can be cached,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_enum_cache_is_cacheable (ecma_object_t *object_p, /**< object */
+                              uint32_t opts) /**< ecma_list_properties_options_t values */
+{
+  return ((opts & ~((uint32_t) ECMA_LIST_ENUMERABLE_PROTOTYPE)) == 0
+          && ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL
+          && !ecma_get_object_is_builtin (object_p));
+} /* ecma_enum_cache_is_cacheable */
+
+/**
+ * Get the first property pair of an object.
+ *
+ * @return pointer to the property pair - if the object has properties,
+ *         NULL - otherwise
+ */
+static inline ecma_property_header_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_enum_cache_get_first_pair (ecma_object_t *object_p) /**< object */
+{
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
+
+  if (prop_iter_p != NULL && prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  return prop_iter_p;
+} /* ecma_enum_cache_get_first_pair */
+
+/**
+ * Get the index of the cache entry of an object.
+ *
+ * Note:
+ *      the index is computed from the prototype and the most recently created
+ *      properties, so objects with the same properties share the same entry
+ *
+ * @return index of the entry
+ */
+static uint32_t
+ecma_enum_cache_get_index (ecma_object_t *object_p, /**< object */
+                           uint32_t opts) /**< ecma_list_properties_options_t values */
+{
+  uint32_t hash = (uint32_t) object_p->prototype_or_outer_reference_cp + opts;
+  ecma_property_header_t *prop_iter_p = ecma_enum_cache_get_first_pair (object_p);
+
+  if (prop_iter_p != NULL)
+  {
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+    hash ^= (uint32_t) prop_pair_p->names_cp[1] * 31u;
+  }
+
+  hash ^= hash >> 8;
+  return hash & (ECMA_ENUM_CACHE_SIZE - 1);
+} /* ecma_enum_cache_get_index */
+
+/**
+ * Walk the property lists of an object and (when the prototype chain is listed) its
+ * prototypes, and count, store or compare an item for each named property and prototype.
+ *
+ * @return number of items - if the walk succeeded,
+ *         ECMA_ENUM_CACHE_NO_MATCH - if the items do not match or there are too many of them
+ */
+static uint32_t
+ecma_enum_cache_walk (ecma_object_t *object_p, /**< object */
+                      uint32_t opts, /**< ecma_list_properties_options_t values */
+                      ecma_enum_cache_operation_t operation, /**< operation */
+                      ecma_enum_cache_item_t *items_p, /**< items to store or compare */
+                      uint32_t item_limit) /**< maximum number of items */
+{
+  uint32_t index = 0;
+
+  while (true)
+  {
+    ecma_property_header_t *prop_iter_p = ecma_enum_cache_get_first_pair (object_p);
+
+    while (prop_iter_p != NULL)
+    {
+      JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+      ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+      for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+      {
+        uint32_t type = ECMA_PROPERTY_GET_TYPE (prop_iter_p->types[i]);
+
+        if (type != ECMA_PROPERTY_TYPE_NAMEDDATA && type != ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
+        {
+          continue;
+        }
+
+        if (index >= item_limit)
+        {
+          return ECMA_ENUM_CACHE_NO_MATCH;
+        }
+
+        /* The lcached flag does not affect the property names. */
+        uint8_t type_and_flags = (uint8_t) (prop_iter_p->types[i] & ~ECMA_PROPERTY_FLAG_LCACHED);
+
+        if (operation == ECMA_ENUM_CACHE_STORE)
+        {
+          items_p[index].name_cp = prop_pair_p->names_cp[i];
+          items_p[index].type_and_flags = type_and_flags;
+        }
+        else if (operation == ECMA_ENUM_CACHE_COMPARE
+                 && (items_p[index].name_cp != prop_pair_p->names_cp[i]
+                     || items_p[index].type_and_flags != type_and_flags))
+        {
+          return ECMA_ENUM_CACHE_NO_MATCH;
+        }
+
+        index++;
+      }
+
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+    }
+
+    if (!(opts & ECMA_LIST_PROTOTYPE))
+    {
+      return index;
+    }
+
+    if (index >= item_limit)
+    {
+      return ECMA_ENUM_CACHE_NO_MATCH;
+    }
+
+    jmem_cpointer_t prototype_cp = object_p->prototype_or_outer_reference_cp;
+
+    if (operation == ECMA_ENUM_CACHE_STORE)
+    {
+      items_p[index].name_cp = prototype_cp;
+      items_p[index].type_and_flags = ECMA_ENUM_CACHE_PROTOTYPE_ITEM;
+    }
+    else if (operation == ECMA_ENUM_CACHE_COMPARE
+             && (items_p[index].name_cp != prototype_cp
+                 || items_p[index].type_and_flags != ECMA_ENUM_CACHE_PROTOTYPE_ITEM))
+    {
+      return ECMA_ENUM_CACHE_NO_MATCH;
+    }
+
+    index++;
+
+    if (prototype_cp == ECMA_NULL_POINTER)
+    {
+      return index;
+    }
+
+    object_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, prototype_cp);
+  }
+} /* ecma_enum_cache_walk */
+
+/**
+ * Free an enumeration cache entry.
+ */
+static void
+ecma_enum_cache_free_entry (ecma_enum_cache_entry_t *entry_p) /**< entry */
+{
+  ecma_value_t *names_p = ECMA_ENUM_CACHE_GET_NAMES (entry_p);
+
+  for (uint32_t i = 0; i < entry_p->name_count; i++)
+  {
+    ecma_free_value (names_p[i]);
+  }
+
+  jmem_heap_free_block (entry_p, ECMA_ENUM_CACHE_GET_SIZE (entry_p->name_count, entry_p->item_count));
+} /* ecma_enum_cache_free_entry */
+
+/**
+ * Lookup the property names of an object in the enumeration cache.
+ *
+ * The names are found when the property lists of the object and its prototypes
+ * have the same properties (names, types and attributes) in the same order as
+ * the object whose names are cached, so the property names of objects with the
+ * same properties are listed only once.
+ *
+ * @return collection of property names - if the names are cached,
+ *         NULL - otherwise
+ */
+ecma_collection_header_t *
+ecma_enum_cache_lookup (ecma_object_t *object_p, /**< object */
+                        uint32_t opts) /**< ecma_list_properties_options_t values */
+{
+  if (!ecma_enum_cache_is_cacheable (object_p, opts))
+  {
+    return NULL;
+  }
+
+  uint32_t index = ecma_enum_cache_get_index (object_p, opts);
+  ecma_enum_cache_entry_t *entry_p = JERRY_CONTEXT (enum_cache)[index];
+
+  if (entry_p == NULL
+      || entry_p->opts != opts
+      || (ecma_enum_cache_walk (object_p,
+                                opts,
+                                ECMA_ENUM_CACHE_COMPARE,
+                                ECMA_ENUM_CACHE_GET_ITEMS (entry_p),
+                                entry_p->item_count) != entry_p->item_count))
+  {
+    return NULL;
+  }
+
+  /* Allocating the collection may trigger a garbage collection which clears the
+   * cache, so the entry is removed from the cache until the names are copied. */
+  JERRY_CONTEXT (enum_cache)[index] = NULL;
+  JERRY_CONTEXT (enum_cache_active_p) = entry_p;
+
+  ecma_collection_header_t *names_p = ecma_new_values_collection ();
+  ecma_value_t *cached_names_p = ECMA_ENUM_CACHE_GET_NAMES (entry_p);
+
+  for (uint32_t i = 0; i < entry_p->name_count; i++)
+  {
+    ecma_append_to_values_collection (names_p, cached_names_p[i], 0);
+  }
+
+  if (JERRY_CONTEXT (enum_cache_active_p) == entry_p
+      && JERRY_CONTEXT (enum_cache)[index] == NULL)
+  {
+    JERRY_CONTEXT (enum_cache)[index] = entry_p;
+  }
+  else
+  {
+    ecma_enum_cache_free_entry (entry_p);
+  }
+
+  JERRY_CONTEXT (enum_cache_active_p) = NULL;
+  return names_p;
+} /* ecma_enum_cache_lookup */
+
+/**
+ * Insert the property names of an object into the enumeration cache.
+ */
+void
+ecma_enum_cache_insert (ecma_object_t *object_p, /**< object */
+                        uint32_t opts, /**< ecma_list_properties_options_t values */
+                        ecma_collection_header_t *names_p) /**< property names of the object */
+{
+  if (!ecma_enum_cache_is_cacheable (object_p, opts))
+  {
+    return;
+  }
+
+  uint32_t item_count = ecma_enum_cache_walk (object_p,
+                                              opts,
+                                              ECMA_ENUM_CACHE_COUNT,
+                                              NULL,
+                                              ECMA_ENUM_CACHE_MAX_ITEMS);
+
+  if (item_count == ECMA_ENUM_CACHE_NO_MATCH)
+  {
+    return;
+  }
+
+  /* Each name belongs to a property of the object or its prototypes. */
+  JERRY_ASSERT (names_p->item_count <= item_count);
+
+  size_t size = ECMA_ENUM_CACHE_GET_SIZE (names_p->item_count, item_count);
+  ecma_enum_cache_entry_t *entry_p = (ecma_enum_cache_entry_t *) jmem_heap_alloc_block_null_on_error (size);
+
+  if (entry_p == NULL)
+  {
+    return;
+  }
+
+  entry_p->opts = (uint16_t) opts;
+  entry_p->name_count = (uint16_t) names_p->item_count;
+  entry_p->item_count = (uint16_t) item_count;
+
+  ecma_value_t *cached_names_p = ECMA_ENUM_CACHE_GET_NAMES (entry_p);
+  ecma_value_t *ecma_value_p = ecma_collection_iterator_init (names_p);
+
+  while (ecma_value_p != NULL)
+  {
+    *cached_names_p++ = ecma_copy_value (*ecma_value_p);
+    ecma_value_p = ecma_collection_iterator_next (ecma_value_p);
+  }
+
+  ecma_enum_cache_walk (object_p, opts, ECMA_ENUM_CACHE_STORE, ECMA_ENUM_CACHE_GET_ITEMS (entry_p), item_count);
+
+  uint32_t index = ecma_enum_cache_get_index (object_p, opts);
+
+  if (JERRY_CONTEXT (enum_cache)[index] != NULL)
+  {
+    ecma_enum_cache_free_entry (JERRY_CONTEXT (enum_cache)[index]);
+  }
+
+  JERRY_CONTEXT (enum_cache)[index] = entry_p;
+} /* ecma_enum_cache_insert */
+
+/**
+ * Clear the enumeration cache.
+ *
+ * Note:
+ *      the cached property lists refer to objects and property names without holding a
+ *      reference to them, so the cache must be cleared when they can be freed: when the
+ *      garbage collector runs and when a property is deleted
+ */
+void
+ecma_enum_cache_clear (void)
+{
+  for (uint32_t i = 0; i < ECMA_ENUM_CACHE_SIZE; i++)
+  {
+    if (JERRY_CONTEXT (enum_cache)[i] != NULL)
+    {
+      ecma_enum_cache_free_entry (JERRY_CONTEXT (enum_cache)[i]);
+      JERRY_CONTEXT (enum_cache)[i] = NULL;
+    }
+  }
+
+  /* The entry which is being copied is freed after the copy is completed. */
+  JERRY_CONTEXT (enum_cache_active_p) = NULL;
+} /* ecma_enum_cache_clear */
+
+#endif /* !CONFIG_ECMA_ENUM_CACHE_DISABLE */
+
+/**
+ * @}
+ * @}
+ */
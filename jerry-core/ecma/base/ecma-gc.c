@@ -18,6 +18,8 @@
  */
 
 #include "ecma-alloc.h"
+#include "ecma-enum-cache.h"
+#include "ecma-eval-cache.h"
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
@@ -309,7 +311,20 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
       ecma_gc_set_object_visited (lex_env_p);
     }
 
-    if (ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+    if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+    {
+      ecma_value_t *slots_p = ECMA_SLOT_LEX_ENV_GET_SLOTS (object_p);
+      uint32_t slot_count = ((ecma_slot_lex_env_t *) object_p)->slot_count;
+
+      for (uint32_t i = 0; i < slot_count; i++)
+      {
+        if (ecma_is_value_object (slots_p[i]))
+        {
+          ecma_gc_set_object_visited (ecma_get_object_from_value (slots_p[i]));
+        }
+      }
+    }
+    else if (ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
     {
       ecma_object_t *binding_object_p = ecma_get_lex_env_binding_object (object_p);
       ecma_gc_set_object_visited (binding_object_p);
@@ -514,7 +529,7 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
   bool obj_is_not_lex_env = !ecma_is_lexical_environment (object_p);
 
   if (obj_is_not_lex_env
-      || ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+      || ecma_get_lex_env_type (object_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
   {
     ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
 
@@ -811,6 +826,25 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
       return;
     }
   }
+  else if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    ecma_slot_lex_env_t *slot_lex_env_p = (ecma_slot_lex_env_t *) object_p;
+    ecma_value_t *slots_p = ECMA_SLOT_LEX_ENV_GET_SLOTS (object_p);
+    uint32_t slot_count = slot_lex_env_p->slot_count;
+
+    for (uint32_t i = 0; i < slot_count; i++)
+    {
+      ecma_free_value_if_not_object (slots_p[i]);
+    }
+
+    if (!(slot_lex_env_p->bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
+    {
+      ecma_bytecode_deref ((ecma_compiled_code_t *) slot_lex_env_p->bytecode_p);
+    }
+
+    ecma_dealloc_extended_object (object_p, sizeof (ecma_slot_lex_env_t) + slot_count * sizeof (ecma_value_t));
+    return;
+  }
 
   ecma_dealloc_object (object_p);
 } /* ecma_gc_free_object */
@@ -947,7 +981,7 @@ ecma_gc_run (jmem_free_unused_memory_severity_t severity) /**< gc severity */
     while (obj_iter_p != NULL)
     {
       if (!ecma_is_lexical_environment (obj_iter_p)
-          || ecma_get_lex_env_type (obj_iter_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+          || ecma_get_lex_env_type (obj_iter_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
       {
         ecma_property_header_t *prop_iter_p = ecma_get_property_list (obj_iter_p);
 
@@ -967,6 +1001,28 @@ ecma_gc_run (jmem_free_unused_memory_severity_t severity) /**< gc severity */
   /* Free RegExp bytecodes stored in cache */
   re_cache_gc_run ();
 #endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+
+#ifndef CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE
+  /* Free the cached number strings which are not used anywhere else */
+  ecma_number_string_cache_gc_run ();
+#endif /* !CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE */
+
+#ifndef CONFIG_ECMA_ENUM_CACHE_DISABLE
+  /* The cached property lists may refer to freed objects */
+  ecma_enum_cache_clear ();
+#endif /* !CONFIG_ECMA_ENUM_CACHE_DISABLE */
+
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  /* Free the compiled code of eval which is not used since the previous collection */
+  ecma_eval_cache_gc_run (severity);
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+
+#ifdef JMEM_HEAP_RELEASE_FREE_PAGES
+  if (severity == JMEM_FREE_UNUSED_MEMORY_SEVERITY_HIGH)
+  {
+    jmem_heap_release_free_pages ();
+  }
+#endif /* JMEM_HEAP_RELEASE_FREE_PAGES */
 } /* ecma_gc_run */
 
 /**
@@ -0,0 +1,107 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-global-cache.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "jcontext.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaglobalcache Global property cache
+ * @{
+ */
+
+#ifndef CONFIG_ECMA_GLOBAL_CACHE_DISABLE
+
+/**
+ * Get the entry of a property name.
+ *
+ * Note:
+ *      literal strings are unique, so their values are used as hash keys
+ *
+ * @return pointer to the entry
+ */
+static inline ecma_global_cache_entry_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_global_cache_get_entry (ecma_value_t name) /**< literal string value */
+{
+  return JERRY_CONTEXT (global_cache) + ((name >> ECMA_VALUE_SHIFT) & (ECMA_GLOBAL_CACHE_SIZE - 1));
+} /* ecma_global_cache_get_entry */
+
+/**
+ * Lookup a property of the global object in the global property cache.
+ *
+ * Note:
+ *      the property pointers are valid until a property of the global object is
+ *      deleted, which increases the epoch, so the lookup only checks the epoch
+ *
+ * @return pointer to the property - if the name is found,
+ *         NULL - otherwise
+ */
+inline ecma_property_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_global_cache_lookup (ecma_value_t name) /**< literal string value of the property name */
+{
+  ecma_global_cache_entry_t *entry_p = ecma_global_cache_get_entry (name);
+
+  if (entry_p->name == name && entry_p->epoch == JERRY_CONTEXT (global_cache_epoch))
+  {
+    return entry_p->prop_p;
+  }
+
+  return NULL;
+} /* ecma_global_cache_lookup */
+
+/**
+ * Insert a property of the global object into the global property cache.
+ */
+void
+ecma_global_cache_insert (ecma_value_t name, /**< literal string value of the property name */
+                          ecma_property_t *prop_p) /**< property */
+{
+  JERRY_ASSERT (ecma_is_value_string (name));
+  JERRY_ASSERT (prop_p != NULL && ECMA_PROPERTY_GET_TYPE (*prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+  ecma_global_cache_entry_t *entry_p = ecma_global_cache_get_entry (name);
+
+  entry_p->prop_p = prop_p;
+  entry_p->name = name;
+  entry_p->epoch = JERRY_CONTEXT (global_cache_epoch);
+} /* ecma_global_cache_insert */
+
+/**
+ * Invalidate all entries of the global property cache.
+ *
+ * Called when a property of the global object is deleted.
+ */
+void
+ecma_global_cache_invalidate (void)
+{
+  JERRY_CONTEXT (global_cache_epoch)++;
+
+  if (JERRY_CONTEXT (global_cache_epoch) == 0)
+  {
+    /* The epoch is wrapped around: the entries inserted
+     * in the previous round must not become valid again. */
+    memset (JERRY_CONTEXT (global_cache), 0, sizeof (JERRY_CONTEXT (global_cache)));
+  }
+} /* ecma_global_cache_invalidate */
+
+#endif /* !CONFIG_ECMA_GLOBAL_CACHE_DISABLE */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,41 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_GLOBAL_CACHE_H
+#define ECMA_GLOBAL_CACHE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaglobalcache Global property cache
+ * @{
+ */
+
+#ifndef CONFIG_ECMA_GLOBAL_CACHE_DISABLE
+
+ecma_property_t *ecma_global_cache_lookup (ecma_value_t name);
+void ecma_global_cache_insert (ecma_value_t name, ecma_property_t *prop_p);
+void ecma_global_cache_invalidate (void);
+
+#endif /* !CONFIG_ECMA_GLOBAL_CACHE_DISABLE */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_GLOBAL_CACHE_H */
@@ -651,7 +651,7 @@ typedef enum
   ECMA_OBJECT_TYPE_ARROW_FUNCTION = 7, /**< arrow function objects */
 #endif /* !CONFIG_DISABLE_ES2015_ARROW_FUNCTION */
 
-  /* Types between 13-15 cannot have a built-in flag. See ecma_lexical_environment_type_t. */
+  /* Types between 12-15 cannot have a built-in flag. See ecma_lexical_environment_type_t. */
 
   ECMA_OBJECT_TYPE__MAX /**< maximum value */
 } ecma_object_type_t;
@@ -673,9 +673,12 @@ typedef enum
  */
 typedef enum
 {
-  /* Types between 0 - 12 are ecma_object_type_t which can have a built-in flag. */
+  /* Types between 0 - 11 are ecma_object_type_t which can have a built-in flag. */
 
-  ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE = 13, /**< declarative lexical environment */
+  ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE = 12, /**< declarative lexical environment */
+  ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS = 13, /**< declarative lexical environment of a function call,
+                                                    *   which stores the variables of the function
+                                                    *   in slots (see ecma_slot_lex_env_t) */
   ECMA_LEXICAL_ENVIRONMENT_THIS_OBJECT_BOUND = 14, /**< object-bound lexical environment
                                                     *   with provideThis flag */
   ECMA_LEXICAL_ENVIRONMENT_SUPER_OBJECT_BOUND = 15, /**< object-bound lexical environment
@@ -683,6 +686,9 @@ typedef enum
 
   ECMA_LEXICAL_ENVIRONMENT_TYPE_START = ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE, /**< first lexical
                                                                                *   environment type */
+  ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END = ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS, /**< last declarative
+                                                                                       *   lexical environment
+                                                                                       *   type */
   ECMA_LEXICAL_ENVIRONMENT_TYPE__MAX = ECMA_LEXICAL_ENVIRONMENT_SUPER_OBJECT_BOUND /**< maximum value */
 } ecma_lexical_environment_type_t;
 
@@ -897,6 +903,26 @@ typedef struct
                                      *   If regexp, the other flags must be RE_FLAG... */
 } ecma_compiled_code_t;
 
+/**
+ * Description of declarative lexical environments with slots.
+ *
+ * The values of the slots follow this structure. The slots are the variables of
+ * the function: the name of a slot is the literal of the same position in the
+ * literal list of the byte code (register literals are not part of the list).
+ * Other bindings (e.g. variables declared by eval) are stored in the property list.
+ */
+typedef struct
+{
+  ecma_object_t header; /**< lexical environment header */
+  const ecma_compiled_code_t *bytecode_p; /**< byte code of the function */
+  uint32_t slot_count; /**< number of slots */
+} ecma_slot_lex_env_t;
+
+/**
+ * Get the slot values of a declarative lexical environment with slots.
+ */
+#define ECMA_SLOT_LEX_ENV_GET_SLOTS(lex_env_p) ((ecma_value_t *) (((ecma_slot_lex_env_t *) (lex_env_p)) + 1))
+
 #ifdef JERRY_ENABLE_SNAPSHOT_EXEC
 
 /**
@@ -1197,21 +1223,16 @@ typedef double ecma_number_t;
 #define ECMA_STRING_NOT_ARRAY_INDEX UINT32_MAX
 
 /*
- * Ecma-collection: a growable list of ecma-values. Currently the list is
- * a chain list, where appending new items at the end is cheap operation.
+ * Ecma-collection: a growable list of ecma-values. The values are stored in a
+ * contiguous buffer, so items can be accessed by their index. The capacity
+ * of the buffer is doubled when it becomes full, so appending new items at
+ * the end is a cheap (amortized constant time) operation.
  *
- * Enumerating elements is also cheap, since each page is terminated by a
- * special ecma-value: collection-type. This type has a pointer to the next
- * chunk. The last chunk is terminated by a NULL pointer. There when the
- * next value is requested from the iterator it simply checks the next
- * memory location. If it is not a collection-type value, it returns with
- * the value. Otherwise it gets the start address of the next chunk, and
- * return the value there.
- *
- * The collection-type value is always the last item of a collection chunk,
- * even if the chunk is not completely filled with values (this is only true
- * for the last chunk). Each chunk must have at least one non collection-type
- * value as well.
+ * The last item of the buffer is always followed by a special ecma-value:
+ * collection-type. Therefore the iterator does not need the item count: when
+ * the next value is requested, it simply checks the next memory location. If
+ * it is not a collection-type value, it returns with the value. Otherwise the
+ * end of the collection is reached.
  */
 
 /**
@@ -1228,25 +1249,14 @@ typedef enum
  */
 typedef struct
 {
-  jmem_cpointer_t first_chunk_cp; /**< compressed pointer to first chunk with collection's data */
-  jmem_cpointer_t last_chunk_cp; /**< compressed pointer to last chunk with collection's data */
+  jmem_cpointer_t buffer_cp; /**< compressed pointer to the buffer of the items */
   ecma_length_t item_count; /**< number of items in the collection */
 } ecma_collection_header_t;
 
 /**
- * Maximum number of items stored by a collection chunk (excluding the last collection-type value).
- */
-#define ECMA_COLLECTION_CHUNK_ITEMS 5
-
-/**
- * Collection chunk item.
+ * Initial capacity of a collection buffer including the terminator value (must be a power of 2).
  */
-typedef struct
-{
-  ecma_value_t items[ECMA_COLLECTION_CHUNK_ITEMS + 1]; /**< ecma-value list, where the last value is a special
-                                                        *   collection-type value which points to the next chunk,
-                                                        *   so the chunk area is enlarged by one for this value */
-} ecma_collection_chunk_t;
+#define ECMA_COLLECTION_INITIAL_CAPACITY 4
 
 /**
  * Direct string types (2 bit).
@@ -1339,7 +1349,10 @@ typedef enum
                                *   so no string processing function supports this type except
                                *   the ecma_deref_ecma_string function. */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_LITERAL_NUMBER /**< maximum value */
+  ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING, /**< actual data is an utf-8 (cesu8) string in host memory
+                                               *   referenced by the descriptor, maximum size is 2^32. */
+
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -1418,6 +1431,25 @@ typedef struct
   lit_utf8_size_t long_utf8_string_length; /**< length of this long utf-8 string in bytes */
 } ecma_long_string_t;
 
+/**
+ * External ECMA string-value descriptor
+ *
+ * The size and length are stored in the long string header, the
+ * characters are owned by the host and are not copied.
+ */
+typedef struct
+{
+  ecma_long_string_t header; /**< long string header */
+  const lit_utf8_byte_t *data_p; /**< external buffer pointer */
+  ecma_object_native_free_callback_t free_cb; /**< the free callback for the above buffer pointer */
+} ecma_external_string_t;
+
+/**
+ * Minimum size of external strings. Shorter strings are copied onto
+ * the heap, because the descriptor would be larger than the characters.
+ */
+#define ECMA_EXTERNAL_STRING_MIN_SIZE (sizeof (ecma_external_string_t) - sizeof (ecma_string_t))
+
 /**
  * Abort flag for error reference.
  */
@@ -1501,6 +1533,119 @@ typedef struct
 
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
+#ifndef CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE
+
+/**
+ * Entry of the number to string conversion cache
+ */
+typedef struct
+{
+  ecma_number_t number; /**< converted number */
+  ecma_string_t *string_p; /**< string representation of the number (NULL marks the entry empty) */
+} ecma_number_string_cache_entry_t;
+
+/**
+ * Number of entries in the number to string conversion cache (must be a power of 2)
+ */
+#define ECMA_NUMBER_STRING_CACHE_SIZE 16
+
+#endif /* !CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE */
+
+#ifndef CONFIG_ECMA_GLOBAL_CACHE_DISABLE
+
+/**
+ * Entry of the global property cache
+ */
+typedef struct
+{
+  ecma_property_t *prop_p; /**< named data property of the global object */
+  ecma_value_t name; /**< literal string value of the property name */
+  uint32_t epoch; /**< value of the global cache epoch when the entry was inserted */
+} ecma_global_cache_entry_t;
+
+/**
+ * Number of entries in the global property cache (must be a power of 2)
+ */
+#define ECMA_GLOBAL_CACHE_SIZE 64
+
+#endif /* !CONFIG_ECMA_GLOBAL_CACHE_DISABLE */
+
+#ifndef CONFIG_ECMA_ENUM_CACHE_DISABLE
+
+/**
+ * Property or prototype of the property lists whose names are cached
+ */
+typedef struct
+{
+  jmem_cpointer_t name_cp; /**< property name or compressed pointer to the prototype */
+  uint8_t type_and_flags; /**< type and flags of the property or 0 for prototypes */
+} ecma_enum_cache_item_t;
+
+/**
+ * Entry of the property name enumeration cache
+ *
+ * The entry is followed by the cached property names and the items of the property lists.
+ */
+typedef struct
+{
+  uint16_t opts; /**< ecma_list_properties_options_t values */
+  uint16_t name_count; /**< number of property names */
+  uint16_t item_count; /**< number of items */
+} ecma_enum_cache_entry_t;
+
+/**
+ * Number of entries in the property name enumeration cache (must be a power of 2)
+ */
+#define ECMA_ENUM_CACHE_SIZE 8
+
+/**
+ * Maximum number of items of an entry of the property name enumeration cache
+ */
+#define ECMA_ENUM_CACHE_MAX_ITEMS 64
+
+#endif /* !CONFIG_ECMA_ENUM_CACHE_DISABLE */
+
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+
+/**
+ * Entry of the compiled code cache of indirect eval and the Function constructor
+ *
+ * The entry is followed by the characters of the arguments and the source code.
+ */
+typedef struct
+{
+  ecma_compiled_code_t *bytecode_p; /**< compiled code, the cache holds a reference to it */
+  uint32_t parse_opts; /**< ecma_parse_opts_t option bits */
+  uint32_t args_size; /**< size of the arguments */
+  uint32_t source_size; /**< size of the source code */
+  uint32_t last_used; /**< value of eval_cache_clock when the entry was last used */
+  uint16_t hash; /**< hash of the arguments and the source code */
+} ecma_eval_cache_entry_t;
+
+/**
+ * Maximum number of entries in the compiled code cache of indirect eval and the Function constructor
+ */
+#define ECMA_EVAL_CACHE_SIZE ((uint32_t) CONFIG_ECMA_EVAL_CACHE_SIZE)
+
+/**
+ * Number of slots of the hash table of the compiled code cache
+ */
+#define ECMA_EVAL_CACHE_TABLE_SIZE (2 * ECMA_EVAL_CACHE_SIZE)
+
+/**
+ * A cached compiled code is not reused when the reference counter of the compiled
+ * code or of any function literal in it reaches this value, since each function
+ * object created from the shared compiled code holds a further reference.
+ */
+#define ECMA_EVAL_CACHE_MAX_REFS (UINT16_MAX / 2)
+
+/**
+ * Maximum size of the arguments and the source code which are cached
+ */
+#define ECMA_EVAL_CACHE_MAX_SOURCE_SIZE 2048
+
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+
 #ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
 
 /**
@@ -1510,11 +1655,15 @@ typedef enum
 {
   ECMA_ARRAYBUFFER_INTERNAL_MEMORY = 0u,        /* ArrayBuffer memory is handled internally. */
   ECMA_ARRAYBUFFER_EXTERNAL_MEMORY = (1u << 0), /* ArrayBuffer created via jerry_create_arraybuffer_external. */
+  ECMA_ARRAYBUFFER_DETACHED = (1u << 1),        /* ArrayBuffer memory has been detached. */
 } ecma_arraybuffer_extra_flag_t;
 
 #define ECMA_ARRAYBUFFER_HAS_EXTERNAL_MEMORY(object_p) \
     ((((ecma_extended_object_t *) object_p)->u.class_prop.extra_info & ECMA_ARRAYBUFFER_EXTERNAL_MEMORY) != 0)
 
+#define ECMA_ARRAYBUFFER_IS_DETACHED(object_p) \
+    ((((ecma_extended_object_t *) object_p)->u.class_prop.extra_info & ECMA_ARRAYBUFFER_DETACHED) != 0)
+
 /**
  * Struct to store information for ArrayBuffers with external memory.
  *
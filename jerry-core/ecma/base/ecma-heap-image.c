@@ -0,0 +1,725 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "byte-code.h"
+#include "ecma-eval-cache.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-heap-image.h"
+#include "ecma-helpers.h"
+#include "ecma-jobqueue.h"
+#include "jcontext.h"
+#include "re-compiler.h"
+#include "vm-profiler.h"
+#include "vm-stats.h"
+
+#ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
+#include "ecma-promise-object.h"
+#endif /* !CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
+
+#ifdef JERRY_HEAP_IMAGE
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaheapimage Heap image
+ * @{
+ *
+ * A heap image is a copy of the heap and the context roots, which can initialize a new context
+ * without running the code which built the heap:
+ *
+ *   header                 the context roots as heap offsets (ecma_heap_image_header_t)
+ *   heap data              the heap from its start to the free block at its end
+ *   relocation entries     uint32_t heap offsets of the raw pointers stored in the heap data
+ *
+ * Compressed pointers are heap offsets, so they are valid in any heap. The few raw pointers
+ * of the heap are listed by the relocation entries: the heap pointers are stored as offsets,
+ * and the native pointers (e.g. external function handlers, native pointers of objects) are
+ * passed to a callback, which can map them to values which are valid in another process.
+ *
+ * The image is saved after a high severity gc, and the caches of the engine are flushed first,
+ * so the heap contains only live data, and only the objects keep raw pointers.
+ */
+
+/**
+ * Types of relocation entries (stored in the low bits of the offset).
+ */
+typedef enum
+{
+  ECMA_HEAP_IMAGE_RELOCATION_HEAP = 0, /**< pointer to the heap */
+  ECMA_HEAP_IMAGE_RELOCATION_NATIVE = 1, /**< native pointer mapped by the callback */
+  ECMA_HEAP_IMAGE_RELOCATION_TYPE_MASK = 0x3, /**< mask of the type bits */
+} ecma_heap_image_relocation_type_t;
+
+/**
+ * Configuration flags of the engine, which must be the same when the image is restored.
+ */
+#define ECMA_HEAP_IMAGE_CONFIG_FLAGS \
+  ((uint32_t) sizeof (uintptr_t) \
+   | ECMA_HEAP_IMAGE_CONFIG_CPOINTER_32_BIT \
+   | ECMA_HEAP_IMAGE_CONFIG_LINE_INFO \
+   | ECMA_HEAP_IMAGE_CONFIG_MEM_STATS)
+
+#ifdef JERRY_CPOINTER_32_BIT
+#define ECMA_HEAP_IMAGE_CONFIG_CPOINTER_32_BIT (1u << 8)
+#else /* !JERRY_CPOINTER_32_BIT */
+#define ECMA_HEAP_IMAGE_CONFIG_CPOINTER_32_BIT 0
+#endif /* JERRY_CPOINTER_32_BIT */
+
+#ifdef JERRY_ENABLE_LINE_INFO
+#define ECMA_HEAP_IMAGE_CONFIG_LINE_INFO (1u << 9)
+#else /* !JERRY_ENABLE_LINE_INFO */
+#define ECMA_HEAP_IMAGE_CONFIG_LINE_INFO 0
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+#ifdef JMEM_STATS
+#define ECMA_HEAP_IMAGE_CONFIG_MEM_STATS (1u << 10)
+#else /* !JMEM_STATS */
+#define ECMA_HEAP_IMAGE_CONFIG_MEM_STATS 0
+#endif /* JMEM_STATS */
+
+/**
+ * Heap image header.
+ */
+typedef struct
+{
+  uint32_t magic; /**< ECMA_HEAP_IMAGE_MAGIC */
+  uint32_t version; /**< ECMA_HEAP_IMAGE_VERSION */
+  uint32_t config_flags; /**< ECMA_HEAP_IMAGE_CONFIG_FLAGS */
+  uint16_t builtin_count; /**< number of built-in objects */
+  uint16_t magic_string_count; /**< number of magic strings */
+  uintptr_t heap_start; /**< start address of the heap (compressed pointers are addresses
+                         *   when ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY is defined) */
+  uint32_t heap_size; /**< size of the heap */
+  uint32_t heap_image_size; /**< number of heap bytes stored in the image */
+  uint32_t relocation_count; /**< number of relocation entries */
+  uint32_t allocated_size; /**< size of the allocated heap blocks */
+  uint32_t gc_objects_number; /**< number of objects */
+  uint32_t gc_objects_offset; /**< first object of the gc list */
+  uint32_t global_lex_env_offset; /**< global lexical environment */
+  uint32_t string_list_offset; /**< first item of the literal string list */
+  uint32_t symbol_list_offset; /**< first item of the global symbol list */
+  uint32_t number_list_offset; /**< first item of the literal number list */
+  uint32_t builtin_offsets[ECMA_BUILTIN_ID__COUNT]; /**< instantiated built-in objects */
+#ifdef JERRY_ENABLE_LINE_INFO
+  ecma_value_t resource_name; /**< resource name */
+#endif /* JERRY_ENABLE_LINE_INFO */
+#ifdef JMEM_STATS
+  jmem_heap_stats_t heap_stats; /**< heap's memory usage statistics */
+#endif /* JMEM_STATS */
+} ecma_heap_image_header_t;
+
+/**
+ * Heap image writer.
+ */
+typedef struct
+{
+  uint8_t *heap_start_p; /**< start of the heap */
+  uint8_t *heap_copy_p; /**< copy of the heap in the image (NULL if it does not fit into the buffer) */
+  uint8_t *relocation_p; /**< next relocation entry in the buffer */
+  uint8_t *buffer_end_p; /**< end of the buffer */
+  uint32_t relocation_count; /**< number of relocation entries */
+  ecma_heap_image_pointer_cb_t pointer_cb; /**< native pointer callback (can be NULL) */
+  void *user_p; /**< user pointer passed to the callback */
+} ecma_heap_image_writer_t;
+
+/**
+ * Get the heap offset of a pointer.
+ *
+ * @return heap offset - if the pointer is not NULL,
+ *         0 - otherwise
+ */
+static uint32_t
+ecma_heap_image_get_offset (ecma_heap_image_writer_t *writer_p, /**< writer */
+                            const void *pointer_p) /**< heap pointer */
+{
+  if (pointer_p == NULL)
+  {
+    return 0;
+  }
+
+  JERRY_ASSERT ((const uint8_t *) pointer_p > writer_p->heap_start_p
+                && (const uint8_t *) pointer_p < writer_p->heap_start_p + JMEM_HEAP_SIZE);
+  return (uint32_t) ((const uint8_t *) pointer_p - writer_p->heap_start_p);
+} /* ecma_heap_image_get_offset */
+
+/**
+ * Get the pointer of a heap offset.
+ *
+ * @return heap pointer - if the offset is not 0,
+ *         NULL - otherwise
+ */
+static inline void * JERRY_ATTR_ALWAYS_INLINE
+ecma_heap_image_get_pointer (uint8_t *heap_start_p, /**< start of the heap */
+                             uint32_t offset) /**< heap offset */
+{
+  return (offset == 0) ? NULL : (heap_start_p + offset);
+} /* ecma_heap_image_get_pointer */
+
+/**
+ * Add a relocation entry for a raw pointer of the heap, and store the relocatable
+ * form of the pointer into the copy of the heap.
+ *
+ * Note:
+ *      the pointer can have any pointer type (including function pointers), so it is accessed
+ *      with memcpy, and NULL pointers are not relocated
+ */
+static void
+ecma_heap_image_add_relocation (ecma_heap_image_writer_t *writer_p, /**< writer */
+                                const void *field_p, /**< address of the pointer in the heap */
+                                ecma_heap_image_relocation_type_t type) /**< relocation type */
+{
+  uintptr_t value;
+  memcpy (&value, field_p, sizeof (uintptr_t));
+
+  if (value == 0)
+  {
+    return;
+  }
+
+  uint32_t offset = ecma_heap_image_get_offset (writer_p, field_p);
+  JERRY_ASSERT ((offset & ECMA_HEAP_IMAGE_RELOCATION_TYPE_MASK) == 0);
+
+  writer_p->relocation_count++;
+
+  if (writer_p->heap_copy_p == NULL)
+  {
+    return;
+  }
+
+  if (type == ECMA_HEAP_IMAGE_RELOCATION_HEAP)
+  {
+    value = (uintptr_t) ecma_heap_image_get_offset (writer_p, (const void *) value);
+  }
+  else if (writer_p->pointer_cb != NULL)
+  {
+    value = writer_p->pointer_cb (value, writer_p->user_p);
+  }
+
+  memcpy (writer_p->heap_copy_p + offset, &value, sizeof (uintptr_t));
+
+  if (writer_p->relocation_p + sizeof (uint32_t) <= writer_p->buffer_end_p)
+  {
+    uint32_t relocation = offset | (uint32_t) type;
+    memcpy (writer_p->relocation_p, &relocation, sizeof (uint32_t));
+    writer_p->relocation_p += sizeof (uint32_t);
+  }
+} /* ecma_heap_image_add_relocation */
+
+/**
+ * Add the relocation entries of the native pointer properties of an object.
+ */
+static void
+ecma_heap_image_walk_properties (ecma_heap_image_writer_t *writer_p, /**< writer */
+                                 ecma_object_t *object_p) /**< object */
+{
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
+
+  /* The property hashmaps are freed by the high severity gc. */
+  JERRY_ASSERT (prop_iter_p == NULL || ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+  while (prop_iter_p != NULL)
+  {
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      if (ECMA_PROPERTY_GET_TYPE (prop_iter_p->types[i]) == ECMA_PROPERTY_TYPE_INTERNAL
+          && prop_pair_p->names_cp[i] == LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER)
+      {
+        ecma_native_pointer_t *native_pointer_p;
+        native_pointer_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_native_pointer_t, prop_pair_p->values[i].value);
+
+        ecma_heap_image_add_relocation (writer_p, &native_pointer_p->data_p, ECMA_HEAP_IMAGE_RELOCATION_NATIVE);
+        ecma_heap_image_add_relocation (writer_p, &native_pointer_p->info_p, ECMA_HEAP_IMAGE_RELOCATION_NATIVE);
+      }
+    }
+
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+} /* ecma_heap_image_walk_properties */
+
+/**
+ * Add the relocation entries of an object, and clear its reference counter in the copy
+ * of the heap: the references of the application are not part of the image.
+ */
+static void
+ecma_heap_image_walk_object (ecma_heap_image_writer_t *writer_p, /**< writer */
+                             ecma_object_t *object_p) /**< object */
+{
+  if (writer_p->heap_copy_p != NULL)
+  {
+    uint16_t type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
+    memcpy (writer_p->heap_copy_p + ecma_heap_image_get_offset (writer_p, &object_p->type_flags_refs),
+            &type_flags_refs,
+            sizeof (uint16_t));
+  }
+
+  if (ecma_is_lexical_environment (object_p))
+  {
+    ecma_lexical_environment_type_t lex_env_type = ecma_get_lex_env_type (object_p);
+
+    if (lex_env_type > ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
+    {
+      return;
+    }
+
+    if (lex_env_type == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+    {
+      ecma_slot_lex_env_t *slot_lex_env_p = (ecma_slot_lex_env_t *) object_p;
+      bool is_static = (slot_lex_env_p->bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION) != 0;
+
+      ecma_heap_image_add_relocation (writer_p,
+                                      &slot_lex_env_p->bytecode_p,
+                                      is_static ? ECMA_HEAP_IMAGE_RELOCATION_NATIVE
+                                                : ECMA_HEAP_IMAGE_RELOCATION_HEAP);
+    }
+
+    ecma_heap_image_walk_properties (writer_p, object_p);
+    return;
+  }
+
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+  switch (ecma_get_object_type (object_p))
+  {
+    case ECMA_OBJECT_TYPE_CLASS:
+    {
+      if (ecma_get_object_is_builtin (object_p))
+      {
+        break;
+      }
+
+      switch (ext_object_p->u.class_prop.class_id)
+      {
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+        case LIT_MAGIC_STRING_ARRAY_BUFFER_UL:
+        {
+          if (ECMA_ARRAYBUFFER_HAS_EXTERNAL_MEMORY (ext_object_p))
+          {
+            ecma_arraybuffer_external_info *array_p = (ecma_arraybuffer_external_info *) object_p;
+
+            ecma_heap_image_add_relocation (writer_p, &array_p->buffer_p, ECMA_HEAP_IMAGE_RELOCATION_NATIVE);
+            ecma_heap_image_add_relocation (writer_p, &array_p->free_cb, ECMA_HEAP_IMAGE_RELOCATION_NATIVE);
+          }
+          break;
+        }
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
+        case LIT_MAGIC_STRING_PROMISE_UL:
+        {
+          ecma_promise_object_t *promise_p = (ecma_promise_object_t *) object_p;
+
+          ecma_heap_image_add_relocation (writer_p, &promise_p->fulfill_reactions, ECMA_HEAP_IMAGE_RELOCATION_HEAP);
+          ecma_heap_image_add_relocation (writer_p, &promise_p->reject_reactions, ECMA_HEAP_IMAGE_RELOCATION_HEAP);
+          break;
+        }
+#endif /* !CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
+        default:
+        {
+          break;
+        }
+      }
+      break;
+    }
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+    case ECMA_OBJECT_TYPE_FUNCTION:
+    {
+      if (!ecma_get_object_is_builtin (object_p) && ext_object_p->u.function.bytecode_cp == ECMA_NULL_POINTER)
+      {
+        ecma_static_function_t *static_function_p = (ecma_static_function_t *) object_p;
+
+        ecma_heap_image_add_relocation (writer_p, &static_function_p->bytecode_p, ECMA_HEAP_IMAGE_RELOCATION_NATIVE);
+      }
+      break;
+    }
+#ifndef CONFIG_DISABLE_ES2015_ARROW_FUNCTION
+    case ECMA_OBJECT_TYPE_ARROW_FUNCTION:
+    {
+      if (((ecma_arrow_function_t *) object_p)->bytecode_cp == ECMA_NULL_POINTER)
+      {
+        ecma_static_arrow_function_t *static_arrow_p = (ecma_static_arrow_function_t *) object_p;
+
+        ecma_heap_image_add_relocation (writer_p, &static_arrow_p->bytecode_p, ECMA_HEAP_IMAGE_RELOCATION_NATIVE);
+      }
+      break;
+    }
+#endif /* !CONFIG_DISABLE_ES2015_ARROW_FUNCTION */
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+    case ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION:
+    {
+      ecma_heap_image_add_relocation (writer_p,
+                                      &ext_object_p->u.external_handler_cb,
+                                      ECMA_HEAP_IMAGE_RELOCATION_NATIVE);
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  ecma_heap_image_walk_properties (writer_p, object_p);
+} /* ecma_heap_image_walk_object */
+
+/**
+ * Add a context reference to an object in the copy of the heap.
+ */
+static void
+ecma_heap_image_add_root_reference (ecma_heap_image_writer_t *writer_p, /**< writer */
+                                    ecma_object_t *object_p) /**< object */
+{
+  uint8_t *refs_p = writer_p->heap_copy_p + ecma_heap_image_get_offset (writer_p, &object_p->type_flags_refs);
+  uint16_t type_flags_refs;
+
+  memcpy (&type_flags_refs, refs_p, sizeof (uint16_t));
+  type_flags_refs = (uint16_t) (type_flags_refs + ECMA_OBJECT_REF_ONE);
+  memcpy (refs_p, &type_flags_refs, sizeof (uint16_t));
+} /* ecma_heap_image_add_root_reference */
+
+/**
+ * Release the references held by the caches of the engine, and clear the lookup cache.
+ */
+static void
+ecma_heap_image_flush_caches (void)
+{
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  re_cache_clear ();
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+
+#ifndef CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE
+  ecma_number_string_cache_flush ();
+#endif /* !CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE */
+
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  ecma_eval_cache_clear ();
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  /* The cached properties are marked, and the lcache of the restored context is empty. */
+  for (uint32_t row = 0; row < ECMA_LCACHE_HASH_ROWS_COUNT; row++)
+  {
+    for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
+    {
+      ecma_lcache_hash_entry_t *entry_p = JERRY_CONTEXT (lcache)[row] + i;
+
+      if (entry_p->object_cp != ECMA_NULL_POINTER)
+      {
+        ecma_set_property_lcached (entry_p->prop_p, false);
+        entry_p->object_cp = ECMA_NULL_POINTER;
+      }
+    }
+  }
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+} /* ecma_heap_image_flush_caches */
+
+/**
+ * Save the heap and the context roots into a heap image.
+ *
+ * Note:
+ *      if the image does not fit into the buffer, the content of the buffer is unspecified,
+ *      and the native pointer callback is not called
+ *
+ * @return number value with the size of the image - if the heap can be saved,
+ *         thrown error - otherwise
+ */
+ecma_value_t
+ecma_heap_image_save (uint8_t *buffer_p, /**< [out] output buffer (can be NULL) */
+                      size_t buffer_size, /**< size of the output buffer */
+                      ecma_heap_image_pointer_cb_t pointer_cb, /**< native pointer callback (can be NULL) */
+                      void *user_p) /**< user pointer passed to the callback */
+{
+  if (JERRY_CONTEXT (vm_top_context_p) != NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Heap image cannot be saved while code is running."));
+  }
+
+#ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
+  if (JERRY_CONTEXT (job_queue_head_p) != NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Heap image cannot be saved while jobs are pending."));
+  }
+#endif /* !CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
+
+  if (JERRY_CONTEXT (lit_magic_string_ex_count) > 0)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Heap image cannot be saved with external magic strings."));
+  }
+
+  ecma_heap_image_flush_caches ();
+
+  /* The collected statistics are allocated on the heap, but they are not part of the image. */
+#ifdef JERRY_PROFILER
+  vm_profiler_free_stacks ();
+#endif /* JERRY_PROFILER */
+
+#ifdef JERRY_VM_STATS
+  vm_stats_reset ();
+#endif /* JERRY_VM_STATS */
+
+  ecma_gc_run (JMEM_FREE_UNUSED_MEMORY_SEVERITY_HIGH);
+
+  if (JERRY_CONTEXT (ecma_external_string_count) > 0)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("Heap image cannot contain external strings."));
+  }
+
+  size_t heap_image_size = jmem_heap_prepare_image ();
+  size_t relocation_start = sizeof (ecma_heap_image_header_t) + heap_image_size;
+
+  if (buffer_p == NULL)
+  {
+    buffer_size = 0;
+  }
+
+  ecma_heap_image_writer_t writer;
+  writer.heap_start_p = (uint8_t *) &JERRY_HEAP_CONTEXT (first);
+  writer.heap_copy_p = NULL;
+  writer.relocation_p = NULL;
+  writer.buffer_end_p = NULL;
+  writer.relocation_count = 0;
+  writer.pointer_cb = pointer_cb;
+  writer.user_p = user_p;
+
+  if (relocation_start <= buffer_size)
+  {
+    writer.heap_copy_p = buffer_p + sizeof (ecma_heap_image_header_t);
+    writer.relocation_p = buffer_p + relocation_start;
+    writer.buffer_end_p = buffer_p + buffer_size;
+    memcpy (writer.heap_copy_p, writer.heap_start_p, heap_image_size);
+  }
+
+  for (ecma_object_t *iter_p = JERRY_CONTEXT (ecma_gc_objects_p);
+       iter_p != NULL;
+       iter_p = ECMA_GET_POINTER (ecma_object_t, iter_p->gc_next_cp))
+  {
+    ecma_heap_image_walk_object (&writer, iter_p);
+  }
+
+  size_t image_size = relocation_start + writer.relocation_count * sizeof (uint32_t);
+
+  if (image_size > buffer_size)
+  {
+    return ecma_make_number_value ((ecma_number_t) image_size);
+  }
+
+  ecma_heap_image_header_t header;
+  memset (&header, 0, sizeof (ecma_heap_image_header_t));
+
+  header.magic = ECMA_HEAP_IMAGE_MAGIC;
+  header.version = ECMA_HEAP_IMAGE_VERSION;
+  header.config_flags = ECMA_HEAP_IMAGE_CONFIG_FLAGS;
+  header.builtin_count = ECMA_BUILTIN_ID__COUNT;
+  header.magic_string_count = LIT_MAGIC_STRING__COUNT;
+  header.heap_start = (uintptr_t) writer.heap_start_p;
+  header.heap_size = (uint32_t) JMEM_HEAP_SIZE;
+  header.heap_image_size = (uint32_t) heap_image_size;
+  header.relocation_count = writer.relocation_count;
+  header.allocated_size = (uint32_t) JERRY_CONTEXT (jmem_heap_allocated_size);
+  header.gc_objects_number = (uint32_t) JERRY_CONTEXT (ecma_gc_objects_number);
+  header.gc_objects_offset = ecma_heap_image_get_offset (&writer, JERRY_CONTEXT (ecma_gc_objects_p));
+  header.global_lex_env_offset = ecma_heap_image_get_offset (&writer, JERRY_CONTEXT (ecma_global_lex_env_p));
+  header.string_list_offset = ecma_heap_image_get_offset (&writer, JERRY_CONTEXT (string_list_first_p));
+#ifndef CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN
+  header.symbol_list_offset = ecma_heap_image_get_offset (&writer, JERRY_CONTEXT (symbol_list_first_p));
+#endif /* !CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN */
+  header.number_list_offset = ecma_heap_image_get_offset (&writer, JERRY_CONTEXT (number_list_first_p));
+
+  /* The built-in objects and the global lexical environment are referenced by the context. */
+  for (uint32_t i = 0; i < ECMA_BUILTIN_ID__COUNT; i++)
+  {
+    ecma_object_t *builtin_p = JERRY_CONTEXT (ecma_builtin_objects)[i];
+
+    header.builtin_offsets[i] = ecma_heap_image_get_offset (&writer, builtin_p);
+
+    if (builtin_p != NULL)
+    {
+      ecma_heap_image_add_root_reference (&writer, builtin_p);
+    }
+  }
+
+  ecma_heap_image_add_root_reference (&writer, JERRY_CONTEXT (ecma_global_lex_env_p));
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  header.resource_name = JERRY_CONTEXT (resource_name);
+#endif /* JERRY_ENABLE_LINE_INFO */
+#ifdef JMEM_STATS
+  header.heap_stats = JERRY_CONTEXT (jmem_heap_stats);
+#endif /* JMEM_STATS */
+
+  memcpy (buffer_p, &header, sizeof (ecma_heap_image_header_t));
+  return ecma_make_number_value ((ecma_number_t) image_size);
+} /* ecma_heap_image_save */
+
+/**
+ * Check whether the heap image was saved by the same engine configuration, and
+ * its offsets are inside the heap.
+ *
+ * Note:
+ *      the heap data itself is not validated, so the image must come from a trusted source
+ *
+ * @return true - if the image can be restored,
+ *         false - otherwise
+ */
+bool
+ecma_heap_image_is_valid (const uint8_t *image_p, /**< heap image */
+                          size_t image_size) /**< size of the heap image */
+{
+  ecma_heap_image_header_t header;
+
+  if (image_p == NULL || image_size < sizeof (ecma_heap_image_header_t))
+  {
+    return false;
+  }
+
+  memcpy (&header, image_p, sizeof (ecma_heap_image_header_t));
+
+  if (header.magic != ECMA_HEAP_IMAGE_MAGIC
+      || header.version != ECMA_HEAP_IMAGE_VERSION
+      || header.config_flags != ECMA_HEAP_IMAGE_CONFIG_FLAGS
+      || header.builtin_count != ECMA_BUILTIN_ID__COUNT
+      || header.magic_string_count != LIT_MAGIC_STRING__COUNT
+      || header.heap_size != JMEM_HEAP_SIZE
+      || header.heap_image_size < sizeof (jmem_heap_free_t)
+      || header.heap_image_size > header.heap_size
+      || header.heap_image_size % JMEM_ALIGNMENT != 0
+      || header.allocated_size > header.heap_image_size
+      || (image_size - sizeof (ecma_heap_image_header_t) - header.heap_image_size) / sizeof (uint32_t)
+         != header.relocation_count
+      || image_size != (sizeof (ecma_heap_image_header_t) + header.heap_image_size
+                        + header.relocation_count * sizeof (uint32_t)))
+  {
+    return false;
+  }
+
+#ifdef ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY
+  /* Compressed pointers and internal values are addresses, so the heap cannot be moved. */
+  if (header.heap_start != (uintptr_t) &JERRY_HEAP_CONTEXT (first))
+  {
+    return false;
+  }
+#endif /* ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
+
+  const uint8_t *relocation_p = image_p + sizeof (ecma_heap_image_header_t) + header.heap_image_size;
+
+  for (uint32_t i = 0; i < header.relocation_count; i++)
+  {
+    uint32_t relocation;
+    memcpy (&relocation, relocation_p, sizeof (uint32_t));
+    relocation_p += sizeof (uint32_t);
+
+    uint32_t offset = relocation & ~(uint32_t) ECMA_HEAP_IMAGE_RELOCATION_TYPE_MASK;
+
+    if ((relocation & ECMA_HEAP_IMAGE_RELOCATION_TYPE_MASK) > ECMA_HEAP_IMAGE_RELOCATION_NATIVE
+        || offset < sizeof (jmem_heap_free_t)
+        || offset > header.heap_image_size - sizeof (uintptr_t))
+    {
+      return false;
+    }
+  }
+
+  return (header.global_lex_env_offset != 0
+          && header.global_lex_env_offset < header.heap_image_size
+          && header.gc_objects_offset < header.heap_image_size
+          && header.string_list_offset < header.heap_image_size
+          && header.symbol_list_offset < header.heap_image_size
+          && header.number_list_offset < header.heap_image_size);
+} /* ecma_heap_image_is_valid */
+
+/**
+ * Initialize the heap and the context roots from a valid heap image.
+ *
+ * Note:
+ *      this is the replacement of jmem_init and ecma_init, the other members of the context
+ *      must be initialized by the caller
+ */
+void
+ecma_heap_image_restore (const uint8_t *image_p, /**< heap image */
+                         ecma_heap_image_pointer_cb_t pointer_cb, /**< native pointer callback (can be NULL) */
+                         void *user_p) /**< user pointer passed to the callback */
+{
+  ecma_heap_image_header_t header;
+  memcpy (&header, image_p, sizeof (ecma_heap_image_header_t));
+
+  const uint8_t *heap_image_p = image_p + sizeof (ecma_heap_image_header_t);
+  jmem_heap_init_from_image (heap_image_p, header.heap_image_size, header.allocated_size);
+
+#ifdef JMEM_STATS
+  JERRY_CONTEXT (jmem_heap_stats) = header.heap_stats;
+#endif /* JMEM_STATS */
+
+  uint8_t *heap_start_p = (uint8_t *) &JERRY_HEAP_CONTEXT (first);
+  const uint8_t *relocation_p = heap_image_p + header.heap_image_size;
+
+  for (uint32_t i = 0; i < header.relocation_count; i++)
+  {
+    uint32_t relocation;
+    memcpy (&relocation, relocation_p, sizeof (uint32_t));
+    relocation_p += sizeof (uint32_t);
+
+    uint8_t *field_p = heap_start_p + (relocation & ~(uint32_t) ECMA_HEAP_IMAGE_RELOCATION_TYPE_MASK);
+    uintptr_t value;
+    memcpy (&value, field_p, sizeof (uintptr_t));
+
+    if ((relocation & ECMA_HEAP_IMAGE_RELOCATION_TYPE_MASK) == ECMA_HEAP_IMAGE_RELOCATION_HEAP)
+    {
+      value += (uintptr_t) heap_start_p;
+    }
+    else if (pointer_cb != NULL)
+    {
+      value = pointer_cb (value, user_p);
+    }
+
+    memcpy (field_p, &value, sizeof (uintptr_t));
+  }
+
+  for (uint32_t i = 0; i < ECMA_BUILTIN_ID__COUNT; i++)
+  {
+    JERRY_CONTEXT (ecma_builtin_objects)[i] = ecma_heap_image_get_pointer (heap_start_p, header.builtin_offsets[i]);
+  }
+
+  JERRY_CONTEXT (ecma_gc_objects_p) = ecma_heap_image_get_pointer (heap_start_p, header.gc_objects_offset);
+  JERRY_CONTEXT (ecma_gc_objects_number) = header.gc_objects_number;
+  JERRY_CONTEXT (ecma_global_lex_env_p) = ecma_heap_image_get_pointer (heap_start_p, header.global_lex_env_offset);
+  JERRY_CONTEXT (string_list_first_p) = ecma_heap_image_get_pointer (heap_start_p, header.string_list_offset);
+#ifndef CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN
+  JERRY_CONTEXT (symbol_list_first_p) = ecma_heap_image_get_pointer (heap_start_p, header.symbol_list_offset);
+#endif /* !CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN */
+  JERRY_CONTEXT (number_list_first_p) = ecma_heap_image_get_pointer (heap_start_p, header.number_list_offset);
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  JERRY_CONTEXT (resource_name) = header.resource_name;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+  /* The rest of ecma_init. */
+  jmem_register_free_unused_memory_callback (ecma_free_unused_memory);
+
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  JERRY_CONTEXT (ecma_prop_hashmap_alloc_state) = ECMA_PROP_HASHMAP_ALLOC_ON;
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_HIGH_SEV_GC;
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+
+#ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
+  ecma_job_queue_init ();
+#endif /* CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
+} /* ecma_heap_image_restore */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_HEAP_IMAGE */
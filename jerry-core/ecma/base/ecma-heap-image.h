@@ -0,0 +1,61 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_HEAP_IMAGE_H
+#define ECMA_HEAP_IMAGE_H
+
+#include "ecma-globals.h"
+
+#ifdef JERRY_HEAP_IMAGE
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaheapimage Heap image
+ * @{
+ */
+
+/**
+ * Magic number of heap images ("JRHI").
+ */
+#define ECMA_HEAP_IMAGE_MAGIC 0x4948524au
+
+/**
+ * Version of the heap image format.
+ */
+#define ECMA_HEAP_IMAGE_VERSION 2
+
+/**
+ * Callback which maps the native pointers of the heap.
+ *
+ * @return mapped value
+ */
+typedef uintptr_t (*ecma_heap_image_pointer_cb_t) (uintptr_t pointer, void *user_p);
+
+ecma_value_t ecma_heap_image_save (uint8_t *buffer_p,
+                                   size_t buffer_size,
+                                   ecma_heap_image_pointer_cb_t pointer_cb,
+                                   void *user_p);
+bool ecma_heap_image_is_valid (const uint8_t *image_p, size_t image_size);
+void ecma_heap_image_restore (const uint8_t *image_p, ecma_heap_image_pointer_cb_t pointer_cb, void *user_p);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_HEAP_IMAGE */
+
+#endif /* !ECMA_HEAP_IMAGE_H */
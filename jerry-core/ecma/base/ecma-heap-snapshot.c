@@ -0,0 +1,1305 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-function-object.h"
+#include "ecma-globals.h"
+#include "ecma-heap-snapshot.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-property-hashmap.h"
+#include "jcontext.h"
+#include "lit-char-helpers.h"
+#include "lit-strings.h"
+
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+#include "ecma-typedarray-object.h"
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
+#include "ecma-promise-object.h"
+#endif /* !CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
+
+#ifdef JERRY_HEAP_SNAPSHOT
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaheapsnapshot Heap snapshot
+ * @{
+ *
+ * The snapshot is a line based text stream:
+ *
+ *   JERRY-HEAP-SNAPSHOT <version>
+ *   N <id> <type> <self size> "<name>"       a node (object, scope, string, symbol, bytecode, native)
+ *   E <from id> <to id> <type> "<name>"      an edge (property, element, variable, getter, setter,
+ *                                             prototype, scope, binding, bytecode, native, internal)
+ *   R <id>                                   a root node (referenced from the stack or the engine)
+ *
+ * Node ids are addresses, so they are unique while the snapshot is taken. Objects and scopes are
+ * reported once, but shared nodes (strings, symbols, byte code) may be repeated with the same edges.
+ * Numbers are not shared, so their size is included in the size of the owner node.
+ *
+ * The walk must not allocate memory, since a garbage collection would modify the object list.
+ */
+
+/**
+ * Heap snapshot writer.
+ */
+typedef struct
+{
+  ecma_heap_snapshot_callback_t callback; /**< user callback */
+  void *user_p; /**< user pointer passed to the callback */
+  bool is_aborted; /**< the callback requested to stop */
+  size_t buffer_size; /**< number of bytes in the buffer */
+  const void *emitted_p[ECMA_HEAP_SNAPSHOT_CACHE_SIZE]; /**< recently emitted shared nodes */
+  lit_utf8_byte_t buffer[ECMA_HEAP_SNAPSHOT_BUFFER_SIZE]; /**< output buffer */
+} ecma_heap_snapshot_writer_t;
+
+/**
+ * Pass the buffered data to the user callback.
+ */
+static void
+ecma_heap_snapshot_flush (ecma_heap_snapshot_writer_t *writer_p) /**< writer */
+{
+  if (writer_p->buffer_size > 0 && !writer_p->is_aborted)
+  {
+    writer_p->is_aborted = !writer_p->callback (writer_p->buffer, writer_p->buffer_size, writer_p->user_p);
+  }
+
+  writer_p->buffer_size = 0;
+} /* ecma_heap_snapshot_flush */
+
+/**
+ * Append a byte to the output.
+ */
+static void
+ecma_heap_snapshot_append_byte (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                lit_utf8_byte_t byte) /**< byte */
+{
+  if (writer_p->buffer_size == ECMA_HEAP_SNAPSHOT_BUFFER_SIZE)
+  {
+    ecma_heap_snapshot_flush (writer_p);
+  }
+
+  writer_p->buffer[writer_p->buffer_size++] = byte;
+} /* ecma_heap_snapshot_append_byte */
+
+/**
+ * Append a zero terminated ASCII string to the output.
+ */
+static void
+ecma_heap_snapshot_append_ascii (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                 const char *str_p) /**< string */
+{
+  while (*str_p != '\0')
+  {
+    ecma_heap_snapshot_append_byte (writer_p, (lit_utf8_byte_t) *str_p++);
+  }
+} /* ecma_heap_snapshot_append_ascii */
+
+/**
+ * Append an unsigned decimal number to the output.
+ */
+static void
+ecma_heap_snapshot_append_uint (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                uintptr_t value) /**< value */
+{
+  lit_utf8_byte_t digits[24];
+  size_t length = 0;
+
+  do
+  {
+    digits[length++] = (lit_utf8_byte_t) (LIT_CHAR_0 + (value % 10));
+    value /= 10;
+  }
+  while (value > 0);
+
+  while (length > 0)
+  {
+    ecma_heap_snapshot_append_byte (writer_p, digits[--length]);
+  }
+} /* ecma_heap_snapshot_append_uint */
+
+/**
+ * Append the id of a node to the output.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_heap_snapshot_append_id (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                              const void *node_p) /**< node */
+{
+  ecma_heap_snapshot_append_uint (writer_p, (uintptr_t) node_p);
+} /* ecma_heap_snapshot_append_id */
+
+/**
+ * Append a quoted name to the output. Quotes, backslashes and control
+ * characters are escaped as in JSON, long names are truncated at a
+ * character boundary.
+ */
+static void
+ecma_heap_snapshot_append_name (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                const lit_utf8_byte_t *name_p, /**< name */
+                                lit_utf8_size_t name_size) /**< size of the name */
+{
+  static const char hex_digits[] = "0123456789abcdef";
+
+  if (name_size > ECMA_HEAP_SNAPSHOT_MAX_NAME_SIZE)
+  {
+    name_size = ECMA_HEAP_SNAPSHOT_MAX_NAME_SIZE;
+
+    while ((name_p[name_size] & LIT_UTF8_EXTRA_BYTE_MASK) == LIT_UTF8_EXTRA_BYTE_MARKER)
+    {
+      name_size--;
+    }
+  }
+
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_DOUBLE_QUOTE);
+
+  for (lit_utf8_size_t i = 0; i < name_size; i++)
+  {
+    lit_utf8_byte_t byte = name_p[i];
+
+    if (byte == LIT_CHAR_DOUBLE_QUOTE || byte == LIT_CHAR_BACKSLASH)
+    {
+      ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_BACKSLASH);
+    }
+    else if (byte < LIT_CHAR_SP)
+    {
+      ecma_heap_snapshot_append_ascii (writer_p, "\\u00");
+      ecma_heap_snapshot_append_byte (writer_p, (lit_utf8_byte_t) hex_digits[byte >> 4]);
+      byte = (lit_utf8_byte_t) hex_digits[byte & 0xf];
+    }
+
+    ecma_heap_snapshot_append_byte (writer_p, byte);
+  }
+
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_DOUBLE_QUOTE);
+} /* ecma_heap_snapshot_append_name */
+
+/**
+ * Append a quoted ASCII name to the output.
+ */
+static void
+ecma_heap_snapshot_append_ascii_name (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                      const char *name_p) /**< name */
+{
+  ecma_heap_snapshot_append_name (writer_p, (const lit_utf8_byte_t *) name_p, (lit_utf8_size_t) strlen (name_p));
+} /* ecma_heap_snapshot_append_ascii_name */
+
+/**
+ * Append a quoted magic string to the output.
+ */
+static void
+ecma_heap_snapshot_append_magic_name (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                      lit_magic_string_id_t id) /**< magic string id */
+{
+  if (id >= LIT_NON_INTERNAL_MAGIC_STRING__COUNT)
+  {
+    ecma_heap_snapshot_append_ascii_name (writer_p, "<internal>");
+    return;
+  }
+
+  ecma_heap_snapshot_append_name (writer_p, lit_get_magic_string_utf8 (id), lit_get_magic_string_size (id));
+} /* ecma_heap_snapshot_append_magic_name */
+
+/**
+ * Append a quoted number to the output.
+ */
+static void
+ecma_heap_snapshot_append_uint_name (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                     uint32_t value) /**< value */
+{
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_DOUBLE_QUOTE);
+  ecma_heap_snapshot_append_uint (writer_p, value);
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_DOUBLE_QUOTE);
+} /* ecma_heap_snapshot_append_uint_name */
+
+/**
+ * Append the contents of a non-direct string as a quoted name.
+ *
+ * Note: unlike ecma_string_get_chars, no memory is allocated.
+ */
+static void
+ecma_heap_snapshot_append_string_name (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                       ecma_string_t *string_p) /**< string */
+{
+  JERRY_ASSERT (!ECMA_IS_DIRECT_STRING (string_p));
+
+  switch (ECMA_STRING_GET_CONTAINER (string_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      ecma_heap_snapshot_append_name (writer_p, (const lit_utf8_byte_t *) (string_p + 1), string_p->u.utf8_string.size);
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
+    {
+      ecma_heap_snapshot_append_name (writer_p,
+                                      (const lit_utf8_byte_t *) (((ecma_long_string_t *) string_p) + 1),
+                                      string_p->u.long_utf8_string_size);
+      break;
+    }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      ecma_heap_snapshot_append_name (writer_p,
+                                      ((ecma_external_string_t *) string_p)->data_p,
+                                      string_p->u.long_utf8_string_size);
+      break;
+    }
+    case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
+    {
+      ecma_heap_snapshot_append_uint_name (writer_p, string_p->u.uint32_number);
+      break;
+    }
+    case ECMA_STRING_CONTAINER_MAGIC_STRING_EX:
+    {
+      lit_magic_string_ex_id_t id = (lit_magic_string_ex_id_t) string_p->u.magic_string_ex_id;
+      ecma_heap_snapshot_append_name (writer_p, lit_get_magic_string_ex_utf8 (id), lit_get_magic_string_ex_size (id));
+      break;
+    }
+    default:
+    {
+      ecma_heap_snapshot_append_ascii_name (writer_p, "<symbol>");
+      break;
+    }
+  }
+} /* ecma_heap_snapshot_append_string_name */
+
+/**
+ * Append a property name as a quoted name.
+ */
+static void
+ecma_heap_snapshot_append_property_name (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                         ecma_property_t property, /**< property */
+                                         jmem_cpointer_t name_cp) /**< property name */
+{
+  switch (ECMA_PROPERTY_GET_NAME_TYPE (property))
+  {
+    case ECMA_DIRECT_STRING_MAGIC:
+    {
+      ecma_heap_snapshot_append_magic_name (writer_p, (lit_magic_string_id_t) name_cp);
+      break;
+    }
+    case ECMA_DIRECT_STRING_UINT:
+    {
+      ecma_heap_snapshot_append_uint_name (writer_p, (uint32_t) name_cp);
+      break;
+    }
+    case ECMA_DIRECT_STRING_MAGIC_EX:
+    {
+      lit_magic_string_ex_id_t id = (lit_magic_string_ex_id_t) name_cp;
+      ecma_heap_snapshot_append_name (writer_p, lit_get_magic_string_ex_utf8 (id), lit_get_magic_string_ex_size (id));
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_PTR);
+      ecma_heap_snapshot_append_string_name (writer_p, ECMA_GET_NON_NULL_POINTER (ecma_string_t, name_cp));
+      break;
+    }
+  }
+} /* ecma_heap_snapshot_append_property_name */
+
+/**
+ * Append the name of a variable slot as a quoted name.
+ */
+static void
+ecma_heap_snapshot_append_slot_name (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                     ecma_value_t name) /**< variable name */
+{
+  ecma_string_t *string_p = ecma_get_string_from_value (name);
+
+  if (!ECMA_IS_DIRECT_STRING (string_p))
+  {
+    ecma_heap_snapshot_append_string_name (writer_p, string_p);
+    return;
+  }
+
+  ecma_property_t property = (ecma_property_t) (ECMA_GET_DIRECT_STRING_TYPE (string_p)
+                                                << ECMA_PROPERTY_NAME_TYPE_SHIFT);
+  jmem_cpointer_t name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (string_p);
+
+  ecma_heap_snapshot_append_property_name (writer_p, property, name_cp);
+} /* ecma_heap_snapshot_append_slot_name */
+
+/**
+ * Start a node line. The caller appends the quoted name and calls ecma_heap_snapshot_end_line.
+ */
+static void
+ecma_heap_snapshot_start_node (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                               const void *node_p, /**< node */
+                               const char *type_p, /**< node type */
+                               size_t size) /**< self size of the node */
+{
+  ecma_heap_snapshot_append_ascii (writer_p, "N ");
+  ecma_heap_snapshot_append_id (writer_p, node_p);
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_SP);
+  ecma_heap_snapshot_append_ascii (writer_p, type_p);
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_SP);
+  ecma_heap_snapshot_append_uint (writer_p, size);
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_SP);
+} /* ecma_heap_snapshot_start_node */
+
+/**
+ * Start an edge line. The caller appends the quoted name and calls ecma_heap_snapshot_end_line.
+ */
+static void
+ecma_heap_snapshot_start_edge (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                               const void *from_p, /**< source node */
+                               const void *to_p, /**< target node */
+                               const char *type_p) /**< edge type */
+{
+  ecma_heap_snapshot_append_ascii (writer_p, "E ");
+  ecma_heap_snapshot_append_id (writer_p, from_p);
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_SP);
+  ecma_heap_snapshot_append_id (writer_p, to_p);
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_SP);
+  ecma_heap_snapshot_append_ascii (writer_p, type_p);
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_SP);
+} /* ecma_heap_snapshot_start_edge */
+
+/**
+ * Finish a node or edge line.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_heap_snapshot_end_line (ecma_heap_snapshot_writer_t *writer_p) /**< writer */
+{
+  ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_LF);
+} /* ecma_heap_snapshot_end_line */
+
+/**
+ * Emit an edge with an ASCII name.
+ */
+static void
+ecma_heap_snapshot_edge (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                         const void *from_p, /**< source node */
+                         const void *to_p, /**< target node */
+                         const char *type_p, /**< edge type */
+                         const char *name_p) /**< edge name */
+{
+  ecma_heap_snapshot_start_edge (writer_p, from_p, to_p, type_p);
+  ecma_heap_snapshot_append_ascii_name (writer_p, name_p);
+  ecma_heap_snapshot_end_line (writer_p);
+} /* ecma_heap_snapshot_edge */
+
+/**
+ * Check whether a shared node was emitted recently and remember it otherwise.
+ *
+ * @return true - if the node does not need to be emitted again,
+ *         false - otherwise
+ */
+static bool
+ecma_heap_snapshot_is_emitted (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                               const void *node_p) /**< node */
+{
+  size_t index = (size_t) (((uintptr_t) node_p >> JMEM_ALIGNMENT_LOG) % ECMA_HEAP_SNAPSHOT_CACHE_SIZE);
+
+  if (writer_p->emitted_p[index] == node_p)
+  {
+    return true;
+  }
+
+  writer_p->emitted_p[index] = node_p;
+  return false;
+} /* ecma_heap_snapshot_is_emitted */
+
+/**
+ * Emit a non-direct string or a symbol node.
+ */
+static void
+ecma_heap_snapshot_string (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                           ecma_string_t *string_p) /**< string */
+{
+  if (ecma_heap_snapshot_is_emitted (writer_p, string_p))
+  {
+    return;
+  }
+
+  switch (ECMA_STRING_GET_CONTAINER (string_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      ecma_heap_snapshot_start_node (writer_p,
+                                     string_p,
+                                     "string",
+                                     sizeof (ecma_string_t) + string_p->u.utf8_string.size);
+      break;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
+    {
+      ecma_heap_snapshot_start_node (writer_p,
+                                     string_p,
+                                     "string",
+                                     sizeof (ecma_long_string_t) + string_p->u.long_utf8_string_size);
+      break;
+    }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      /* The characters are owned by the host. */
+      ecma_heap_snapshot_start_node (writer_p, string_p, "string", sizeof (ecma_external_string_t));
+      break;
+    }
+#ifndef CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN
+    case ECMA_STRING_CONTAINER_SYMBOL:
+    {
+      ecma_heap_snapshot_start_node (writer_p, string_p, "symbol", sizeof (ecma_string_t));
+      ecma_heap_snapshot_append_ascii_name (writer_p, "Symbol");
+      ecma_heap_snapshot_end_line (writer_p);
+
+      ecma_value_t description = string_p->u.symbol_descriptor;
+
+      if (ecma_is_value_string (description) && !ecma_is_value_direct_string (description))
+      {
+        ecma_string_t *description_p = ecma_get_string_from_value (description);
+
+        ecma_heap_snapshot_edge (writer_p, string_p, description_p, "internal", "description");
+        ecma_heap_snapshot_string (writer_p, description_p);
+      }
+      return;
+    }
+#endif /* !CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN */
+    default:
+    {
+      ecma_heap_snapshot_start_node (writer_p, string_p, "string", sizeof (ecma_string_t));
+      break;
+    }
+  }
+
+  ecma_heap_snapshot_append_string_name (writer_p, string_p);
+  ecma_heap_snapshot_end_line (writer_p);
+} /* ecma_heap_snapshot_string */
+
+/**
+ * Emit a byte code node and the byte code of its nested functions.
+ */
+static void
+ecma_heap_snapshot_bytecode (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                             const ecma_compiled_code_t *bytecode_p) /**< byte code */
+{
+  if (ecma_heap_snapshot_is_emitted (writer_p, bytecode_p))
+  {
+    return;
+  }
+
+  /* Static snapshot functions are not stored on the engine heap. */
+  size_t size = 0;
+
+  if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
+  {
+    size = ((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG;
+  }
+
+  ecma_heap_snapshot_start_node (writer_p, bytecode_p, "bytecode", size);
+  ecma_heap_snapshot_append_ascii_name (writer_p,
+                                        (bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION) ? "function"
+                                                                                            : "regexp");
+  ecma_heap_snapshot_end_line (writer_p);
+
+  if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
+  {
+    return;
+  }
+
+  ecma_value_t *literal_start_p;
+  uint32_t literal_end;
+  uint32_t const_literal_end;
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_p;
+    literal_end = args_p->literal_end;
+    const_literal_end = args_p->const_literal_end;
+
+    literal_start_p = (ecma_value_t *) ((uint8_t *) bytecode_p + sizeof (cbc_uint16_arguments_t));
+    literal_start_p -= args_p->register_end;
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_p;
+    literal_end = args_p->literal_end;
+    const_literal_end = args_p->const_literal_end;
+
+    literal_start_p = (ecma_value_t *) ((uint8_t *) bytecode_p + sizeof (cbc_uint8_arguments_t));
+    literal_start_p -= args_p->register_end;
+  }
+
+  for (uint32_t i = const_literal_end; i < literal_end; i++)
+  {
+    const ecma_compiled_code_t *literal_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t,
+                                                                             literal_start_p[i]);
+
+    /* Self references are ignored. */
+    if (literal_p != bytecode_p)
+    {
+      ecma_heap_snapshot_edge (writer_p, bytecode_p, literal_p, "bytecode", "nested");
+      ecma_heap_snapshot_bytecode (writer_p, literal_p);
+    }
+  }
+} /* ecma_heap_snapshot_bytecode */
+
+/**
+ * Emit an edge to the node referenced by a value and the node itself if it is shared.
+ * The caller appends the quoted name and calls ecma_heap_snapshot_end_line.
+ *
+ * @return true - if the edge is started,
+ *         false - if the value does not reference a node
+ */
+static bool
+ecma_heap_snapshot_start_value_edge (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                     const void *from_p, /**< source node */
+                                     ecma_value_t value, /**< referenced value */
+                                     const char *type_p) /**< edge type */
+{
+  if (ecma_is_value_object (value))
+  {
+    ecma_heap_snapshot_start_edge (writer_p, from_p, ecma_get_object_from_value (value), type_p);
+    return true;
+  }
+
+  ecma_string_t *string_p;
+
+  if (ecma_is_value_string (value) && !ecma_is_value_direct_string (value))
+  {
+    string_p = ecma_get_string_from_value (value);
+  }
+#ifndef CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN
+  else if (ecma_is_value_symbol (value))
+  {
+    string_p = ecma_get_symbol_from_value (value);
+  }
+#endif /* !CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN */
+  else
+  {
+    return false;
+  }
+
+  /* The string node is emitted before the edge, so the edge line is not interrupted. */
+  ecma_heap_snapshot_string (writer_p, string_p);
+  ecma_heap_snapshot_start_edge (writer_p, from_p, string_p, type_p);
+  return true;
+} /* ecma_heap_snapshot_start_value_edge */
+
+/**
+ * Emit an edge with an ASCII name to the node referenced by a value.
+ */
+static void
+ecma_heap_snapshot_value_edge (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                               const void *from_p, /**< source node */
+                               ecma_value_t value, /**< referenced value */
+                               const char *type_p, /**< edge type */
+                               const char *name_p) /**< edge name */
+{
+  if (ecma_heap_snapshot_start_value_edge (writer_p, from_p, value, type_p))
+  {
+    ecma_heap_snapshot_append_ascii_name (writer_p, name_p);
+    ecma_heap_snapshot_end_line (writer_p);
+  }
+} /* ecma_heap_snapshot_value_edge */
+
+/**
+ * Get the size of the numbers owned by a value.
+ *
+ * @return size in bytes
+ */
+static inline size_t JERRY_ATTR_ALWAYS_INLINE
+ecma_heap_snapshot_get_value_size (ecma_value_t value) /**< value */
+{
+  return ecma_is_value_float_number (value) ? sizeof (ecma_number_t) : 0;
+} /* ecma_heap_snapshot_get_value_size */
+
+/**
+ * Get the size of an object without its properties. Mirrors ecma_gc_free_object.
+ *
+ * @return size in bytes
+ */
+static size_t
+ecma_heap_snapshot_get_object_base_size (ecma_object_t *object_p) /**< object */
+{
+  if (ecma_is_lexical_environment (object_p))
+  {
+    if (ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+    {
+      return sizeof (ecma_object_t);
+    }
+
+    ecma_value_t *slots_p = ECMA_SLOT_LEX_ENV_GET_SLOTS (object_p);
+    uint32_t slot_count = ((ecma_slot_lex_env_t *) object_p)->slot_count;
+    size_t size = sizeof (ecma_slot_lex_env_t) + slot_count * sizeof (ecma_value_t);
+
+    for (uint32_t i = 0; i < slot_count; i++)
+    {
+      size += ecma_heap_snapshot_get_value_size (slots_p[i]);
+    }
+
+    return size;
+  }
+
+  ecma_object_type_t object_type = ecma_get_object_type (object_p);
+  size_t ext_object_size = sizeof (ecma_extended_object_t);
+
+  if (ecma_get_object_is_builtin (object_p))
+  {
+    uint8_t length_and_bitset_size;
+
+    if (object_type == ECMA_OBJECT_TYPE_CLASS
+        || object_type == ECMA_OBJECT_TYPE_ARRAY)
+    {
+      ext_object_size = sizeof (ecma_extended_built_in_object_t);
+      length_and_bitset_size = ((ecma_extended_built_in_object_t *) object_p)->built_in.length_and_bitset_size;
+    }
+    else
+    {
+      length_and_bitset_size = ((ecma_extended_object_t *) object_p)->u.built_in.length_and_bitset_size;
+    }
+
+    ext_object_size += (2 * sizeof (uint32_t)) * (length_and_bitset_size >> ECMA_BUILT_IN_BITSET_SHIFT);
+  }
+
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+  switch (object_type)
+  {
+    case ECMA_OBJECT_TYPE_CLASS:
+    {
+      switch (ext_object_p->u.class_prop.class_id)
+      {
+        case LIT_MAGIC_STRING_NUMBER_UL:
+        {
+          return ext_object_size + ecma_heap_snapshot_get_value_size (ext_object_p->u.class_prop.u.value);
+        }
+        case LIT_MAGIC_STRING_DATE_UL:
+        {
+          return ext_object_size + sizeof (ecma_number_t);
+        }
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+        case LIT_MAGIC_STRING_ARRAY_BUFFER_UL:
+        {
+          if (ECMA_ARRAYBUFFER_HAS_EXTERNAL_MEMORY (ext_object_p))
+          {
+            return sizeof (ecma_arraybuffer_external_info);
+          }
+          return sizeof (ecma_extended_object_t) + ext_object_p->u.class_prop.u.length;
+        }
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
+        case LIT_MAGIC_STRING_PROMISE_UL:
+        {
+          return (sizeof (ecma_promise_object_t)
+                  + ecma_heap_snapshot_get_value_size (ext_object_p->u.class_prop.u.value));
+        }
+#endif /* !CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_MAP_BUILTIN
+        case LIT_MAGIC_STRING_MAP_UL:
+        {
+          size_t size = sizeof (ecma_map_object_t);
+          jmem_cpointer_t chunk_cp = ((ecma_map_object_t *) object_p)->first_chunk_cp;
+
+          if (chunk_cp == ECMA_NULL_POINTER)
+          {
+            return size;
+          }
+
+          ecma_value_t *item_p = ECMA_GET_NON_NULL_POINTER (ecma_map_object_chunk_t, chunk_cp)->items;
+          size += sizeof (ecma_map_object_chunk_t);
+
+          while (true)
+          {
+            ecma_value_t item = *item_p++;
+
+            if (!ecma_is_value_pointer (item))
+            {
+              size += ecma_heap_snapshot_get_value_size (item);
+              continue;
+            }
+
+            item_p = (ecma_value_t *) ecma_get_pointer_from_value (item);
+
+            if (item_p == NULL)
+            {
+              return size;
+            }
+
+            size += sizeof (ecma_map_object_chunk_t);
+          }
+        }
+#endif /* !CONFIG_DISABLE_ES2015_MAP_BUILTIN */
+        default:
+        {
+          return ext_object_size;
+        }
+      }
+    }
+    case ECMA_OBJECT_TYPE_FUNCTION:
+    {
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+      if (!ecma_get_object_is_builtin (object_p) && ext_object_p->u.function.bytecode_cp == ECMA_NULL_POINTER)
+      {
+        return sizeof (ecma_static_function_t);
+      }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+      return ext_object_size;
+    }
+#ifndef CONFIG_DISABLE_ES2015_ARROW_FUNCTION
+    case ECMA_OBJECT_TYPE_ARROW_FUNCTION:
+    {
+      ecma_arrow_function_t *arrow_func_p = (ecma_arrow_function_t *) object_p;
+      size_t size = sizeof (ecma_arrow_function_t);
+
+#ifdef JERRY_ENABLE_SNAPSHOT_EXEC
+      if (arrow_func_p->bytecode_cp == ECMA_NULL_POINTER)
+      {
+        size = sizeof (ecma_static_arrow_function_t);
+      }
+#endif /* JERRY_ENABLE_SNAPSHOT_EXEC */
+      return size + ecma_heap_snapshot_get_value_size (arrow_func_p->this_binding);
+    }
+#endif /* !CONFIG_DISABLE_ES2015_ARROW_FUNCTION */
+    case ECMA_OBJECT_TYPE_PSEUDO_ARRAY:
+    {
+      switch (ext_object_p->u.pseudo_array.type)
+      {
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+        case ECMA_PSEUDO_ARRAY_TYPEDARRAY:
+        {
+          return sizeof (ecma_extended_object_t);
+        }
+        case ECMA_PSEUDO_ARRAY_TYPEDARRAY_WITH_INFO:
+        {
+          return sizeof (ecma_extended_typedarray_object_t);
+        }
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+        default:
+        {
+          JERRY_ASSERT (ext_object_p->u.pseudo_array.type == ECMA_PSEUDO_ARRAY_ARGUMENTS);
+
+          return sizeof (ecma_extended_object_t) + ext_object_p->u.pseudo_array.u1.length * sizeof (ecma_value_t);
+        }
+      }
+    }
+    case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
+    {
+      ecma_value_t args_len_or_this = ext_object_p->u.bound_function.args_len_or_this;
+
+      if (!ecma_is_value_integer_number (args_len_or_this))
+      {
+        return sizeof (ecma_extended_object_t) + ecma_heap_snapshot_get_value_size (args_len_or_this);
+      }
+
+      ecma_integer_value_t args_length = ecma_get_integer_from_value (args_len_or_this);
+      ecma_value_t *args_p = (ecma_value_t *) (ext_object_p + 1);
+      size_t size = sizeof (ecma_extended_object_t) + ((size_t) args_length) * sizeof (ecma_value_t);
+
+      for (ecma_integer_value_t i = 0; i < args_length; i++)
+      {
+        size += ecma_heap_snapshot_get_value_size (args_p[i]);
+      }
+      return size;
+    }
+    case ECMA_OBJECT_TYPE_ARRAY:
+    case ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION:
+    {
+      return ext_object_size;
+    }
+    default:
+    {
+      return ecma_get_object_is_builtin (object_p) ? ext_object_size : sizeof (ecma_object_t);
+    }
+  }
+} /* ecma_heap_snapshot_get_object_base_size */
+
+/**
+ * Get the self size of an object including its property list.
+ *
+ * @return size in bytes
+ */
+static size_t
+ecma_heap_snapshot_get_object_size (ecma_object_t *object_p) /**< object */
+{
+  size_t size = ecma_heap_snapshot_get_object_base_size (object_p);
+
+  if (ecma_is_lexical_environment (object_p)
+      && ecma_get_lex_env_type (object_p) > ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
+  {
+    return size;
+  }
+
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
+
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
+  if (prop_iter_p != NULL && prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    size += ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE (((ecma_property_hashmap_t *) prop_iter_p)->max_property_count);
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
+
+  while (prop_iter_p != NULL)
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
+    size += sizeof (ecma_property_pair_t);
+
+    for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      if (ECMA_PROPERTY_GET_TYPE (prop_iter_p->types[i]) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+      {
+        size += ecma_heap_snapshot_get_value_size (prop_pair_p->values[i].value);
+      }
+      else if (ECMA_PROPERTY_GET_TYPE (prop_iter_p->types[i]) == ECMA_PROPERTY_TYPE_INTERNAL
+               && prop_pair_p->names_cp[i] == LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER)
+      {
+        size += sizeof (ecma_native_pointer_t);
+      }
+    }
+
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  return size;
+} /* ecma_heap_snapshot_get_object_size */
+
+/**
+ * Emit the edges of a property.
+ */
+static void
+ecma_heap_snapshot_property (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                             ecma_object_t *object_p, /**< owner object */
+                             ecma_property_pair_t *property_pair_p, /**< property pair */
+                             uint32_t index) /**< property index */
+{
+  ecma_property_t property = property_pair_p->header.types[index];
+  jmem_cpointer_t name_cp = property_pair_p->names_cp[index];
+
+  switch (ECMA_PROPERTY_GET_TYPE (property))
+  {
+    case ECMA_PROPERTY_TYPE_NAMEDDATA:
+    {
+      const char *type_p = "property";
+
+      if (ecma_is_lexical_environment (object_p))
+      {
+        type_p = "variable";
+      }
+      else if (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_DIRECT_STRING_UINT)
+      {
+        type_p = "element";
+      }
+
+      if (ecma_heap_snapshot_start_value_edge (writer_p, object_p, property_pair_p->values[index].value, type_p))
+      {
+        ecma_heap_snapshot_append_property_name (writer_p, property, name_cp);
+        ecma_heap_snapshot_end_line (writer_p);
+      }
+      break;
+    }
+    case ECMA_PROPERTY_TYPE_NAMEDACCESSOR:
+    {
+      ecma_property_value_t *accessor_objs_p = property_pair_p->values + index;
+      ecma_object_t *getter_obj_p = ecma_get_named_accessor_property_getter (accessor_objs_p);
+      ecma_object_t *setter_obj_p = ecma_get_named_accessor_property_setter (accessor_objs_p);
+
+      if (getter_obj_p != NULL)
+      {
+        ecma_heap_snapshot_start_edge (writer_p, object_p, getter_obj_p, "getter");
+        ecma_heap_snapshot_append_property_name (writer_p, property, name_cp);
+        ecma_heap_snapshot_end_line (writer_p);
+      }
+
+      if (setter_obj_p != NULL)
+      {
+        ecma_heap_snapshot_start_edge (writer_p, object_p, setter_obj_p, "setter");
+        ecma_heap_snapshot_append_property_name (writer_p, property, name_cp);
+        ecma_heap_snapshot_end_line (writer_p);
+      }
+      break;
+    }
+    case ECMA_PROPERTY_TYPE_INTERNAL:
+    {
+      if (name_cp != LIT_INTERNAL_MAGIC_STRING_NATIVE_POINTER)
+      {
+        break;
+      }
+
+      ecma_native_pointer_t *native_pointer_p;
+      native_pointer_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_native_pointer_t,
+                                                          property_pair_p->values[index].value);
+
+      /* The host data is not known, the node only stores its address. The
+       * size of the native pointer record is included in the owner object. */
+      ecma_heap_snapshot_start_node (writer_p, native_pointer_p, "native", 0);
+      ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_DOUBLE_QUOTE);
+      ecma_heap_snapshot_append_uint (writer_p, (uintptr_t) native_pointer_p->data_p);
+      ecma_heap_snapshot_append_byte (writer_p, LIT_CHAR_DOUBLE_QUOTE);
+      ecma_heap_snapshot_end_line (writer_p);
+
+      ecma_heap_snapshot_edge (writer_p, object_p, native_pointer_p, "native", "native");
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+} /* ecma_heap_snapshot_property */
+
+/**
+ * Emit the edges of an object which are not stored in properties. Mirrors ecma_gc_mark.
+ */
+static void
+ecma_heap_snapshot_object_references (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                                      ecma_object_t *object_p) /**< object */
+{
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+  switch (ecma_get_object_type (object_p))
+  {
+    case ECMA_OBJECT_TYPE_CLASS:
+    {
+      switch (ext_object_p->u.class_prop.class_id)
+      {
+#ifndef CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN
+        case LIT_MAGIC_STRING_SYMBOL_UL:
+#endif /* !CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN */
+        case LIT_MAGIC_STRING_STRING_UL:
+        {
+          ecma_heap_snapshot_value_edge (writer_p, object_p, ext_object_p->u.class_prop.u.value, "internal", "value");
+          break;
+        }
+        case LIT_MAGIC_STRING_REGEXP_UL:
+        {
+          ecma_compiled_code_t *bytecode_p;
+          bytecode_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_compiled_code_t, ext_object_p->u.class_prop.u.value);
+
+          if (bytecode_p != NULL)
+          {
+            ecma_heap_snapshot_edge (writer_p, object_p, bytecode_p, "bytecode", "bytecode");
+            ecma_heap_snapshot_bytecode (writer_p, bytecode_p);
+          }
+          break;
+        }
+#ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
+        case LIT_MAGIC_STRING_PROMISE_UL:
+        {
+          ecma_heap_snapshot_value_edge (writer_p, object_p, ext_object_p->u.class_prop.u.value, "internal", "result");
+
+          ecma_value_t *value_p;
+          value_p = ecma_collection_iterator_init (((ecma_promise_object_t *) ext_object_p)->fulfill_reactions);
+
+          while (value_p != NULL)
+          {
+            ecma_heap_snapshot_value_edge (writer_p, object_p, *value_p, "internal", "fulfill");
+            value_p = ecma_collection_iterator_next (value_p);
+          }
+
+          value_p = ecma_collection_iterator_init (((ecma_promise_object_t *) ext_object_p)->reject_reactions);
+
+          while (value_p != NULL)
+          {
+            ecma_heap_snapshot_value_edge (writer_p, object_p, *value_p, "internal", "reject");
+            value_p = ecma_collection_iterator_next (value_p);
+          }
+          break;
+        }
+#endif /* !CONFIG_DISABLE_ES2015_PROMISE_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_MAP_BUILTIN
+        case LIT_MAGIC_STRING_MAP_UL:
+        {
+          jmem_cpointer_t chunk_cp = ((ecma_map_object_t *) object_p)->first_chunk_cp;
+
+          if (chunk_cp == ECMA_NULL_POINTER)
+          {
+            break;
+          }
+
+          ecma_value_t *item_p = ECMA_GET_NON_NULL_POINTER (ecma_map_object_chunk_t, chunk_cp)->items;
+          bool is_key = true;
+
+          /* Keys and values are stored in pairs, and removed pairs are replaced by two holes. */
+          while (true)
+          {
+            ecma_value_t item = *item_p++;
+
+            if (!ecma_is_value_pointer (item))
+            {
+              ecma_heap_snapshot_value_edge (writer_p, object_p, item, "internal", is_key ? "key" : "value");
+              is_key = !is_key;
+              continue;
+            }
+
+            item_p = (ecma_value_t *) ecma_get_pointer_from_value (item);
+
+            if (item_p == NULL)
+            {
+              break;
+            }
+          }
+          break;
+        }
+#endif /* !CONFIG_DISABLE_ES2015_MAP_BUILTIN */
+        default:
+        {
+          break;
+        }
+      }
+      break;
+    }
+    case ECMA_OBJECT_TYPE_PSEUDO_ARRAY:
+    {
+      switch (ext_object_p->u.pseudo_array.type)
+      {
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+        case ECMA_PSEUDO_ARRAY_TYPEDARRAY:
+        case ECMA_PSEUDO_ARRAY_TYPEDARRAY_WITH_INFO:
+        {
+          ecma_object_t *arraybuffer_p = ecma_typedarray_get_arraybuffer (object_p);
+          ecma_heap_snapshot_edge (writer_p, object_p, arraybuffer_p, "internal", "buffer");
+          break;
+        }
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+        default:
+        {
+          JERRY_ASSERT (ext_object_p->u.pseudo_array.type == ECMA_PSEUDO_ARRAY_ARGUMENTS);
+
+          ecma_object_t *lex_env_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_object_t,
+                                                                      ext_object_p->u.pseudo_array.u2.lex_env_cp);
+          ecma_heap_snapshot_edge (writer_p, object_p, lex_env_p, "scope", "scope");
+          break;
+        }
+      }
+      break;
+    }
+    case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
+    {
+      ecma_object_t *target_func_obj_p;
+      target_func_obj_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_object_t,
+                                                           ext_object_p->u.bound_function.target_function);
+      ecma_heap_snapshot_edge (writer_p, object_p, target_func_obj_p, "internal", "target");
+
+      ecma_value_t args_len_or_this = ext_object_p->u.bound_function.args_len_or_this;
+
+      if (!ecma_is_value_integer_number (args_len_or_this))
+      {
+        ecma_heap_snapshot_value_edge (writer_p, object_p, args_len_or_this, "internal", "this");
+        break;
+      }
+
+      ecma_integer_value_t args_length = ecma_get_integer_from_value (args_len_or_this);
+      ecma_value_t *args_p = (ecma_value_t *) (ext_object_p + 1);
+
+      ecma_heap_snapshot_value_edge (writer_p, object_p, args_p[0], "internal", "this");
+
+      for (ecma_integer_value_t i = 1; i < args_length; i++)
+      {
+        ecma_heap_snapshot_value_edge (writer_p, object_p, args_p[i], "internal", "argument");
+      }
+      break;
+    }
+    case ECMA_OBJECT_TYPE_FUNCTION:
+    {
+      if (ecma_get_object_is_builtin (object_p))
+      {
+        break;
+      }
+
+      ecma_heap_snapshot_edge (writer_p,
+                               object_p,
+                               ECMA_GET_INTERNAL_VALUE_POINTER (ecma_object_t, ext_object_p->u.function.scope_cp),
+                               "scope",
+                               "scope");
+
+      const ecma_compiled_code_t *bytecode_p = ecma_op_function_get_compiled_code (ext_object_p);
+      ecma_heap_snapshot_edge (writer_p, object_p, bytecode_p, "bytecode", "bytecode");
+      ecma_heap_snapshot_bytecode (writer_p, bytecode_p);
+      break;
+    }
+#ifndef CONFIG_DISABLE_ES2015_ARROW_FUNCTION
+    case ECMA_OBJECT_TYPE_ARROW_FUNCTION:
+    {
+      ecma_arrow_function_t *arrow_func_p = (ecma_arrow_function_t *) object_p;
+
+      ecma_heap_snapshot_edge (writer_p,
+                               object_p,
+                               ECMA_GET_NON_NULL_POINTER (ecma_object_t, arrow_func_p->scope_cp),
+                               "scope",
+                               "scope");
+      ecma_heap_snapshot_value_edge (writer_p, object_p, arrow_func_p->this_binding, "internal", "this");
+
+      const ecma_compiled_code_t *bytecode_p = ecma_op_arrow_function_get_compiled_code (arrow_func_p);
+      ecma_heap_snapshot_edge (writer_p, object_p, bytecode_p, "bytecode", "bytecode");
+      ecma_heap_snapshot_bytecode (writer_p, bytecode_p);
+      break;
+    }
+#endif /* !CONFIG_DISABLE_ES2015_ARROW_FUNCTION */
+    default:
+    {
+      break;
+    }
+  }
+} /* ecma_heap_snapshot_object_references */
+
+/**
+ * Emit an object or a lexical environment node with its edges.
+ */
+static void
+ecma_heap_snapshot_object (ecma_heap_snapshot_writer_t *writer_p, /**< writer */
+                           ecma_object_t *object_p) /**< object */
+{
+  bool traverse_properties = true;
+  size_t size = ecma_heap_snapshot_get_object_size (object_p);
+
+  if (ecma_is_lexical_environment (object_p))
+  {
+    ecma_heap_snapshot_start_node (writer_p, object_p, "scope", size);
+
+    if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+    {
+      ecma_heap_snapshot_append_ascii_name (writer_p, "declarative");
+      ecma_heap_snapshot_end_line (writer_p);
+    }
+    else if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+    {
+      ecma_heap_snapshot_append_ascii_name (writer_p, "declarative");
+      ecma_heap_snapshot_end_line (writer_p);
+
+      const ecma_compiled_code_t *bytecode_p = ((ecma_slot_lex_env_t *) object_p)->bytecode_p;
+      size_t header_size = ((bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+                            ? sizeof (cbc_uint16_arguments_t)
+                            : sizeof (cbc_uint8_arguments_t));
+      const ecma_value_t *names_p = (const ecma_value_t *) (((const uint8_t *) bytecode_p) + header_size);
+      ecma_value_t *slots_p = ECMA_SLOT_LEX_ENV_GET_SLOTS (object_p);
+      uint32_t slot_count = ((ecma_slot_lex_env_t *) object_p)->slot_count;
+
+      for (uint32_t i = 0; i < slot_count; i++)
+      {
+        if (ecma_heap_snapshot_start_value_edge (writer_p, object_p, slots_p[i], "variable"))
+        {
+          ecma_heap_snapshot_append_slot_name (writer_p, names_p[i]);
+          ecma_heap_snapshot_end_line (writer_p);
+        }
+      }
+    }
+    else
+    {
+      ecma_heap_snapshot_append_ascii_name (writer_p, "object");
+      ecma_heap_snapshot_end_line (writer_p);
+
+      ecma_heap_snapshot_edge (writer_p, object_p, ecma_get_lex_env_binding_object (object_p), "binding", "binding");
+      traverse_properties = false;
+    }
+
+    ecma_object_t *outer_lex_env_p = ecma_get_lex_env_outer_reference (object_p);
+
+    if (outer_lex_env_p != NULL)
+    {
+      ecma_heap_snapshot_edge (writer_p, object_p, outer_lex_env_p, "scope", "outer");
+    }
+  }
+  else
+  {
+    ecma_heap_snapshot_start_node (writer_p, object_p, "object", size);
+    lit_magic_string_id_t class_name_id = LIT_MAGIC_STRING_OBJECT_UL;
+
+    /* The [[Class]] of built-in general objects is only defined for a few of them. */
+    if (ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_GENERAL)
+    {
+      class_name_id = ecma_object_get_class_name (object_p);
+    }
+
+    ecma_heap_snapshot_append_magic_name (writer_p, class_name_id);
+    ecma_heap_snapshot_end_line (writer_p);
+
+    ecma_object_t *proto_p = ecma_get_object_prototype (object_p);
+
+    if (proto_p != NULL)
+    {
+      ecma_heap_snapshot_edge (writer_p, object_p, proto_p, "prototype", "__proto__");
+    }
+
+    ecma_heap_snapshot_object_references (writer_p, object_p);
+  }
+
+  if (!traverse_properties)
+  {
+    return;
+  }
+
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
+
+  if (prop_iter_p != NULL && prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+
+  while (prop_iter_p != NULL)
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    ecma_heap_snapshot_property (writer_p, object_p, (ecma_property_pair_t *) prop_iter_p, 0);
+    ecma_heap_snapshot_property (writer_p, object_p, (ecma_property_pair_t *) prop_iter_p, 1);
+
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+  }
+} /* ecma_heap_snapshot_object */
+
+/**
+ * Write a heap snapshot of all live objects through the callback.
+ *
+ * Note:
+ *      the callback must not call engine functions
+ *
+ * @return true - if the whole snapshot was passed to the callback,
+ *         false - if the callback aborted it
+ */
+bool
+ecma_heap_snapshot (ecma_heap_snapshot_callback_t callback, /**< callback */
+                    void *user_p) /**< user pointer passed to the callback */
+{
+  JERRY_ASSERT (callback != NULL);
+
+  ecma_heap_snapshot_writer_t writer;
+  writer.callback = callback;
+  writer.user_p = user_p;
+  writer.is_aborted = false;
+  writer.buffer_size = 0;
+  memset (writer.emitted_p, 0, sizeof (writer.emitted_p));
+
+  ecma_heap_snapshot_append_ascii (&writer, "JERRY-HEAP-SNAPSHOT ");
+  ecma_heap_snapshot_append_uint (&writer, ECMA_HEAP_SNAPSHOT_VERSION);
+  ecma_heap_snapshot_end_line (&writer);
+
+  for (ecma_object_t *iter_p = JERRY_CONTEXT (ecma_gc_objects_p);
+       iter_p != NULL && !writer.is_aborted;
+       iter_p = ECMA_GET_POINTER (ecma_object_t, iter_p->gc_next_cp))
+  {
+    ecma_heap_snapshot_object (&writer, iter_p);
+
+    /* Objects referenced from the stack, the API or the engine itself are the roots of the GC. */
+    if (iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+    {
+      ecma_heap_snapshot_append_ascii (&writer, "R ");
+      ecma_heap_snapshot_append_id (&writer, iter_p);
+      ecma_heap_snapshot_end_line (&writer);
+    }
+  }
+
+  ecma_heap_snapshot_flush (&writer);
+  return !writer.is_aborted;
+} /* ecma_heap_snapshot */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_HEAP_SNAPSHOT */
@@ -0,0 +1,67 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_HEAP_SNAPSHOT_H
+#define ECMA_HEAP_SNAPSHOT_H
+
+#include "ecma-globals.h"
+
+#ifdef JERRY_HEAP_SNAPSHOT
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaheapsnapshot Heap snapshot
+ * @{
+ */
+
+/**
+ * Version of the heap snapshot stream format.
+ */
+#define ECMA_HEAP_SNAPSHOT_VERSION 1
+
+/**
+ * Size of the buffer passed to the heap snapshot callback.
+ */
+#define ECMA_HEAP_SNAPSHOT_BUFFER_SIZE 256
+
+/**
+ * Number of recently emitted shared nodes which are not emitted again.
+ */
+#define ECMA_HEAP_SNAPSHOT_CACHE_SIZE 64
+
+/**
+ * Maximum number of string bytes used as the name of a node or an edge.
+ */
+#define ECMA_HEAP_SNAPSHOT_MAX_NAME_SIZE 64
+
+/**
+ * Callback which receives the heap snapshot stream.
+ *
+ * @return true - to continue the snapshot,
+ *         false - to abort it
+ */
+typedef bool (*ecma_heap_snapshot_callback_t) (const lit_utf8_byte_t *buffer_p, size_t buffer_size, void *user_p);
+
+bool ecma_heap_snapshot (ecma_heap_snapshot_callback_t callback, void *user_p);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_HEAP_SNAPSHOT */
+
+#endif /* !ECMA_HEAP_SNAPSHOT_H */
@@ -31,215 +31,316 @@
 #if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
 
 /**
- * \addtogroup ecmahelpersbigintegers Helpers for operations intermediate 128-bit integers
+ * \addtogroup ecmahelpersbignums Helpers for exact comparison of decimal and binary numbers
  * @{
  */
 
 /**
- * 128-bit integer type
+ * Maximum number of 32-bit limbs of an ecma_bigint_t.
+ *
+ * The largest operand is the halfway point of the smallest denormal number multiplied by
+ * 5^343 (the value of the smallest non-zero literal with twenty significant digits),
+ * which fits into 900 bits.
  */
-typedef struct
-{
-  uint64_t lo; /**< low 64 bits */
-  uint64_t hi; /**< high 64 bits */
-} ecma_uint128_t;
+#define ECMA_BIGINT_MAX_LIMBS 32
 
 /**
- * Round high part of 128-bit integer to uint64_t
+ * Largest power of five which fits into a 32-bit limb (5^13).
  */
-#define ECMA_UINT128_ROUND_HIGH_TO_UINT64(name) \
-  (name.hi + (name.lo >> 63u))
+#define ECMA_BIGINT_POW5_MAX_LIMB_VALUE 1220703125u
 
 /**
- * Check if 128-bit integer is zero
+ * Non-negative integer of arbitrary (but limited) precision
  */
-#define ECMA_UINT128_IS_ZERO(name) \
-  (name.hi == 0 && name.lo == 0)
+typedef struct
+{
+  uint32_t size; /**< number of used limbs, the highest used limb is never zero */
+  uint32_t limbs[ECMA_BIGINT_MAX_LIMBS]; /**< limbs, least significant first */
+} ecma_bigint_t;
 
 /**
- * Left shift 128-bit integer by max 63 bits
+ * Initialize a big integer from a 64-bit integer
  */
-#define ECMA_UINT128_LEFT_SHIFT_MAX63(name, shift) \
-{ \
-  name.hi = (name.hi << (shift)) | (name.lo >> (64 - (shift))); \
-  name.lo <<= (shift); \
-}
+static void
+ecma_bigint_init (ecma_bigint_t *num_p, /**< [out] big integer */
+                  uint64_t value) /**< initial value */
+{
+  num_p->limbs[0] = (uint32_t) value;
+  num_p->limbs[1] = (uint32_t) (value >> 32);
+  num_p->size = (num_p->limbs[1] != 0) ? 2 : (num_p->limbs[0] != 0);
+} /* ecma_bigint_init */
 
 /**
- * Right shift 128-bit integer by max 63 bits
+ * Multiply a big integer by a 32-bit integer and add a 32-bit integer to the product
  */
-#define ECMA_UINT128_RIGHT_SHIFT_MAX63(name, shift) \
-{ \
-  name.lo = (name.lo >> (shift)) | (name.hi << (64 - (shift))); \
-  name.hi >>= (shift); \
-}
+static void
+ecma_bigint_mul_add (ecma_bigint_t *num_p, /**< [in, out] big integer */
+                     uint32_t multiplier, /**< multiplier */
+                     uint32_t addend) /**< addend */
+{
+  uint64_t carry = addend;
+
+  for (uint32_t i = 0; i < num_p->size; i++)
+  {
+    uint64_t product = (uint64_t) num_p->limbs[i] * multiplier + carry;
+    num_p->limbs[i] = (uint32_t) product;
+    carry = product >> 32;
+  }
+
+  if (carry != 0)
+  {
+    JERRY_ASSERT (num_p->size < ECMA_BIGINT_MAX_LIMBS);
+    num_p->limbs[num_p->size++] = (uint32_t) carry;
+  }
+} /* ecma_bigint_mul_add */
 
 /**
- * Add 128-bit integer
+ * Multiply a big integer by a power of five
  */
-#define ECMA_UINT128_ADD(name_add_to, name_to_add) \
-{ \
-  name_add_to.hi += name_to_add.hi; \
-  name_add_to.lo += name_to_add.lo; \
-  if (name_add_to.lo < name_to_add.lo) \
-  { \
-    name_add_to.hi++; \
-  } \
-}
+static void
+ecma_bigint_mul_pow5 (ecma_bigint_t *num_p, /**< [in, out] big integer */
+                      uint32_t exponent) /**< exponent of the power of five */
+{
+  while (exponent >= 13)
+  {
+    ecma_bigint_mul_add (num_p, ECMA_BIGINT_POW5_MAX_LIMB_VALUE, 0);
+    exponent -= 13;
+  }
+
+  uint32_t multiplier = 1;
+
+  while (exponent > 0)
+  {
+    multiplier *= 5;
+    exponent--;
+  }
+
+  ecma_bigint_mul_add (num_p, multiplier, 0);
+} /* ecma_bigint_mul_pow5 */
 
 /**
- * Multiply 128-bit integer by 10
+ * Multiply a big integer by a power of two
  */
-#define ECMA_UINT128_MUL10(name) \
-{ \
-  ECMA_UINT128_LEFT_SHIFT_MAX63 (name, 1u); \
-  \
-  ecma_uint128_t name ## _tmp = name; \
-  \
-  ECMA_UINT128_LEFT_SHIFT_MAX63 (name ## _tmp, 2u); \
-  \
-  ECMA_UINT128_ADD (name, name ## _tmp); \
-}
+static void
+ecma_bigint_shift_left (ecma_bigint_t *num_p, /**< [in, out] big integer */
+                        uint32_t shift) /**< exponent of the power of two */
+{
+  if (num_p->size == 0)
+  {
+    return;
+  }
+
+  uint32_t limb_shift = shift / 32;
+  uint32_t bit_shift = shift % 32;
+  uint32_t size = num_p->size;
+
+  JERRY_ASSERT (size + limb_shift < ECMA_BIGINT_MAX_LIMBS);
+
+  if (bit_shift == 0)
+  {
+    for (uint32_t i = size; i > 0; i--)
+    {
+      num_p->limbs[i - 1 + limb_shift] = num_p->limbs[i - 1];
+    }
+  }
+  else
+  {
+    num_p->limbs[size + limb_shift] = num_p->limbs[size - 1] >> (32 - bit_shift);
+
+    for (uint32_t i = size - 1; i > 0; i--)
+    {
+      num_p->limbs[i + limb_shift] = (num_p->limbs[i] << bit_shift) | (num_p->limbs[i - 1] >> (32 - bit_shift));
+    }
+
+    num_p->limbs[limb_shift] = num_p->limbs[0] << bit_shift;
+
+    if (num_p->limbs[size + limb_shift] != 0)
+    {
+      size++;
+    }
+  }
+
+  memset (num_p->limbs, 0, limb_shift * sizeof (uint32_t));
+  num_p->size = size + limb_shift;
+} /* ecma_bigint_shift_left */
 
 /**
- * Divide 128-bit integer by 10
+ * Compare two big integers
  *
- * N = N3 *2^96  + N2 *2^64  + N1 *2^32  + N0 *2^0     // 128-bit dividend
- * T = T3 *2^-32 + T2 *2^-64 + T1 *2^-96 + T0 *2^-128  // 128-bit divisor reciprocal, 1/10 * 2^-128
- *
- * N * T    = N3*T3 *2^64 + N2*T3 *2^32 + N1*T3 *2^0 + N0*T3 *2^-32
- *          +               N3*T2 *2^32 + N2*T2 *2^0 + N1*T2 *2^-32 + N0*T2 *2^-64
- *          +                             N3*T1 *2^0 + N2*T1 *2^-32 + N1*T1 *2^-64 + N0*T1 *2^-96
- *          +                                          N3*T0 *2^-32 + N2*T0 *2^-64 + N1*T0 *2^-96 + N0*T0 *2^-128
- *
- *  Q3=carry  Q2=^+carry    Q1=^+carry    Q0=^+carry   fraction=^...
- *
- * Q = Q3 *2^96  + Q2 *2^64  + Q1 *2^32  + Q0 *2^0     // 128-bit quotient
+ * @return negative - if the left value is smaller,
+ *         zero - if the values are equal,
+ *         positive - if the left value is greater
  */
-#define ECMA_UINT128_DIV10(name) \
-{ \
-  /* estimation of reciprocal of 10, 128 bits right of the binary point (T1 == T2) */ \
-  const uint64_t tenth_l = 0x9999999aul; \
-  const uint64_t tenth_m = 0x99999999ul; \
-  const uint64_t tenth_h = 0x19999999ul; \
-  \
-  uint64_t l0 = ((uint32_t) name.lo) * tenth_l; \
-  uint64_t l1 = (name.lo >> 32u) * tenth_l; \
-  uint64_t l2 = ((uint32_t) name.hi) * tenth_l; \
-  uint64_t l3 = (name.hi >> 32u) * tenth_l; \
-  uint64_t m0 = ((uint32_t) name.lo) * tenth_m; \
-  uint64_t m1 = (name.lo >> 32u) * tenth_m; \
-  uint64_t m2 = ((uint32_t) name.hi) * tenth_m; \
-  uint64_t m3 = (name.hi >> 32u) * tenth_m; \
-  uint64_t h0 = ((uint32_t) name.lo) * tenth_h; \
-  uint64_t h1 = (name.lo >> 32u) * tenth_h; \
-  uint64_t h2 = ((uint32_t) name.hi) * tenth_h; \
-  uint64_t h3 = (name.hi >> 32u) * tenth_h; \
-  \
-  uint64_t q0 = l0 >> 32u; \
-  q0 += (uint32_t) l1; \
-  q0 += (uint32_t) m0; \
-  \
-  q0 >>= 32u; \
-  q0 += l1 >> 32u; \
-  q0 += m0 >> 32u; \
-  q0 += (uint32_t) l2; \
-  q0 += (uint32_t) m1; \
-  q0 += (uint32_t) m0; \
-  \
-  q0 >>= 32u; \
-  q0 += l2 >> 32u; \
-  q0 += m1 >> 32u; \
-  q0 += m0 >> 32u; \
-  q0 += (uint32_t) l3; \
-  q0 += (uint32_t) m2; \
-  q0 += (uint32_t) m1; \
-  q0 += (uint32_t) h0; \
-  \
-  q0 >>=32u; \
-  q0 += l3 >> 32u; \
-  q0 += m2 >> 32u; \
-  q0 += m1 >> 32u; \
-  q0 += h0 >> 32u; \
-  q0 += (uint32_t) m3; \
-  q0 += (uint32_t) m2; \
-  q0 += (uint32_t) h1; \
-  \
-  uint64_t q1 = q0 >> 32u; \
-  q1 += m3 >> 32u; \
-  q1 += m2 >> 32u; \
-  q1 += h1 >> 32u; \
-  q1 += (uint32_t) m3; \
-  q1 += (uint32_t) h2; \
-  \
-  uint64_t q32 = q1 >> 32u; \
-  q32 += m3 >> 32u; \
-  q32 += h2 >> 32u; \
-  q32 += h3; \
-  \
-  name.lo = (q1 << 32u) | ((uint32_t) q0); \
-  name.hi = q32; \
-}
-
-#if defined (__GNUC__) || defined (__clang__)
+static int
+ecma_bigint_compare (const ecma_bigint_t *left_p, /**< left value */
+                     const ecma_bigint_t *right_p) /**< right value */
+{
+  if (left_p->size != right_p->size)
+  {
+    return (left_p->size > right_p->size) ? 1 : -1;
+  }
+
+  for (uint32_t i = left_p->size; i > 0; i--)
+  {
+    if (left_p->limbs[i - 1] != right_p->limbs[i - 1])
+    {
+      return (left_p->limbs[i - 1] > right_p->limbs[i - 1]) ? 1 : -1;
+    }
+  }
+
+  return 0;
+} /* ecma_bigint_compare */
 
 /**
- * Count leading zeros in the topmost 64 bits of a 128-bit integer.
+ * Get the binary representation of an ecma-number.
+ *
+ * @return IEEE-754 bits of the number
  */
-#define ECMA_UINT128_CLZ_MAX63(name) \
-  __builtin_clzll (name.hi)
+static inline uint64_t JERRY_ATTR_ALWAYS_INLINE
+ecma_number_to_bits (ecma_number_t num) /**< ecma-number */
+{
+  union
+  {
+    ecma_number_t value;
+    uint64_t bits;
+  } u;
+
+  u.value = num;
+  return u.bits;
+} /* ecma_number_to_bits */
 
 /**
- * Count leading zeros in the topmost 4 bits of a 128-bit integer.
+ * Create an ecma-number from its binary representation.
+ *
+ * @return ecma-number
  */
-#define ECMA_UINT128_CLZ_MAX4(name) \
-  __builtin_clzll (name.hi)
+static inline ecma_number_t JERRY_ATTR_ALWAYS_INLINE
+ecma_number_from_bits (uint64_t bits) /**< IEEE-754 bits of the number */
+{
+  union
+  {
+    ecma_number_t value;
+    uint64_t bits;
+  } u;
 
-#else /* !__GNUC__ && !__clang__ */
+  u.bits = bits;
+  return u.value;
+} /* ecma_number_from_bits */
 
 /**
- * Count leading zeros in a 64-bit integer. The behaviour is undefined for 0.
+ * Compare a decimal number with the halfway point between a non-negative finite ecma-number
+ * and the next representable ecma-number.
  *
- * @return number of leading zeros.
+ * @return negative - if the decimal number is below the halfway point,
+ *         zero - if the decimal number is the halfway point,
+ *         positive - if the decimal number is above the halfway point
  */
-static inline int JERRY_ATTR_ALWAYS_INLINE
-ecma_uint64_clz (uint64_t n) /**< integer to count leading zeros in */
+static int
+ecma_number_compare_to_halfway (const ecma_bigint_t *digits_p, /**< decimal digits of the number */
+                                int32_t exponent, /**< decimal exponent of the number */
+                                uint64_t bits) /**< binary representation of the ecma-number */
 {
-  JERRY_ASSERT (n != 0);
+  uint64_t mantissa = bits & ((1ull << ECMA_NUMBER_FRACTION_WIDTH) - 1);
+  int32_t biased_exp = (int32_t) (bits >> ECMA_NUMBER_FRACTION_WIDTH);
+
+  /* Exponent of the least significant mantissa bit of denormal numbers: 1 - 1023 - 52 */
+  int32_t binary_exponent = -1074;
 
-  int cnt = 0;
-  uint64_t one = 0x8000000000000000ull;
-  while ((n & one) == 0)
+  if (biased_exp != 0)
   {
-    cnt++;
-    one >>= 1;
+    mantissa |= 1ull << ECMA_NUMBER_FRACTION_WIDTH;
+    binary_exponent += biased_exp - 1;
   }
-  return cnt;
-} /* ecma_uint64_clz */
 
-/**
- * Number of leading zeros in 4-bit integers.
- */
-static const uint8_t ecma_uint4_clz[] = { 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0 };
+  /* decimal: digits * 5^exponent * 2^exponent, halfway: (2 * mantissa + 1) * 2^(binary_exponent - 1) */
+  ecma_bigint_t decimal = *digits_p;
+  ecma_bigint_t halfway;
 
-/**
- * Count leading zeros in the topmost 64 bits of a 128-bit integer.
- */
-#define ECMA_UINT128_CLZ_MAX63(name) \
-  ecma_uint64_clz (name.hi)
+  ecma_bigint_init (&halfway, 2 * mantissa + 1);
+
+  int32_t decimal_binary_exponent = 0;
+  int32_t halfway_binary_exponent = binary_exponent - 1;
+
+  if (exponent >= 0)
+  {
+    ecma_bigint_mul_pow5 (&decimal, (uint32_t) exponent);
+    decimal_binary_exponent = exponent;
+  }
+  else
+  {
+    ecma_bigint_mul_pow5 (&halfway, (uint32_t) -exponent);
+    halfway_binary_exponent -= exponent;
+  }
+
+  if (decimal_binary_exponent > halfway_binary_exponent)
+  {
+    ecma_bigint_shift_left (&decimal, (uint32_t) (decimal_binary_exponent - halfway_binary_exponent));
+  }
+  else
+  {
+    ecma_bigint_shift_left (&halfway, (uint32_t) (halfway_binary_exponent - decimal_binary_exponent));
+  }
+
+  return ecma_bigint_compare (&decimal, &halfway);
+} /* ecma_number_compare_to_halfway */
 
 /**
- * Count leading zeros in the topmost 4 bits of a 128-bit integer.
+ * Round a decimal number to the nearest ecma-number, ties to even.
+ *
+ * The approximation is moved towards the exact value one unit in the last place at a time,
+ * so it should be at most a few units away from the result.
+ *
+ * @return correctly rounded non-negative ecma-number
  */
-#define ECMA_UINT128_CLZ_MAX4(name) \
-  ecma_uint4_clz[name.hi >> 60]
+static ecma_number_t
+ecma_number_round_decimal (const ecma_bigint_t *digits_p, /**< decimal digits of the number */
+                           int32_t exponent, /**< decimal exponent of the number */
+                           ecma_number_t approximation) /**< non-negative estimation of the result */
+{
+  const uint64_t infinity_bits = ecma_number_to_bits (ecma_number_make_infinity (false));
+  uint64_t bits = ecma_number_to_bits (approximation);
 
-#endif /* __GNUC__ || __clang__ */
+  if (bits == infinity_bits)
+  {
+    bits--;
+  }
+
+  while (true)
+  {
+    int result = ecma_number_compare_to_halfway (digits_p, exponent, bits);
+
+    if (result > 0 || (result == 0 && (bits & 0x1) != 0))
+    {
+      /* The successor of the largest finite number is Infinity. */
+      if (++bits == infinity_bits)
+      {
+        break;
+      }
+      continue;
+    }
+
+    if (bits == 0)
+    {
+      break;
+    }
+
+    result = ecma_number_compare_to_halfway (digits_p, exponent, bits - 1);
+
+    if (result < 0 || (result == 0 && (bits & 0x1) != 0))
+    {
+      bits--;
+      continue;
+    }
+
+    break;
+  }
+
+  return ecma_number_from_bits (bits);
+} /* ecma_number_round_decimal */
 
 /**
  * @}
  */
-
 /**
  * Number.MAX_VALUE exponent part when using 64 bit float representation.
  */
@@ -249,6 +350,25 @@ static const uint8_t ecma_uint4_clz[] = { 4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0,
  */
 #define NUMBER_MIN_DECIMAL_EXPONENT -324
 
+/**
+ * Number of the powers of ten which can be represented exactly in an ecma-number.
+ */
+#define ECMA_NUMBER_EXACT_POW10_COUNT 23
+
+/**
+ * Largest integer up to which all integers can be represented exactly in an ecma-number (2^53).
+ */
+#define ECMA_NUMBER_MAX_EXACT_INTEGER (1ull << (ECMA_NUMBER_FRACTION_WIDTH + 1))
+
+/**
+ * Powers of ten which are exactly representable in an ecma-number.
+ */
+static const ecma_number_t ecma_number_exact_pow10[ECMA_NUMBER_EXACT_POW10_COUNT] =
+{
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
 #elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
 
 /**
@@ -400,6 +520,9 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
   uint32_t digits = 0;
   int32_t e = 0;
   bool digit_seen = false;
+  /* The first significant digit which does not fit into fraction_uint64 (or -1). ECMA-262 v5, 9.3.1
+   * allows replacing the significant digits after the 20th with zero, so the rest is ignored. */
+  int32_t extra_digit = -1;
 
   /* Parsing digits before dot (or before end of digits part if there is no dot in number) */
   while (begin_p <= end_p)
@@ -426,6 +549,11 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
       }
       else
       {
+        if (extra_digit < 0)
+        {
+          extra_digit = digit_value;
+        }
+
         e++;
       }
     }
@@ -469,6 +597,10 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
 
         e--;
       }
+      else if (extra_digit < 0)
+      {
+        extra_digit = digit_value;
+      }
 
       begin_p++;
     }
@@ -518,16 +650,20 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
         return ecma_number_make_nan ();
       }
 
-      e_in_lit = e_in_lit * 10 + digit_value;
-      int32_t e_check = e + (int32_t) digits - 1  + (e_in_lit_sign ? -e_in_lit : e_in_lit);
-
-      if (e_check > NUMBER_MAX_DECIMAL_EXPONENT)
+      /* The exponent of zero is irrelevant (and its digits are only validated) */
+      if (digits != 0)
       {
-        return ecma_number_make_infinity (sign);
-      }
-      else if (e_check < NUMBER_MIN_DECIMAL_EXPONENT)
-      {
-        return sign ? -ECMA_NUMBER_ZERO : ECMA_NUMBER_ZERO;
+        e_in_lit = e_in_lit * 10 + digit_value;
+        int32_t e_check = e + (int32_t) digits - 1  + (e_in_lit_sign ? -e_in_lit : e_in_lit);
+
+        if (e_check > NUMBER_MAX_DECIMAL_EXPONENT)
+        {
+          return ecma_number_make_infinity (sign);
+        }
+        else if (e_check < NUMBER_MIN_DECIMAL_EXPONENT)
+        {
+          return sign ? -ECMA_NUMBER_ZERO : ECMA_NUMBER_ZERO;
+        }
       }
 
       begin_p++;
@@ -544,18 +680,6 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
     e += e_in_lit;
   }
 
-  bool e_sign;
-
-  if (e < 0)
-  {
-    e_sign = true;
-    e = -e;
-  }
-  else
-  {
-    e_sign = false;
-  }
-
   if (begin_p <= end_p)
   {
     return ecma_number_make_nan ();
@@ -568,92 +692,103 @@ ecma_utf8_string_to_number (const lit_utf8_byte_t *str_p, /**< utf-8 string */
     return sign ? -ECMA_NUMBER_ZERO : ECMA_NUMBER_ZERO;
   }
 
-#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
-  /*
-   * 128-bit mantissa storage
-   *
-   * Normalized: |4 bits zero|124-bit mantissa with highest bit set to 1|
-   */
-  ecma_uint128_t fraction_uint128 = { 0, fraction_uint64 };
-
-  /* Normalizing mantissa */
-  int shift = 4 - ECMA_UINT128_CLZ_MAX63 (fraction_uint128);
-  if (shift < 0)
+  /* Long digit sequences without exponent literal can be out of range as well */
+  if (e + (int32_t) digits - 1 > NUMBER_MAX_DECIMAL_EXPONENT)
   {
-    ECMA_UINT128_LEFT_SHIFT_MAX63 (fraction_uint128, -shift);
+    return ecma_number_make_infinity (sign);
   }
-  else
+  else if (e + (int32_t) digits - 1 < NUMBER_MIN_DECIMAL_EXPONENT)
   {
-    ECMA_UINT128_RIGHT_SHIFT_MAX63 (fraction_uint128, shift);
+    return sign ? -ECMA_NUMBER_ZERO : ECMA_NUMBER_ZERO;
   }
-  int32_t binary_exponent = 1 + shift;
 
-  if (!e_sign)
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+#if defined (FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+  /*
+   * Fast path: if both the digits and the power of ten are exactly representable, a single
+   * IEEE-754 multiplication or division gives the correctly rounded result (Clinger's algorithm).
+   * Not used when the floating point operations are evaluated with extended precision, since the
+   * double rounding could change the result.
+   */
+  if (extra_digit <= 0 && fraction_uint64 <= ECMA_NUMBER_MAX_EXACT_INTEGER)
   {
-    /* positive or zero decimal exponent */
-    JERRY_ASSERT (e >= 0);
-
-    while (e > 0)
+    if (e < 0 && -e < ECMA_NUMBER_EXACT_POW10_COUNT)
     {
-      JERRY_ASSERT (ECMA_UINT128_CLZ_MAX63 (fraction_uint128) == 4);
-
-      ECMA_UINT128_MUL10 (fraction_uint128);
+      ecma_number_t num = (ecma_number_t) fraction_uint64 / ecma_number_exact_pow10[-e];
+      return sign ? -num : num;
+    }
 
+    /* Moving trailing zeros of the exponent into the digits while they stay exact, e.g. 123e25 */
+    while (e >= ECMA_NUMBER_EXACT_POW10_COUNT && fraction_uint64 <= ECMA_NUMBER_MAX_EXACT_INTEGER / 10)
+    {
+      fraction_uint64 *= 10;
       e--;
+    }
 
-      /* Normalizing mantissa */
-      shift = 4 - ECMA_UINT128_CLZ_MAX4 (fraction_uint128);
-      JERRY_ASSERT (shift >= 0);
-      ECMA_UINT128_RIGHT_SHIFT_MAX63 (fraction_uint128, shift);
-      binary_exponent += shift;
+    if (e >= 0 && e < ECMA_NUMBER_EXACT_POW10_COUNT)
+    {
+      ecma_number_t num = (ecma_number_t) fraction_uint64 * ecma_number_exact_pow10[e];
+      return sign ? -num : num;
     }
   }
-  else
-  {
-    /* negative decimal exponent */
-    JERRY_ASSERT (e != 0);
+#endif /* defined (FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0 */
 
-    while (e > 0)
-    {
-      /* Denormalizing mantissa, moving highest 1 to bit 127 */
-      shift = ECMA_UINT128_CLZ_MAX4 (fraction_uint128);
-      JERRY_ASSERT (shift <= 4);
-      ECMA_UINT128_LEFT_SHIFT_MAX63 (fraction_uint128, shift);
-      binary_exponent -= shift;
+  /* Digits of the number for the exact rounding */
+  ecma_bigint_t decimal_digits;
+  int32_t decimal_exponent = e;
 
-      JERRY_ASSERT (!ECMA_UINT128_IS_ZERO (fraction_uint128));
+  ecma_bigint_init (&decimal_digits, fraction_uint64);
 
-      ECMA_UINT128_DIV10 (fraction_uint128);
+  if (extra_digit > 0)
+  {
+    ecma_bigint_mul_add (&decimal_digits, 10, (uint32_t) extra_digit);
+    decimal_exponent--;
+  }
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
 
-      e--;
-    }
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+  /* Approximating the number with a few floating point operations, which is then rounded exactly */
+  ecma_number_t num = (ecma_number_t) fraction_uint64;
 
-    /* Normalizing mantissa */
-    shift = 4 - ECMA_UINT128_CLZ_MAX4 (fraction_uint128);
-    JERRY_ASSERT (shift >= 0);
-    ECMA_UINT128_RIGHT_SHIFT_MAX63 (fraction_uint128, shift);
-    binary_exponent += shift;
+  while (e >= ECMA_NUMBER_EXACT_POW10_COUNT)
+  {
+    num *= ecma_number_exact_pow10[ECMA_NUMBER_EXACT_POW10_COUNT - 1];
+    e -= ECMA_NUMBER_EXACT_POW10_COUNT - 1;
+  }
 
-    JERRY_ASSERT (ECMA_UINT128_CLZ_MAX63 (fraction_uint128) == 4);
+  while (e <= -ECMA_NUMBER_EXACT_POW10_COUNT)
+  {
+    num /= ecma_number_exact_pow10[ECMA_NUMBER_EXACT_POW10_COUNT - 1];
+    e += ECMA_NUMBER_EXACT_POW10_COUNT - 1;
   }
 
-  JERRY_ASSERT (!ECMA_UINT128_IS_ZERO (fraction_uint128));
-  JERRY_ASSERT (ECMA_UINT128_CLZ_MAX63 (fraction_uint128) == 4);
+  if (e >= 0)
+  {
+    num *= ecma_number_exact_pow10[e];
+  }
+  else
+  {
+    num /= ecma_number_exact_pow10[-e];
+  }
 
-  /*
-   * Preparing mantissa for conversion to 52-bit representation, converting it to:
-   *
-   * |11 zero bits|1|116 mantissa bits|
-   */
-  ECMA_UINT128_RIGHT_SHIFT_MAX63 (fraction_uint128, 7u);
-  binary_exponent += 7;
+  num = ecma_number_round_decimal (&decimal_digits, decimal_exponent, num);
 
-  JERRY_ASSERT (ECMA_UINT128_CLZ_MAX63 (fraction_uint128) == 11);
+  return sign ? -num : num;
+#elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
+  JERRY_UNUSED (extra_digit);
 
-  fraction_uint64 = ECMA_UINT128_ROUND_HIGH_TO_UINT64 (fraction_uint128);
+  bool e_sign;
+
+  if (e < 0)
+  {
+    e_sign = true;
+    e = -e;
+  }
+  else
+  {
+    e_sign = false;
+  }
 
-  return ecma_number_make_from_sign_mantissa_and_exponent (sign, fraction_uint64, binary_exponent);
-#elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
   /* Less precise conversion */
   ecma_number_t num = (ecma_number_t) (uint32_t) fraction_uint64;
 
@@ -839,7 +974,7 @@ ecma_number_to_decimal (ecma_number_t num, /**< ecma-number */
   JERRY_ASSERT (!ecma_number_is_infinity (num));
   JERRY_ASSERT (!ecma_number_is_negative (num));
 
-  return ecma_errol0_dtoa ((double) num, out_digits_p, out_decimal_exp_p);
+  return ecma_ryu_dtoa ((double) num, out_digits_p, out_decimal_exp_p);
 } /* ecma_number_to_decimal */
 
 /**
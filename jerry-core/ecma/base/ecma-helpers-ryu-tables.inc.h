@@ -0,0 +1,87 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* This file is automatically generated by the gen-ryu-tables.py script. Do not edit! */
+
+
+/* Powers of five which fit into 64 bits. */
+static const uint64_t ecma_number_pow5_table[26] JERRY_CONST_DATA =
+{
+  0x0000000000000001ull, 0x0000000000000005ull, 0x0000000000000019ull,
+  0x000000000000007dull, 0x0000000000000271ull, 0x0000000000000c35ull,
+  0x0000000000003d09ull, 0x000000000001312dull, 0x000000000005f5e1ull,
+  0x00000000001dcd65ull, 0x00000000009502f9ull, 0x0000000002e90eddull,
+  0x000000000e8d4a51ull, 0x0000000048c27395ull, 0x000000016bcc41e9ull,
+  0x000000071afd498dull, 0x0000002386f26fc1ull, 0x000000b1a2bc2ec5ull,
+  0x000003782dace9d9ull, 0x00001158e460913dull, 0x000056bc75e2d631ull,
+  0x0001b1ae4d6e2ef5ull, 0x000878678326eac9ull, 0x002a5a058fc295edull,
+  0x00d3c21bcecceda1ull, 0x0422ca8b0a00a425ull
+};
+
+/* Every 26-th power of five normalized to 125 bits, low and high half. */
+static const uint64_t ecma_number_pow5_split[13][2] JERRY_CONST_DATA =
+{
+  { 0x0000000000000000ull, 0x1000000000000000ull },
+  { 0x0000000000000000ull, 0x14adf4b7320334b9ull },
+  { 0x0e549208b31adb10ull, 0x1aba4714957d300dull },
+  { 0x6dc6ad264d8f0866ull, 0x1145b7e285bf98f5ull },
+  { 0xeb1dbd923d8596caull, 0x1652efdc6018a1fcull },
+  { 0xb4c1b80b22ae923cull, 0x1cda62055b2d9d83ull },
+  { 0x5bb28b4e8f7e4c30ull, 0x12a5568b9f52f416ull },
+  { 0xf08aed437682d4fbull, 0x1819651531f9e78full },
+  { 0xb4ee134ad99bf150ull, 0x1f25c186a6f04c28ull },
+  { 0x16499ecb70c25f03ull, 0x1420eb449c8842e6ull },
+  { 0x85a56ead360865b0ull, 0x1a03fde214caf085ull },
+  { 0x093db1d57999890bull, 0x10cfeb353a97dad8ull },
+  { 0xcf38bb735e3f36acull, 0x15baaf44fa52673eull }
+};
+
+/* Corrections of the computed powers of five, two bits per power. */
+static const uint32_t ecma_number_pow5_offsets[21] JERRY_CONST_DATA =
+{
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x59695995,
+  0x55545555, 0x56555515, 0x41150504, 0x40555410, 0x44555145, 0x44504540,
+  0x45555550, 0x40004000, 0x96440440, 0x55565565, 0x54454045, 0x40154151,
+  0x55559155, 0x51405555, 0x00000105
+};
+
+/* Every 26-th inverse power of five normalized to 125 bits, low and high half. */
+static const uint64_t ecma_number_pow5_inv_split[15][2] JERRY_CONST_DATA =
+{
+  { 0x0000000000000001ull, 0x2000000000000000ull },
+  { 0x52a6c95fc0655034ull, 0x18c240c4aecb13bbull },
+  { 0x7ca8d50071dfc806ull, 0x1327fc58da0f6ff5ull },
+  { 0x6520247d3556476eull, 0x1da48ce468e7c702ull },
+  { 0x6139cdd76802e6e9ull, 0x16ef5b40c2fc7779ull },
+  { 0xf951a7ff43de8c79ull, 0x11bebdf578b2f391ull },
+  { 0x7be8bee8d6e957e8ull, 0x1b758d848fac54b0ull },
+  { 0x8bd3f9e999a423eaull, 0x153eda614071a3b7ull },
+  { 0x0848f973cb3ee3ceull, 0x10701bd527b4978cull },
+  { 0x153285ebb9efbfa2ull, 0x196fbb9bb44db44dull },
+  { 0xadeee7f86c07b696ull, 0x13ae3591f5b4d936ull },
+  { 0x4d686a4eaf182222ull, 0x1e74404f3daada91ull },
+  { 0x98c0a106e09ebd9full, 0x17900ea4fda7c257ull },
+  { 0x8f20e37371497d0eull, 0x123b140576d820b2ull },
+  { 0xb043138134743d85ull, 0x1c35f4275f7a29adull }
+};
+
+/* Corrections of the computed inverse powers of five, two bits per power. */
+static const uint32_t ecma_number_pow5_inv_offsets[22] JERRY_CONST_DATA =
+{
+  0x54544554, 0x04055545, 0x10041000, 0x00400414, 0x40010000, 0x41155555,
+  0x00000454, 0x00010044, 0x40000000, 0x44000041, 0x50454450, 0x55550054,
+  0x51655554, 0x40004000, 0x01000001, 0x00010500, 0x51515411, 0x05555554,
+  0x50411500, 0x40040000, 0x05040110, 0x00000000
+};
@@ -0,0 +1,513 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * This file is based on work under the following copyright and permission
+ * notice:
+ *
+ *   Copyright 2018 Ulf Adams
+ *
+ *   The contents of this file may be used under the terms of the Apache License,
+ *   Version 2.0.
+ *
+ *      (See accompanying file LICENSE-Apache or copy at
+ *       http://www.apache.org/licenses/LICENSE-2.0)
+ *
+ *   Unless required by applicable law or agreed to in writing, this software
+ *   is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *   KIND, either express or implied.
+ */
+
+#include "ecma-helpers.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmahelpers Helpers for operations with ECMA data types
+ * @{
+ */
+
+/**
+ * Ryu: Fast Float-to-String Conversion
+ *
+ * available at https://dl.acm.org/citation.cfm?id=3192369
+ *
+ * The algorithm computes the shortest decimal representation which rounds back to
+ * the same double value, and the closest one to the exact value if there are more.
+ * Only 64 bit integer arithmetic is used, 128 bit products are computed from 32 bit
+ * halves, so the code does not depend on compiler specific 128 bit integer types.
+ */
+
+#include "ecma-helpers-ryu-tables.inc.h"
+
+/**
+ * Number of explicitly stored mantissa bits of a double
+ */
+#define ECMA_RYU_MANTISSA_BITS 52
+
+/**
+ * Exponent bias of a double
+ */
+#define ECMA_RYU_EXPONENT_BIAS 1023
+
+/**
+ * Number of bits of the normalized (inverse) powers of five
+ */
+#define ECMA_RYU_POW5_BITCOUNT 125
+
+/**
+ * Number of consecutive powers of five which are computed from a stored one
+ */
+#define ECMA_RYU_POW5_TABLE_SIZE 26
+
+/**
+ * Get the number of bits of 5^exp, for 0 <= exp <= 3528.
+ *
+ * @return bit length of 5^exp (1 for exp == 0)
+ */
+static inline int32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_ryu_pow5_bits (int32_t exp) /**< exponent */
+{
+  JERRY_ASSERT (exp >= 0 && exp <= 3528);
+  return (int32_t) (((uint32_t) exp * 1217359u) >> 19) + 1;
+} /* ecma_ryu_pow5_bits */
+
+/**
+ * Get floor (log10 (2^exp)), for 0 <= exp <= 1650.
+ *
+ * @return decimal logarithm
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_ryu_log10_pow2 (int32_t exp) /**< exponent */
+{
+  JERRY_ASSERT (exp >= 0 && exp <= 1650);
+  return ((uint32_t) exp * 78913u) >> 18;
+} /* ecma_ryu_log10_pow2 */
+
+/**
+ * Get floor (log10 (5^exp)), for 0 <= exp <= 2620.
+ *
+ * @return decimal logarithm
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_ryu_log10_pow5 (int32_t exp) /**< exponent */
+{
+  JERRY_ASSERT (exp >= 0 && exp <= 2620);
+  return ((uint32_t) exp * 732923u) >> 20;
+} /* ecma_ryu_log10_pow5 */
+
+/**
+ * Check whether the value is divisible by 5^p.
+ *
+ * @return true - if the value is divisible,
+ *         false - otherwise
+ */
+static bool
+ecma_ryu_is_multiple_of_pow5 (uint64_t value, /**< value */
+                              uint32_t p) /**< exponent */
+{
+  JERRY_ASSERT (value != 0);
+
+  uint32_t count = 0;
+
+  while (value % 5 == 0)
+  {
+    value /= 5;
+    count++;
+  }
+
+  return count >= p;
+} /* ecma_ryu_is_multiple_of_pow5 */
+
+/**
+ * Check whether the value is divisible by 2^p.
+ *
+ * @return true - if the value is divisible,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_ryu_is_multiple_of_pow2 (uint64_t value, /**< value */
+                              uint32_t p) /**< exponent, less than 64 */
+{
+  JERRY_ASSERT (p < 64);
+  return (value & ((1ull << p) - 1)) == 0;
+} /* ecma_ryu_is_multiple_of_pow2 */
+
+/**
+ * Multiply two 64 bit values.
+ *
+ * @return low half of the 128 bit product
+ */
+static inline uint64_t JERRY_ATTR_ALWAYS_INLINE
+ecma_ryu_umul128 (uint64_t a, /**< first operand */
+                  uint64_t b, /**< second operand */
+                  uint64_t *high_p) /**< [out] high half of the product */
+{
+  const uint64_t a_low = (uint32_t) a;
+  const uint64_t a_high = a >> 32;
+  const uint64_t b_low = (uint32_t) b;
+  const uint64_t b_high = b >> 32;
+
+  const uint64_t b00 = a_low * b_low;
+  const uint64_t b01 = a_low * b_high;
+  const uint64_t b10 = a_high * b_low;
+  const uint64_t b11 = a_high * b_high;
+
+  const uint64_t mid1 = b10 + (b00 >> 32);
+  const uint64_t mid2 = b01 + (uint32_t) mid1;
+
+  *high_p = b11 + (mid1 >> 32) + (mid2 >> 32);
+  return (mid2 << 32) | (uint32_t) b00;
+} /* ecma_ryu_umul128 */
+
+/**
+ * Shift a 128 bit value right, for 0 < dist < 64.
+ *
+ * @return low 64 bit of the shifted value
+ */
+static inline uint64_t JERRY_ATTR_ALWAYS_INLINE
+ecma_ryu_shift_right128 (uint64_t low, /**< low half */
+                         uint64_t high, /**< high half */
+                         int32_t dist) /**< shift distance */
+{
+  JERRY_ASSERT (dist > 0 && dist < 64);
+  return (high << (64 - dist)) | (low >> dist);
+} /* ecma_ryu_shift_right128 */
+
+/**
+ * Compute 5^i normalized to ECMA_RYU_POW5_BITCOUNT bits.
+ */
+static void
+ecma_ryu_compute_pow5 (uint32_t i, /**< exponent */
+                       uint64_t *result_p) /**< [out] low and high half of the power */
+{
+  const uint32_t base = i / ECMA_RYU_POW5_TABLE_SIZE;
+  const uint32_t base2 = base * ECMA_RYU_POW5_TABLE_SIZE;
+  const uint64_t *mul_p = ecma_number_pow5_split[base];
+
+  JERRY_ASSERT (base < sizeof (ecma_number_pow5_split) / sizeof (ecma_number_pow5_split[0]));
+
+  if (i == base2)
+  {
+    result_p[0] = mul_p[0];
+    result_p[1] = mul_p[1];
+    return;
+  }
+
+  const uint64_t m = ecma_number_pow5_table[i - base2];
+  uint64_t high1;
+  const uint64_t low1 = ecma_ryu_umul128 (m, mul_p[1], &high1);
+  uint64_t high0;
+  const uint64_t low0 = ecma_ryu_umul128 (m, mul_p[0], &high0);
+  const uint64_t sum = high0 + low1;
+
+  if (sum < high0)
+  {
+    high1++;
+  }
+
+  const int32_t delta = ecma_ryu_pow5_bits ((int32_t) i) - ecma_ryu_pow5_bits ((int32_t) base2);
+  const uint32_t offset = (ecma_number_pow5_offsets[i / 16] >> ((i % 16) << 1)) & 0x3;
+
+  result_p[0] = ecma_ryu_shift_right128 (low0, sum, delta) + offset;
+  result_p[1] = ecma_ryu_shift_right128 (sum, high1, delta);
+} /* ecma_ryu_compute_pow5 */
+
+/**
+ * Compute the inverse of 5^i normalized to ECMA_RYU_POW5_BITCOUNT bits.
+ */
+static void
+ecma_ryu_compute_inv_pow5 (uint32_t i, /**< exponent */
+                           uint64_t *result_p) /**< [out] low and high half of the inverse power */
+{
+  const uint32_t base = (i + ECMA_RYU_POW5_TABLE_SIZE - 1) / ECMA_RYU_POW5_TABLE_SIZE;
+  const uint32_t base2 = base * ECMA_RYU_POW5_TABLE_SIZE;
+  const uint64_t *mul_p = ecma_number_pow5_inv_split[base];
+
+  JERRY_ASSERT (base < sizeof (ecma_number_pow5_inv_split) / sizeof (ecma_number_pow5_inv_split[0]));
+
+  if (i == base2)
+  {
+    result_p[0] = mul_p[0];
+    result_p[1] = mul_p[1];
+    return;
+  }
+
+  const uint64_t m = ecma_number_pow5_table[base2 - i];
+  uint64_t high1;
+  const uint64_t low1 = ecma_ryu_umul128 (m, mul_p[1], &high1);
+  uint64_t high0;
+  const uint64_t low0 = ecma_ryu_umul128 (m, mul_p[0] - 1, &high0);
+  const uint64_t sum = high0 + low1;
+
+  if (sum < high0)
+  {
+    high1++;
+  }
+
+  const int32_t delta = ecma_ryu_pow5_bits ((int32_t) base2) - ecma_ryu_pow5_bits ((int32_t) i);
+  const uint32_t offset = (ecma_number_pow5_inv_offsets[i / 16] >> ((i % 16) << 1)) & 0x3;
+
+  result_p[0] = ecma_ryu_shift_right128 (low0, sum, delta) + 1 + offset;
+  result_p[1] = ecma_ryu_shift_right128 (sum, high1, delta);
+} /* ecma_ryu_compute_inv_pow5 */
+
+/**
+ * Multiply the value with a normalized power and shift the product right by j bits.
+ *
+ * @return bits j .. j + 63 of the product
+ */
+static inline uint64_t JERRY_ATTR_ALWAYS_INLINE
+ecma_ryu_mul_shift64 (uint64_t m, /**< value, at most 55 bits */
+                      const uint64_t *mul_p, /**< normalized power */
+                      int32_t j) /**< shift distance, at least 64 */
+{
+  uint64_t high1;
+  const uint64_t low1 = ecma_ryu_umul128 (m, mul_p[1], &high1);
+  uint64_t high0;
+  ecma_ryu_umul128 (m, mul_p[0], &high0);
+  const uint64_t sum = high0 + low1;
+
+  if (sum < high0)
+  {
+    high1++;
+  }
+
+  return ecma_ryu_shift_right128 (sum, high1, j - 64);
+} /* ecma_ryu_mul_shift64 */
+
+/**
+ * Get the number of decimal digits of a value with at most 17 digits.
+ *
+ * @return number of digits
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_ryu_decimal_length (uint64_t value) /**< value */
+{
+  JERRY_ASSERT (value < 100000000000000000ull);
+
+  uint32_t length = 1;
+  uint64_t limit = 10;
+
+  while (length < 17 && value >= limit)
+  {
+    length++;
+    limit *= 10;
+  }
+
+  return length;
+} /* ecma_ryu_decimal_length */
+
+/**
+ * Ryu double to ASCII conversion, computes the shortest digits which round back to the value.
+ *
+ * @return number of generated digits
+ */
+lit_utf8_size_t
+ecma_ryu_dtoa (double val, /**< ecma number, positive and finite */
+               lit_utf8_byte_t *buffer_p, /**< buffer to generate digits into */
+               int32_t *exp_p) /**< [out] exponent */
+{
+  union
+  {
+    double value;
+    uint64_t bits;
+  } u;
+
+  u.value = val;
+
+  const uint64_t ieee_mantissa = u.bits & ((1ull << ECMA_RYU_MANTISSA_BITS) - 1);
+  const uint32_t ieee_exponent = (uint32_t) (u.bits >> ECMA_RYU_MANTISSA_BITS) & 0x7ff;
+
+  JERRY_ASSERT ((u.bits >> 63) == 0 && ieee_exponent != 0x7ff && (ieee_exponent | ieee_mantissa) != 0);
+
+  /* Step 1: decode the value as m2 * 2^e2, with two extra bits for the bounds. */
+  int32_t e2;
+  uint64_t m2;
+
+  if (ieee_exponent == 0)
+  {
+    e2 = 1 - ECMA_RYU_EXPONENT_BIAS - ECMA_RYU_MANTISSA_BITS - 2;
+    m2 = ieee_mantissa;
+  }
+  else
+  {
+    e2 = (int32_t) ieee_exponent - ECMA_RYU_EXPONENT_BIAS - ECMA_RYU_MANTISSA_BITS - 2;
+    m2 = (1ull << ECMA_RYU_MANTISSA_BITS) | ieee_mantissa;
+  }
+
+  /* The bounds belong to the interval if the mantissa is even (round half to even). */
+  const bool accept_bounds = (m2 & 0x1) == 0;
+
+  /* Step 2: the interval of the valid representations is (4 * m2 - 1 - mm_shift, 4 * m2 + 2). */
+  const uint64_t mv = 4 * m2;
+  const uint32_t mm_shift = (ieee_mantissa != 0 || ieee_exponent <= 1) ? 1 : 0;
+
+  /* Step 3: convert the interval to a decimal power base. */
+  uint64_t vr, vp, vm;
+  uint64_t pow5[2];
+  int32_t e10;
+  bool vm_is_trailing_zeros = false;
+  bool vr_is_trailing_zeros = false;
+
+  if (e2 >= 0)
+  {
+    const uint32_t q = ecma_ryu_log10_pow2 (e2) - (e2 > 3);
+    const int32_t k = ECMA_RYU_POW5_BITCOUNT + ecma_ryu_pow5_bits ((int32_t) q) - 1;
+    const int32_t i = -e2 + (int32_t) q + k;
+
+    e10 = (int32_t) q;
+    ecma_ryu_compute_inv_pow5 (q, pow5);
+
+    vr = ecma_ryu_mul_shift64 (mv, pow5, i);
+    vp = ecma_ryu_mul_shift64 (mv + 2, pow5, i);
+    vm = ecma_ryu_mul_shift64 (mv - 1 - mm_shift, pow5, i);
+
+    if (q <= 21)
+    {
+      /* Only one of mp, mv, and mm can be a multiple of 5, if any. */
+      if (mv % 5 == 0)
+      {
+        vr_is_trailing_zeros = ecma_ryu_is_multiple_of_pow5 (mv, q);
+      }
+      else if (accept_bounds)
+      {
+        vm_is_trailing_zeros = ecma_ryu_is_multiple_of_pow5 (mv - 1 - mm_shift, q);
+      }
+      else
+      {
+        vp -= ecma_ryu_is_multiple_of_pow5 (mv + 2, q);
+      }
+    }
+  }
+  else
+  {
+    const uint32_t q = ecma_ryu_log10_pow5 (-e2) - (-e2 > 1);
+    const int32_t i = -e2 - (int32_t) q;
+    const int32_t k = ecma_ryu_pow5_bits (i) - ECMA_RYU_POW5_BITCOUNT;
+    const int32_t j = (int32_t) q - k;
+
+    e10 = (int32_t) q + e2;
+    ecma_ryu_compute_pow5 ((uint32_t) i, pow5);
+
+    vr = ecma_ryu_mul_shift64 (mv, pow5, j);
+    vp = ecma_ryu_mul_shift64 (mv + 2, pow5, j);
+    vm = ecma_ryu_mul_shift64 (mv - 1 - mm_shift, pow5, j);
+
+    if (q <= 1)
+    {
+      /* mv = 4 * m2 always has at least two trailing zero bits. */
+      vr_is_trailing_zeros = true;
+
+      if (accept_bounds)
+      {
+        /* mm = mv - 1 - mm_shift has a trailing zero bit if mm_shift is 1. */
+        vm_is_trailing_zeros = (mm_shift == 1);
+      }
+      else
+      {
+        /* mp = mv + 2 always has at least one trailing zero bit. */
+        vp--;
+      }
+    }
+    else if (q < 63)
+    {
+      vr_is_trailing_zeros = ecma_ryu_is_multiple_of_pow2 (mv, q);
+    }
+  }
+
+  /* Step 4: find the shortest representation in the interval. */
+  int32_t removed = 0;
+  uint8_t last_removed_digit = 0;
+  uint64_t output;
+
+  if (vm_is_trailing_zeros || vr_is_trailing_zeros)
+  {
+    /* General case, which happens rarely. */
+    while (vp / 10 > vm / 10)
+    {
+      vm_is_trailing_zeros &= (vm % 10 == 0);
+      vr_is_trailing_zeros &= (last_removed_digit == 0);
+      last_removed_digit = (uint8_t) (vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      removed++;
+    }
+
+    if (vm_is_trailing_zeros)
+    {
+      while (vm % 10 == 0)
+      {
+        vr_is_trailing_zeros &= (last_removed_digit == 0);
+        last_removed_digit = (uint8_t) (vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        removed++;
+      }
+    }
+
+    if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
+    {
+      /* Round to even if the exact value is .....50..0. */
+      last_removed_digit = 4;
+    }
+
+    /* Take vr + 1 if vr is outside the bounds or it needs to be rounded up. */
+    output = vr + (((vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) || last_removed_digit >= 5) ? 1 : 0);
+  }
+  else
+  {
+    /* Common case, the digits can be removed without tracking the trailing zeros. */
+    bool round_up = false;
+
+    if (vp / 100 > vm / 100)
+    {
+      round_up = (vr % 100) >= 50;
+      vr /= 100;
+      vp /= 100;
+      vm /= 100;
+      removed += 2;
+    }
+
+    while (vp / 10 > vm / 10)
+    {
+      round_up = (vr % 10) >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      removed++;
+    }
+
+    /* Take vr + 1 if vr is outside the bounds or it needs to be rounded up. */
+    output = vr + ((vr == vm || round_up) ? 1 : 0);
+  }
+
+  /* Step 5: print the digits. */
+  const uint32_t length = ecma_ryu_decimal_length (output);
+
+  for (uint32_t i = length; i > 0; i--)
+  {
+    buffer_p[i - 1] = (lit_utf8_byte_t) ('0' + (output % 10));
+    output /= 10;
+  }
+
+  *exp_p = e10 + removed + (int32_t) length;
+  return (lit_utf8_size_t) length;
+} /* ecma_ryu_dtoa */
+
+/**
+ * @}
+ * @}
+ */
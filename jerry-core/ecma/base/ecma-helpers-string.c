@@ -17,6 +17,7 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
@@ -164,6 +165,11 @@ ecma_string_get_chars_fast (const ecma_string_t *string_p, /**< ecma-string */
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
       return (const lit_utf8_byte_t *) (long_string_p + 1);
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      *size_p = string_p->u.long_utf8_string_size;
+      return ((ecma_external_string_t *) string_p)->data_p;
+    }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
@@ -235,17 +241,15 @@ ecma_prop_name_is_symbol (ecma_string_t *string_p) /**< ecma-string */
 #endif /* !CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN */
 
 /**
- * Allocate new ecma-string and fill it with characters from the utf8 string
+ * Get the magic, array index or external magic string which is equal to a cesu8 string
  *
- * @return pointer to ecma-string descriptor
+ * @return pointer to ecma-string descriptor - if such a string exists
+ *         NULL - otherwise
  */
-ecma_string_t *
-ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 string */
-                                lit_utf8_size_t string_size) /**< string size */
+static inline ecma_string_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_find_special_string (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                          lit_utf8_size_t string_size) /**< string size */
 {
-  JERRY_ASSERT (string_p != NULL || string_size == 0);
-  JERRY_ASSERT (lit_is_valid_cesu8_string (string_p, string_size));
-
   lit_magic_string_id_t magic_string_id = lit_is_utf8_string_magic (string_p, string_size);
 
   if (magic_string_id != LIT_MAGIC_STRING__COUNT)
@@ -275,7 +279,28 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
     }
   }
 
-  ecma_string_t *string_desc_p;
+  return NULL;
+} /* ecma_find_special_string */
+
+/**
+ * Allocate new ecma-string and fill it with characters from the utf8 string
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 string */
+                                lit_utf8_size_t string_size) /**< string size */
+{
+  JERRY_ASSERT (string_p != NULL || string_size == 0);
+  JERRY_ASSERT (lit_is_valid_cesu8_string (string_p, string_size));
+
+  ecma_string_t *string_desc_p = ecma_find_special_string (string_p, string_size);
+
+  if (string_desc_p != NULL)
+  {
+    return string_desc_p;
+  }
+
   lit_utf8_byte_t *data_p;
 
   if (JERRY_LIKELY (string_size <= UINT16_MAX))
@@ -308,6 +333,63 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
   return string_desc_p;
 } /* ecma_new_ecma_string_from_utf8 */
 
+/**
+ * Allocate new ecma-string which refers to a cesu8 string stored in host memory
+ *
+ * Note:
+ *   the free callback is called with the string pointer when the characters are no longer
+ *   referenced by the engine, which happens immediately when the string is short or equal
+ *   to a magic string (these strings are copied or represented without a buffer)
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_external_string_from_cesu8 (const lit_utf8_byte_t *string_p, /**< cesu-8 string */
+                                          lit_utf8_size_t string_size, /**< string size */
+                                          ecma_object_native_free_callback_t free_cb) /**< free callback */
+{
+  JERRY_ASSERT (string_p != NULL || string_size == 0);
+  JERRY_ASSERT (lit_is_valid_cesu8_string (string_p, string_size));
+
+  ecma_string_t *string_desc_p;
+
+  if (string_size < ECMA_EXTERNAL_STRING_MIN_SIZE)
+  {
+    string_desc_p = ecma_new_ecma_string_from_utf8 (string_p, string_size);
+  }
+  else
+  {
+    string_desc_p = ecma_find_special_string (string_p, string_size);
+  }
+
+  if (string_desc_p != NULL)
+  {
+    if (free_cb != NULL)
+    {
+      free_cb ((void *) string_p);
+    }
+
+    return string_desc_p;
+  }
+
+  ecma_external_string_t *external_string_p;
+  external_string_p = (ecma_external_string_t *) ecma_alloc_string_buffer (sizeof (ecma_external_string_t));
+
+  string_desc_p = &external_string_p->header.header;
+  string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING | ECMA_STRING_REF_ONE;
+  string_desc_p->hash = lit_utf8_string_calc_hash (string_p, string_size);
+  string_desc_p->u.long_utf8_string_size = string_size;
+
+  external_string_p->header.long_utf8_string_length = lit_utf8_string_length (string_p, string_size);
+  external_string_p->data_p = string_p;
+  external_string_p->free_cb = free_cb;
+
+#ifdef JERRY_HEAP_IMAGE
+  JERRY_CONTEXT (ecma_external_string_count)++;
+#endif /* JERRY_HEAP_IMAGE */
+  return string_desc_p;
+} /* ecma_new_ecma_external_string_from_cesu8 */
+
 /**
  * Allocate a new ecma-string and initialize it from the utf8 string argument.
  * All 4-bytes long unicode sequences are converted into two 3-bytes long sequences.
@@ -476,9 +558,73 @@ ecma_get_ecma_string_from_uint32 (uint32_t uint32_number) /**< input number */
   return (ecma_string_t *) ECMA_CREATE_DIRECT_STRING (ECMA_DIRECT_STRING_UINT, (uintptr_t) uint32_number);
 } /* ecma_get_ecma_string_from_uint32 */
 
+#ifndef CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE
+/**
+ * Get the index of the number in the number to string conversion cache.
+ *
+ * @return index of the cache entry
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_number_string_cache_get_index (ecma_number_t num) /**< ecma-number */
+{
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
+  uint32_t bits;
+  memcpy (&bits, &num, sizeof (bits));
+#else /* CONFIG_ECMA_NUMBER_TYPE != CONFIG_ECMA_NUMBER_FLOAT32 */
+  uint64_t bits64;
+  memcpy (&bits64, &num, sizeof (bits64));
+  uint32_t bits = (uint32_t) (bits64 ^ (bits64 >> 32));
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32 */
+
+  bits ^= bits >> 16;
+  bits ^= bits >> 8;
+  bits ^= bits >> 4;
+  return bits & (ECMA_NUMBER_STRING_CACHE_SIZE - 1);
+} /* ecma_number_string_cache_get_index */
+
+/**
+ * Free the strings of the number to string conversion cache which are referenced only by the cache.
+ */
+void
+ecma_number_string_cache_gc_run (void)
+{
+  for (uint32_t i = 0; i < ECMA_NUMBER_STRING_CACHE_SIZE; i++)
+  {
+    ecma_string_t *string_p = JERRY_CONTEXT (number_string_cache)[i].string_p;
+
+    if (string_p != NULL
+        && string_p->refs_and_container < 2 * ECMA_STRING_REF_ONE)
+    {
+      ecma_deref_ecma_string (string_p);
+      JERRY_CONTEXT (number_string_cache)[i].string_p = NULL;
+    }
+  }
+} /* ecma_number_string_cache_gc_run */
+
+/**
+ * Release all strings of the number to string conversion cache.
+ */
+void
+ecma_number_string_cache_flush (void)
+{
+  for (uint32_t i = 0; i < ECMA_NUMBER_STRING_CACHE_SIZE; i++)
+  {
+    if (JERRY_CONTEXT (number_string_cache)[i].string_p != NULL)
+    {
+      ecma_deref_ecma_string (JERRY_CONTEXT (number_string_cache)[i].string_p);
+      JERRY_CONTEXT (number_string_cache)[i].string_p = NULL;
+    }
+  }
+} /* ecma_number_string_cache_flush */
+#endif /* !CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE */
+
 /**
  * Allocate new ecma-string and fill it with ecma-number
  *
+ * Note:
+ *      strings of non-integer numbers are kept in a small direct-mapped cache,
+ *      so converting the same number repeatedly returns the same string
+ *
  * @return pointer to ecma-string descriptor
  */
 ecma_string_t *
@@ -502,6 +648,21 @@ ecma_new_ecma_string_from_number (ecma_number_t num) /**< ecma-number */
     return ecma_get_magic_string (id);
   }
 
+#ifndef CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE
+  ecma_number_string_cache_entry_t *entry_p;
+  entry_p = JERRY_CONTEXT (number_string_cache) + ecma_number_string_cache_get_index (num);
+
+  if (entry_p->string_p != NULL && entry_p->number == num)
+  {
+    /* The string is not shared any further when it has many references. */
+    if (JERRY_LIKELY (entry_p->string_p->refs_and_container < ECMA_STRING_MAX_REF / 2))
+    {
+      ecma_ref_ecma_string (entry_p->string_p);
+      return entry_p->string_p;
+    }
+  }
+#endif /* !CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE */
+
   lit_utf8_byte_t str_buf[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
   lit_utf8_size_t str_size = ecma_number_to_utf8_string (num, str_buf, sizeof (str_buf));
 
@@ -521,6 +682,18 @@ ecma_new_ecma_string_from_number (ecma_number_t num) /**< ecma-number */
 
   lit_utf8_byte_t *data_p = (lit_utf8_byte_t *) (string_desc_p + 1);
   memcpy (data_p, str_buf, str_size);
+
+#ifndef CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE
+  if (entry_p->string_p != NULL)
+  {
+    ecma_deref_ecma_string (entry_p->string_p);
+  }
+
+  entry_p->number = num;
+  entry_p->string_p = string_desc_p;
+  ecma_ref_ecma_string (string_desc_p);
+#endif /* !CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE */
+
   return string_desc_p;
 } /* ecma_new_ecma_string_from_number */
 
@@ -628,6 +801,15 @@ ecma_append_chars_to_string (ecma_string_t *string1_p, /**< base ecma-string */
         cesu8_string1_length = long_string_desc_p->long_utf8_string_length;
         break;
       }
+      case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+      {
+        ecma_external_string_t *external_string_desc_p = (ecma_external_string_t *) string1_p;
+
+        cesu8_string1_p = external_string_desc_p->data_p;
+        cesu8_string1_size = string1_p->u.long_utf8_string_size;
+        cesu8_string1_length = external_string_desc_p->header.long_utf8_string_length;
+        break;
+      }
       case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
       {
         cesu8_string1_size = ecma_uint32_to_utf8_string (string1_p->u.uint32_number,
@@ -840,6 +1022,15 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
         cesu8_string2_length = long_string_desc_p->long_utf8_string_length;
         break;
       }
+      case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+      {
+        ecma_external_string_t *external_string_desc_p = (ecma_external_string_t *) string2_p;
+
+        cesu8_string2_p = external_string_desc_p->data_p;
+        cesu8_string2_size = string2_p->u.long_utf8_string_size;
+        cesu8_string2_length = external_string_desc_p->header.long_utf8_string_length;
+        break;
+      }
       case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
       {
         cesu8_string2_size = ecma_uint32_to_utf8_string (string2_p->u.uint32_number,
@@ -965,6 +1156,23 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       ecma_dealloc_string_buffer (string_p, string_p->u.long_utf8_string_size + sizeof (ecma_long_string_t));
       return;
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      ecma_external_string_t *external_string_p = (ecma_external_string_t *) string_p;
+
+      if (external_string_p->free_cb != NULL)
+      {
+        external_string_p->free_cb ((void *) external_string_p->data_p);
+      }
+
+      ecma_dealloc_string_buffer (string_p, sizeof (ecma_external_string_t));
+
+#ifdef JERRY_HEAP_IMAGE
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_external_string_count) > 0);
+      JERRY_CONTEXT (ecma_external_string_count)--;
+#endif /* JERRY_HEAP_IMAGE */
+      return;
+    }
     case ECMA_STRING_LITERAL_NUMBER:
     {
       ecma_free_value (string_p->u.lit_number);
@@ -1523,6 +1731,14 @@ ecma_string_get_chars (const ecma_string_t *string_p, /**< ecma-string */
         result_p = (const lit_utf8_byte_t *) (long_string_p + 1);
         break;
       }
+      case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+      {
+        size = string_p->u.long_utf8_string_size;
+        ecma_external_string_t *external_string_p = (ecma_external_string_t *) string_p;
+        length = external_string_p->header.long_utf8_string_length;
+        result_p = external_string_p->data_p;
+        break;
+      }
       case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
       {
         size = (lit_utf8_size_t) ecma_string_get_uint32_size (string_p->u.uint32_number);
@@ -1562,6 +1778,87 @@ ecma_string_get_chars (const ecma_string_t *string_p, /**< ecma-string */
   return result_p;
 } /* ecma_string_get_chars */
 
+/**
+ * Checks whether the characters of an ecma-string are stored as a number.
+ *
+ * @return true - if the string is an uint32 string
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_string_is_uint32 (const ecma_string_t *string_p) /**< ecma-string */
+{
+  if (ECMA_IS_DIRECT_STRING (string_p))
+  {
+    return ECMA_GET_DIRECT_STRING_TYPE (string_p) == ECMA_DIRECT_STRING_UINT;
+  }
+
+  return ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC;
+} /* ecma_string_is_uint32 */
+
+/**
+ * Get the utf-8 encoded characters of an ecma-string.
+ *
+ * Note:
+ *   - The characters are not copied if the string is stored as a contiguous
+ *     cesu-8 buffer which is also a valid utf-8 string (it has no surrogate pairs).
+ *   - The returned buffer must be released by ecma_string_release_utf8_chars.
+ *
+ * @return start of utf-8 characters - if success
+ *         NULL - if the characters must be copied and there is not enough memory
+ */
+const lit_utf8_byte_t *
+ecma_string_borrow_utf8_chars (const ecma_string_t *string_p, /**< ecma-string */
+                               lit_utf8_size_t *size_p) /**< [out] size of the utf-8 characters */
+{
+  lit_utf8_size_t utf8_size = ecma_string_get_utf8_size (string_p);
+
+  if (!ecma_string_is_uint32 (string_p))
+  {
+    lit_utf8_size_t size;
+    const lit_utf8_byte_t *chars_p = ecma_string_get_chars_fast (string_p, &size);
+
+    if (size == utf8_size)
+    {
+      *size_p = size;
+      return chars_p;
+    }
+  }
+
+  lit_utf8_byte_t *buffer_p = (lit_utf8_byte_t *) jmem_heap_alloc_block_null_on_error (utf8_size);
+
+  if (JERRY_UNLIKELY (buffer_p == NULL))
+  {
+    *size_p = 0;
+    return NULL;
+  }
+
+  *size_p = ecma_string_copy_to_utf8_buffer (string_p, buffer_p, utf8_size);
+
+  JERRY_ASSERT (*size_p == utf8_size);
+  return buffer_p;
+} /* ecma_string_borrow_utf8_chars */
+
+/**
+ * Release the characters returned by ecma_string_borrow_utf8_chars.
+ */
+void
+ecma_string_release_utf8_chars (const ecma_string_t *string_p, /**< ecma-string */
+                                const lit_utf8_byte_t *chars_p, /**< characters of the string */
+                                lit_utf8_size_t size) /**< size of the characters */
+{
+  if (!ecma_string_is_uint32 (string_p))
+  {
+    lit_utf8_size_t string_size;
+
+    if (ecma_string_get_chars_fast (string_p, &string_size) == chars_p)
+    {
+      return;
+    }
+  }
+
+  jmem_heap_free_block ((void *) chars_p, size);
+} /* ecma_string_release_utf8_chars */
+
 /**
  * Checks whether the string equals to the magic string id.
  *
@@ -1780,6 +2077,49 @@ ecma_compare_ecma_strings_longpath (const ecma_string_t *string1_p, /**< ecma-st
   return !memcmp ((char *) utf8_string1_p, (char *) utf8_string2_p, utf8_string1_size);
 } /* ecma_compare_ecma_strings_longpath */
 
+/**
+ * Compare two ecma-strings when their containers are different or both are external strings
+ *
+ * Note:
+ *   external strings are the only strings whose characters can be equal to
+ *   the characters of a string with a different container
+ *
+ * @return true - if strings are equal;
+ *         false - otherwise
+ */
+static bool JERRY_ATTR_NOINLINE
+ecma_compare_ecma_strings_external (const ecma_string_t *string1_p, /**< ecma-string */
+                                    const ecma_string_t *string2_p) /**< ecma-string */
+{
+  ecma_string_container_t string1_container = ECMA_STRING_GET_CONTAINER (string1_p);
+  ecma_string_container_t string2_container = ECMA_STRING_GET_CONTAINER (string2_p);
+
+  if (string1_container == ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING)
+  {
+    if (string2_container > ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING
+        && string2_container != ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING)
+    {
+      return false;
+    }
+  }
+  else if (string2_container != ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING
+           || string1_container > ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING)
+  {
+    return false;
+  }
+
+  lit_utf8_size_t utf8_string1_size, utf8_string2_size;
+  const lit_utf8_byte_t *utf8_string1_p = ecma_string_get_chars_fast (string1_p, &utf8_string1_size);
+  const lit_utf8_byte_t *utf8_string2_p = ecma_string_get_chars_fast (string2_p, &utf8_string2_size);
+
+  if (utf8_string1_size != utf8_string2_size)
+  {
+    return false;
+  }
+
+  return !memcmp ((char *) utf8_string1_p, (char *) utf8_string2_p, utf8_string1_size);
+} /* ecma_compare_ecma_strings_external */
+
 /**
  * Compare two ecma-strings
  *
@@ -1813,7 +2153,7 @@ ecma_compare_ecma_strings (const ecma_string_t *string1_p, /**< ecma-string */
 
   if (string1_container != ECMA_STRING_GET_CONTAINER (string2_p))
   {
-    return false;
+    return ecma_compare_ecma_strings_external (string1_p, string2_p);
   }
 
 #ifndef CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN
@@ -1825,6 +2165,11 @@ ecma_compare_ecma_strings (const ecma_string_t *string1_p, /**< ecma-string */
 
   if (string1_container >= ECMA_STRING_CONTAINER_UINT32_IN_DESC)
   {
+    if (JERRY_UNLIKELY (string1_container == ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING))
+    {
+      return ecma_compare_ecma_strings_external (string1_p, string2_p);
+    }
+
     return string1_p->u.common_uint32_field == string2_p->u.common_uint32_field;
   }
 
@@ -1859,11 +2204,16 @@ ecma_compare_ecma_non_direct_strings (const ecma_string_t *string1_p, /**< ecma-
 
   if (string1_container != ECMA_STRING_GET_CONTAINER (string2_p))
   {
-    return false;
+    return ecma_compare_ecma_strings_external (string1_p, string2_p);
   }
 
   if (string1_container >= ECMA_STRING_CONTAINER_UINT32_IN_DESC)
   {
+    if (JERRY_UNLIKELY (string1_container == ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING))
+    {
+      return ecma_compare_ecma_strings_external (string1_p, string2_p);
+    }
+
     return string1_p->u.common_uint32_field == string2_p->u.common_uint32_field;
   }
 
@@ -2045,6 +2395,7 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
       return (ecma_length_t) (string_p->u.utf8_string.length);
     }
     case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
     {
       return (ecma_length_t) (((ecma_long_string_t *) string_p)->long_utf8_string_length);
     }
@@ -2105,6 +2456,17 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
       return lit_get_utf8_length_of_cesu8_string ((const lit_utf8_byte_t *) (long_string_p + 1),
                                                   (lit_utf8_size_t) string_p->u.long_utf8_string_size);
     }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      ecma_external_string_t *external_string_p = (ecma_external_string_t *) string_p;
+      if (string_p->u.long_utf8_string_size == (lit_utf8_size_t) external_string_p->header.long_utf8_string_length)
+      {
+        return (ecma_length_t) (external_string_p->header.long_utf8_string_length);
+      }
+
+      return lit_get_utf8_length_of_cesu8_string (external_string_p->data_p,
+                                                  (lit_utf8_size_t) string_p->u.long_utf8_string_size);
+    }
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
@@ -2145,6 +2507,7 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
       return (lit_utf8_size_t) string_p->u.utf8_string.size;
     }
     case ECMA_STRING_CONTAINER_HEAP_LONG_UTF8_STRING:
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
     {
       return (lit_utf8_size_t) string_p->u.long_utf8_string_size;
     }
@@ -2201,7 +2564,18 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
         return (lit_utf8_size_t) string_p->u.long_utf8_string_size;
       }
 
-      return lit_get_utf8_size_of_cesu8_string ((const lit_utf8_byte_t *) (string_p + 1),
+      return lit_get_utf8_size_of_cesu8_string ((const lit_utf8_byte_t *) (long_string_p + 1),
+                                                (lit_utf8_size_t) string_p->u.long_utf8_string_size);
+    }
+    case ECMA_STRING_CONTAINER_EXTERNAL_UTF8_STRING:
+    {
+      ecma_external_string_t *external_string_p = (ecma_external_string_t *) string_p;
+      if (string_p->u.long_utf8_string_size == (lit_utf8_size_t) external_string_p->header.long_utf8_string_length)
+      {
+        return (lit_utf8_size_t) string_p->u.long_utf8_string_size;
+      }
+
+      return lit_get_utf8_size_of_cesu8_string (external_string_p->data_p,
                                                 (lit_utf8_size_t) string_p->u.long_utf8_string_size);
     }
     default:
@@ -26,11 +26,32 @@
  */
 
 /**
- * The type of ecma error and ecma collection chunk must be the same.
+ * The type of ecma error and ecma collection terminator must be the same.
  */
 JERRY_STATIC_ASSERT (ECMA_TYPE_ERROR == ECMA_TYPE_POINTER,
                      ecma_type_error_must_be_the_same_as_ecma_type_pointer);
 
+/**
+ * Get the capacity of the buffer of a collection.
+ *
+ * Note:
+ *      the buffer also contains the terminator value after the last item
+ *
+ * @return number of values which can be stored in the buffer
+ */
+static inline ecma_length_t JERRY_ATTR_ALWAYS_INLINE
+ecma_collection_get_capacity (ecma_length_t item_count) /**< number of items */
+{
+  ecma_length_t capacity = ECMA_COLLECTION_INITIAL_CAPACITY;
+
+  while (capacity <= item_count)
+  {
+    capacity <<= 1;
+  }
+
+  return capacity;
+} /* ecma_collection_get_capacity */
+
 /**
  * Allocate a collection of ecma values.
  *
@@ -42,9 +63,8 @@ ecma_new_values_collection (void)
   ecma_collection_header_t *header_p;
   header_p = (ecma_collection_header_t *) jmem_pools_alloc (sizeof (ecma_collection_header_t));
 
+  header_p->buffer_cp = ECMA_NULL_POINTER;
   header_p->item_count = 0;
-  header_p->first_chunk_cp = ECMA_NULL_POINTER;
-  header_p->last_chunk_cp = ECMA_NULL_POINTER;
 
   return header_p;
 } /* ecma_new_values_collection */
@@ -56,42 +76,29 @@ void
 ecma_free_values_collection (ecma_collection_header_t *header_p, /**< collection's header */
                              uint32_t flags) /**< combination of ecma_collection_flag_t flags */
 {
-  ecma_collection_chunk_t *chunk_p = ECMA_GET_POINTER (ecma_collection_chunk_t,
-                                                       header_p->first_chunk_cp);
+  ecma_value_t *buffer_p = ECMA_GET_POINTER (ecma_value_t, header_p->buffer_cp);
+  ecma_length_t item_count = header_p->item_count;
 
-  jmem_heap_free_block (header_p, sizeof (ecma_collection_header_t));
+  jmem_pools_free (header_p, sizeof (ecma_collection_header_t));
 
-  if (chunk_p == NULL)
+  if (buffer_p == NULL)
   {
     return;
   }
 
-  do
+  if (!(flags & ECMA_COLLECTION_NO_COPY))
   {
-    ecma_value_t *item_p = chunk_p->items;
-
-    JERRY_ASSERT (!ecma_is_value_pointer (*item_p));
-
-    do
+    for (ecma_length_t i = 0; i < item_count; i++)
     {
-      if (!(flags & ECMA_COLLECTION_NO_COPY)
-          && (!ecma_is_value_object (*item_p)
-              || !(flags & ECMA_COLLECTION_NO_REF_OBJECTS)))
+      if (!ecma_is_value_object (buffer_p[i])
+          || !(flags & ECMA_COLLECTION_NO_REF_OBJECTS))
       {
-        ecma_free_value (*item_p);
+        ecma_free_value (buffer_p[i]);
       }
-
-      item_p++;
     }
-    while (!ecma_is_value_pointer (*item_p));
-
-    ecma_collection_chunk_t *next_chunk_p = (ecma_collection_chunk_t *) ecma_get_pointer_from_value (*item_p);
-
-    jmem_heap_free_block (chunk_p, sizeof (ecma_collection_chunk_t));
-
-    chunk_p = next_chunk_p;
   }
-  while (chunk_p != NULL);
+
+  jmem_heap_free_block (buffer_p, ecma_collection_get_capacity (item_count) * sizeof (ecma_value_t));
 } /* ecma_free_values_collection */
 
 /**
@@ -102,41 +109,37 @@ ecma_append_to_values_collection (ecma_collection_header_t *header_p, /**< colle
                                   ecma_value_t value, /**< ecma value to append */
                                   uint32_t flags) /**< combination of ecma_collection_flag_t flags */
 {
-  ecma_length_t item_index;
-  ecma_collection_chunk_t *chunk_p;
+  ecma_length_t item_count = header_p->item_count;
+  ecma_value_t *buffer_p;
 
-  if (JERRY_UNLIKELY (header_p->item_count == 0))
+  if (JERRY_UNLIKELY (item_count == 0))
   {
-    item_index = 0;
-    chunk_p = (ecma_collection_chunk_t *) jmem_heap_alloc_block (sizeof (ecma_collection_chunk_t));
+    JERRY_ASSERT (header_p->buffer_cp == ECMA_NULL_POINTER);
+
+    const size_t size = ECMA_COLLECTION_INITIAL_CAPACITY * sizeof (ecma_value_t);
+    buffer_p = (ecma_value_t *) jmem_heap_alloc_block (size);
 
-    ECMA_SET_POINTER (header_p->first_chunk_cp, chunk_p);
-    header_p->last_chunk_cp = header_p->first_chunk_cp;
+    ECMA_SET_NON_NULL_POINTER (header_p->buffer_cp, buffer_p);
   }
   else
   {
-    item_index = header_p->item_count % ECMA_COLLECTION_CHUNK_ITEMS;
+    buffer_p = ECMA_GET_NON_NULL_POINTER (ecma_value_t, header_p->buffer_cp);
 
-    chunk_p = ECMA_GET_NON_NULL_POINTER (ecma_collection_chunk_t,
-                                         header_p->last_chunk_cp);
+    JERRY_ASSERT (ecma_is_value_pointer (buffer_p[item_count])
+                  && ecma_get_pointer_from_value (buffer_p[item_count]) == NULL);
 
-    if (JERRY_UNLIKELY (item_index == 0))
-    {
-      JERRY_ASSERT (ecma_is_value_pointer (chunk_p->items[ECMA_COLLECTION_CHUNK_ITEMS])
-                    && ecma_get_pointer_from_value (chunk_p->items[ECMA_COLLECTION_CHUNK_ITEMS]) == NULL);
+    ecma_length_t capacity = ecma_collection_get_capacity (item_count);
 
-      ecma_collection_chunk_t *next_chunk_p;
-      next_chunk_p = (ecma_collection_chunk_t *) jmem_heap_alloc_block (sizeof (ecma_collection_chunk_t));
+    if (JERRY_UNLIKELY (item_count + 1 == capacity))
+    {
+      /* The buffer is full: it is replaced by a buffer with doubled capacity. */
+      ecma_value_t *new_buffer_p = (ecma_value_t *) jmem_heap_alloc_block (2 * capacity * sizeof (ecma_value_t));
 
-      chunk_p->items[ECMA_COLLECTION_CHUNK_ITEMS] = ecma_make_pointer_value ((void *) next_chunk_p);
-      ECMA_SET_POINTER (header_p->last_chunk_cp, next_chunk_p);
+      memcpy (new_buffer_p, buffer_p, item_count * sizeof (ecma_value_t));
+      jmem_heap_free_block (buffer_p, capacity * sizeof (ecma_value_t));
 
-      chunk_p = next_chunk_p;
-    }
-    else
-    {
-      JERRY_ASSERT (ecma_is_value_pointer (chunk_p->items[item_index])
-                    && ecma_get_pointer_from_value (chunk_p->items[item_index]) == NULL);
+      buffer_p = new_buffer_p;
+      ECMA_SET_NON_NULL_POINTER (header_p->buffer_cp, buffer_p);
     }
   }
 
@@ -147,11 +150,23 @@ ecma_append_to_values_collection (ecma_collection_header_t *header_p, /**< colle
     value = ecma_copy_value (value);
   }
 
-  chunk_p->items[item_index] = value;
-  chunk_p->items[item_index + 1] = ecma_make_pointer_value (NULL);
-  header_p->item_count++;
+  buffer_p[item_count] = value;
+  buffer_p[item_count + 1] = ecma_make_pointer_value (NULL);
+  header_p->item_count = item_count + 1;
 } /* ecma_append_to_values_collection */
 
+/**
+ * Get the buffer of a collection, which contains the items in append order.
+ *
+ * @return pointer to the first item - if the collection is not empty,
+ *         NULL - otherwise
+ */
+ecma_value_t *
+ecma_collection_get_buffer (ecma_collection_header_t *header_p) /**< header of collection */
+{
+  return ECMA_GET_POINTER (ecma_value_t, header_p->buffer_cp);
+} /* ecma_collection_get_buffer */
+
 /**
  * Initialize new collection iterator for the collection
  *
@@ -165,16 +180,14 @@ ecma_collection_iterator_init (ecma_collection_header_t *header_p) /**< header o
     return NULL;
   }
 
-  ecma_collection_chunk_t *chunk_p = ECMA_GET_NON_NULL_POINTER (ecma_collection_chunk_t,
-                                                                header_p->first_chunk_cp);
-
-  return chunk_p->items;
+  return ECMA_GET_NON_NULL_POINTER (ecma_value_t, header_p->buffer_cp);
 } /* ecma_collection_iterator_init */
 
 /**
  * Move collection iterator to next element if there is any.
  *
- * @return pointer to the next item
+ * @return pointer to the next item - if there is any,
+ *         NULL - otherwise
  */
 ecma_value_t *
 ecma_collection_iterator_next (ecma_value_t *ecma_value_p) /**< current value */
@@ -185,10 +198,7 @@ ecma_collection_iterator_next (ecma_value_t *ecma_value_p) /**< current value */
 
   if (JERRY_UNLIKELY (ecma_is_value_pointer (*ecma_value_p)))
   {
-    ecma_value_p = ((ecma_collection_chunk_t *) ecma_get_pointer_from_value (*ecma_value_p))->items;
-
-    JERRY_ASSERT (ecma_value_p == NULL || !ecma_is_value_pointer (*ecma_value_p));
-    return ecma_value_p;
+    return NULL;
   }
 
   return ecma_value_p;
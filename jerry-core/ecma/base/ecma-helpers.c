@@ -15,6 +15,8 @@
 
 #include "ecma-alloc.h"
 #include "ecma-gc.h"
+#include "ecma-enum-cache.h"
+#include "ecma-global-cache.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
@@ -125,6 +127,247 @@ ecma_create_decl_lex_env (ecma_object_t *outer_lexical_environment_p) /**< outer
   return new_lexical_environment_p;
 } /* ecma_create_decl_lex_env */
 
+/**
+ * Create a declarative lexical environment with slots for the variables of a function call.
+ *
+ * Note:
+ *      the slots are initialized to undefined
+ *
+ * Reference counter's value will be set to one.
+ *
+ * @return pointer to the descriptor of lexical environment
+ */
+ecma_object_t *
+ecma_create_slot_lex_env (ecma_object_t *outer_lexical_environment_p, /**< outer lexical environment */
+                          const ecma_compiled_code_t *bytecode_p, /**< function byte code */
+                          uint32_t slot_count) /**< number of variables */
+{
+  JERRY_ASSERT (slot_count > 0);
+
+  size_t size = sizeof (ecma_slot_lex_env_t) + slot_count * sizeof (ecma_value_t);
+  ecma_slot_lex_env_t *lex_env_p = (ecma_slot_lex_env_t *) ecma_alloc_extended_object (size);
+  ecma_object_t *new_lexical_environment_p = &lex_env_p->header;
+
+  uint16_t type = ECMA_OBJECT_FLAG_BUILT_IN_OR_LEXICAL_ENV | ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS;
+  new_lexical_environment_p->type_flags_refs = type;
+
+  ecma_init_gc_info (new_lexical_environment_p);
+
+  new_lexical_environment_p->property_list_or_bound_object_cp = JMEM_CP_NULL;
+
+  ECMA_SET_POINTER (new_lexical_environment_p->prototype_or_outer_reference_cp,
+                    outer_lexical_environment_p);
+
+  if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_FUNCTION))
+  {
+    ecma_bytecode_ref ((ecma_compiled_code_t *) bytecode_p);
+  }
+
+  lex_env_p->bytecode_p = bytecode_p;
+  lex_env_p->slot_count = slot_count;
+
+  ecma_value_t *slots_p = ECMA_SLOT_LEX_ENV_GET_SLOTS (lex_env_p);
+
+  for (uint32_t i = 0; i < slot_count; i++)
+  {
+    slots_p[i] = ECMA_VALUE_UNDEFINED;
+  }
+
+  return new_lexical_environment_p;
+} /* ecma_create_slot_lex_env */
+
+/**
+ * Find the slot of a variable in a declarative lexical environment with slots.
+ *
+ * @return pointer to the value of the slot - if the variable has a slot,
+ *         NULL - otherwise
+ */
+ecma_value_t *
+ecma_find_lex_env_slot (ecma_object_t *lex_env_p, /**< lexical environment */
+                        ecma_string_t *name_p) /**< variable name */
+{
+  JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS);
+
+  ecma_slot_lex_env_t *slot_lex_env_p = (ecma_slot_lex_env_t *) lex_env_p;
+  const ecma_compiled_code_t *bytecode_p = slot_lex_env_p->bytecode_p;
+  const ecma_value_t *names_p;
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    names_p = (const ecma_value_t *) (((const uint8_t *) bytecode_p) + sizeof (cbc_uint16_arguments_t));
+  }
+  else
+  {
+    names_p = (const ecma_value_t *) (((const uint8_t *) bytecode_p) + sizeof (cbc_uint8_arguments_t));
+  }
+
+  uint32_t slot_count = slot_lex_env_p->slot_count;
+
+  for (uint32_t i = 0; i < slot_count; i++)
+  {
+    if (ecma_compare_ecma_strings (ecma_get_string_from_value (names_p[i]), name_p))
+    {
+      return ECMA_SLOT_LEX_ENV_GET_SLOTS (lex_env_p) + i;
+    }
+  }
+
+  return NULL;
+} /* ecma_find_lex_env_slot */
+
+/**
+ * Get the start of the argument names of a function byte code.
+ *
+ * Note:
+ *   the returned pointer is the end of the byte code if the argument names are not stored
+ *
+ * @return pointer to the first argument name
+ */
+static const uint8_t *
+ecma_compiled_code_get_argument_names_start (const ecma_compiled_code_t *bytecode_p) /**< function byte code */
+{
+  const uint8_t *end_p = ((const uint8_t *) bytecode_p) + (((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG);
+
+  if (CBC_NON_STRICT_ARGUMENTS_NEEDED (bytecode_p))
+  {
+    uint32_t argument_end;
+
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+    {
+      argument_end = ((const cbc_uint16_arguments_t *) bytecode_p)->argument_end;
+    }
+    else
+    {
+      argument_end = ((const cbc_uint8_arguments_t *) bytecode_p)->argument_end;
+    }
+
+    end_p -= argument_end * sizeof (ecma_value_t);
+  }
+
+  return end_p;
+} /* ecma_compiled_code_get_argument_names_start */
+
+/**
+ * Get the end of the scope info block of a function byte code.
+ *
+ * See also: CBC_SCOPE_INFO_SIZE
+ *
+ * @return pointer after the last item of the scope info block
+ */
+const uint16_t *
+ecma_compiled_code_get_scope_info_end (const ecma_compiled_code_t *bytecode_p) /**< function byte code */
+{
+  JERRY_ASSERT (bytecode_p->status_flags & CBC_CODE_FLAGS_SCOPE_INFO);
+
+  return (const uint16_t *) ecma_compiled_code_get_argument_names_start (bytecode_p);
+} /* ecma_compiled_code_get_scope_info_end */
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Get the resource name of a function byte code.
+ *
+ * See also: CBC_LINE_INFO_SIZE
+ *
+ * @return pointer to the resource name (last item of the line info block)
+ */
+const ecma_value_t *
+ecma_compiled_code_get_resource_name_p (const ecma_compiled_code_t *bytecode_p) /**< function byte code */
+{
+  JERRY_ASSERT (bytecode_p->status_flags & CBC_CODE_FLAGS_LINE_INFO);
+
+  const uint8_t *end_p = ecma_compiled_code_get_argument_names_start (bytecode_p);
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_SCOPE_INFO)
+  {
+    const uint16_t *scope_info_end_p = (const uint16_t *) end_p;
+    uint32_t ident_end;
+
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+    {
+      ident_end = ((const cbc_uint16_arguments_t *) bytecode_p)->ident_end;
+    }
+    else
+    {
+      ident_end = ((const cbc_uint8_arguments_t *) bytecode_p)->ident_end;
+    }
+
+    end_p -= CBC_SCOPE_INFO_SIZE (ident_end - scope_info_end_p[-1]);
+  }
+
+  return ((const ecma_value_t *) end_p) - 1;
+} /* ecma_compiled_code_get_resource_name_p */
+
+/**
+ * Decode a variable length integer of the line info table.
+ *
+ * @return decoded value
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_line_info_decode (const uint8_t **table_p) /**< [in, out] table position */
+{
+  const uint8_t *byte_p = *table_p;
+  uint32_t value = 0;
+  uint8_t byte;
+
+  do
+  {
+    byte = *byte_p++;
+    value = (value << 7) | (byte & CBC_LOWER_SEVEN_BIT_MASK);
+  }
+  while (byte & CBC_HIGHEST_BIT_MASK);
+
+  *table_p = byte_p;
+  return value;
+} /* ecma_line_info_decode */
+
+/**
+ * Get the source line of an instruction of a function byte code.
+ *
+ * The line info table is only decoded when a position is requested (backtraces,
+ * error objects, the debugger and the profilers), so the executed byte code does
+ * not contain any line info.
+ *
+ * @return line of the instruction, or 0 if the byte code has no line info
+ */
+uint32_t
+ecma_compiled_code_get_line (const ecma_compiled_code_t *bytecode_p, /**< function byte code */
+                             uint32_t offset) /**< byte code offset of the instruction
+                                               *   (relative to the start of the byte code) */
+{
+  if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_LINE_INFO))
+  {
+    return 0;
+  }
+
+  const ecma_value_t *resource_name_p = ecma_compiled_code_get_resource_name_p (bytecode_p);
+  uint32_t table_size = ((const uint32_t *) resource_name_p)[-1];
+  const uint8_t *table_p = ((const uint8_t *) (resource_name_p + 1)) - CBC_LINE_INFO_SIZE (table_size);
+  const uint8_t *table_end_p = table_p + table_size;
+
+  uint32_t entry_offset = 0;
+  uint32_t line = 0;
+
+  while (table_p < table_end_p)
+  {
+    entry_offset += ecma_line_info_decode (&table_p);
+
+    /* Instructions before the first entry belong to its line. */
+    if (entry_offset > offset && line != 0)
+    {
+      break;
+    }
+
+    uint32_t line_delta = ecma_line_info_decode (&table_p);
+
+    /* The line deltas are zigzag encoded. */
+    line += (line_delta & 0x1) ? ~(line_delta >> 1) : (line_delta >> 1);
+  }
+
+  return line;
+} /* ecma_compiled_code_get_line */
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 /**
  * Create a object lexical environment with specified outer lexical environment
  * (or NULL if the environment is not nested), binding object and provided type flag.
@@ -345,7 +588,7 @@ ecma_get_property_list (const ecma_object_t *object_p) /**< object or lexical en
 {
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (!ecma_is_lexical_environment (object_p)
-                || ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+                || ecma_get_lex_env_type (object_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END);
 
   return ECMA_GET_POINTER (ecma_property_header_t,
                            object_p->property_list_or_bound_object_cp);
@@ -611,6 +854,15 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
                                              name_p,
                                              &property_real_name_cp);
 
+#ifdef JERRY_VM_STATS
+    JERRY_CONTEXT (vm_stats_hashmap_lookups)++;
+
+    if (property_p != NULL)
+    {
+      JERRY_CONTEXT (vm_stats_hashmap_hits)++;
+    }
+#endif /* JERRY_VM_STATS */
+
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
     if (property_p != NULL
         && !ecma_is_property_lcached (property_p))
@@ -809,6 +1061,18 @@ ecma_delete_property (ecma_object_t *object_p, /**< object */
   ecma_property_header_t *prev_prop_p = NULL;
   ecma_property_hashmap_delete_status hashmap_status = ECMA_PROPERTY_HASHMAP_DELETE_NO_HASHMAP;
 
+#ifndef CONFIG_ECMA_GLOBAL_CACHE_DISABLE
+  if (object_p == JERRY_CONTEXT (ecma_builtin_objects)[ECMA_BUILTIN_ID_GLOBAL])
+  {
+    ecma_global_cache_invalidate ();
+  }
+#endif /* !CONFIG_ECMA_GLOBAL_CACHE_DISABLE */
+
+#ifndef CONFIG_ECMA_ENUM_CACHE_DISABLE
+  /* The name of the deleted property may be freed and reused. */
+  ecma_enum_cache_clear ();
+#endif /* !CONFIG_ECMA_ENUM_CACHE_DISABLE */
+
   if (cur_prop_p != NULL && cur_prop_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
   {
     prev_prop_p = cur_prop_p;
@@ -1548,6 +1812,10 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
       }
     }
 
+#ifdef JERRY_VM_STATS
+    vm_stats_bytecode_freed (bytecode_p);
+#endif /* JERRY_VM_STATS */
+
 #ifdef JERRY_DEBUGGER
     if ((JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
         && !(bytecode_p->status_flags & CBC_CODE_FLAGS_DEBUGGER_IGNORE)
@@ -223,12 +223,18 @@ ecma_string_t *ecma_new_symbol_from_descriptor_string (ecma_value_t string_desc)
 bool ecma_prop_name_is_symbol (ecma_string_t *string_p);
 #endif /* !CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN */
 ecma_string_t *ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, lit_utf8_size_t string_size);
+ecma_string_t *ecma_new_ecma_external_string_from_cesu8 (const lit_utf8_byte_t *string_p, lit_utf8_size_t string_size,
+                                                        ecma_object_native_free_callback_t free_cb);
 ecma_string_t *ecma_new_ecma_string_from_utf8_converted_to_cesu8 (const lit_utf8_byte_t *string_p,
                                                                   lit_utf8_size_t string_size);
 ecma_string_t *ecma_new_ecma_string_from_code_unit (ecma_char_t code_unit);
 ecma_string_t *ecma_new_ecma_string_from_uint32 (uint32_t uint32_number);
 ecma_string_t *ecma_get_ecma_string_from_uint32 (uint32_t uint32_number);
 ecma_string_t *ecma_new_ecma_string_from_number (ecma_number_t num);
+#ifndef CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE
+void ecma_number_string_cache_gc_run (void);
+void ecma_number_string_cache_flush (void);
+#endif /* !CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE */
 ecma_string_t *ecma_get_magic_string (lit_magic_string_id_t id);
 ecma_string_t *ecma_append_chars_to_string (ecma_string_t *string1_p,
                                             const lit_utf8_byte_t *cesu8_string2_p,
@@ -264,6 +270,9 @@ ecma_substring_copy_to_utf8_buffer (const ecma_string_t *string_desc_p,
 void ecma_string_to_utf8_bytes (const ecma_string_t *string_desc_p, lit_utf8_byte_t *buffer_p,
                                 lit_utf8_size_t buffer_size);
 const lit_utf8_byte_t *ecma_string_get_chars (const ecma_string_t *string_p, lit_utf8_size_t *size_p, uint8_t *flags_p);
+const lit_utf8_byte_t *ecma_string_borrow_utf8_chars (const ecma_string_t *string_p, lit_utf8_size_t *size_p);
+void ecma_string_release_utf8_chars (const ecma_string_t *string_p, const lit_utf8_byte_t *chars_p,
+                                     lit_utf8_size_t size);
 bool ecma_compare_ecma_string_to_magic_id (const ecma_string_t *string_p, lit_magic_string_id_t id);
 bool ecma_string_is_empty (const ecma_string_t *string_p);
 bool ecma_string_is_length (const ecma_string_t *string_p);
@@ -313,6 +322,7 @@ lit_utf8_size_t ecma_number_to_binary_floating_point_number (ecma_number_t num,
 ecma_collection_header_t *ecma_new_values_collection (void);
 void ecma_free_values_collection (ecma_collection_header_t *header_p, uint32_t flags);
 void ecma_append_to_values_collection (ecma_collection_header_t *header_p, ecma_value_t v, uint32_t flags);
+ecma_value_t *ecma_collection_get_buffer (ecma_collection_header_t *header_p);
 
 ecma_value_t *
 ecma_collection_iterator_init (ecma_collection_header_t *header_p);
@@ -322,6 +332,9 @@ ecma_collection_iterator_next (ecma_value_t *iterator_p);
 /* ecma-helpers.c */
 ecma_object_t *ecma_create_object (ecma_object_t *prototype_object_p, size_t ext_object_size, ecma_object_type_t type);
 ecma_object_t *ecma_create_decl_lex_env (ecma_object_t *outer_lexical_environment_p);
+ecma_object_t *ecma_create_slot_lex_env (ecma_object_t *outer_lexical_environment_p,
+                                         const ecma_compiled_code_t *bytecode_p, uint32_t slot_count);
+ecma_value_t *ecma_find_lex_env_slot (ecma_object_t *lex_env_p, ecma_string_t *name_p);
 ecma_object_t *ecma_create_object_lex_env (ecma_object_t *outer_lexical_environment_p, ecma_object_t *binding_obj_p,
                                            ecma_lexical_environment_type_t type);
 bool JERRY_ATTR_PURE ecma_is_lexical_environment (const ecma_object_t *object_p);
@@ -386,6 +399,11 @@ ecma_value_t ecma_clear_error_reference (ecma_value_t value, bool set_abort_flag
 
 void ecma_bytecode_ref (ecma_compiled_code_t *bytecode_p);
 void ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p);
+const uint16_t *ecma_compiled_code_get_scope_info_end (const ecma_compiled_code_t *bytecode_p);
+#ifdef JERRY_ENABLE_LINE_INFO
+const ecma_value_t *ecma_compiled_code_get_resource_name_p (const ecma_compiled_code_t *bytecode_p);
+uint32_t ecma_compiled_code_get_line (const ecma_compiled_code_t *bytecode_p, uint32_t offset);
+#endif /* JERRY_ENABLE_LINE_INFO */
 
 /* ecma-helpers-external-pointers.c */
 bool ecma_create_native_pointer_property (ecma_object_t *obj_p, void *native_p, void *info_p);
@@ -398,8 +416,8 @@ uint32_t ecma_number_to_uint32 (ecma_number_t num);
 int32_t ecma_number_to_int32 (ecma_number_t num);
 lit_utf8_size_t ecma_number_to_utf8_string (ecma_number_t num, lit_utf8_byte_t *buffer_p, lit_utf8_size_t buffer_size);
 
-/* ecma-helpers-errol.c */
-lit_utf8_size_t ecma_errol0_dtoa (double val, lit_utf8_byte_t *buffer_p, int32_t *exp_p);
+/* ecma-helpers-ryu.c */
+lit_utf8_size_t ecma_ryu_dtoa (double val, lit_utf8_byte_t *buffer_p, int32_t *exp_p);
 
 /**
  * @}
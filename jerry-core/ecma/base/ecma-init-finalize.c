@@ -14,6 +14,7 @@
  */
 
 #include "ecma-builtins.h"
+#include "ecma-eval-cache.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
@@ -59,7 +60,14 @@ ecma_finalize (void)
 
   ecma_finalize_global_lex_env ();
   ecma_finalize_builtins ();
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  ecma_eval_cache_clear ();
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
   ecma_gc_run (JMEM_FREE_UNUSED_MEMORY_SEVERITY_LOW);
+#ifndef CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE
+  /* The cached strings may still be shared with the strings freed by the literal storage. */
+  ecma_number_string_cache_flush ();
+#endif /* !CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE */
   ecma_finalize_lit_storage ();
 } /* ecma_finalize */
 
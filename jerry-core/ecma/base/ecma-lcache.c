@@ -157,6 +157,10 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
 
   size_t row_index = ecma_lcache_row_index (object_cp, name_hash);
 
+#ifdef JERRY_VM_STATS
+  JERRY_CONTEXT (vm_stats_lcache_lookups)++;
+#endif /* JERRY_VM_STATS */
+
   ecma_lcache_hash_entry_t *entry_p = JERRY_CONTEXT (lcache) [row_index];
   ecma_lcache_hash_entry_t *entry_end_p = entry_p + ECMA_LCACHE_HASH_ROW_LENGTH;
 
@@ -171,6 +175,9 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
 
       if (ECMA_PROPERTY_GET_NAME_TYPE (*prop_p) == prop_name_type)
       {
+#ifdef JERRY_VM_STATS
+        JERRY_CONTEXT (vm_stats_lcache_hits)++;
+#endif /* JERRY_VM_STATS */
         return prop_p;
       }
     }
@@ -343,6 +343,13 @@ ecma_save_literals_add_compiled_code (const ecma_compiled_code_t *compiled_code_
       ecma_save_literals_append_value (literal_p[i], lit_pool_p);
     }
   }
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_LINE_INFO)
+  {
+    ecma_save_literals_append_value (*ecma_compiled_code_get_resource_name_p (compiled_code_p), lit_pool_p);
+  }
+#endif /* JERRY_ENABLE_LINE_INFO */
 } /* ecma_save_literals_add_compiled_code */
 
 /**
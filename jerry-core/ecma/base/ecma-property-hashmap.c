@@ -28,12 +28,6 @@
 
 #ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
 
-/**
- * Compute the total size of the property hashmap.
- */
-#define ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE(max_property_count) \
-  (sizeof (ecma_property_hashmap_t) + (max_property_count * sizeof (jmem_cpointer_t)) + (max_property_count >> 3))
-
 /**
  * Number of items in the stepping table.
  */
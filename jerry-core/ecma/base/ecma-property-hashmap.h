@@ -53,6 +53,12 @@ typedef struct
    */
 } ecma_property_hashmap_t;
 
+/**
+ * Compute the total size of the property hashmap.
+ */
+#define ECMA_PROPERTY_HASHMAP_GET_TOTAL_SIZE(max_property_count) \
+  (sizeof (ecma_property_hashmap_t) + (max_property_count * sizeof (jmem_cpointer_t)) + (max_property_count >> 3))
+
 /**
  * Simple ecma values
  */
@@ -17,6 +17,7 @@
 #include "ecma-conversion.h"
 #include "ecma-exceptions.h"
 #include "ecma-eval.h"
+#include "ecma-eval-cache.h"
 #include "ecma-gc.h"
 #include "ecma-function-object.h"
 #include "ecma-lex-env.h"
@@ -165,12 +166,21 @@ ecma_builtin_function_dispatch_construct (const ecma_value_t *arguments_list_p,
 
   ecma_compiled_code_t *bytecode_data_p = NULL;
 
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  ecma_value_t ret_value = ecma_eval_cache_parse_script (arguments_buffer_p,
+                                                         arguments_buffer_size,
+                                                         function_body_buffer_p,
+                                                         function_body_buffer_size,
+                                                         ECMA_PARSE_NO_OPTS,
+                                                         &bytecode_data_p);
+#else /* CONFIG_ECMA_EVAL_CACHE_DISABLE */
   ecma_value_t ret_value = parser_parse_script (arguments_buffer_p,
                                                 arguments_buffer_size,
                                                 function_body_buffer_p,
                                                 function_body_buffer_size,
                                                 ECMA_PARSE_NO_OPTS,
                                                 &bytecode_data_p);
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
 
   if (!ECMA_IS_VALUE_ERROR (ret_value))
   {
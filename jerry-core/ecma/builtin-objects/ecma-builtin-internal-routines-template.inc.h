@@ -29,6 +29,8 @@
 
 #define PROPERTY_DESCRIPTOR_LIST_NAME \
   PASTE (PASTE (ecma_builtin_, BUILTIN_UNDERSCORED_ID), _property_descriptor_list)
+#define PROPERTY_FILTER_NAME \
+  PASTE (PASTE (ecma_builtin_, BUILTIN_UNDERSCORED_ID), _property_filter)
 #define DISPATCH_ROUTINE_ROUTINE_NAME \
   PASTE (PASTE (ecma_builtin_, BUILTIN_UNDERSCORED_ID), _dispatch_routine)
 
@@ -174,6 +176,28 @@ const ecma_builtin_property_descriptor_t PROPERTY_DESCRIPTOR_LIST_NAME[] =
   }
 };
 
+#ifndef CONFIG_ECMA_BUILTIN_ROM_DISABLE
+
+/**
+ * Property name filter of the built-in object.
+ */
+const uint32_t PROPERTY_FILTER_NAME[ECMA_BUILTIN_PROPERTY_FILTER_WORDS] =
+{
+#define ECMA_BUILTIN_PROPERTY_FILTER_WORD 0
+#include "ecma-builtin-property-filter.inc.h"
+  ,
+#define ECMA_BUILTIN_PROPERTY_FILTER_WORD 1
+#include "ecma-builtin-property-filter.inc.h"
+  ,
+#define ECMA_BUILTIN_PROPERTY_FILTER_WORD 2
+#include "ecma-builtin-property-filter.inc.h"
+  ,
+#define ECMA_BUILTIN_PROPERTY_FILTER_WORD 3
+#include "ecma-builtin-property-filter.inc.h"
+};
+
+#endif /* !CONFIG_ECMA_BUILTIN_ROM_DISABLE */
+
 #ifndef BUILTIN_CUSTOM_DISPATCH
 
 /**
@@ -255,3 +279,4 @@ DISPATCH_ROUTINE_ROUTINE_NAME (uint16_t builtin_routine_id, /**< built-in wide r
 #undef PASTE_
 #undef PASTE
 #undef PROPERTY_DESCRIPTOR_LIST_NAME
+#undef PROPERTY_FILTER_NAME
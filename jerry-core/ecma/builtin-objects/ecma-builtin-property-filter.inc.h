@@ -0,0 +1,53 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Computes one word of the property name filter of a built-in object.
+ *
+ * The ECMA_BUILTIN_PROPERTY_FILTER_WORD macro selects the word.
+ */
+
+#ifndef ECMA_BUILTIN_PROPERTY_FILTER_WORD
+# error "Please, define ECMA_BUILTIN_PROPERTY_FILTER_WORD"
+#endif /* !ECMA_BUILTIN_PROPERTY_FILTER_WORD */
+
+#define ECMA_BUILTIN_PROPERTY_FILTER_ENTRY(name) \
+  | ECMA_BUILTIN_PROPERTY_FILTER_BIT (name, ECMA_BUILTIN_PROPERTY_FILTER_WORD)
+
+  0u
+#define ROUTINE(name, c_function_name, args_number, length_prop_value) \
+  ECMA_BUILTIN_PROPERTY_FILTER_ENTRY (name)
+#define ROUTINE_CONFIGURABLE_ONLY(name, c_function_name, args_number, length_prop_value) \
+  ECMA_BUILTIN_PROPERTY_FILTER_ENTRY (name)
+#define OBJECT_VALUE(name, obj_builtin_id, prop_attributes) \
+  ECMA_BUILTIN_PROPERTY_FILTER_ENTRY (name)
+#define SIMPLE_VALUE(name, simple_value, prop_attributes) \
+  ECMA_BUILTIN_PROPERTY_FILTER_ENTRY (name)
+#define NUMBER_VALUE(name, number_value, prop_attributes) \
+  ECMA_BUILTIN_PROPERTY_FILTER_ENTRY (name)
+#define STRING_VALUE(name, magic_string_id, prop_attributes) \
+  ECMA_BUILTIN_PROPERTY_FILTER_ENTRY (name)
+#ifndef CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN
+#define SYMBOL_VALUE(name, desc_string_id) \
+  ECMA_BUILTIN_PROPERTY_FILTER_ENTRY (name)
+#endif /* !CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN */
+#define ACCESSOR_READ_WRITE(name, c_getter_name, c_setter_name, prop_attributes) \
+  ECMA_BUILTIN_PROPERTY_FILTER_ENTRY (name)
+#define ACCESSOR_READ_ONLY(name, c_getter_func_name, prop_attributes) \
+  ECMA_BUILTIN_PROPERTY_FILTER_ENTRY (name)
+#include BUILTIN_INC_HEADER_NAME
+
+#undef ECMA_BUILTIN_PROPERTY_FILTER_ENTRY
+#undef ECMA_BUILTIN_PROPERTY_FILTER_WORD
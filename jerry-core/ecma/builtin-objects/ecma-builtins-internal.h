@@ -72,6 +72,37 @@ typedef struct
   uint16_t value; /**< value of the property */
 } ecma_builtin_property_descriptor_t;
 
+#ifndef CONFIG_ECMA_BUILTIN_ROM_DISABLE
+
+/**
+ * Number of 32 bit words in the property name filter of a built-in object.
+ */
+#define ECMA_BUILTIN_PROPERTY_FILTER_WORDS 4
+
+/**
+ * Get the bit of a property name in the given word of the property name filter.
+ */
+#define ECMA_BUILTIN_PROPERTY_FILTER_BIT(magic_string_id, word) \
+  ((((magic_string_id) >> 5) & (ECMA_BUILTIN_PROPERTY_FILTER_WORDS - 1)) == (word) \
+   ? (1u << ((magic_string_id) & 0x1f)) \
+   : 0u)
+
+/**
+ * Declare the property name filter of a built-in object.
+ */
+#define ECMA_BUILTIN_PROPERTY_FILTER_DECLARE(lowercase_name) \
+extern const uint32_t \
+ecma_builtin_ ## lowercase_name ## _property_filter[ECMA_BUILTIN_PROPERTY_FILTER_WORDS];
+
+#else /* CONFIG_ECMA_BUILTIN_ROM_DISABLE */
+
+/**
+ * Property name filters are not generated.
+ */
+#define ECMA_BUILTIN_PROPERTY_FILTER_DECLARE(lowercase_name)
+
+#endif /* !CONFIG_ECMA_BUILTIN_ROM_DISABLE */
+
 #define BUILTIN_ROUTINE(builtin_id, \
                         object_type, \
                         object_prototype_builtin_id, \
@@ -79,6 +110,7 @@ typedef struct
                         lowercase_name) \
 extern const ecma_builtin_property_descriptor_t \
 ecma_builtin_ ## lowercase_name ## _property_descriptor_list[]; \
+ECMA_BUILTIN_PROPERTY_FILTER_DECLARE (lowercase_name) \
 ecma_value_t \
 ecma_builtin_ ## lowercase_name ## _dispatch_call (const ecma_value_t *, \
                                                    ecma_length_t); \
@@ -97,6 +129,7 @@ ecma_builtin_ ## lowercase_name ## _dispatch_routine (uint16_t builtin_routine_i
                 lowercase_name) \
 extern const ecma_builtin_property_descriptor_t \
 ecma_builtin_ ## lowercase_name ## _property_descriptor_list[]; \
+ECMA_BUILTIN_PROPERTY_FILTER_DECLARE (lowercase_name) \
 ecma_value_t \
 ecma_builtin_ ## lowercase_name ## _dispatch_routine (uint16_t builtin_routine_id, \
                                                       ecma_value_t this_arg_value, \
@@ -106,5 +139,6 @@ ecma_builtin_ ## lowercase_name ## _dispatch_routine (uint16_t builtin_routine_i
 
 #undef BUILTIN_ROUTINE
 #undef BUILTIN
+#undef ECMA_BUILTIN_PROPERTY_FILTER_DECLARE
 
 #endif /* !ECMA_BUILTINS_INTERNAL_H */
@@ -240,6 +240,39 @@ static const ecma_builtin_property_list_reference_t ecma_builtin_property_list_r
 /** @endcond */
 };
 
+#ifndef CONFIG_ECMA_BUILTIN_ROM_DISABLE
+
+/**
+ * Property name filters for all built-ins.
+ */
+static const uint32_t * const ecma_builtin_property_filter_references[] =
+{
+/** @cond doxygen_suppress */
+#define BUILTIN(a, b, c, d, e)
+#define BUILTIN_ROUTINE(builtin_id, \
+                        object_type, \
+                        object_prototype_builtin_id, \
+                        is_extensible, \
+                        lowercase_name) \
+  ecma_builtin_ ## lowercase_name ## _property_filter,
+#include "ecma-builtins.inc.h"
+#undef BUILTIN
+#undef BUILTIN_ROUTINE
+#define BUILTIN_ROUTINE(a, b, c, d, e)
+#define BUILTIN(builtin_id, \
+                object_type, \
+                object_prototype_builtin_id, \
+                is_extensible, \
+                lowercase_name) \
+  ecma_builtin_ ## lowercase_name ## _property_filter,
+#include "ecma-builtins.inc.h"
+#undef BUILTIN_ROUTINE
+#undef BUILTIN
+/** @endcond */
+};
+
+#endif /* !CONFIG_ECMA_BUILTIN_ROM_DISABLE */
+
 /**
  * Get the number of properties of a built-in object.
  *
@@ -607,50 +640,34 @@ ecma_builtin_make_function_object_for_setter_accessor (ecma_builtin_id_t builtin
 } /* ecma_builtin_make_function_object_for_setter_accessor */
 
 /**
- * If the property's name is one of built-in properties of the object
- * that is not instantiated yet, instantiate the property and
- * return pointer to the instantiated property.
+ * Get the built-in part of a built-in object.
  *
- * @return pointer property, if one was instantiated,
- *         NULL - otherwise.
+ * @return pointer to the built-in properties of the object
  */
-ecma_property_t *
-ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object */
-                                          ecma_string_t *string_p) /**< property's name */
+static ecma_built_in_props_t *
+ecma_builtin_get_built_in_props (ecma_object_t *object_p) /**< built-in object */
 {
-  JERRY_ASSERT (ecma_get_object_is_builtin (object_p));
+  ecma_object_type_t object_type = ecma_get_object_type (object_p);
 
-  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_FUNCTION
-      && ecma_builtin_function_is_routine (object_p))
+  if (object_type == ECMA_OBJECT_TYPE_CLASS || object_type == ECMA_OBJECT_TYPE_ARRAY)
   {
-    if (ecma_string_is_length (string_p))
-    {
-      /*
-       * Lazy instantiation of 'length' property
-       *
-       * Note:
-       *      We don't need to mark that the property was already lazy instantiated,
-       *      as it is non-configurable and so can't be deleted
-       */
-
-      ecma_property_t *len_prop_p;
-      ecma_property_value_t *len_prop_value_p = ecma_create_named_data_property (object_p,
-                                                                                 string_p,
-                                                                                 ECMA_PROPERTY_FIXED,
-                                                                                 &len_prop_p);
-
-      ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
-
-      uint8_t length = ext_obj_p->u.built_in.length_and_bitset_size & ((1 << ECMA_BUILT_IN_BITSET_SHIFT) - 1);
-
-      len_prop_value_p->value = ecma_make_integer_value (length);
-
-      return len_prop_p;
-    }
-
-    return NULL;
+    return &((ecma_extended_built_in_object_t *) object_p)->built_in;
   }
 
+  return &((ecma_extended_object_t *) object_p)->u.built_in;
+} /* ecma_builtin_get_built_in_props */
+
+/**
+ * Find the descriptor of a built-in property which is not instantiated yet.
+ *
+ * @return pointer to the property descriptor - if the property is found,
+ *         NULL - otherwise
+ */
+static const ecma_builtin_property_descriptor_t *
+ecma_builtin_find_lazy_property (ecma_object_t *object_p, /**< built-in object (not a routine) */
+                                 ecma_string_t *string_p, /**< property's name */
+                                 uint32_t *index_p) /**< [out] index of the property */
+{
   lit_magic_string_id_t magic_string_id = ecma_get_string_magic (string_p);
 
 #ifndef CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN
@@ -668,23 +685,23 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
     return NULL;
   }
 
-  ecma_built_in_props_t *built_in_props_p;
-  ecma_object_type_t object_type = ecma_get_object_type (object_p);
-
-  if (object_type == ECMA_OBJECT_TYPE_CLASS || object_type == ECMA_OBJECT_TYPE_ARRAY)
-  {
-    built_in_props_p = &((ecma_extended_built_in_object_t *) object_p)->built_in;
-  }
-  else
-  {
-    built_in_props_p = &((ecma_extended_object_t *) object_p)->u.built_in;
-  }
-
+  ecma_built_in_props_t *built_in_props_p = ecma_builtin_get_built_in_props (object_p);
   ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) built_in_props_p->id;
 
   JERRY_ASSERT (builtin_id < ECMA_BUILTIN_ID__COUNT);
   JERRY_ASSERT (ecma_builtin_is (object_p, builtin_id));
 
+#ifndef CONFIG_ECMA_BUILTIN_ROM_DISABLE
+  const uint32_t *filter_p = ecma_builtin_property_filter_references[builtin_id];
+  uint32_t filter_word = (uint32_t) (magic_string_id >> 5) & (ECMA_BUILTIN_PROPERTY_FILTER_WORDS - 1);
+
+  if (!(filter_p[filter_word] & ECMA_BUILTIN_PROPERTY_FILTER_BIT (magic_string_id, filter_word)))
+  {
+    /* The name is surely not a property of this built-in. */
+    return NULL;
+  }
+#endif /* !CONFIG_ECMA_BUILTIN_ROM_DISABLE */
+
   const ecma_builtin_property_descriptor_t *property_list_p = ecma_builtin_property_list_references[builtin_id];
 
   const ecma_builtin_property_descriptor_t *curr_property_p = property_list_p;
@@ -700,29 +717,45 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
 
   uint32_t index = (uint32_t) (curr_property_p - property_list_p);
 
-  uint32_t *bitset_p = built_in_props_p->instantiated_bitset + (index >> 5);
-
-  uint32_t bit_for_index = (uint32_t) (1u << (index & 0x1f));
-
-  if (*bitset_p & bit_for_index)
+  if (built_in_props_p->instantiated_bitset[index >> 5] & (uint32_t) (1u << (index & 0x1f)))
   {
     /* This property was instantiated before. */
     return NULL;
   }
 
-  *bitset_p |= bit_for_index;
+  *index_p = index;
+  return curr_property_p;
+} /* ecma_builtin_find_lazy_property */
 
-  ecma_value_t value = ECMA_VALUE_EMPTY;
-  bool is_accessor = false;
-  ecma_object_t *getter_p = NULL;
-  ecma_object_t *setter_p = NULL;
+/**
+ * Get the length of a built-in routine.
+ *
+ * @return length of the routine
+ */
+static inline uint8_t JERRY_ATTR_ALWAYS_INLINE
+ecma_builtin_routine_get_length (ecma_object_t *object_p) /**< built-in routine */
+{
+  ecma_extended_object_t *ext_obj_p = (ecma_extended_object_t *) object_p;
 
+  return (uint8_t) (ext_obj_p->u.built_in.length_and_bitset_size & ((1 << ECMA_BUILT_IN_BITSET_SHIFT) - 1));
+} /* ecma_builtin_routine_get_length */
+
+/**
+ * Create the value of a built-in data property whose value is
+ * fully described by its property descriptor.
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_builtin_make_property_value (const ecma_builtin_property_descriptor_t *curr_property_p) /**< property
+                                                                                               *   descriptor */
+{
   switch (curr_property_p->type)
   {
     case ECMA_BUILTIN_PROPERTY_SIMPLE:
     {
-      value = curr_property_p->value;
-      break;
+      return curr_property_p->value;
     }
     case ECMA_BUILTIN_PROPERTY_NUMBER:
     {
@@ -774,14 +807,147 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
         }
       }
 
-      value = ecma_make_number_value (num);
-      break;
+      return ecma_make_number_value (num);
     }
     case ECMA_BUILTIN_PROPERTY_STRING:
     {
-      value = ecma_make_magic_string_value ((lit_magic_string_id_t) curr_property_p->value);
-      break;
+      return ecma_make_magic_string_value ((lit_magic_string_id_t) curr_property_p->value);
     }
+    default:
+    {
+      JERRY_ASSERT (curr_property_p->type == ECMA_BUILTIN_PROPERTY_OBJECT);
+
+      ecma_object_t *builtin_object_p = ecma_builtin_get ((ecma_builtin_id_t) curr_property_p->value);
+      ecma_ref_object (builtin_object_p);
+      return ecma_make_object_value (builtin_object_p);
+    }
+  }
+} /* ecma_builtin_make_property_value */
+
+#ifndef CONFIG_ECMA_BUILTIN_ROM_DISABLE
+
+/**
+ * Read the value of a built-in property without instantiating it.
+ *
+ * The value of a data property, which is not instantiated yet, is the one
+ * stored in the constant property list of the built-in. Simple values and
+ * magic strings are read directly from the list, and only instantiated when
+ * they are modified (e.g. written, deleted or redefined). Other properties
+ * are instantiated on first access: numbers might need a heap allocation
+ * on every read, objects are often read in hot code where the property
+ * lookup caches help, and the identity of routines and accessors matters.
+ *
+ * @return ecma value - if the value is available without instantiation,
+ *         ECMA_VALUE_NOT_FOUND - if the property is not a built-in property,
+ *         ECMA_VALUE_EMPTY - if the property must be instantiated
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_builtin_try_to_get_property_value (ecma_object_t *object_p, /**< object */
+                                        ecma_string_t *string_p) /**< property's name */
+{
+  JERRY_ASSERT (ecma_get_object_is_builtin (object_p));
+
+  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_FUNCTION
+      && ecma_builtin_function_is_routine (object_p))
+  {
+    if (ecma_string_is_length (string_p))
+    {
+      return ecma_make_integer_value (ecma_builtin_routine_get_length (object_p));
+    }
+
+    return ECMA_VALUE_NOT_FOUND;
+  }
+
+  uint32_t index;
+  const ecma_builtin_property_descriptor_t *curr_property_p = ecma_builtin_find_lazy_property (object_p,
+                                                                                                string_p,
+                                                                                                &index);
+
+  if (curr_property_p == NULL)
+  {
+    return ECMA_VALUE_NOT_FOUND;
+  }
+
+  switch (curr_property_p->type)
+  {
+    case ECMA_BUILTIN_PROPERTY_SIMPLE:
+    case ECMA_BUILTIN_PROPERTY_STRING:
+    {
+      return ecma_builtin_make_property_value (curr_property_p);
+    }
+    default:
+    {
+      return ECMA_VALUE_EMPTY;
+    }
+  }
+} /* ecma_builtin_try_to_get_property_value */
+
+#endif /* !CONFIG_ECMA_BUILTIN_ROM_DISABLE */
+
+/**
+ * If the property's name is one of built-in properties of the object
+ * that is not instantiated yet, instantiate the property and
+ * return pointer to the instantiated property.
+ *
+ * @return pointer property, if one was instantiated,
+ *         NULL - otherwise.
+ */
+ecma_property_t *
+ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object */
+                                          ecma_string_t *string_p) /**< property's name */
+{
+  JERRY_ASSERT (ecma_get_object_is_builtin (object_p));
+
+  if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_FUNCTION
+      && ecma_builtin_function_is_routine (object_p))
+  {
+    if (ecma_string_is_length (string_p))
+    {
+      /*
+       * Lazy instantiation of 'length' property
+       *
+       * Note:
+       *      We don't need to mark that the property was already lazy instantiated,
+       *      as it is non-configurable and so can't be deleted
+       */
+
+      ecma_property_t *len_prop_p;
+      ecma_property_value_t *len_prop_value_p = ecma_create_named_data_property (object_p,
+                                                                                 string_p,
+                                                                                 ECMA_PROPERTY_FIXED,
+                                                                                 &len_prop_p);
+
+      len_prop_value_p->value = ecma_make_integer_value (ecma_builtin_routine_get_length (object_p));
+
+      return len_prop_p;
+    }
+
+    return NULL;
+  }
+
+  uint32_t index;
+  const ecma_builtin_property_descriptor_t *curr_property_p = ecma_builtin_find_lazy_property (object_p,
+                                                                                                string_p,
+                                                                                                &index);
+
+  if (curr_property_p == NULL)
+  {
+    return NULL;
+  }
+
+  ecma_built_in_props_t *built_in_props_p = ecma_builtin_get_built_in_props (object_p);
+  ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) built_in_props_p->id;
+
+  built_in_props_p->instantiated_bitset[index >> 5] |= (uint32_t) (1u << (index & 0x1f));
+
+  ecma_value_t value = ECMA_VALUE_EMPTY;
+  bool is_accessor = false;
+  ecma_object_t *getter_p = NULL;
+  ecma_object_t *setter_p = NULL;
+
+  switch (curr_property_p->type)
+  {
 #ifndef CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN
     case ECMA_BUILTIN_PROPERTY_SYMBOL:
     {
@@ -801,13 +967,6 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
       break;
     }
 #endif /* !CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN */
-    case ECMA_BUILTIN_PROPERTY_OBJECT:
-    {
-      ecma_object_t *builtin_object_p = ecma_builtin_get ((ecma_builtin_id_t) curr_property_p->value);
-      ecma_ref_object (builtin_object_p);
-      value = ecma_make_object_value (builtin_object_p);
-      break;
-    }
     case ECMA_BUILTIN_PROPERTY_ROUTINE:
     {
       ecma_object_t *func_obj_p;
@@ -826,15 +985,18 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
       setter_p = ecma_builtin_make_function_object_for_setter_accessor (builtin_id, setter_id);
       break;
     }
-    default:
+    case ECMA_BUILTIN_PROPERTY_ACCESSOR_READ_ONLY:
     {
-      JERRY_ASSERT (curr_property_p->type == ECMA_BUILTIN_PROPERTY_ACCESSOR_READ_ONLY);
-
       is_accessor = true;
       getter_p = ecma_builtin_make_function_object_for_getter_accessor (builtin_id,
                                                                         curr_property_p->value);
       break;
     }
+    default:
+    {
+      value = ecma_builtin_make_property_value (curr_property_p);
+      break;
+    }
   }
 
   ecma_property_t *prop_p;
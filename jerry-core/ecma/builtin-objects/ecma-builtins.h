@@ -87,6 +87,10 @@ ecma_builtin_dispatch_call (ecma_object_t *obj_p, ecma_value_t this_arg_value,
 ecma_value_t
 ecma_builtin_dispatch_construct (ecma_object_t *obj_p,
                                  const ecma_value_t *arguments_list_p, ecma_length_t arguments_list_len);
+#ifndef CONFIG_ECMA_BUILTIN_ROM_DISABLE
+ecma_value_t
+ecma_builtin_try_to_get_property_value (ecma_object_t *object_p, ecma_string_t *string_p);
+#endif /* !CONFIG_ECMA_BUILTIN_ROM_DISABLE */
 ecma_property_t *
 ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, ecma_string_t *string_p);
 void
@@ -186,7 +186,8 @@ ecma_builtin_typedarray_prototype_exec_routine (ecma_value_t this_arg, /**< this
     ecma_value_t current_index =  ecma_make_uint32_value (index);
     ecma_value_t get_value = ecma_op_typedarray_get_index_prop (obj_p, index);
 
-    JERRY_ASSERT (ecma_is_value_number (get_value));
+    /* The value is undefined if a previous callback detached the buffer. */
+    JERRY_ASSERT (ecma_is_value_number (get_value) || ecma_is_value_undefined (get_value));
 
     ecma_value_t call_args[] = { get_value, current_index, this_arg };
 
@@ -440,7 +441,8 @@ ecma_builtin_typedarray_prototype_reduce_with_direction (ecma_value_t this_arg,
     ecma_value_t get_value = ecma_op_typedarray_get_index_prop (obj_p, index);
     ecma_value_t call_args[] = { accumulator, get_value, current_index, this_arg };
 
-    JERRY_ASSERT (ecma_is_value_number (get_value));
+    /* The value is undefined if a previous callback detached the buffer. */
+    JERRY_ASSERT (ecma_is_value_number (get_value) || ecma_is_value_undefined (get_value));
 
     ecma_value_t call_value = ecma_op_function_call (func_object_p,
                                                      ECMA_VALUE_UNDEFINED,
@@ -547,9 +549,9 @@ ecma_builtin_typedarray_prototype_filter (ecma_value_t this_arg, /**< this argum
 
   ecma_object_t *obj_p = ecma_get_object_from_value (this_arg);
   uint32_t len = ecma_typedarray_get_length (obj_p);
-  lit_utf8_byte_t *buffer_p = ecma_typedarray_get_buffer (obj_p);
   uint8_t shift = ecma_typedarray_get_element_size_shift (obj_p);
   uint8_t element_size = (uint8_t) (1 << shift);
+  lit_magic_string_id_t class_id = ecma_object_get_class_name (obj_p);
   ecma_object_t *func_object_p = ecma_get_object_from_value (cb_func_val);
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
 
@@ -567,7 +569,16 @@ ecma_builtin_typedarray_prototype_filter (ecma_value_t this_arg, /**< this argum
     ecma_value_t current_index = ecma_make_uint32_value (index);
     ecma_value_t get_value = ecma_op_typedarray_get_index_prop (obj_p, index);
 
-    JERRY_ASSERT (ecma_is_value_number (get_value));
+    /* The element is saved before the call, since the callback may detach the buffer. */
+    if (ecma_is_value_number (get_value))
+    {
+      memcpy (pass_value_p, ecma_typedarray_get_buffer (obj_p) + (index << shift), element_size);
+    }
+    else
+    {
+      JERRY_ASSERT (ecma_is_value_undefined (get_value));
+      ecma_set_typedarray_element (pass_value_p, ecma_number_make_nan (), class_id);
+    }
 
     ecma_value_t call_args[] = { get_value, current_index, this_arg };
 
@@ -575,12 +586,9 @@ ecma_builtin_typedarray_prototype_filter (ecma_value_t this_arg, /**< this argum
 
     if (ecma_op_to_boolean (call_value))
     {
-      memcpy (pass_value_p, buffer_p, element_size);
       pass_value_p += element_size;
     }
 
-    buffer_p += element_size;
-
     ECMA_FINALIZE (call_value);
 
     ecma_fast_free_value (current_index);
@@ -686,13 +694,21 @@ ecma_op_typedarray_set_with_typedarray (ecma_value_t this_arg, /**< this argumen
 
   /* 9. targetBuffer */
   ecma_object_t *target_arraybuffer_p = ecma_typedarray_get_arraybuffer (target_typedarray_p);
+
+  /* 12. srcBuffer */
+  ecma_object_t *src_arraybuffer_p = ecma_typedarray_get_arraybuffer (src_typedarray_p);
+
+  /* 10., 13. */
+  if (ecma_arraybuffer_is_detached (target_arraybuffer_p) || ecma_arraybuffer_is_detached (src_arraybuffer_p))
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("ArrayBuffer has been detached."));
+  }
+
   lit_utf8_byte_t *target_buffer_p = ecma_typedarray_get_buffer (target_typedarray_p);
 
   /* 11. targetLength */
   ecma_length_t target_length = ecma_typedarray_get_length (target_typedarray_p);
 
-  /* 12. srcBuffer */
-  ecma_object_t *src_arraybuffer_p = ecma_typedarray_get_arraybuffer (src_typedarray_p);
   lit_utf8_byte_t *src_buffer_p = ecma_typedarray_get_buffer (src_typedarray_p);
 
   /* 15. targetType */
@@ -863,7 +879,15 @@ ecma_builtin_typedarray_prototype_set (ecma_value_t this_arg, /**< this argument
 
     ECMA_OP_TO_NUMBER_TRY_CATCH (elem_num, elem, ret_val);
 
-    ecma_set_typedarray_element (target_buffer_p + target_byte_index, elem_num, target_class_id);
+    /* The getters and the conversions may detach the buffer. */
+    if (ecma_arraybuffer_is_detached (ecma_typedarray_get_arraybuffer (typedarray_p)))
+    {
+      ret_val = ecma_raise_type_error (ECMA_ERR_MSG ("ArrayBuffer has been detached."));
+    }
+    else
+    {
+      ecma_set_typedarray_element (target_buffer_p + target_byte_index, elem_num, target_class_id);
+    }
 
     ECMA_OP_TO_NUMBER_FINALIZE (elem_num);
     ECMA_FINALIZE (elem);
@@ -1229,7 +1253,6 @@ ecma_builtin_typedarray_prototype_fill (ecma_value_t this_arg, /**< this argumen
 
   ecma_object_t *typedarray_p = ecma_get_object_from_value (this_arg);
   ecma_object_t *typedarray_arraybuffer_p = ecma_typedarray_get_arraybuffer (typedarray_p);
-  lit_utf8_byte_t *buffer_p = ecma_arraybuffer_get_buffer (typedarray_arraybuffer_p);
   ecma_length_t length = ecma_typedarray_get_length (typedarray_p);
 
   uint32_t begin_index_uint32 = 0, end_index_uint32 = 0;
@@ -1257,6 +1280,13 @@ ecma_builtin_typedarray_prototype_fill (ecma_value_t this_arg, /**< this argumen
     return ret_value;
   }
 
+  /* The conversions may detach the buffer. */
+  if (ecma_arraybuffer_is_detached (typedarray_arraybuffer_p))
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG ("ArrayBuffer has been detached."));
+  }
+
+  lit_utf8_byte_t *buffer_p = ecma_arraybuffer_get_buffer (typedarray_arraybuffer_p);
   ecma_length_t subarray_length = 0;
 
   if (end_index_uint32 > begin_index_uint32)
@@ -1438,7 +1468,9 @@ ecma_builtin_typedarray_prototype_sort (ecma_value_t this_arg, /**< this argumen
                   ret_value);
   ECMA_FINALIZE (sort_value);
 
-  if (ecma_is_value_empty (ret_value))
+  /* The compare function may detach the buffer. */
+  if (ecma_is_value_empty (ret_value)
+      && !ecma_arraybuffer_is_detached (ecma_typedarray_get_arraybuffer (typedarray_p)))
   {
     byte_index = 0;
     buffer_index = 0;
@@ -1502,21 +1534,13 @@ ecma_builtin_typedarray_prototype_find (ecma_value_t this_arg, /**< this argumen
 
   ecma_object_t *typedarray_p = ecma_get_object_from_value (this_arg);
   uint32_t typedarray_length = ecma_typedarray_get_length (typedarray_p);
-  lit_magic_string_id_t class_id = ecma_object_get_class_name (typedarray_p);
-  lit_utf8_byte_t *typedarray_buffer_p = ecma_typedarray_get_buffer (typedarray_p);
-  uint8_t shift = ecma_typedarray_get_element_size_shift (typedarray_p);
-  uint8_t element_size = (uint8_t) (1 << shift);
 
-  uint32_t buffer_index = 0;
-  uint32_t limit = typedarray_length * element_size;
-
-  for (uint32_t byte_index = 0;  byte_index < limit; byte_index += element_size)
+  for (uint32_t buffer_index = 0; buffer_index < typedarray_length; buffer_index++)
   {
-    JERRY_ASSERT (buffer_index < typedarray_length);
-    ecma_number_t element_num = ecma_get_typedarray_element (typedarray_buffer_p + byte_index, class_id);
-    ecma_value_t element_value = ecma_make_number_value (element_num);
+    /* The value is undefined if a previous predicate call detached the buffer. */
+    ecma_value_t element_value = ecma_op_typedarray_get_index_prop (typedarray_p, buffer_index);
 
-    ecma_value_t call_args[] = { element_value, ecma_make_uint32_value (buffer_index++), this_arg };
+    ecma_value_t call_args[] = { element_value, ecma_make_uint32_value (buffer_index), this_arg };
 
     ecma_value_t call_value = ecma_op_function_call (func_object_p, predicate_this_arg, call_args, 3);
 
@@ -21,6 +21,7 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "jerryscript-port.h"
 #include "jmem.h"
 
 #ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
@@ -176,6 +177,11 @@ ecma_arraybuffer_get_length (ecma_object_t *object_p) /**< pointer to the ArrayB
 {
   JERRY_ASSERT (ecma_object_class_is (object_p, LIT_MAGIC_STRING_ARRAY_BUFFER_UL));
 
+  if (ECMA_ARRAYBUFFER_IS_DETACHED (object_p))
+  {
+    return 0;
+  }
+
   ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
   return ext_object_p->u.class_prop.u.length;
 } /* ecma_arraybuffer_get_length */
@@ -203,6 +209,109 @@ ecma_arraybuffer_get_buffer (ecma_object_t *object_p) /**< pointer to the ArrayB
   }
 } /* ecma_arraybuffer_get_buffer */
 
+/**
+ * Helper function: check whether the memory of the arraybuffer object has been detached
+ *
+ * @return true - if the ArrayBuffer is detached
+ *         false - otherwise
+ */
+inline bool JERRY_ATTR_PURE JERRY_ATTR_ALWAYS_INLINE
+ecma_arraybuffer_is_detached (ecma_object_t *object_p) /**< pointer to the ArrayBuffer object */
+{
+  JERRY_ASSERT (ecma_object_class_is (object_p, LIT_MAGIC_STRING_ARRAY_BUFFER_UL));
+
+  return ECMA_ARRAYBUFFER_IS_DETACHED (object_p);
+} /* ecma_arraybuffer_is_detached */
+
+/**
+ * Helper function: check whether the memory of the arraybuffer object can be detached
+ *
+ * @return true - if the ArrayBuffer can be detached
+ *         false - otherwise
+ */
+bool JERRY_ATTR_PURE
+ecma_arraybuffer_is_detachable (ecma_object_t *object_p) /**< pointer to the ArrayBuffer object */
+{
+  JERRY_ASSERT (ecma_object_class_is (object_p, LIT_MAGIC_STRING_ARRAY_BUFFER_UL));
+
+  return !ECMA_ARRAYBUFFER_IS_DETACHED (object_p);
+} /* ecma_arraybuffer_is_detachable */
+
+/**
+ * Helper function: detach the memory of the arraybuffer object
+ *
+ * After detaching, the length of the ArrayBuffer and its TypedArray views become zero.
+ * If buffer_pp is not NULL, the ownership of the memory is passed to the caller, i.e. the
+ * free callback of the memory is not called by the ArrayBuffer anymore. Otherwise the
+ * memory is released.
+ *
+ * Note:
+ *      the memory of ArrayBuffers created by the engine is part of the object, so it is
+ *      copied into memory allocated by jerry_port_alloc_arraybuffer, which does not
+ *      belong to any context
+ *
+ * See also: ES2015 24.1.1.3
+ *
+ * @return ECMA_VALUE_TRUE - if the ArrayBuffer is detached
+ *         raised RangeError - if the memory cannot be allocated (the ArrayBuffer is not detached)
+ */
+ecma_value_t
+ecma_arraybuffer_detach (ecma_object_t *object_p, /**< pointer to the ArrayBuffer object */
+                         void **buffer_pp, /**< [out] detached memory (NULL if the memory is released) */
+                         ecma_object_native_free_callback_t *free_cb_p) /**< [out] free callback of the memory */
+{
+  JERRY_ASSERT (ecma_arraybuffer_is_detachable (object_p));
+  JERRY_ASSERT ((buffer_pp == NULL) == (free_cb_p == NULL));
+
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+  if (ECMA_ARRAYBUFFER_HAS_EXTERNAL_MEMORY (ext_object_p))
+  {
+    ecma_arraybuffer_external_info *array_p = (ecma_arraybuffer_external_info *) object_p;
+
+    if (buffer_pp != NULL)
+    {
+      *buffer_pp = array_p->buffer_p;
+      *free_cb_p = array_p->free_cb;
+    }
+    else if (array_p->free_cb != NULL)
+    {
+      array_p->free_cb (array_p->buffer_p);
+    }
+
+    ext_object_p->u.class_prop.u.length = 0;
+    array_p->buffer_p = NULL;
+    array_p->free_cb = NULL;
+  }
+  else if (buffer_pp != NULL)
+  {
+    /* The length is kept, since the object is freed with its memory. */
+    const ecma_length_t length = ext_object_p->u.class_prop.u.length;
+
+    *buffer_pp = NULL;
+    *free_cb_p = NULL;
+
+    if (length > 0)
+    {
+      void *buffer_p = jerry_port_alloc_arraybuffer (length);
+
+      if (buffer_p == NULL)
+      {
+        return ecma_raise_range_error (ECMA_ERR_MSG ("Cannot allocate memory for the detached ArrayBuffer."));
+      }
+
+      memcpy (buffer_p, ext_object_p + 1, length);
+
+      *buffer_pp = buffer_p;
+      *free_cb_p = jerry_port_free_arraybuffer;
+    }
+  }
+
+  ext_object_p->u.class_prop.extra_info |= ECMA_ARRAYBUFFER_DETACHED;
+
+  return ECMA_VALUE_TRUE;
+} /* ecma_arraybuffer_detach */
+
 /**
  * @}
  * @}
@@ -42,6 +42,12 @@ lit_utf8_byte_t * JERRY_ATTR_PURE
 ecma_arraybuffer_get_buffer (ecma_object_t *obj_p);
 ecma_length_t JERRY_ATTR_PURE
 ecma_arraybuffer_get_length (ecma_object_t *obj_p);
+bool JERRY_ATTR_PURE
+ecma_arraybuffer_is_detached (ecma_object_t *obj_p);
+bool JERRY_ATTR_PURE
+ecma_arraybuffer_is_detachable (ecma_object_t *obj_p);
+ecma_value_t
+ecma_arraybuffer_detach (ecma_object_t *obj_p, void **buffer_pp, ecma_object_native_free_callback_t *free_cb_p);
 bool
 ecma_is_arraybuffer (ecma_value_t val);
 
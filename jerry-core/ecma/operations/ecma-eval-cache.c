@@ -0,0 +1,480 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "byte-code.h"
+#include "ecma-eval-cache.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "js-parser.h"
+#include "lit-strings.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaevalcache Compiled code cache of eval
+ * @{
+ */
+
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+
+/**
+ * Get the characters of an eval cache entry.
+ *
+ * @return pointer to the characters of the arguments, which are followed by the source code
+ */
+#define ECMA_EVAL_CACHE_GET_CHARS(entry_p) ((lit_utf8_byte_t *) ((entry_p) + 1))
+
+/**
+ * Get the size of an eval cache entry.
+ *
+ * @return size in bytes
+ */
+#define ECMA_EVAL_CACHE_GET_SIZE(args_size, source_size) \
+  (sizeof (ecma_eval_cache_entry_t) + (args_size) + (source_size))
+
+JERRY_STATIC_ASSERT ((ECMA_EVAL_CACHE_SIZE & (ECMA_EVAL_CACHE_SIZE - 1)) == 0 && ECMA_EVAL_CACHE_SIZE > 0,
+                     eval_cache_size_must_be_a_power_of_2);
+
+/**
+ * Get the entry stored in a slot of the eval cache.
+ *
+ * @return pointer to the entry - if the slot is used,
+ *         NULL - otherwise
+ */
+static inline ecma_eval_cache_entry_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_eval_cache_get_entry (uint32_t idx) /**< slot index */
+{
+  return JMEM_CP_GET_POINTER (ecma_eval_cache_entry_t, JERRY_CONTEXT (eval_cache)[idx]);
+} /* ecma_eval_cache_get_entry */
+
+/**
+ * Search for a source code in the eval cache.
+ *
+ * Note:
+ *      the cache is an open addressing hash table which is at most half full,
+ *      so the search always ends at a slot which holds the source code or a free slot
+ *
+ * @return index of the slot of the source code - if found
+ *         index of a free slot                 - otherwise
+ */
+static uint32_t
+ecma_eval_cache_find (const lit_utf8_byte_t *args_p, /**< arguments characters */
+                      uint32_t args_size, /**< size of the arguments */
+                      const lit_utf8_byte_t *source_p, /**< source code characters */
+                      uint32_t source_size, /**< size of the source code */
+                      uint32_t parse_opts, /**< ecma_parse_opts_t option bits */
+                      lit_string_hash_t hash) /**< hash of the arguments and the source code */
+{
+  uint32_t idx = (uint32_t) hash & (ECMA_EVAL_CACHE_TABLE_SIZE - 1);
+
+  while (true)
+  {
+    ecma_eval_cache_entry_t *entry_p = ecma_eval_cache_get_entry (idx);
+
+    if (entry_p == NULL)
+    {
+      return idx;
+    }
+
+    if (entry_p->hash == hash
+        && entry_p->parse_opts == parse_opts
+        && entry_p->args_size == args_size
+        && entry_p->source_size == source_size)
+    {
+      lit_utf8_byte_t *chars_p = ECMA_EVAL_CACHE_GET_CHARS (entry_p);
+
+      if ((args_size == 0 || memcmp (chars_p, args_p, args_size) == 0)
+          && memcmp (chars_p + args_size, source_p, source_size) == 0)
+      {
+        return idx;
+      }
+    }
+
+    idx = (idx + 1) & (ECMA_EVAL_CACHE_TABLE_SIZE - 1);
+  }
+} /* ecma_eval_cache_find */
+
+/**
+ * Mark an entry of the eval cache as the most recently used one.
+ */
+static void
+ecma_eval_cache_touch (ecma_eval_cache_entry_t *entry_p) /**< entry */
+{
+  if (JERRY_UNLIKELY (++JERRY_CONTEXT (eval_cache_clock) == 0))
+  {
+    /* The order of the entries is forgotten when the clock overflows. */
+    for (uint32_t i = 0; i < ECMA_EVAL_CACHE_TABLE_SIZE; i++)
+    {
+      ecma_eval_cache_entry_t *current_p = ecma_eval_cache_get_entry (i);
+
+      if (current_p != NULL)
+      {
+        current_p->last_used = 0;
+      }
+    }
+
+    JERRY_CONTEXT (eval_cache_clock) = 1;
+    JERRY_CONTEXT (eval_cache_gc_clock) = 0;
+  }
+
+  entry_p->last_used = JERRY_CONTEXT (eval_cache_clock);
+} /* ecma_eval_cache_touch */
+
+/**
+ * Free an eval cache entry.
+ */
+static void
+ecma_eval_cache_free_entry (ecma_eval_cache_entry_t *entry_p) /**< entry */
+{
+  ecma_bytecode_deref (entry_p->bytecode_p);
+  jmem_heap_free_block (entry_p, ECMA_EVAL_CACHE_GET_SIZE (entry_p->args_size, entry_p->source_size));
+} /* ecma_eval_cache_free_entry */
+
+/**
+ * Remove an entry from the eval cache, and move the following entries
+ * of its cluster to the slots where they are found by ecma_eval_cache_find.
+ */
+static void
+ecma_eval_cache_remove (uint32_t idx) /**< slot index */
+{
+  ecma_eval_cache_free_entry (ecma_eval_cache_get_entry (idx));
+  JERRY_CONTEXT (eval_cache)[idx] = JMEM_CP_NULL;
+  JERRY_CONTEXT (eval_cache_count)--;
+
+  idx = (idx + 1) & (ECMA_EVAL_CACHE_TABLE_SIZE - 1);
+
+  while (JERRY_CONTEXT (eval_cache)[idx] != JMEM_CP_NULL)
+  {
+    jmem_cpointer_t entry_cp = JERRY_CONTEXT (eval_cache)[idx];
+    ecma_eval_cache_entry_t *entry_p = ecma_eval_cache_get_entry (idx);
+    lit_utf8_byte_t *chars_p = ECMA_EVAL_CACHE_GET_CHARS (entry_p);
+
+    JERRY_CONTEXT (eval_cache)[idx] = JMEM_CP_NULL;
+
+    uint32_t new_idx = ecma_eval_cache_find (chars_p,
+                                             entry_p->args_size,
+                                             chars_p + entry_p->args_size,
+                                             entry_p->source_size,
+                                             entry_p->parse_opts,
+                                             entry_p->hash);
+
+    JERRY_CONTEXT (eval_cache)[new_idx] = entry_cp;
+
+    idx = (idx + 1) & (ECMA_EVAL_CACHE_TABLE_SIZE - 1);
+  }
+} /* ecma_eval_cache_remove */
+
+/**
+ * Check whether a cached compiled code can be shared by one more evaluation.
+ *
+ * Note:
+ *      the function objects created by the evaluations reference the nested
+ *      function literals, so their reference counters are checked as well
+ *
+ * @return true - if the reference counters of the compiled code and its function literals are low enough,
+ *         false - otherwise
+ */
+static bool
+ecma_eval_cache_is_reusable (const ecma_compiled_code_t *bytecode_p) /**< compiled code */
+{
+  if (bytecode_p->refs >= ECMA_EVAL_CACHE_MAX_REFS)
+  {
+    return false;
+  }
+
+  if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_FUNCTION))
+  {
+    return true;
+  }
+
+  ecma_value_t *literal_start_p;
+  uint32_t literal_end;
+  uint32_t const_literal_end;
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_p;
+    literal_end = args_p->literal_end;
+    const_literal_end = args_p->const_literal_end;
+
+    literal_start_p = (ecma_value_t *) ((uint8_t *) bytecode_p + sizeof (cbc_uint16_arguments_t));
+    literal_start_p -= args_p->register_end;
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_p;
+    literal_end = args_p->literal_end;
+    const_literal_end = args_p->const_literal_end;
+
+    literal_start_p = (ecma_value_t *) ((uint8_t *) bytecode_p + sizeof (cbc_uint8_arguments_t));
+    literal_start_p -= args_p->register_end;
+  }
+
+  for (uint32_t i = const_literal_end; i < literal_end; i++)
+  {
+    const ecma_compiled_code_t *literal_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t,
+                                                                             literal_start_p[i]);
+
+    /* Self references are ignored. */
+    if (literal_p != bytecode_p && !ecma_eval_cache_is_reusable (literal_p))
+    {
+      return false;
+    }
+  }
+
+  return true;
+} /* ecma_eval_cache_is_reusable */
+
+/**
+ * Lookup the compiled code of a source code in the eval cache.
+ *
+ * @return compiled code with an increased reference counter - if the source code is cached,
+ *         NULL - otherwise
+ */
+static ecma_compiled_code_t *
+ecma_eval_cache_lookup (const lit_utf8_byte_t *args_p, /**< arguments characters */
+                        uint32_t args_size, /**< size of the arguments */
+                        const lit_utf8_byte_t *source_p, /**< source code characters */
+                        uint32_t source_size, /**< size of the source code */
+                        uint32_t parse_opts, /**< ecma_parse_opts_t option bits */
+                        lit_string_hash_t hash) /**< hash of the arguments and the source code */
+{
+  uint32_t idx = ecma_eval_cache_find (args_p, args_size, source_p, source_size, parse_opts, hash);
+  ecma_eval_cache_entry_t *entry_p = ecma_eval_cache_get_entry (idx);
+
+  if (entry_p == NULL)
+  {
+    return NULL;
+  }
+
+  if (!ecma_eval_cache_is_reusable (entry_p->bytecode_p))
+  {
+    /* The entry is replaced by a new compiled code. */
+    ecma_eval_cache_remove (idx);
+    return NULL;
+  }
+
+  ecma_eval_cache_touch (entry_p);
+
+  ecma_bytecode_ref (entry_p->bytecode_p);
+  return entry_p->bytecode_p;
+} /* ecma_eval_cache_lookup */
+
+/**
+ * Insert the compiled code of a source code into the eval cache, and evict
+ * the least recently used entry when the cache is full.
+ */
+static void
+ecma_eval_cache_insert (const lit_utf8_byte_t *args_p, /**< arguments characters */
+                        uint32_t args_size, /**< size of the arguments */
+                        const lit_utf8_byte_t *source_p, /**< source code characters */
+                        uint32_t source_size, /**< size of the source code */
+                        uint32_t parse_opts, /**< ecma_parse_opts_t option bits */
+                        lit_string_hash_t hash, /**< hash of the arguments and the source code */
+                        ecma_compiled_code_t *bytecode_p) /**< compiled code */
+{
+  size_t size = ECMA_EVAL_CACHE_GET_SIZE (args_size, source_size);
+  ecma_eval_cache_entry_t *entry_p = (ecma_eval_cache_entry_t *) jmem_heap_alloc_block_null_on_error (size);
+
+  if (entry_p == NULL)
+  {
+    return;
+  }
+
+  ecma_bytecode_ref (bytecode_p);
+
+  entry_p->bytecode_p = bytecode_p;
+  entry_p->parse_opts = parse_opts;
+  entry_p->args_size = args_size;
+  entry_p->source_size = source_size;
+  entry_p->hash = hash;
+
+  lit_utf8_byte_t *chars_p = ECMA_EVAL_CACHE_GET_CHARS (entry_p);
+
+  if (args_size > 0)
+  {
+    memcpy (chars_p, args_p, args_size);
+  }
+
+  memcpy (chars_p + args_size, source_p, source_size);
+
+  /* The allocation may have run the garbage collector, so the cache is read after it. */
+  if (JERRY_CONTEXT (eval_cache_count) >= ECMA_EVAL_CACHE_SIZE)
+  {
+    uint32_t lru_idx = 0;
+    uint32_t lru_age = 0;
+
+    for (uint32_t i = 0; i < ECMA_EVAL_CACHE_TABLE_SIZE; i++)
+    {
+      ecma_eval_cache_entry_t *current_p = ecma_eval_cache_get_entry (i);
+
+      if (current_p != NULL && JERRY_CONTEXT (eval_cache_clock) - current_p->last_used >= lru_age)
+      {
+        lru_idx = i;
+        lru_age = JERRY_CONTEXT (eval_cache_clock) - current_p->last_used;
+      }
+    }
+
+    ecma_eval_cache_remove (lru_idx);
+  }
+
+  uint32_t idx = ecma_eval_cache_find (args_p, args_size, source_p, source_size, parse_opts, hash);
+  JERRY_ASSERT (JERRY_CONTEXT (eval_cache)[idx] == JMEM_CP_NULL);
+
+  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (eval_cache)[idx], entry_p);
+  JERRY_CONTEXT (eval_cache_count)++;
+  ecma_eval_cache_touch (entry_p);
+} /* ecma_eval_cache_insert */
+
+/**
+ * Parse a script of indirect eval or the Function constructor, and reuse the compiled
+ * code when the same source code is parsed again with the same options.
+ *
+ * Note:
+ *      the cache is not used by direct eval and when the debugger is connected
+ *
+ * @return the result of parser_parse_script
+ */
+ecma_value_t
+ecma_eval_cache_parse_script (const lit_utf8_byte_t *args_p, /**< arguments characters */
+                              size_t args_size, /**< size of the arguments */
+                              const lit_utf8_byte_t *source_p, /**< source code characters */
+                              size_t source_size, /**< size of the source code */
+                              uint32_t parse_opts, /**< ecma_parse_opts_t option bits */
+                              ecma_compiled_code_t **bytecode_data_p) /**< [out] compiled code */
+{
+  bool is_cacheable = ((parse_opts & ECMA_PARSE_DIRECT_EVAL) == 0
+                       && args_size + source_size <= ECMA_EVAL_CACHE_MAX_SOURCE_SIZE);
+
+#ifdef JERRY_DEBUGGER
+  if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+  {
+    /* The parser sends the source code and the breakpoints to the debugger client. */
+    is_cacheable = false;
+  }
+#endif /* JERRY_DEBUGGER */
+
+  if (!is_cacheable)
+  {
+    return parser_parse_script (args_p, args_size, source_p, source_size, parse_opts, bytecode_data_p);
+  }
+
+  lit_string_hash_t hash = lit_utf8_string_calc_hash (args_p, (lit_utf8_size_t) args_size);
+  hash = lit_utf8_string_hash_combine (hash, source_p, (lit_utf8_size_t) source_size);
+
+  ecma_compiled_code_t *bytecode_p = ecma_eval_cache_lookup (args_p,
+                                                             (uint32_t) args_size,
+                                                             source_p,
+                                                             (uint32_t) source_size,
+                                                             parse_opts,
+                                                             hash);
+
+#ifdef JMEM_STATS
+  jmem_stats_eval_cache_lookup (bytecode_p != NULL);
+#endif /* JMEM_STATS */
+
+  if (bytecode_p != NULL)
+  {
+    *bytecode_data_p = bytecode_p;
+    return ECMA_VALUE_TRUE;
+  }
+
+  ecma_value_t ret_value = parser_parse_script (args_p,
+                                                args_size,
+                                                source_p,
+                                                source_size,
+                                                parse_opts,
+                                                bytecode_data_p);
+
+  if (!ECMA_IS_VALUE_ERROR (ret_value))
+  {
+    ecma_eval_cache_insert (args_p,
+                            (uint32_t) args_size,
+                            source_p,
+                            (uint32_t) source_size,
+                            parse_opts,
+                            hash,
+                            *bytecode_data_p);
+  }
+
+  return ret_value;
+} /* ecma_eval_cache_parse_script */
+
+/**
+ * Trim the eval cache when the garbage collector runs.
+ *
+ * Note:
+ *      the entries which are not used during the last ECMA_EVAL_CACHE_SIZE uses of the cache are freed,
+ *      and all entries are freed when the cache is not used since the previous garbage collection or
+ *      the severity is high
+ */
+void
+ecma_eval_cache_gc_run (jmem_free_unused_memory_severity_t severity) /**< severity of the request */
+{
+  uint32_t clock = JERRY_CONTEXT (eval_cache_clock);
+
+  if (severity == JMEM_FREE_UNUSED_MEMORY_SEVERITY_HIGH
+      || clock == JERRY_CONTEXT (eval_cache_gc_clock))
+  {
+    ecma_eval_cache_clear ();
+    return;
+  }
+
+  JERRY_CONTEXT (eval_cache_gc_clock) = clock;
+
+  uint32_t i = 0;
+
+  while (i < ECMA_EVAL_CACHE_TABLE_SIZE)
+  {
+    ecma_eval_cache_entry_t *entry_p = ecma_eval_cache_get_entry (i);
+
+    if (entry_p != NULL && clock - entry_p->last_used >= ECMA_EVAL_CACHE_SIZE)
+    {
+      /* Another entry may be moved into this slot, so it is checked again. */
+      ecma_eval_cache_remove (i);
+      continue;
+    }
+
+    i++;
+  }
+} /* ecma_eval_cache_gc_run */
+
+/**
+ * Free all entries of the eval cache.
+ */
+void
+ecma_eval_cache_clear (void)
+{
+  for (uint32_t i = 0; i < ECMA_EVAL_CACHE_TABLE_SIZE; i++)
+  {
+    ecma_eval_cache_entry_t *entry_p = ecma_eval_cache_get_entry (i);
+
+    if (entry_p != NULL)
+    {
+      ecma_eval_cache_free_entry (entry_p);
+      JERRY_CONTEXT (eval_cache)[i] = JMEM_CP_NULL;
+    }
+  }
+
+  JERRY_CONTEXT (eval_cache_count) = 0;
+} /* ecma_eval_cache_clear */
+
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+
+/**
+ * @}
+ * @}
+ */
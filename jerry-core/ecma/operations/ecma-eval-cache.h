@@ -0,0 +1,43 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_EVAL_CACHE_H
+#define ECMA_EVAL_CACHE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmaevalcache Compiled code cache of eval
+ * @{
+ */
+
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+
+ecma_value_t ecma_eval_cache_parse_script (const lit_utf8_byte_t *args_p, size_t args_size,
+                                           const lit_utf8_byte_t *source_p, size_t source_size,
+                                           uint32_t parse_opts, ecma_compiled_code_t **bytecode_data_p);
+void ecma_eval_cache_gc_run (jmem_free_unused_memory_severity_t severity);
+void ecma_eval_cache_clear (void);
+
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_EVAL_CACHE_H */
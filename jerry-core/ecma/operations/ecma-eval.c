@@ -16,6 +16,7 @@
 #include "ecma-builtins.h"
 #include "ecma-exceptions.h"
 #include "ecma-eval.h"
+#include "ecma-eval-cache.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
@@ -101,12 +102,21 @@ ecma_op_eval_chars_buffer (const lit_utf8_byte_t *code_p, /**< code characters b
   ECMA_CLEAR_SUPER_EVAL_PARSER_OPTS ();
 #endif /* !CONFIG_DISABLE_ES2015_CLASS */
 
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  ecma_value_t parse_status = ecma_eval_cache_parse_script (NULL,
+                                                            0,
+                                                            code_p,
+                                                            code_buffer_size,
+                                                            parse_opts,
+                                                            &bytecode_data_p);
+#else /* CONFIG_ECMA_EVAL_CACHE_DISABLE */
   ecma_value_t parse_status = parser_parse_script (NULL,
                                                    0,
                                                    code_p,
                                                    code_buffer_size,
                                                    parse_opts,
                                                    &bytecode_data_p);
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
 
   if (ECMA_IS_VALUE_ERROR (parse_status))
   {
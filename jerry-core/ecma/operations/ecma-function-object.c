@@ -475,7 +475,7 @@ ecma_op_find_super_declerative_lex_env (ecma_object_t *lex_env_p) /**< starting
 
     if (ecma_get_lex_env_type (lex_env_outer_p) == ECMA_LEXICAL_ENVIRONMENT_SUPER_OBJECT_BOUND)
     {
-      JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+      JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END);
       return lex_env_p;
     }
 
@@ -607,6 +607,41 @@ ecma_op_set_class_prototype (ecma_value_t completion_value, /**< completion_valu
 } /* ecma_op_set_class_prototype */
 #endif /* !CONFIG_DISABLE_ES2015_CLASS */
 
+/**
+ * Create the lexical environment of a function call.
+ *
+ * The variables of the function are stored in slots when the byte code has a scope info block.
+ *
+ * @return pointer to the lexical environment
+ */
+static ecma_object_t *
+ecma_op_create_function_call_lex_env (ecma_object_t *scope_p, /**< function scope */
+                                      const ecma_compiled_code_t *bytecode_data_p) /**< function byte code */
+{
+  if (bytecode_data_p->status_flags & CBC_CODE_FLAGS_SCOPE_INFO)
+  {
+    uint32_t register_end;
+
+    if (bytecode_data_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+    {
+      register_end = ((cbc_uint16_arguments_t *) bytecode_data_p)->register_end;
+    }
+    else
+    {
+      register_end = ((cbc_uint8_arguments_t *) bytecode_data_p)->register_end;
+    }
+
+    uint32_t var_end = ecma_compiled_code_get_scope_info_end (bytecode_data_p)[-1];
+
+    if (var_end > register_end)
+    {
+      return ecma_create_slot_lex_env (scope_p, bytecode_data_p, var_end - register_end);
+    }
+  }
+
+  return ecma_create_decl_lex_env (scope_p);
+} /* ecma_op_create_function_call_lex_env */
+
 /**
  * [[Call]] implementation for Function objects,
  * created through 13.2 (ECMA_OBJECT_TYPE_FUNCTION)
@@ -701,7 +736,7 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
       }
       else
       {
-        local_env_p = ecma_create_decl_lex_env (scope_p);
+        local_env_p = ecma_op_create_function_call_lex_env (scope_p, bytecode_data_p);
         if (bytecode_data_p->status_flags & CBC_CODE_FLAGS_ARGUMENTS_NEEDED)
         {
           ecma_op_create_arguments_object (func_obj_p,
@@ -776,7 +811,7 @@ ecma_op_function_call (ecma_object_t *func_obj_p, /**< Function object */
 
       if (!is_no_lex_env)
       {
-        local_env_p = ecma_create_decl_lex_env (scope_p);
+        local_env_p = ecma_op_create_function_call_lex_env (scope_p, bytecode_data_p);
 
         JERRY_ASSERT (!(bytecode_data_p->status_flags & CBC_CODE_FLAGS_ARGUMENTS_NEEDED));
       }
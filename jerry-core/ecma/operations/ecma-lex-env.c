@@ -88,8 +88,14 @@ ecma_op_has_binding (ecma_object_t *lex_env_p, /**< lexical environment */
 
   ecma_lexical_environment_type_t lex_env_type = ecma_get_lex_env_type (lex_env_p);
 
-  if (lex_env_type == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  if (lex_env_type <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
   {
+    if (lex_env_type == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS
+        && ecma_find_lex_env_slot (lex_env_p, name_p) != NULL)
+    {
+      return true;
+    }
+
     ecma_property_t *property_p = ecma_find_named_property (lex_env_p, name_p);
 
     return (property_p != NULL);
@@ -121,8 +127,15 @@ ecma_op_create_mutable_binding (ecma_object_t *lex_env_p, /**< lexical environme
                 && ecma_is_lexical_environment (lex_env_p));
   JERRY_ASSERT (name_p != NULL);
 
-  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  if (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
   {
+    if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS
+        && ecma_find_lex_env_slot (lex_env_p, name_p) != NULL)
+    {
+      /* Variables of the function are created with the lexical environment. */
+      return ECMA_VALUE_EMPTY;
+    }
+
     uint8_t prop_attributes = ECMA_PROPERTY_FLAG_WRITABLE;
 
     if (is_deletable)
@@ -185,8 +198,19 @@ ecma_op_set_mutable_binding (ecma_object_t *lex_env_p, /**< lexical environment
                 && ecma_is_lexical_environment (lex_env_p));
   JERRY_ASSERT (name_p != NULL);
 
-  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  if (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
   {
+    if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+    {
+      ecma_value_t *slot_p = ecma_find_lex_env_slot (lex_env_p, name_p);
+
+      if (slot_p != NULL)
+      {
+        ecma_value_assign_value (slot_p, value);
+        return ECMA_VALUE_EMPTY;
+      }
+    }
+
     ecma_property_t *property_p = ecma_find_named_property (lex_env_p, name_p);
 
     JERRY_ASSERT (property_p != NULL
@@ -240,8 +264,18 @@ ecma_op_get_binding_value (ecma_object_t *lex_env_p, /**< lexical environment */
                 && ecma_is_lexical_environment (lex_env_p));
   JERRY_ASSERT (name_p != NULL);
 
-  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  if (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
   {
+    if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+    {
+      ecma_value_t *slot_p = ecma_find_lex_env_slot (lex_env_p, name_p);
+
+      if (slot_p != NULL)
+      {
+        return ecma_copy_value (*slot_p);
+      }
+    }
+
     ecma_property_value_t *prop_value_p = ecma_get_named_data_property (lex_env_p, name_p);
 
     return ecma_copy_value (prop_value_p->value);
@@ -288,8 +322,15 @@ ecma_op_delete_binding (ecma_object_t *lex_env_p, /**< lexical environment */
   JERRY_ASSERT (name_p != NULL);
 
 
-  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  if (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
   {
+    if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS
+        && ecma_find_lex_env_slot (lex_env_p, name_p) != NULL)
+    {
+      /* Variables are not deletable. */
+      return ECMA_VALUE_FALSE;
+    }
+
     ecma_property_t *prop_p = ecma_find_named_property (lex_env_p, name_p);
     ecma_value_t ret_val;
 
@@ -339,7 +380,7 @@ ecma_op_implicit_this_value (ecma_object_t *lex_env_p) /**< lexical environment
   JERRY_ASSERT (lex_env_p != NULL
                 && ecma_is_lexical_environment (lex_env_p));
 
-  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+  if (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
   {
     return ECMA_VALUE_UNDEFINED;
   }
@@ -366,7 +407,18 @@ ecma_op_create_immutable_binding (ecma_object_t *lex_env_p, /**< lexical environ
 {
   JERRY_ASSERT (lex_env_p != NULL
                 && ecma_is_lexical_environment (lex_env_p));
-  JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+  JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END);
+
+  if (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+  {
+    ecma_value_t *slot_p = ecma_find_lex_env_slot (lex_env_p, name_p);
+
+    if (slot_p != NULL)
+    {
+      ecma_value_assign_value (slot_p, value);
+      return;
+    }
+  }
 
   /*
    * Warning:
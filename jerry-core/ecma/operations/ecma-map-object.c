@@ -576,6 +576,42 @@ ecma_op_map_delete (ecma_value_t this_arg, /**< this argument */
   return ECMA_VALUE_TRUE;
 } /* ecma_op_map_delete */
 
+/**
+ * Collect the items of a map in insertion order.
+ *
+ * Note:
+ *      keys and values are alternating in the returned collection
+ *
+ * @return collection of the items
+ *         Returned collection must be freed with ecma_free_values_collection.
+ */
+ecma_collection_header_t *
+ecma_op_map_get_items (ecma_map_object_t *map_object_p) /**< map object */
+{
+  JERRY_ASSERT (ecma_get_object_type (&map_object_p->header.object) == ECMA_OBJECT_TYPE_CLASS
+                && (map_object_p->header.u.class_prop.class_id == LIT_MAGIC_STRING_MAP_UL));
+
+  ecma_collection_header_t *items_p = ecma_new_values_collection ();
+  ecma_map_object_chunk_t *chunk_p = ECMA_GET_POINTER (ecma_map_object_chunk_t, map_object_p->first_chunk_cp);
+
+  while (chunk_p != NULL)
+  {
+    for (int i = 0; i < ECMA_MAP_OBJECT_ITEM_COUNT; i++)
+    {
+      if (chunk_p->items[i] != ECMA_VALUE_ARRAY_HOLE)
+      {
+        ecma_append_to_values_collection (items_p, chunk_p->items[i], 0);
+      }
+    }
+
+    ecma_value_t next = chunk_p->items[ECMA_MAP_OBJECT_ITEM_COUNT];
+    chunk_p = (ecma_map_object_chunk_t *) ecma_get_pointer_from_value (next);
+  }
+
+  JERRY_ASSERT (items_p->item_count == 2 * map_object_p->header.u.class_prop.u.length);
+  return items_p;
+} /* ecma_op_map_get_items */
+
 /**
  * @}
  * @}
@@ -35,6 +35,7 @@ ecma_value_t ecma_op_map_set (ecma_value_t this_arg, ecma_value_t key_arg, ecma_
 void ecma_op_map_clear_map (ecma_map_object_t *map_object_p);
 ecma_value_t ecma_op_map_clear (ecma_value_t this_arg);
 ecma_value_t ecma_op_map_delete (ecma_value_t this_arg, ecma_value_t key_arg);
+ecma_collection_header_t *ecma_op_map_get_items (ecma_map_object_t *map_object_p);
 
 /**
  * @}
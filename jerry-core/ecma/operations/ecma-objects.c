@@ -16,6 +16,7 @@
 #include "ecma-array-object.h"
 #include "ecma-builtins.h"
 #include "ecma-builtin-helpers.h"
+#include "ecma-enum-cache.h"
 #include "ecma-exceptions.h"
 #include "ecma-gc.h"
 #include "ecma-globals.h"
@@ -525,6 +526,16 @@ ecma_op_object_find_own (ecma_value_t base_value, /**< base value */
   {
     if (ecma_get_object_is_builtin (object_p))
     {
+#ifndef CONFIG_ECMA_BUILTIN_ROM_DISABLE
+      /* Reading a built-in property does not instantiate it when possible. */
+      ecma_value_t value = ecma_builtin_try_to_get_property_value (object_p, property_name_p);
+
+      if (value != ECMA_VALUE_EMPTY)
+      {
+        return value;
+      }
+#endif /* !CONFIG_ECMA_BUILTIN_ROM_DISABLE */
+
       property_p = ecma_builtin_try_to_instantiate_property (object_p, property_name_p);
     }
     else if (ecma_is_normal_or_arrow_function (type))
@@ -658,13 +669,15 @@ ecma_op_object_get_own_data_prop (ecma_object_t *object_p, /**< the object */
 
 #ifndef JERRY_NDEBUG
   /* Because ecma_op_object_find_own might create a property
-   * this check is executed after the function return. */
+   * this check is executed after the function return. Built-in
+   * properties might be read without being instantiated. */
   ecma_property_t *property_p = ecma_find_named_property (object_p,
                                                           property_name_p);
 
-  JERRY_ASSERT (property_p != NULL
-                && ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
-                && !ecma_is_property_configurable (*property_p));
+  JERRY_ASSERT ((property_p == NULL && ecma_get_object_is_builtin (object_p))
+                || (property_p != NULL
+                    && ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+                    && !ecma_is_property_configurable (*property_p)));
 #endif /* !JERRY_NDEBUG */
 
   return result;
@@ -1373,6 +1386,15 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
   JERRY_ASSERT (obj_p != NULL
                 && !ecma_is_lexical_environment (obj_p));
 
+#ifndef CONFIG_ECMA_ENUM_CACHE_DISABLE
+  ecma_collection_header_t *cached_names_p = ecma_enum_cache_lookup (obj_p, opts);
+
+  if (cached_names_p != NULL)
+  {
+    return cached_names_p;
+  }
+#endif /* !CONFIG_ECMA_ENUM_CACHE_DISABLE */
+
   ecma_collection_header_t *ret_p = ecma_new_values_collection ();
   ecma_collection_header_t *skipped_non_enumerable_p = ecma_new_values_collection ();
 
@@ -1399,6 +1421,11 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
     ecma_length_t string_named_properties_count = 0;
     ecma_length_t array_index_named_properties_count = 0;
 
+    /* The names of the current object are unique, so they only need
+     * to be compared to the names listed before the current object. */
+    const ecma_length_t prev_names_count = ret_p->item_count;
+    const ecma_length_t prev_skipped_count = skipped_non_enumerable_p->item_count;
+
     ecma_collection_header_t *prop_names_p = ecma_new_values_collection ();
 
 #ifndef CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN
@@ -1486,6 +1513,8 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
     }
 #endif /* !CONFIG_DISABLE_ES2015_SYMBOL_BUILTIN */
 
+    /* The names of the properties are unique, so they only need to be compared to the lazy property names. */
+    const ecma_length_t lazy_names_count = prop_names_p->item_count;
     ecma_value_t *ecma_value_p = ecma_collection_iterator_init (prop_names_p);
 
     const size_t own_names_hashes_bitmap_size = ECMA_OBJECT_HASH_BITMAP_SIZE / bitmap_row_size;
@@ -1567,14 +1596,11 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
 
             if ((own_names_hashes_bitmap[bitmap_row] & (1u << bitmap_column)) != 0)
             {
-              ecma_value_p = ecma_collection_iterator_init (prop_names_p);
+              ecma_value_t *lazy_names_p = ecma_collection_get_buffer (prop_names_p);
 
-              while (ecma_value_p != NULL)
+              for (ecma_length_t j = 0; j < lazy_names_count; j++)
               {
-                ecma_string_t *current_name_p = ecma_get_prop_name_from_value (*ecma_value_p);
-                ecma_value_p = ecma_collection_iterator_next (ecma_value_p);
-
-                if (ecma_compare_ecma_strings (name_p, current_name_p))
+                if (ecma_compare_ecma_strings (name_p, ecma_get_prop_name_from_value (lazy_names_p[j])))
                 {
                   is_add = false;
                   break;
@@ -1727,14 +1753,11 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
       else
       {
         /* Name with same hash has already occured. */
-        ecma_value_p = ecma_collection_iterator_init (ret_p);
+        ecma_value_t *names_buffer_p = ecma_collection_get_buffer (ret_p);
 
-        while (ecma_value_p != NULL)
+        for (ecma_length_t j = 0; j < prev_names_count; j++)
         {
-          ecma_string_t *current_name_p = ecma_get_prop_name_from_value (*ecma_value_p);
-          ecma_value_p = ecma_collection_iterator_next (ecma_value_p);
-
-          if (ecma_compare_ecma_strings (name_p, current_name_p))
+          if (ecma_compare_ecma_strings (name_p, ecma_get_prop_name_from_value (names_buffer_p[j])))
           {
             is_append = false;
             break;
@@ -1744,14 +1767,11 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
 
       if (is_append)
       {
-        ecma_value_p = ecma_collection_iterator_init (skipped_non_enumerable_p);
+        ecma_value_t *skipped_buffer_p = ecma_collection_get_buffer (skipped_non_enumerable_p);
 
-        while (ecma_value_p != NULL)
+        for (ecma_length_t j = 0; j < prev_skipped_count; j++)
         {
-          ecma_string_t *current_name_p = ecma_get_prop_name_from_value (*ecma_value_p);
-          ecma_value_p = ecma_collection_iterator_next (ecma_value_p);
-
-          if (ecma_compare_ecma_strings (name_p, current_name_p))
+          if (ecma_compare_ecma_strings (name_p, ecma_get_prop_name_from_value (skipped_buffer_p[j])))
           {
             is_append = false;
             break;
@@ -1774,6 +1794,10 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
 
   ecma_free_values_collection (skipped_non_enumerable_p, 0);
 
+#ifndef CONFIG_ECMA_ENUM_CACHE_DISABLE
+  ecma_enum_cache_insert (obj_p, opts, ret_p);
+#endif /* !CONFIG_ECMA_ENUM_CACHE_DISABLE */
+
   return ret_p;
 } /* ecma_op_object_get_property_names */
 
@@ -105,8 +105,18 @@ ecma_op_resolve_reference_value (ecma_object_t *lex_env_p, /**< starting lexical
   {
     ecma_lexical_environment_type_t lex_env_type = ecma_get_lex_env_type (lex_env_p);
 
-    if (lex_env_type == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+    if (lex_env_type <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END)
     {
+      if (lex_env_type == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS)
+      {
+        ecma_value_t *slot_p = ecma_find_lex_env_slot (lex_env_p, name_p);
+
+        if (slot_p != NULL)
+        {
+          return ecma_fast_copy_value (*slot_p);
+        }
+      }
+
       ecma_property_t *property_p = ecma_find_named_property (lex_env_p, name_p);
 
       if (property_p != NULL)
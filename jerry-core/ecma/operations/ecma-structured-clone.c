@@ -0,0 +1,1367 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-array-object.h"
+#include "ecma-boolean-object.h"
+#include "ecma-builtin-helpers.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-number-object.h"
+#include "ecma-objects.h"
+#include "ecma-objects-general.h"
+#include "ecma-string-object.h"
+#include "ecma-structured-clone.h"
+#include "lit-strings.h"
+
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+#include "ecma-regexp-object.h"
+#include "re-bytecode.h"
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+#include "ecma-arraybuffer-object.h"
+#include "ecma-builtin-typedarray-helpers.h"
+#include "ecma-typedarray-object.h"
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_MAP_BUILTIN
+#include "ecma-map-object.h"
+#endif /* !CONFIG_DISABLE_ES2015_MAP_BUILTIN */
+
+#ifdef JERRY_STRUCTURED_CLONE
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmastructuredclone Structured clone
+ * @{
+ *
+ * The serialized data starts with a four byte header ('J', 'S', version, size of ecma_number_t)
+ * followed by a single value. Each value starts with a tag byte:
+ *
+ *   undefined, null, false, true      no payload
+ *   integer                           zigzag encoded varint
+ *   number                            raw ecma_number_t
+ *   string                            varint size and cesu-8 bytes
+ *   object                            varint property count and key / value pairs
+ *   array                             varint length, varint property count and key / value pairs
+ *   reference                         varint id of an object which is already serialized
+ *   Boolean, Number, String object    the primitive value without tag
+ *   Date                              raw ecma_number_t
+ *   RegExp                            pattern string and a flags byte
+ *   ArrayBuffer                       varint length and the raw bytes
+ *   TypedArray                        builtin id byte, varint byte offset and length, the ArrayBuffer value
+ *   Map                               varint entry count and key / value pairs
+ *
+ * Property keys are varints: array indices are stored as (index << 1) | 1, other names as
+ * (size << 1) followed by the cesu-8 bytes. Objects get increasing ids in the order they are
+ * first visited, so shared subgraphs and cycles are written once and restored with references.
+ * Only own enumerable string keyed properties of plain objects and arrays are serialized.
+ *
+ * The builtin ids are not stable between engine versions, so the data should only be passed
+ * between contexts of the same engine build.
+ */
+
+/**
+ * Tags of the serialized values.
+ */
+typedef enum
+{
+  ECMA_STRUCTURED_CLONE_UNDEFINED, /**< undefined value */
+  ECMA_STRUCTURED_CLONE_NULL, /**< null value */
+  ECMA_STRUCTURED_CLONE_FALSE, /**< false value */
+  ECMA_STRUCTURED_CLONE_TRUE, /**< true value */
+  ECMA_STRUCTURED_CLONE_INTEGER, /**< integer number */
+  ECMA_STRUCTURED_CLONE_NUMBER, /**< floating point number */
+  ECMA_STRUCTURED_CLONE_STRING, /**< string */
+  ECMA_STRUCTURED_CLONE_OBJECT, /**< plain object */
+  ECMA_STRUCTURED_CLONE_ARRAY, /**< array object */
+  ECMA_STRUCTURED_CLONE_REFERENCE, /**< reference to an already serialized object */
+  ECMA_STRUCTURED_CLONE_BOOLEAN_OBJECT, /**< Boolean object */
+  ECMA_STRUCTURED_CLONE_NUMBER_OBJECT, /**< Number object */
+  ECMA_STRUCTURED_CLONE_STRING_OBJECT, /**< String object */
+  ECMA_STRUCTURED_CLONE_DATE, /**< Date object */
+  ECMA_STRUCTURED_CLONE_REGEXP, /**< RegExp object */
+  ECMA_STRUCTURED_CLONE_ARRAY_BUFFER, /**< ArrayBuffer object */
+  ECMA_STRUCTURED_CLONE_TYPEDARRAY, /**< TypedArray object */
+  ECMA_STRUCTURED_CLONE_MAP, /**< Map object */
+} ecma_structured_clone_tag_t;
+
+/**
+ * Size of the header of the serialized data.
+ */
+#define ECMA_STRUCTURED_CLONE_HEADER_SIZE 4
+
+/**
+ * Initial size of the object id hash table (must be a power of 2).
+ */
+#define ECMA_STRUCTURED_CLONE_HASH_INITIAL_SIZE 64
+
+/**
+ * Structured clone writer.
+ */
+typedef struct
+{
+  uint8_t *buffer_p; /**< output buffer */
+  size_t buffer_size; /**< size of the output buffer */
+  size_t size; /**< size of the serialized data (can be larger than buffer_size) */
+  ecma_collection_header_t *objects_p; /**< serialized objects, the index of an object is its id */
+  uint32_t *hash_p; /**< hash table of object ids + 1 (0 marks an empty slot) */
+  uint32_t hash_mask; /**< size of the hash table - 1 */
+  uint32_t depth; /**< current nesting depth */
+} ecma_structured_clone_writer_t;
+
+/**
+ * Structured clone reader.
+ */
+typedef struct
+{
+  const uint8_t *buffer_p; /**< current position */
+  const uint8_t *buffer_end_p; /**< end of the input buffer */
+  ecma_collection_header_t *objects_p; /**< deserialized objects, the index of an object is its id */
+  uint32_t depth; /**< current nesting depth */
+} ecma_structured_clone_reader_t;
+
+static ecma_value_t ecma_structured_clone_write_value (ecma_structured_clone_writer_t *writer_p, ecma_value_t value);
+static ecma_value_t ecma_structured_clone_read_value (ecma_structured_clone_reader_t *reader_p);
+
+/**
+ * Append bytes to the output buffer.
+ *
+ * Note:
+ *      the bytes which do not fit into the buffer are only counted
+ */
+static void
+ecma_structured_clone_write_bytes (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                   const void *data_p, /**< data */
+                                   size_t size) /**< size of the data */
+{
+  if (size > 0 && writer_p->size + size <= writer_p->buffer_size)
+  {
+    memcpy (writer_p->buffer_p + writer_p->size, data_p, size);
+  }
+
+  writer_p->size += size;
+} /* ecma_structured_clone_write_bytes */
+
+/**
+ * Append a single byte to the output buffer.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_structured_clone_write_byte (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                  uint8_t byte) /**< byte */
+{
+  if (writer_p->size < writer_p->buffer_size)
+  {
+    writer_p->buffer_p[writer_p->size] = byte;
+  }
+
+  writer_p->size++;
+} /* ecma_structured_clone_write_byte */
+
+/**
+ * Append an unsigned integer in variable length (7 bits per byte) encoding.
+ */
+static void
+ecma_structured_clone_write_uint32 (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                    uint32_t value) /**< value */
+{
+  uint8_t bytes[5];
+  size_t size = 0;
+
+  do
+  {
+    uint8_t byte = (uint8_t) (value & 0x7f);
+    value >>= 7;
+
+    if (value != 0)
+    {
+      byte |= 0x80;
+    }
+
+    bytes[size++] = byte;
+  }
+  while (value != 0);
+
+  ecma_structured_clone_write_bytes (writer_p, bytes, size);
+} /* ecma_structured_clone_write_uint32 */
+
+/**
+ * Append a number in its internal representation.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_structured_clone_write_number (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                    ecma_number_t number) /**< number */
+{
+  ecma_structured_clone_write_bytes (writer_p, &number, sizeof (ecma_number_t));
+} /* ecma_structured_clone_write_number */
+
+/**
+ * Append the size and the characters of a string.
+ */
+static void
+ecma_structured_clone_write_string (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                    ecma_string_t *string_p) /**< string */
+{
+  ECMA_STRING_TO_UTF8_STRING (string_p, chars_p, size);
+
+  ecma_structured_clone_write_uint32 (writer_p, size);
+  ecma_structured_clone_write_bytes (writer_p, chars_p, size);
+
+  ECMA_FINALIZE_UTF8_STRING (chars_p, size);
+} /* ecma_structured_clone_write_string */
+
+/**
+ * Append a property key.
+ */
+static void
+ecma_structured_clone_write_key (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                 ecma_string_t *string_p) /**< property name */
+{
+  uint32_t index = ecma_string_get_array_index (string_p);
+
+  if (index < (UINT32_MAX >> 1))
+  {
+    ecma_structured_clone_write_uint32 (writer_p, (index << 1) | 1);
+    return;
+  }
+
+  ECMA_STRING_TO_UTF8_STRING (string_p, chars_p, size);
+
+  ecma_structured_clone_write_uint32 (writer_p, size << 1);
+  ecma_structured_clone_write_bytes (writer_p, chars_p, size);
+
+  ECMA_FINALIZE_UTF8_STRING (chars_p, size);
+} /* ecma_structured_clone_write_key */
+
+/**
+ * Compute the hash of an object value.
+ *
+ * @return hash value
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_structured_clone_hash (ecma_value_t object) /**< object value */
+{
+  return (object >> ECMA_VALUE_SHIFT) * 2654435761u;
+} /* ecma_structured_clone_hash */
+
+/**
+ * Insert an object id into the hash table.
+ */
+static void
+ecma_structured_clone_hash_insert (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                   ecma_value_t object, /**< object value */
+                                   uint32_t id) /**< object id */
+{
+  uint32_t slot = ecma_structured_clone_hash (object) & writer_p->hash_mask;
+
+  while (writer_p->hash_p[slot] != 0)
+  {
+    slot = (slot + 1) & writer_p->hash_mask;
+  }
+
+  writer_p->hash_p[slot] = id + 1;
+} /* ecma_structured_clone_hash_insert */
+
+/**
+ * Find the id of an object, or assign a new id to the object if it is not serialized yet.
+ *
+ * Note:
+ *      the writer keeps a reference to the objects, since getters may drop the
+ *      last reference and a new object could be allocated at the same address
+ *
+ * @return true - if the object is already serialized
+ *         false - otherwise
+ */
+static bool
+ecma_structured_clone_find_object (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                   ecma_object_t *object_p, /**< object */
+                                   uint32_t *id_p) /**< [out] object id */
+{
+  ecma_value_t object = ecma_make_object_value (object_p);
+
+  if (writer_p->hash_p != NULL)
+  {
+    ecma_value_t *objects_p = ecma_collection_get_buffer (writer_p->objects_p);
+    uint32_t slot = ecma_structured_clone_hash (object) & writer_p->hash_mask;
+
+    while (writer_p->hash_p[slot] != 0)
+    {
+      uint32_t id = writer_p->hash_p[slot] - 1;
+
+      if (objects_p[id] == object)
+      {
+        *id_p = id;
+        return true;
+      }
+
+      slot = (slot + 1) & writer_p->hash_mask;
+    }
+  }
+
+  uint32_t id = writer_p->objects_p->item_count;
+  ecma_append_to_values_collection (writer_p->objects_p, object, 0);
+  *id_p = id;
+
+  if (2 * (id + 1) <= writer_p->hash_mask)
+  {
+    ecma_structured_clone_hash_insert (writer_p, object, id);
+    return false;
+  }
+
+  /* The hash table is half full: it is replaced by a table with doubled size. */
+  uint32_t hash_size = ECMA_STRUCTURED_CLONE_HASH_INITIAL_SIZE;
+
+  if (writer_p->hash_p != NULL)
+  {
+    hash_size = 2 * (writer_p->hash_mask + 1);
+    jmem_heap_free_block (writer_p->hash_p, (writer_p->hash_mask + 1) * sizeof (uint32_t));
+  }
+
+  writer_p->hash_p = (uint32_t *) jmem_heap_alloc_block (hash_size * sizeof (uint32_t));
+  writer_p->hash_mask = hash_size - 1;
+  memset (writer_p->hash_p, 0, hash_size * sizeof (uint32_t));
+
+  ecma_value_t *objects_p = ecma_collection_get_buffer (writer_p->objects_p);
+
+  for (uint32_t i = 0; i <= id; i++)
+  {
+    ecma_structured_clone_hash_insert (writer_p, objects_p[i], i);
+  }
+
+  return false;
+} /* ecma_structured_clone_find_object */
+
+/**
+ * Raise the error of a value which cannot be serialized.
+ *
+ * @return ECMA_VALUE_ERROR
+ */
+static ecma_value_t
+ecma_structured_clone_raise_not_cloneable (void)
+{
+  return ecma_raise_type_error (ECMA_ERR_MSG ("Value cannot be cloned."));
+} /* ecma_structured_clone_raise_not_cloneable */
+
+/**
+ * Append the own enumerable properties of an object.
+ *
+ * @return ECMA_VALUE_EMPTY - if the properties are serialized successfully
+ *         ECMA_VALUE_ERROR - otherwise
+ */
+static ecma_value_t
+ecma_structured_clone_write_properties (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                        ecma_object_t *object_p) /**< object */
+{
+  ecma_collection_header_t *props_p = ecma_op_object_get_property_names (object_p, ECMA_LIST_ENUMERABLE);
+  ecma_value_t ret_value = ECMA_VALUE_EMPTY;
+
+  ecma_structured_clone_write_uint32 (writer_p, props_p->item_count);
+
+  ecma_value_t *ecma_value_p = ecma_collection_iterator_init (props_p);
+
+  while (ecma_value_p != NULL)
+  {
+    ecma_string_t *property_name_p = ecma_get_string_from_value (*ecma_value_p);
+    ecma_value_t value = ecma_op_object_get (object_p, property_name_p);
+
+    if (ECMA_IS_VALUE_ERROR (value))
+    {
+      ret_value = value;
+      break;
+    }
+
+    ecma_structured_clone_write_key (writer_p, property_name_p);
+    ret_value = ecma_structured_clone_write_value (writer_p, value);
+    ecma_free_value (value);
+
+    if (ECMA_IS_VALUE_ERROR (ret_value))
+    {
+      break;
+    }
+
+    ecma_value_p = ecma_collection_iterator_next (ecma_value_p);
+  }
+
+  ecma_free_values_collection (props_p, 0);
+  return ret_value;
+} /* ecma_structured_clone_write_properties */
+
+/**
+ * Append an object with a class.
+ *
+ * @return ECMA_VALUE_EMPTY - if the object is serialized successfully
+ *         ECMA_VALUE_ERROR - otherwise
+ */
+static ecma_value_t
+ecma_structured_clone_write_class_object (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                          ecma_object_t *object_p) /**< object */
+{
+  ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+  switch (ext_object_p->u.class_prop.class_id)
+  {
+    case LIT_MAGIC_STRING_BOOLEAN_UL:
+    {
+      ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_BOOLEAN_OBJECT);
+      ecma_structured_clone_write_byte (writer_p, ecma_is_value_true (ext_object_p->u.class_prop.u.value) ? 1 : 0);
+      return ECMA_VALUE_EMPTY;
+    }
+    case LIT_MAGIC_STRING_NUMBER_UL:
+    {
+      ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_NUMBER_OBJECT);
+      ecma_structured_clone_write_number (writer_p, ecma_get_number_from_value (ext_object_p->u.class_prop.u.value));
+      return ECMA_VALUE_EMPTY;
+    }
+    case LIT_MAGIC_STRING_STRING_UL:
+    {
+      ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_STRING_OBJECT);
+      ecma_structured_clone_write_string (writer_p, ecma_get_string_from_value (ext_object_p->u.class_prop.u.value));
+      return ECMA_VALUE_EMPTY;
+    }
+#ifndef CONFIG_DISABLE_DATE_BUILTIN
+    case LIT_MAGIC_STRING_DATE_UL:
+    {
+      ecma_number_t *date_num_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_number_t, ext_object_p->u.class_prop.u.value);
+
+      ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_DATE);
+      ecma_structured_clone_write_number (writer_p, *date_num_p);
+      return ECMA_VALUE_EMPTY;
+    }
+#endif /* !CONFIG_DISABLE_DATE_BUILTIN */
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+    case LIT_MAGIC_STRING_REGEXP_UL:
+    {
+      re_compiled_code_t *bc_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (re_compiled_code_t,
+                                                                     ext_object_p->u.class_prop.u.value);
+
+      ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_REGEXP);
+
+      if (bc_p == NULL)
+      {
+        ecma_structured_clone_write_string (writer_p, ecma_get_magic_string (LIT_MAGIC_STRING__EMPTY));
+        ecma_structured_clone_write_byte (writer_p, 0);
+        return ECMA_VALUE_EMPTY;
+      }
+
+      uint16_t flags = bc_p->header.status_flags & (RE_FLAG_GLOBAL | RE_FLAG_IGNORE_CASE | RE_FLAG_MULTILINE);
+
+      ecma_structured_clone_write_string (writer_p, ecma_get_string_from_value (bc_p->pattern));
+      ecma_structured_clone_write_byte (writer_p, (uint8_t) flags);
+      return ECMA_VALUE_EMPTY;
+    }
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+    case LIT_MAGIC_STRING_ARRAY_BUFFER_UL:
+    {
+      ecma_length_t length = ecma_arraybuffer_get_length (object_p);
+
+      ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_ARRAY_BUFFER);
+      ecma_structured_clone_write_uint32 (writer_p, length);
+      ecma_structured_clone_write_bytes (writer_p, ecma_arraybuffer_get_buffer (object_p), length);
+      return ECMA_VALUE_EMPTY;
+    }
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_MAP_BUILTIN
+    case LIT_MAGIC_STRING_MAP_UL:
+    {
+      ecma_collection_header_t *items_p = ecma_op_map_get_items ((ecma_map_object_t *) object_p);
+      ecma_value_t ret_value = ECMA_VALUE_EMPTY;
+
+      ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_MAP);
+      ecma_structured_clone_write_uint32 (writer_p, items_p->item_count / 2);
+
+      ecma_value_t *ecma_value_p = ecma_collection_iterator_init (items_p);
+
+      while (ecma_value_p != NULL && !ECMA_IS_VALUE_ERROR (ret_value))
+      {
+        ret_value = ecma_structured_clone_write_value (writer_p, *ecma_value_p);
+        ecma_value_p = ecma_collection_iterator_next (ecma_value_p);
+      }
+
+      ecma_free_values_collection (items_p, 0);
+      return ret_value;
+    }
+#endif /* !CONFIG_DISABLE_ES2015_MAP_BUILTIN */
+    default:
+    {
+      return ecma_structured_clone_raise_not_cloneable ();
+    }
+  }
+} /* ecma_structured_clone_write_class_object */
+
+/**
+ * Append an object.
+ *
+ * @return ECMA_VALUE_EMPTY - if the object is serialized successfully
+ *         ECMA_VALUE_ERROR - otherwise
+ */
+static ecma_value_t
+ecma_structured_clone_write_object (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                    ecma_object_t *object_p) /**< object */
+{
+  uint32_t id;
+
+  if (ecma_structured_clone_find_object (writer_p, object_p, &id))
+  {
+    ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_REFERENCE);
+    ecma_structured_clone_write_uint32 (writer_p, id);
+    return ECMA_VALUE_EMPTY;
+  }
+
+  if (writer_p->depth >= ECMA_STRUCTURED_CLONE_MAX_DEPTH)
+  {
+    return ecma_raise_range_error (ECMA_ERR_MSG ("Maximum structured clone depth exceeded."));
+  }
+
+  ecma_value_t ret_value;
+  writer_p->depth++;
+
+  switch (ecma_get_object_type (object_p))
+  {
+    case ECMA_OBJECT_TYPE_GENERAL:
+    {
+      ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_OBJECT);
+      ret_value = ecma_structured_clone_write_properties (writer_p, object_p);
+      break;
+    }
+    case ECMA_OBJECT_TYPE_ARRAY:
+    {
+      ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+
+      ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_ARRAY);
+      ecma_structured_clone_write_uint32 (writer_p, ext_object_p->u.array.length);
+      ret_value = ecma_structured_clone_write_properties (writer_p, object_p);
+      break;
+    }
+    case ECMA_OBJECT_TYPE_CLASS:
+    {
+      if (ecma_object_class_is (object_p, LIT_MAGIC_STRING_ARGUMENTS_UL))
+      {
+        /* Arguments objects are cloned as plain objects. */
+        ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_OBJECT);
+        ret_value = ecma_structured_clone_write_properties (writer_p, object_p);
+        break;
+      }
+
+      ret_value = ecma_structured_clone_write_class_object (writer_p, object_p);
+      break;
+    }
+    case ECMA_OBJECT_TYPE_PSEUDO_ARRAY:
+    {
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+      if (ecma_is_typedarray (ecma_make_object_value (object_p)))
+      {
+        ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_TYPEDARRAY);
+        ecma_structured_clone_write_byte (writer_p, ecma_typedarray_helper_get_builtin_id (object_p));
+        ecma_structured_clone_write_uint32 (writer_p, ecma_typedarray_get_offset (object_p));
+        ecma_structured_clone_write_uint32 (writer_p, ecma_typedarray_get_length (object_p));
+        ret_value = ecma_structured_clone_write_object (writer_p, ecma_typedarray_get_arraybuffer (object_p));
+        break;
+      }
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+
+      ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_OBJECT);
+      ret_value = ecma_structured_clone_write_properties (writer_p, object_p);
+      break;
+    }
+    default:
+    {
+      ret_value = ecma_structured_clone_raise_not_cloneable ();
+      break;
+    }
+  }
+
+  writer_p->depth--;
+  return ret_value;
+} /* ecma_structured_clone_write_object */
+
+/**
+ * Append a value.
+ *
+ * @return ECMA_VALUE_EMPTY - if the value is serialized successfully
+ *         ECMA_VALUE_ERROR - otherwise
+ */
+static ecma_value_t
+ecma_structured_clone_write_value (ecma_structured_clone_writer_t *writer_p, /**< writer */
+                                   ecma_value_t value) /**< value */
+{
+  if (ecma_is_value_undefined (value))
+  {
+    ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_UNDEFINED);
+  }
+  else if (ecma_is_value_null (value))
+  {
+    ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_NULL);
+  }
+  else if (ecma_is_value_boolean (value))
+  {
+    ecma_structured_clone_write_byte (writer_p, (ecma_is_value_true (value) ? ECMA_STRUCTURED_CLONE_TRUE
+                                                                            : ECMA_STRUCTURED_CLONE_FALSE));
+  }
+  else if (ecma_is_value_integer_number (value))
+  {
+    ecma_integer_value_t integer = ecma_get_integer_from_value (value);
+    uint32_t zigzag = (integer < 0) ? ((~(uint32_t) integer) << 1) | 1 : ((uint32_t) integer << 1);
+
+    ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_INTEGER);
+    ecma_structured_clone_write_uint32 (writer_p, zigzag);
+  }
+  else if (ecma_is_value_number (value))
+  {
+    ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_NUMBER);
+    ecma_structured_clone_write_number (writer_p, ecma_get_number_from_value (value));
+  }
+  else if (ecma_is_value_string (value))
+  {
+    ecma_structured_clone_write_byte (writer_p, ECMA_STRUCTURED_CLONE_STRING);
+    ecma_structured_clone_write_string (writer_p, ecma_get_string_from_value (value));
+  }
+  else if (ecma_is_value_object (value))
+  {
+    return ecma_structured_clone_write_object (writer_p, ecma_get_object_from_value (value));
+  }
+  else
+  {
+    return ecma_structured_clone_raise_not_cloneable ();
+  }
+
+  return ECMA_VALUE_EMPTY;
+} /* ecma_structured_clone_write_value */
+
+/**
+ * Serialize a value into a caller provided buffer.
+ *
+ * Note:
+ *      if the serialized data does not fit into the buffer, the buffer content is
+ *      unspecified, and the returned size can be used to allocate a large enough buffer
+ *
+ * @return size of the serialized data as a number value - if the value can be cloned
+ *         TypeError or RangeError - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_structured_clone_serialize (ecma_value_t value, /**< value to serialize */
+                                 uint8_t *buffer_p, /**< [out] output buffer (can be NULL) */
+                                 size_t buffer_size) /**< size of the output buffer */
+{
+  ecma_structured_clone_writer_t writer;
+
+  writer.buffer_p = buffer_p;
+  writer.buffer_size = (buffer_p != NULL) ? buffer_size : 0;
+  writer.size = 0;
+  writer.objects_p = ecma_new_values_collection ();
+  writer.hash_p = NULL;
+  writer.hash_mask = 0;
+  writer.depth = 0;
+
+  const uint8_t header[ECMA_STRUCTURED_CLONE_HEADER_SIZE] =
+  {
+    (uint8_t) 'J', (uint8_t) 'S', ECMA_STRUCTURED_CLONE_VERSION, (uint8_t) sizeof (ecma_number_t)
+  };
+
+  ecma_structured_clone_write_bytes (&writer, header, sizeof (header));
+
+  ecma_value_t ret_value = ecma_structured_clone_write_value (&writer, value);
+
+  if (writer.hash_p != NULL)
+  {
+    jmem_heap_free_block (writer.hash_p, (writer.hash_mask + 1) * sizeof (uint32_t));
+  }
+
+  ecma_free_values_collection (writer.objects_p, 0);
+
+  if (ECMA_IS_VALUE_ERROR (ret_value))
+  {
+    return ret_value;
+  }
+
+  return ecma_make_number_value ((ecma_number_t) writer.size);
+} /* ecma_structured_clone_serialize */
+
+/**
+ * Raise the error of malformed serialized data.
+ *
+ * @return ECMA_VALUE_ERROR
+ */
+static ecma_value_t
+ecma_structured_clone_raise_invalid (void)
+{
+  return ecma_raise_type_error (ECMA_ERR_MSG ("Invalid structured clone data."));
+} /* ecma_structured_clone_raise_invalid */
+
+/**
+ * Read a sequence of bytes.
+ *
+ * @return pointer to the bytes - if the input is long enough
+ *         NULL - otherwise
+ */
+static const uint8_t *
+ecma_structured_clone_read_bytes (ecma_structured_clone_reader_t *reader_p, /**< reader */
+                                  size_t size) /**< number of bytes */
+{
+  const uint8_t *bytes_p = reader_p->buffer_p;
+
+  if (size > (size_t) (reader_p->buffer_end_p - bytes_p))
+  {
+    return NULL;
+  }
+
+  reader_p->buffer_p = bytes_p + size;
+  return bytes_p;
+} /* ecma_structured_clone_read_bytes */
+
+/**
+ * Read a single byte.
+ *
+ * @return true - if the input is long enough
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_structured_clone_read_byte (ecma_structured_clone_reader_t *reader_p, /**< reader */
+                                 uint8_t *byte_p) /**< [out] byte */
+{
+  if (reader_p->buffer_p >= reader_p->buffer_end_p)
+  {
+    return false;
+  }
+
+  *byte_p = *reader_p->buffer_p++;
+  return true;
+} /* ecma_structured_clone_read_byte */
+
+/**
+ * Read an unsigned integer in variable length encoding.
+ *
+ * @return true - if the integer is valid
+ *         false - otherwise
+ */
+static bool
+ecma_structured_clone_read_uint32 (ecma_structured_clone_reader_t *reader_p, /**< reader */
+                                   uint32_t *value_p) /**< [out] value */
+{
+  uint32_t value = 0;
+  uint8_t byte;
+
+  for (uint32_t shift = 0; shift < 35; shift += 7)
+  {
+    if (!ecma_structured_clone_read_byte (reader_p, &byte)
+        || (shift == 28 && byte > 0x0f))
+    {
+      return false;
+    }
+
+    value |= (uint32_t) (byte & 0x7f) << shift;
+
+    if (!(byte & 0x80))
+    {
+      *value_p = value;
+      return true;
+    }
+  }
+
+  return false;
+} /* ecma_structured_clone_read_uint32 */
+
+/**
+ * Read a number in its internal representation.
+ *
+ * @return true - if the input is long enough
+ *         false - otherwise
+ */
+static bool
+ecma_structured_clone_read_number (ecma_structured_clone_reader_t *reader_p, /**< reader */
+                                   ecma_number_t *number_p) /**< [out] number */
+{
+  const uint8_t *bytes_p = ecma_structured_clone_read_bytes (reader_p, sizeof (ecma_number_t));
+
+  if (bytes_p == NULL)
+  {
+    return false;
+  }
+
+  memcpy (number_p, bytes_p, sizeof (ecma_number_t));
+  return true;
+} /* ecma_structured_clone_read_number */
+
+/**
+ * Read the characters of a string.
+ *
+ * @return new string - if the characters are valid cesu-8 characters
+ *         NULL - otherwise
+ */
+static ecma_string_t *
+ecma_structured_clone_read_chars (ecma_structured_clone_reader_t *reader_p, /**< reader */
+                                  uint32_t size) /**< size of the string */
+{
+  const uint8_t *chars_p = ecma_structured_clone_read_bytes (reader_p, size);
+
+  if (chars_p == NULL || !lit_is_valid_cesu8_string (chars_p, size))
+  {
+    return NULL;
+  }
+
+  return ecma_new_ecma_string_from_utf8 (chars_p, size);
+} /* ecma_structured_clone_read_chars */
+
+/**
+ * Read the size and the characters of a string.
+ *
+ * @return new string - if the string is valid
+ *         NULL - otherwise
+ */
+static ecma_string_t *
+ecma_structured_clone_read_string (ecma_structured_clone_reader_t *reader_p) /**< reader */
+{
+  uint32_t size;
+
+  if (!ecma_structured_clone_read_uint32 (reader_p, &size))
+  {
+    return NULL;
+  }
+
+  return ecma_structured_clone_read_chars (reader_p, size);
+} /* ecma_structured_clone_read_string */
+
+/**
+ * Read a property key.
+ *
+ * @return new string - if the key is valid
+ *         NULL - otherwise
+ */
+static ecma_string_t *
+ecma_structured_clone_read_key (ecma_structured_clone_reader_t *reader_p) /**< reader */
+{
+  uint32_t key;
+
+  if (!ecma_structured_clone_read_uint32 (reader_p, &key))
+  {
+    return NULL;
+  }
+
+  if (key & 1)
+  {
+    return ecma_new_ecma_string_from_uint32 (key >> 1);
+  }
+
+  return ecma_structured_clone_read_chars (reader_p, key >> 1);
+} /* ecma_structured_clone_read_key */
+
+/**
+ * Assign the next id to a deserialized object.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_structured_clone_add_object (ecma_structured_clone_reader_t *reader_p, /**< reader */
+                                  ecma_value_t object) /**< object value */
+{
+  ecma_append_to_values_collection (reader_p->objects_p, object, 0);
+} /* ecma_structured_clone_add_object */
+
+/**
+ * Read the properties of an object.
+ *
+ * @return ECMA_VALUE_EMPTY - if the properties are valid
+ *         ECMA_VALUE_ERROR - otherwise
+ */
+static ecma_value_t
+ecma_structured_clone_read_properties (ecma_structured_clone_reader_t *reader_p, /**< reader */
+                                       ecma_object_t *object_p) /**< object */
+{
+  uint32_t count;
+
+  if (!ecma_structured_clone_read_uint32 (reader_p, &count))
+  {
+    return ecma_structured_clone_raise_invalid ();
+  }
+
+  while (count-- > 0)
+  {
+    ecma_string_t *property_name_p = ecma_structured_clone_read_key (reader_p);
+
+    if (property_name_p == NULL)
+    {
+      return ecma_structured_clone_raise_invalid ();
+    }
+
+    ecma_value_t value = ecma_structured_clone_read_value (reader_p);
+
+    if (ECMA_IS_VALUE_ERROR (value))
+    {
+      ecma_deref_ecma_string (property_name_p);
+      return value;
+    }
+
+    ecma_value_t completion = ecma_builtin_helper_def_prop (object_p,
+                                                            property_name_p,
+                                                            value,
+                                                            ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE,
+                                                            false); /* Failure handling */
+
+    ecma_deref_ecma_string (property_name_p);
+    ecma_free_value (value);
+
+    if (ECMA_IS_VALUE_ERROR (completion))
+    {
+      return completion;
+    }
+  }
+
+  return ECMA_VALUE_EMPTY;
+} /* ecma_structured_clone_read_properties */
+
+/**
+ * Read an object whose properties are not serialized.
+ *
+ * @return object value - if the object is valid
+ *         ECMA_VALUE_ERROR - otherwise
+ */
+static ecma_value_t
+ecma_structured_clone_read_class_object (ecma_structured_clone_reader_t *reader_p, /**< reader */
+                                         uint8_t tag) /**< tag of the object */
+{
+  switch (tag)
+  {
+    case ECMA_STRUCTURED_CLONE_BOOLEAN_OBJECT:
+    {
+      uint8_t byte;
+
+      if (!ecma_structured_clone_read_byte (reader_p, &byte) || byte > 1)
+      {
+        break;
+      }
+
+      return ecma_op_create_boolean_object (ecma_make_boolean_value (byte != 0));
+    }
+    case ECMA_STRUCTURED_CLONE_NUMBER_OBJECT:
+    {
+      ecma_number_t number;
+
+      if (!ecma_structured_clone_read_number (reader_p, &number))
+      {
+        break;
+      }
+
+      ecma_value_t number_value = ecma_make_number_value (number);
+      ecma_value_t object = ecma_op_create_number_object (number_value);
+      ecma_free_value (number_value);
+      return object;
+    }
+    case ECMA_STRUCTURED_CLONE_STRING_OBJECT:
+    {
+      ecma_string_t *string_p = ecma_structured_clone_read_string (reader_p);
+
+      if (string_p == NULL)
+      {
+        break;
+      }
+
+      ecma_value_t string_value = ecma_make_string_value (string_p);
+      ecma_value_t object = ecma_op_create_string_object (&string_value, 1);
+      ecma_deref_ecma_string (string_p);
+      return object;
+    }
+#ifndef CONFIG_DISABLE_DATE_BUILTIN
+    case ECMA_STRUCTURED_CLONE_DATE:
+    {
+      ecma_number_t date_num;
+
+      if (!ecma_structured_clone_read_number (reader_p, &date_num))
+      {
+        break;
+      }
+
+      ecma_object_t *object_p = ecma_create_object (ecma_builtin_get (ECMA_BUILTIN_ID_DATE_PROTOTYPE),
+                                                    sizeof (ecma_extended_object_t),
+                                                    ECMA_OBJECT_TYPE_CLASS);
+
+      ecma_extended_object_t *ext_object_p = (ecma_extended_object_t *) object_p;
+      ext_object_p->u.class_prop.class_id = LIT_MAGIC_STRING_DATE_UL;
+
+      ecma_number_t *date_num_p = ecma_alloc_number ();
+      *date_num_p = date_num;
+      ECMA_SET_INTERNAL_VALUE_POINTER (ext_object_p->u.class_prop.u.value, date_num_p);
+
+      return ecma_make_object_value (object_p);
+    }
+#endif /* !CONFIG_DISABLE_DATE_BUILTIN */
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+    case ECMA_STRUCTURED_CLONE_REGEXP:
+    {
+      ecma_string_t *pattern_p = ecma_structured_clone_read_string (reader_p);
+      uint8_t flags;
+
+      if (pattern_p == NULL)
+      {
+        break;
+      }
+
+      if (!ecma_structured_clone_read_byte (reader_p, &flags)
+          || (flags & ~(RE_FLAG_GLOBAL | RE_FLAG_IGNORE_CASE | RE_FLAG_MULTILINE)) != 0)
+      {
+        ecma_deref_ecma_string (pattern_p);
+        break;
+      }
+
+      ecma_value_t object = ecma_op_create_regexp_object (pattern_p, flags);
+      ecma_deref_ecma_string (pattern_p);
+      return object;
+    }
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+    case ECMA_STRUCTURED_CLONE_ARRAY_BUFFER:
+    {
+      uint32_t length;
+
+      if (!ecma_structured_clone_read_uint32 (reader_p, &length))
+      {
+        break;
+      }
+
+      const uint8_t *bytes_p = ecma_structured_clone_read_bytes (reader_p, length);
+
+      if (bytes_p == NULL)
+      {
+        break;
+      }
+
+      ecma_object_t *object_p = ecma_arraybuffer_new_object (length);
+
+      if (length > 0)
+      {
+        memcpy (ecma_arraybuffer_get_buffer (object_p), bytes_p, length);
+      }
+
+      return ecma_make_object_value (object_p);
+    }
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+    default:
+    {
+      break;
+    }
+  }
+
+  return ecma_structured_clone_raise_invalid ();
+} /* ecma_structured_clone_read_class_object */
+
+/**
+ * Read an object.
+ *
+ * @return object value - if the object is valid
+ *         ECMA_VALUE_ERROR - otherwise
+ */
+static ecma_value_t
+ecma_structured_clone_read_object (ecma_structured_clone_reader_t *reader_p, /**< reader */
+                                   uint8_t tag) /**< tag of the object */
+{
+  ecma_value_t object;
+  ecma_value_t ret_value;
+
+  switch (tag)
+  {
+    case ECMA_STRUCTURED_CLONE_OBJECT:
+    {
+      object = ecma_make_object_value (ecma_op_create_object_object_noarg ());
+      ecma_structured_clone_add_object (reader_p, object);
+      ret_value = ecma_structured_clone_read_properties (reader_p, ecma_get_object_from_value (object));
+      break;
+    }
+    case ECMA_STRUCTURED_CLONE_ARRAY:
+    {
+      uint32_t length;
+
+      if (!ecma_structured_clone_read_uint32 (reader_p, &length))
+      {
+        return ecma_structured_clone_raise_invalid ();
+      }
+
+      ecma_value_t length_value = ecma_make_uint32_value (length);
+      object = ecma_op_create_array_object (&length_value, 1, true);
+      ecma_free_value (length_value);
+
+      JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (object));
+
+      ecma_structured_clone_add_object (reader_p, object);
+      ret_value = ecma_structured_clone_read_properties (reader_p, ecma_get_object_from_value (object));
+      break;
+    }
+#ifndef CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN
+    case ECMA_STRUCTURED_CLONE_TYPEDARRAY:
+    {
+      uint8_t builtin_id;
+      uint32_t offset;
+      uint32_t length;
+
+      if (!ecma_structured_clone_read_byte (reader_p, &builtin_id)
+          || !ecma_typedarray_helper_is_typedarray (builtin_id)
+          || !ecma_structured_clone_read_uint32 (reader_p, &offset)
+          || !ecma_structured_clone_read_uint32 (reader_p, &length))
+      {
+        return ecma_structured_clone_raise_invalid ();
+      }
+
+      /* The id of the TypedArray precedes the id of its ArrayBuffer. */
+      uint32_t id = reader_p->objects_p->item_count;
+      ecma_structured_clone_add_object (reader_p, ECMA_VALUE_UNDEFINED);
+
+      ecma_value_t arraybuffer = ecma_structured_clone_read_value (reader_p);
+
+      if (ECMA_IS_VALUE_ERROR (arraybuffer))
+      {
+        return arraybuffer;
+      }
+
+      if (!ecma_is_arraybuffer (arraybuffer))
+      {
+        ecma_free_value (arraybuffer);
+        return ecma_structured_clone_raise_invalid ();
+      }
+
+      ecma_value_t arguments[] = { arraybuffer, ecma_make_uint32_value (offset), ecma_make_uint32_value (length) };
+
+      object = ecma_op_create_typedarray (arguments,
+                                          3,
+                                          ecma_builtin_get (ecma_typedarray_helper_get_prototype_id (builtin_id)),
+                                          ecma_typedarray_helper_get_shift_size (builtin_id),
+                                          ecma_typedarray_helper_get_magic_string (builtin_id));
+
+      ecma_free_value (arguments[2]);
+      ecma_free_value (arguments[1]);
+      ecma_free_value (arraybuffer);
+
+      if (!ECMA_IS_VALUE_ERROR (object))
+      {
+        ecma_collection_get_buffer (reader_p->objects_p)[id] = ecma_copy_value (object);
+      }
+
+      return object;
+    }
+#endif /* !CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN */
+#ifndef CONFIG_DISABLE_ES2015_MAP_BUILTIN
+    case ECMA_STRUCTURED_CLONE_MAP:
+    {
+      object = ecma_op_map_create (NULL, 0);
+      ecma_structured_clone_add_object (reader_p, object);
+
+      uint32_t count;
+      ret_value = ECMA_VALUE_EMPTY;
+
+      if (!ecma_structured_clone_read_uint32 (reader_p, &count))
+      {
+        ret_value = ecma_structured_clone_raise_invalid ();
+        break;
+      }
+
+      while (count-- > 0)
+      {
+        ecma_value_t key = ecma_structured_clone_read_value (reader_p);
+
+        if (ECMA_IS_VALUE_ERROR (key))
+        {
+          ret_value = key;
+          break;
+        }
+
+        ecma_value_t value = ecma_structured_clone_read_value (reader_p);
+
+        if (ECMA_IS_VALUE_ERROR (value))
+        {
+          ecma_free_value (key);
+          ret_value = value;
+          break;
+        }
+
+        ecma_free_value (ecma_op_map_set (object, key, value));
+        ecma_free_value (value);
+        ecma_free_value (key);
+      }
+      break;
+    }
+#endif /* !CONFIG_DISABLE_ES2015_MAP_BUILTIN */
+    default:
+    {
+      object = ecma_structured_clone_read_class_object (reader_p, tag);
+
+      if (!ECMA_IS_VALUE_ERROR (object))
+      {
+        ecma_structured_clone_add_object (reader_p, object);
+      }
+
+      return object;
+    }
+  }
+
+  if (ECMA_IS_VALUE_ERROR (ret_value))
+  {
+    ecma_free_value (object);
+    return ret_value;
+  }
+
+  return object;
+} /* ecma_structured_clone_read_object */
+
+/**
+ * Read a value.
+ *
+ * @return deserialized value - if the value is valid
+ *         ECMA_VALUE_ERROR - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_structured_clone_read_value (ecma_structured_clone_reader_t *reader_p) /**< reader */
+{
+  uint8_t tag;
+
+  if (!ecma_structured_clone_read_byte (reader_p, &tag))
+  {
+    return ecma_structured_clone_raise_invalid ();
+  }
+
+  switch (tag)
+  {
+    case ECMA_STRUCTURED_CLONE_UNDEFINED:
+    {
+      return ECMA_VALUE_UNDEFINED;
+    }
+    case ECMA_STRUCTURED_CLONE_NULL:
+    {
+      return ECMA_VALUE_NULL;
+    }
+    case ECMA_STRUCTURED_CLONE_FALSE:
+    {
+      return ECMA_VALUE_FALSE;
+    }
+    case ECMA_STRUCTURED_CLONE_TRUE:
+    {
+      return ECMA_VALUE_TRUE;
+    }
+    case ECMA_STRUCTURED_CLONE_INTEGER:
+    {
+      uint32_t zigzag;
+
+      if (!ecma_structured_clone_read_uint32 (reader_p, &zigzag))
+      {
+        break;
+      }
+
+      int32_t integer = (zigzag & 1) ? (int32_t) ~(zigzag >> 1) : (int32_t) (zigzag >> 1);
+      return ecma_make_int32_value (integer);
+    }
+    case ECMA_STRUCTURED_CLONE_NUMBER:
+    {
+      ecma_number_t number;
+
+      if (!ecma_structured_clone_read_number (reader_p, &number))
+      {
+        break;
+      }
+
+      return ecma_make_number_value (number);
+    }
+    case ECMA_STRUCTURED_CLONE_STRING:
+    {
+      ecma_string_t *string_p = ecma_structured_clone_read_string (reader_p);
+
+      if (string_p == NULL)
+      {
+        break;
+      }
+
+      return ecma_make_string_value (string_p);
+    }
+    case ECMA_STRUCTURED_CLONE_REFERENCE:
+    {
+      uint32_t id;
+
+      if (!ecma_structured_clone_read_uint32 (reader_p, &id)
+          || id >= reader_p->objects_p->item_count)
+      {
+        break;
+      }
+
+      ecma_value_t object = ecma_collection_get_buffer (reader_p->objects_p)[id];
+
+      if (!ecma_is_value_object (object))
+      {
+        /* The TypedArray is referenced before it is created. */
+        break;
+      }
+
+      return ecma_copy_value (object);
+    }
+    default:
+    {
+      if (reader_p->depth >= ECMA_STRUCTURED_CLONE_MAX_DEPTH)
+      {
+        break;
+      }
+
+      reader_p->depth++;
+      ecma_value_t object = ecma_structured_clone_read_object (reader_p, tag);
+      reader_p->depth--;
+      return object;
+    }
+  }
+
+  return ecma_structured_clone_raise_invalid ();
+} /* ecma_structured_clone_read_value */
+
+/**
+ * Deserialize a value which was serialized by ecma_structured_clone_serialize.
+ *
+ * @return deserialized value - if the data is valid
+ *         TypeError - otherwise
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_structured_clone_deserialize (const uint8_t *buffer_p, /**< serialized data */
+                                   size_t buffer_size) /**< size of the serialized data */
+{
+  if (buffer_p == NULL
+      || buffer_size < ECMA_STRUCTURED_CLONE_HEADER_SIZE
+      || buffer_p[0] != (uint8_t) 'J'
+      || buffer_p[1] != (uint8_t) 'S'
+      || buffer_p[2] != ECMA_STRUCTURED_CLONE_VERSION
+      || buffer_p[3] != (uint8_t) sizeof (ecma_number_t))
+  {
+    return ecma_structured_clone_raise_invalid ();
+  }
+
+  ecma_structured_clone_reader_t reader;
+
+  reader.buffer_p = buffer_p + ECMA_STRUCTURED_CLONE_HEADER_SIZE;
+  reader.buffer_end_p = buffer_p + buffer_size;
+  reader.objects_p = ecma_new_values_collection ();
+  reader.depth = 0;
+
+  ecma_value_t ret_value = ecma_structured_clone_read_value (&reader);
+
+  ecma_free_values_collection (reader.objects_p, 0);
+
+  if (!ECMA_IS_VALUE_ERROR (ret_value) && reader.buffer_p != reader.buffer_end_p)
+  {
+    ecma_free_value (ret_value);
+    return ecma_structured_clone_raise_invalid ();
+  }
+
+  return ret_value;
+} /* ecma_structured_clone_deserialize */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_STRUCTURED_CLONE */
@@ -0,0 +1,52 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_STRUCTURED_CLONE_H
+#define ECMA_STRUCTURED_CLONE_H
+
+#include "ecma-globals.h"
+
+#ifdef JERRY_STRUCTURED_CLONE
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmastructuredclone Structured clone
+ * @{
+ */
+
+/**
+ * Version of the structured clone format.
+ */
+#define ECMA_STRUCTURED_CLONE_VERSION 1
+
+/**
+ * Maximum nesting depth of the serialized objects.
+ */
+#ifndef ECMA_STRUCTURED_CLONE_MAX_DEPTH
+#define ECMA_STRUCTURED_CLONE_MAX_DEPTH 512
+#endif /* !ECMA_STRUCTURED_CLONE_MAX_DEPTH */
+
+ecma_value_t ecma_structured_clone_serialize (ecma_value_t value, uint8_t *buffer_p, size_t buffer_size);
+ecma_value_t ecma_structured_clone_deserialize (const uint8_t *buffer_p, size_t buffer_size);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_STRUCTURED_CLONE */
+
+#endif /* !ECMA_STRUCTURED_CLONE_H */
@@ -538,6 +538,11 @@ ecma_typedarray_get_length (ecma_object_t *typedarray_p) /**< the pointer to the
 
   ecma_extended_typedarray_object_t *info_p = (ecma_extended_typedarray_object_t *) ext_object_p;
 
+  if (ecma_arraybuffer_is_detached (ecma_get_object_from_value (ext_object_p->u.pseudo_array.u2.arraybuffer)))
+  {
+    return 0;
+  }
+
   return info_p->array_length;
 } /* ecma_typedarray_get_length */
 
@@ -560,6 +565,11 @@ ecma_typedarray_get_offset (ecma_object_t *typedarray_p) /**< the pointer to the
 
   ecma_extended_typedarray_object_t *info_p = (ecma_extended_typedarray_object_t *) ext_object_p;
 
+  if (ecma_arraybuffer_is_detached (ecma_get_object_from_value (ext_object_p->u.pseudo_array.u2.arraybuffer)))
+  {
+    return 0;
+  }
+
   return info_p->byte_offset;
 } /* ecma_typedarray_get_offset */
 
@@ -635,6 +645,12 @@ ecma_op_create_typedarray (const ecma_value_t *arguments_list_p, /**< the arg li
     {
       /* 22.2.1.3 */
       ecma_object_t *typedarray_p = ecma_get_object_from_value (arguments_list_p[0]);
+
+      if (ecma_arraybuffer_is_detached (ecma_typedarray_get_arraybuffer (typedarray_p)))
+      {
+        return ecma_raise_type_error (ECMA_ERR_MSG ("ArrayBuffer has been detached."));
+      }
+
       ret = ecma_typedarray_create_object_with_typedarray (typedarray_p,
                                                            proto_p,
                                                            element_size_shift,
@@ -658,6 +674,10 @@ ecma_op_create_typedarray (const ecma_value_t *arguments_list_p, /**< the arg li
       {
         ret = ecma_raise_range_error (ECMA_ERR_MSG ("Invalid offset."));
       }
+      else if (ecma_arraybuffer_is_detached (arraybuffer_p))
+      {
+        ret = ecma_raise_type_error (ECMA_ERR_MSG ("ArrayBuffer has been detached."));
+      }
       else
       {
         ecma_length_t buf_byte_length = ecma_arraybuffer_get_length (arraybuffer_p);
@@ -883,12 +903,17 @@ ecma_op_typedarray_set_index_prop (ecma_object_t *obj_p, /**< a TypedArray objec
   ECMA_OP_TO_NUMBER_TRY_CATCH (value_num, value, error);
 
   ecma_object_t *arraybuffer_p = ecma_typedarray_get_arraybuffer (obj_p);
-  ecma_length_t offset = ecma_typedarray_get_offset (obj_p);
-  uint8_t shift = ecma_typedarray_get_element_size_shift (obj_p);
-  ecma_length_t byte_pos = (index << shift) + offset;
-  lit_magic_string_id_t class_id = ecma_object_get_class_name (obj_p);
-  lit_utf8_byte_t *target_p = ecma_arraybuffer_get_buffer (arraybuffer_p) + byte_pos;
-  ecma_set_typedarray_element (target_p, value_num, class_id);
+
+  /* The conversion may detach the buffer. */
+  if (!ecma_arraybuffer_is_detached (arraybuffer_p))
+  {
+    ecma_length_t offset = ecma_typedarray_get_offset (obj_p);
+    uint8_t shift = ecma_typedarray_get_element_size_shift (obj_p);
+    ecma_length_t byte_pos = (index << shift) + offset;
+    lit_magic_string_id_t class_id = ecma_object_get_class_name (obj_p);
+    lit_utf8_byte_t *target_p = ecma_arraybuffer_get_buffer (arraybuffer_p) + byte_pos;
+    ecma_set_typedarray_element (target_p, value_num, class_id);
+  }
 
   ECMA_OP_TO_NUMBER_FINALIZE (value_num);
 
@@ -92,6 +92,12 @@ typedef enum
   JERRY_FEATURE_REGEXP, /**< Regexp support */
   JERRY_FEATURE_LINE_INFO, /**< line info available */
   JERRY_FEATURE_LOGGING, /**< logging */
+  JERRY_FEATURE_PROFILER, /**< sampling profiler */
+  JERRY_FEATURE_VM_STATS, /**< VM execution statistics */
+  JERRY_FEATURE_HEAP_SNAPSHOT, /**< heap snapshot export */
+  JERRY_FEATURE_MEM_ALLOC_SITES, /**< allocation site tracking */
+  JERRY_FEATURE_STRUCTURED_CLONE, /**< structured clone serializer */
+  JERRY_FEATURE_HEAP_IMAGE, /**< saving and restoring heap images */
   JERRY_FEATURE__COUNT /**< number of features. NOTE: must be at the end of the list */
 } jerry_feature_t;
 
@@ -245,6 +251,25 @@ typedef bool (*jerry_objects_foreach_by_native_info_t) (const jerry_value_t obje
                                                         void *object_data_p,
                                                         void *user_data_p);
 
+/**
+ * Callback which receives the next part of a heap snapshot. The buffer is only
+ * valid during the call. Engine functions must not be called from the callback.
+ *
+ * @return true - to continue the snapshot, false - to abort it
+ */
+typedef bool (*jerry_heap_snapshot_cb_t) (const jerry_char_t *buffer_p,
+                                          size_t buffer_size,
+                                          void *user_p);
+
+/**
+ * Callback which maps a native pointer stored in the heap when a heap image is saved
+ * (from the pointer to an application defined value) or restored (from that value back
+ * to the pointer of the new process). Engine functions must not be called from the callback.
+ *
+ * @return mapped value
+ */
+typedef uintptr_t (*jerry_heap_image_pointer_cb_t) (uintptr_t pointer, void *user_p);
+
 /**
  * User context item manager
  */
@@ -303,6 +328,16 @@ typedef struct
   jerry_object_native_free_callback_t free_cb; /**< the free callback of the native pointer */
 } jerry_object_native_info_t;
 
+/**
+ * Memory detached from an ArrayBuffer.
+ */
+typedef struct
+{
+  uint8_t *buffer_p; /**< pointer to the memory */
+  jerry_length_t length; /**< size of the memory */
+  jerry_object_native_free_callback_t free_cb; /**< the free callback of the memory (can be NULL) */
+} jerry_arraybuffer_contents_t;
+
 /**
  * An opaque declaration of the JerryScript context structure.
  */
@@ -418,6 +453,8 @@ jerry_size_t jerry_substring_to_utf8_char_buffer (const jerry_value_t value,
                                                   jerry_length_t end_pos,
                                                   jerry_char_t *buffer_p,
                                                   jerry_size_t buffer_size);
+const jerry_char_t *jerry_string_borrow_utf8 (const jerry_value_t value, jerry_size_t *size_p);
+void jerry_string_release_utf8 (const jerry_value_t value, const jerry_char_t *buffer_p, jerry_size_t size);
 
 /**
  * Functions for array object values.
@@ -457,6 +494,8 @@ jerry_value_t jerry_create_number_infinity (bool sign);
 jerry_value_t jerry_create_number_nan (void);
 jerry_value_t jerry_create_null (void);
 jerry_value_t jerry_create_object (void);
+jerry_value_t jerry_create_object_from_properties (const jerry_value_t *prop_names_p, const jerry_value_t *values_p,
+                                                   jerry_size_t count);
 jerry_value_t jerry_create_promise (void);
 jerry_value_t jerry_create_regexp (const jerry_char_t *pattern, uint16_t flags);
 jerry_value_t jerry_create_regexp_sz (const jerry_char_t *pattern, jerry_size_t pattern_size, uint16_t flags);
@@ -464,6 +503,11 @@ jerry_value_t jerry_create_string_from_utf8 (const jerry_char_t *str_p);
 jerry_value_t jerry_create_string_sz_from_utf8 (const jerry_char_t *str_p, jerry_size_t str_size);
 jerry_value_t jerry_create_string (const jerry_char_t *str_p);
 jerry_value_t jerry_create_string_sz (const jerry_char_t *str_p, jerry_size_t str_size);
+jerry_value_t jerry_create_property_name (const jerry_char_t *str_p, jerry_size_t str_size);
+jerry_value_t jerry_create_external_string (const jerry_char_t *str_p,
+                                           jerry_object_native_free_callback_t free_cb);
+jerry_value_t jerry_create_external_string_sz (const jerry_char_t *str_p, jerry_size_t str_size,
+                                              jerry_object_native_free_callback_t free_cb);
 jerry_value_t jerry_create_undefined (void);
 
 /**
@@ -476,6 +520,8 @@ bool jerry_delete_property_by_index (const jerry_value_t obj_val, uint32_t index
 
 jerry_value_t jerry_get_property (const jerry_value_t obj_val, const jerry_value_t prop_name_val);
 jerry_value_t jerry_get_property_by_index (const jerry_value_t obj_val, uint32_t index);
+jerry_value_t jerry_get_properties (const jerry_value_t obj_val, const jerry_value_t *prop_names_p,
+                                    jerry_value_t *values_p, jerry_size_t count);
 jerry_value_t jerry_set_property (const jerry_value_t obj_val, const jerry_value_t prop_name_val,
                                   const jerry_value_t value_to_set);
 jerry_value_t jerry_set_property_by_index (const jerry_value_t obj_val, uint32_t index,
@@ -544,6 +590,51 @@ jerry_context_t *jerry_create_context (uint32_t heap_size, jerry_context_alloc_t
 void jerry_set_vm_exec_stop_callback (jerry_vm_exec_stop_callback_t stop_cb, void *user_p, uint32_t frequency);
 jerry_value_t jerry_get_backtrace (uint32_t max_depth);
 
+/**
+ * Sampling profiler functions.
+ */
+void jerry_profiler_start (uint32_t interval);
+void jerry_profiler_stop (void);
+void jerry_profiler_request_sample (void);
+void jerry_profiler_reset (void);
+size_t jerry_profiler_get_collapsed_stacks (jerry_char_t *buffer_p, size_t buffer_size);
+
+/**
+ * VM statistics functions.
+ */
+size_t jerry_get_vm_stats_json (jerry_char_t *buffer_p, size_t buffer_size);
+void jerry_reset_vm_stats (void);
+
+/**
+ * Heap snapshot functions.
+ */
+bool jerry_heap_snapshot (jerry_heap_snapshot_cb_t callback_p, void *user_p);
+
+/**
+ * Heap image functions.
+ */
+jerry_value_t jerry_save_heap_image (uint8_t *buffer_p,
+                                     size_t buffer_size,
+                                     jerry_heap_image_pointer_cb_t pointer_cb,
+                                     void *user_p);
+bool jerry_init_from_heap_image (jerry_init_flag_t flags,
+                                 const uint8_t *image_p,
+                                 size_t image_size,
+                                 jerry_heap_image_pointer_cb_t pointer_cb,
+                                 void *user_p);
+
+/**
+ * Allocation site functions.
+ */
+size_t jerry_get_alloc_sites_json (jerry_char_t *buffer_p, size_t buffer_size);
+void jerry_reset_alloc_sites (void);
+
+/**
+ * Structured clone functions.
+ */
+jerry_value_t jerry_serialize (const jerry_value_t value, uint8_t *buffer_p, size_t buffer_size);
+jerry_value_t jerry_deserialize (const uint8_t *buffer_p, size_t buffer_size);
+
 /**
  * Array buffer components.
  */
@@ -562,6 +653,8 @@ jerry_length_t jerry_arraybuffer_read (const jerry_value_t value,
                                        jerry_length_t buf_size);
 jerry_length_t jerry_get_arraybuffer_byte_length (const jerry_value_t value);
 uint8_t *jerry_get_arraybuffer_pointer (const jerry_value_t value);
+bool jerry_is_arraybuffer_detachable (const jerry_value_t value);
+jerry_value_t jerry_detach_arraybuffer (const jerry_value_t value, jerry_arraybuffer_contents_t *contents_p);
 
 
 /**
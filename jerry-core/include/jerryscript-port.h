@@ -179,6 +179,92 @@ struct jerry_context_t *jerry_port_get_current_context (void);
  */
 void jerry_port_sleep (uint32_t sleep_time);
 
+/*
+ * Heap region Port API
+ */
+
+/**
+ * Allocate a region of the engine heap. The heap starts with a single region
+ * and it grows by further regions when the garbage collector cannot free enough
+ * memory, until the heap size is reached.
+ *
+ * Note:
+ *      This port function is called by jerry-core when JMEM_HEAP_REGIONS is
+ *      defined. Otherwise this function is not used.
+ *
+ * @param size size of the region, a multiple of the configured region size.
+ *
+ * @return pointer to the region aligned to 8 bytes, or NULL if there is not
+ *         enough memory.
+ */
+void *jerry_port_alloc_heap_region (size_t size);
+
+/**
+ * Free a region allocated by jerry_port_alloc_heap_region when the engine is
+ * cleaned up.
+ *
+ * Note:
+ *      This port function is called by jerry-core when JMEM_HEAP_REGIONS is
+ *      defined. Otherwise this function is not used.
+ *
+ * @param region_p pointer to the region.
+ * @param size size of the region.
+ */
+void jerry_port_free_heap_region (void *region_p, size_t size);
+
+/*
+ * Detached ArrayBuffer Port API
+ */
+
+/**
+ * Allocate memory for the data of an ArrayBuffer created by the engine, which
+ * is detached by jerry_detach_arraybuffer. The memory does not belong to any
+ * context, so it can be passed to another context.
+ *
+ * Note:
+ *      This port function is called by jerry-core when
+ *      CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN is _not_ defined. Otherwise this
+ *      function is not used.
+ *
+ * @param size size of the memory, greater than zero.
+ *
+ * @return pointer to the memory, or NULL if there is not enough memory.
+ */
+void *jerry_port_alloc_arraybuffer (size_t size);
+
+/**
+ * Free memory allocated by jerry_port_alloc_arraybuffer. This is the free
+ * callback which is returned by jerry_detach_arraybuffer for the memory.
+ *
+ * Note:
+ *      This port function is called by jerry-core when
+ *      CONFIG_DISABLE_ES2015_TYPEDARRAY_BUILTIN is _not_ defined. Otherwise this
+ *      function is not used.
+ *
+ * @param buffer_p pointer to the memory.
+ */
+void jerry_port_free_arraybuffer (void *buffer_p);
+
+/*
+ * Heap page release Port API
+ */
+
+/**
+ * Give the physical memory of unused heap pages back to the system. The pages
+ * stay part of the heap: the engine may write them again later, and it does
+ * not depend on their content, so the port may replace them with zero pages
+ * (e.g. madvise (MADV_DONTNEED) on Linux) or do nothing.
+ *
+ * Note:
+ *      This port function is called by jerry-core when JMEM_HEAP_RELEASE_FREE_PAGES
+ *      is defined, after each high severity garbage collection. Otherwise this
+ *      function is not used.
+ *
+ * @param start_p start of the pages, aligned to the configured page size.
+ * @param size size of the pages, a multiple of the configured page size.
+ */
+void jerry_port_release_heap_pages (void *start_p, size_t size);
+
 /**
  * @}
  */
@@ -26,6 +26,8 @@
 #include "jmem.h"
 #include "re-bytecode.h"
 #include "vm-defines.h"
+#include "vm-profiler.h"
+#include "vm-stats.h"
 #include "jerryscript.h"
 #include "jerryscript-debugger-transport.h"
 
@@ -45,8 +47,34 @@
  * use the first 8 bytes of the heap, nothing prevents to use it
  * for other purposes. Currently the free region start is stored
  * there.
+ *
+ * When JMEM_HEAP_REGIONS is defined, the heap is a set of regions
+ * allocated by jerry_port_alloc_heap_region on demand. The regions
+ * are mapped into a contiguous offset space of JMEM_HEAP_SIZE bytes,
+ * which is used by the compressed pointers and the free list. The
+ * first 8 bytes of each region are reserved in the same way, so free
+ * blocks of different regions are never merged.
  */
 typedef struct jmem_heap_t jmem_heap_t;
+
+#ifdef JMEM_HEAP_REGIONS
+/**
+ * Size of the parts of the offset space, each part is mapped to a
+ * (part of a) region. Larger regions occupy multiple parts.
+ */
+#define JMEM_HEAP_REGION_SIZE ((size_t) (CONFIG_MEM_HEAP_REGION_SIZE))
+
+/**
+ * Item of the region table. The table maps the parts of the offset space to
+ * addresses, and it also stores two buckets of a hash table, which maps the
+ * JMEM_HEAP_REGION_SIZE aligned address slots to the part starting in them.
+ */
+typedef struct
+{
+  uint8_t *start_p; /**< start address of the part with the same index as the item (NULL if unused) */
+  uint32_t buckets[2]; /**< index of a part plus one, 0 if empty, or JMEM_HEAP_REGION_HASH_COLLISION */
+} jmem_heap_region_t;
+#endif /* JMEM_HEAP_REGIONS */
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
 
 /**
@@ -85,8 +113,31 @@ struct jerry_context_t
   /* Update JERRY_CONTEXT_FIRST_MEMBER if the first non-external member changes */
   ecma_object_t *ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT]; /**< pointer to instances of built-in objects */
 #ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-  const re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< regex cache */
+  const re_compiled_code_t *re_cache[RE_CACHE_TABLE_SIZE]; /**< regex cache (open addressing hash table) */
+  uint32_t re_cache_last_used[RE_CACHE_TABLE_SIZE]; /**< value of re_cache_clock when the regex cache
+                                                     *   entry was last used */
+  uint32_t re_cache_count; /**< number of entries in the regex cache */
+  uint32_t re_cache_clock; /**< incremented when an entry of the regex cache is used */
 #endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
+#ifndef CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE
+  ecma_number_string_cache_entry_t number_string_cache[ECMA_NUMBER_STRING_CACHE_SIZE]; /**< number string cache */
+#endif /* !CONFIG_ECMA_NUMBER_STRING_CACHE_DISABLE */
+#ifndef CONFIG_ECMA_GLOBAL_CACHE_DISABLE
+  ecma_global_cache_entry_t global_cache[ECMA_GLOBAL_CACHE_SIZE]; /**< global property cache */
+  uint32_t global_cache_epoch; /**< incremented when a property of the global object is deleted */
+#endif /* !CONFIG_ECMA_GLOBAL_CACHE_DISABLE */
+#ifndef CONFIG_ECMA_ENUM_CACHE_DISABLE
+  ecma_enum_cache_entry_t *enum_cache[ECMA_ENUM_CACHE_SIZE]; /**< property name enumeration cache */
+  ecma_enum_cache_entry_t *enum_cache_active_p; /**< enumeration cache entry whose names are being copied */
+#endif /* !CONFIG_ECMA_ENUM_CACHE_DISABLE */
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  jmem_cpointer_t eval_cache[ECMA_EVAL_CACHE_TABLE_SIZE]; /**< compiled code cache of indirect eval and the
+                                                          *   Function constructor (open addressing hash table) */
+  uint32_t eval_cache_count; /**< number of entries in the eval cache */
+  uint32_t eval_cache_clock; /**< incremented when an entry of the eval cache is used */
+  uint32_t eval_cache_gc_clock; /**< value of eval_cache_clock when the garbage collector last trimmed the
+                                 *   eval cache */
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
   ecma_object_t *ecma_gc_objects_p; /**< List of currently alive objects. */
   jmem_heap_free_t *jmem_heap_list_skip_p; /**< This is used to speed up deallocation. */
   jmem_pools_chunk_t *jmem_free_8_byte_chunk_p; /**< list of free eight byte pool chunks */
@@ -113,16 +164,15 @@ struct jerry_context_t
   uint32_t lit_magic_string_ex_count; /**< external magic strings count */
   uint32_t jerry_init_flags; /**< run-time configuration flags */
   uint32_t status_flags; /**< run-time flags (the top 8 bits are used for passing class parsing options) */
+#ifdef JERRY_HEAP_IMAGE
+  uint32_t ecma_external_string_count; /**< number of live external strings (they cannot be saved into heap images) */
+#endif /* JERRY_HEAP_IMAGE */
 
 #ifndef CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE
   uint8_t ecma_prop_hashmap_alloc_state; /**< property hashmap allocation state: 0-4,
                                           *   if !0 property hashmap allocation is disabled */
 #endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_DISABLE */
 
-#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
-  uint8_t re_cache_idx; /**< evicted item index when regex cache is full (round-robin) */
-#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
-
 #ifndef CONFIG_DISABLE_ES2015_PROMISE_BUILTIN
   ecma_job_queueitem_t *job_queue_head_p; /**< points to the head item of the jobqueue */
   ecma_job_queueitem_t *job_queue_tail_p; /**< points to the tail item of the jobqueue*/
@@ -136,6 +186,31 @@ struct jerry_context_t
                                                  *   ECMAScript execution should be stopped */
 #endif /* JERRY_VM_EXEC_STOP */
 
+#ifdef JERRY_PROFILER
+  vm_profiler_stack_t *profiler_stacks[VM_PROFILER_HASH_SIZE]; /**< hash table of the collected stacks */
+  volatile uint32_t profiler_countdown; /**< number of instructions until the next sample */
+  uint32_t profiler_interval; /**< reset value for profiler_countdown */
+  uint32_t profiler_dropped_samples; /**< number of samples dropped because of memory shortage */
+  bool profiler_is_running; /**< true, if samples are collected */
+#endif /* JERRY_PROFILER */
+
+#ifdef JERRY_VM_STATS
+  uint64_t vm_stats_opcodes[VM_STATS_OPCODE_COUNT]; /**< execution counters of the opcodes */
+  uint64_t vm_stats_lcache_lookups; /**< number of lcache lookups */
+  uint64_t vm_stats_lcache_hits; /**< number of successful lcache lookups */
+  uint64_t vm_stats_hashmap_lookups; /**< number of property hashmap lookups */
+  uint64_t vm_stats_hashmap_hits; /**< number of successful property hashmap lookups */
+  vm_stats_function_t *vm_stats_functions[VM_STATS_HASH_SIZE]; /**< hash table of the function statistics */
+  vm_stats_function_t vm_stats_unknown_function; /**< statistics of the functions which have no
+                                                  *   statistics item because of memory shortage */
+#endif /* JERRY_VM_STATS */
+
+#ifdef JMEM_ALLOC_SITES
+  jmem_alloc_site_t jmem_alloc_sites[JMEM_ALLOC_SITES_COUNT]; /**< hash table of the allocation sites */
+  jmem_alloc_site_tag_t jmem_alloc_site_tags[CONFIG_MEM_HEAP_AREA_SIZE >> JMEM_ALIGNMENT_LOG]; /**< allocation site
+                                                                                             *   of each heap unit */
+#endif /* JMEM_ALLOC_SITES */
+
 #ifdef JERRY_DEBUGGER
   uint8_t debugger_send_buffer[JERRY_DEBUGGER_TRANSPORT_MAX_BUFFER_SIZE]; /**< buffer for sending messages */
   uint8_t debugger_receive_buffer[JERRY_DEBUGGER_TRANSPORT_MAX_BUFFER_SIZE]; /**< buffer for receiving messages */
@@ -181,6 +256,18 @@ struct jerry_context_t
 
 #define JMEM_HEAP_SIZE (JERRY_CONTEXT (heap_size))
 
+#ifdef JMEM_HEAP_REGIONS
+
+struct jmem_heap_t
+{
+  jmem_heap_free_t first; /**< first node in free region list */
+  uint32_t region_count; /**< number of used items in the regions array */
+  uint32_t region_hash_mask; /**< number of hash buckets minus one */
+  jmem_heap_region_t regions[]; /**< table of the JMEM_HEAP_REGION_SIZE parts of the heap */
+};
+
+#else /* !JMEM_HEAP_REGIONS */
+
 #define JMEM_HEAP_AREA_SIZE (JMEM_HEAP_SIZE - JMEM_ALIGNMENT)
 
 struct jmem_heap_t
@@ -189,6 +276,8 @@ struct jmem_heap_t
   uint8_t area[]; /**< heap area */
 };
 
+#endif /* JMEM_HEAP_REGIONS */
+
 #define JERRY_HEAP_CONTEXT(field) (JERRY_CONTEXT (heap_p)->field)
 
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
@@ -216,6 +305,19 @@ extern jerry_context_t jerry_global_context;
 */
 #define JMEM_HEAP_SIZE ((size_t) (CONFIG_MEM_HEAP_AREA_SIZE))
 
+#ifdef JMEM_HEAP_REGIONS
+
+struct jmem_heap_t
+{
+  jmem_heap_free_t first; /**< first node in free region list */
+  uint32_t region_count; /**< number of used items in the regions array */
+  uint32_t region_hash_mask; /**< number of hash buckets minus one */
+  jmem_heap_region_t regions[JMEM_HEAP_SIZE / JMEM_HEAP_REGION_SIZE]; /**< table of the JMEM_HEAP_REGION_SIZE
+                                                                       *   parts of the heap */
+};
+
+#else /* !JMEM_HEAP_REGIONS */
+
 /**
  * Calculate heap area size, leaving space for a pointer to the free list
  */
@@ -227,6 +329,8 @@ struct jmem_heap_t
   uint8_t area[JMEM_HEAP_AREA_SIZE]; /**< heap area */
 };
 
+#endif /* JMEM_HEAP_REGIONS */
+
 /**
  * Global heap.
  */
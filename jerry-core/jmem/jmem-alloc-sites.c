@@ -0,0 +1,401 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Allocation site tracking
+ */
+
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "jmem.h"
+#include "lit-char-helpers.h"
+#include "vm.h"
+
+#define JMEM_ALLOCATOR_INTERNAL
+#include "jmem-allocator-internal.h"
+
+#ifdef JMEM_ALLOC_SITES
+
+/** \addtogroup mem Memory allocation
+ * @{
+ *
+ * \addtogroup allocsites Allocation site tracking
+ * @{
+ */
+
+/**
+ * Site which counts the allocations when the site table is full.
+ */
+#define JMEM_ALLOC_SITE_OVERFLOW 1
+
+/**
+ * Index of the first regular site (index 0 marks untracked blocks).
+ */
+#define JMEM_ALLOC_SITE_FIRST 2
+
+JERRY_STATIC_ASSERT (JMEM_ALLOC_SITES_COUNT > JMEM_ALLOC_SITE_FIRST && JMEM_ALLOC_SITES_COUNT <= UINT16_MAX + 1,
+                     jmem_alloc_sites_count_must_fit_into_the_tags);
+
+/**
+ * Get the tag of a heap block.
+ *
+ * @return pointer to the tag
+ */
+static inline jmem_alloc_site_tag_t * JERRY_ATTR_ALWAYS_INLINE
+jmem_alloc_sites_get_tag (const void *block_p) /**< heap block */
+{
+  size_t offset = (size_t) ((const uint8_t *) block_p - JERRY_HEAP_CONTEXT (area));
+
+  JERRY_ASSERT (offset < JMEM_HEAP_AREA_SIZE);
+
+  return JERRY_CONTEXT (jmem_alloc_site_tags) + (offset >> JMEM_ALIGNMENT_LOG);
+} /* jmem_alloc_sites_get_tag */
+
+/**
+ * Find or create the site of an allocation from the given engine function
+ * at the current script position.
+ *
+ * Note:
+ *      this function is called from the allocator, so it must not allocate memory
+ *
+ * @return index of the site
+ */
+static jmem_alloc_site_tag_t
+jmem_alloc_sites_find (const char *engine_name_p) /**< name of the allocating engine function */
+{
+  uintptr_t script_id = 0;
+  uint32_t script_position = 0;
+  vm_frame_ctx_t *frame_ctx_p = JERRY_CONTEXT (vm_top_context_p);
+
+  if (frame_ctx_p != NULL)
+  {
+#ifdef JERRY_ENABLE_LINE_INFO
+    if (ecma_is_value_string (frame_ctx_p->resource_name))
+    {
+      script_id = (uintptr_t) frame_ctx_p->resource_name;
+      script_position = ecma_compiled_code_get_line (frame_ctx_p->bytecode_header_p,
+                                                     (uint32_t) (frame_ctx_p->current_byte_code_p
+                                                                 - frame_ctx_p->byte_code_start_p));
+    }
+#else /* !JERRY_ENABLE_LINE_INFO */
+    script_id = (uintptr_t) frame_ctx_p->bytecode_header_p;
+    script_position = (uint32_t) (frame_ctx_p->current_byte_code_p - frame_ctx_p->byte_code_start_p);
+#endif /* JERRY_ENABLE_LINE_INFO */
+  }
+
+  uint32_t hash = (uint32_t) ((uintptr_t) engine_name_p >> 2);
+  hash = (hash * 31) + (uint32_t) script_id;
+  hash = (hash * 31) + script_position;
+
+  jmem_alloc_site_t *sites_p = JERRY_CONTEXT (jmem_alloc_sites);
+
+  for (uint32_t i = 0; i < JMEM_ALLOC_SITES_COUNT - JMEM_ALLOC_SITE_FIRST; i++)
+  {
+    uint32_t index = JMEM_ALLOC_SITE_FIRST + ((hash + i) % (JMEM_ALLOC_SITES_COUNT - JMEM_ALLOC_SITE_FIRST));
+    jmem_alloc_site_t *site_p = sites_p + index;
+
+    if (site_p->engine_name_p == NULL)
+    {
+      site_p->engine_name_p = engine_name_p;
+      site_p->script_id = script_id;
+      site_p->script_position = script_position;
+
+#ifdef JERRY_ENABLE_LINE_INFO
+      if (script_id != 0)
+      {
+        ecma_ref_ecma_string (ecma_get_string_from_value ((ecma_value_t) script_id));
+      }
+#endif /* JERRY_ENABLE_LINE_INFO */
+      return (jmem_alloc_site_tag_t) index;
+    }
+
+    if (site_p->engine_name_p == engine_name_p
+        && site_p->script_id == script_id
+        && site_p->script_position == script_position)
+    {
+      return (jmem_alloc_site_tag_t) index;
+    }
+  }
+
+  return JMEM_ALLOC_SITE_OVERFLOW;
+} /* jmem_alloc_sites_find */
+
+/**
+ * Register an allocated block.
+ */
+static void
+jmem_alloc_sites_register (void *block_p, /**< allocated block (can be NULL) */
+                           size_t size, /**< size of the block */
+                           const char *engine_name_p) /**< name of the allocating engine function */
+{
+  if (block_p == NULL)
+  {
+    return;
+  }
+
+  jmem_alloc_site_tag_t index = jmem_alloc_sites_find (engine_name_p);
+  jmem_alloc_site_t *site_p = JERRY_CONTEXT (jmem_alloc_sites) + index;
+
+  site_p->live_blocks++;
+  site_p->live_bytes += size;
+  site_p->allocations++;
+  site_p->allocated_bytes += size;
+
+  *jmem_alloc_sites_get_tag (block_p) = index;
+} /* jmem_alloc_sites_register */
+
+/**
+ * Unregister a block before it is freed.
+ */
+static void
+jmem_alloc_sites_unregister (void *block_p, /**< block */
+                             size_t size) /**< size of the block */
+{
+  jmem_alloc_site_tag_t *tag_p = jmem_alloc_sites_get_tag (block_p);
+
+  /* Blocks allocated by the allocator itself are not tracked. */
+  if (*tag_p == 0)
+  {
+    return;
+  }
+
+  jmem_alloc_site_t *site_p = JERRY_CONTEXT (jmem_alloc_sites) + *tag_p;
+
+  JERRY_ASSERT (site_p->live_blocks > 0 && site_p->live_bytes >= size);
+
+  site_p->live_blocks--;
+  site_p->live_bytes -= size;
+  *tag_p = 0;
+} /* jmem_alloc_sites_unregister */
+
+/**
+ * Tracked version of jmem_heap_alloc_block.
+ *
+ * @return pointer to the allocated block
+ */
+void *
+jmem_heap_alloc_block_at_site (const size_t size, /**< size of the block */
+                               const char *engine_name_p) /**< name of the allocating engine function */
+{
+  void *block_p = jmem_heap_alloc_block (size);
+  jmem_alloc_sites_register (block_p, size, engine_name_p);
+  return block_p;
+} /* jmem_heap_alloc_block_at_site */
+
+/**
+ * Tracked version of jmem_heap_alloc_block_null_on_error.
+ *
+ * @return pointer to the allocated block, or NULL if there is not enough memory
+ */
+void *
+jmem_heap_alloc_block_null_on_error_at_site (const size_t size, /**< size of the block */
+                                             const char *engine_name_p) /**< name of the allocating
+                                                                         *   engine function */
+{
+  void *block_p = jmem_heap_alloc_block_null_on_error (size);
+  jmem_alloc_sites_register (block_p, size, engine_name_p);
+  return block_p;
+} /* jmem_heap_alloc_block_null_on_error_at_site */
+
+/**
+ * Tracked version of jmem_heap_free_block.
+ */
+void
+jmem_heap_free_block_at_site (void *ptr, /**< block */
+                              const size_t size) /**< size of the block */
+{
+  jmem_alloc_sites_unregister (ptr, size);
+  jmem_heap_free_block (ptr, size);
+} /* jmem_heap_free_block_at_site */
+
+/**
+ * Tracked version of jmem_pools_alloc.
+ *
+ * @return pointer to the allocated chunk
+ */
+void *
+jmem_pools_alloc_at_site (size_t size, /**< size of the chunk */
+                          const char *engine_name_p) /**< name of the allocating engine function */
+{
+  void *chunk_p = jmem_pools_alloc (size);
+  jmem_alloc_sites_register (chunk_p, size, engine_name_p);
+  return chunk_p;
+} /* jmem_pools_alloc_at_site */
+
+/**
+ * Tracked version of jmem_pools_free.
+ */
+void
+jmem_pools_free_at_site (void *chunk_p, /**< chunk */
+                         size_t size) /**< size of the chunk */
+{
+  jmem_alloc_sites_unregister (chunk_p, size);
+  jmem_pools_free (chunk_p, size);
+} /* jmem_pools_free_at_site */
+
+/**
+ * Reset the allocation counters of the sites. The live blocks are kept.
+ */
+void
+jmem_alloc_sites_reset (void)
+{
+  jmem_alloc_site_t *sites_p = JERRY_CONTEXT (jmem_alloc_sites);
+
+  for (uint32_t i = 0; i < JMEM_ALLOC_SITES_COUNT; i++)
+  {
+    sites_p[i].allocations = 0;
+    sites_p[i].allocated_bytes = 0;
+  }
+} /* jmem_alloc_sites_reset */
+
+/**
+ * Release the resource names of the sites and stop tracking the live blocks.
+ * The remaining blocks are freed without updating the statistics.
+ */
+void
+jmem_alloc_sites_finalize (void)
+{
+#ifdef JERRY_ENABLE_LINE_INFO
+  jmem_alloc_site_t *sites_p = JERRY_CONTEXT (jmem_alloc_sites);
+
+  for (uint32_t i = JMEM_ALLOC_SITE_FIRST; i < JMEM_ALLOC_SITES_COUNT; i++)
+  {
+    if (sites_p[i].engine_name_p != NULL && sites_p[i].script_id != 0)
+    {
+      /* Freeing the string may update the statistics, so the site is cleared first. */
+      ecma_value_t resource_name = (ecma_value_t) sites_p[i].script_id;
+      sites_p[i].script_id = 0;
+      ecma_deref_ecma_string (ecma_get_string_from_value (resource_name));
+    }
+  }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+  memset (JERRY_CONTEXT (jmem_alloc_site_tags), 0, sizeof (JERRY_CONTEXT (jmem_alloc_site_tags)));
+  memset (JERRY_CONTEXT (jmem_alloc_sites), 0, sizeof (JERRY_CONTEXT (jmem_alloc_sites)));
+} /* jmem_alloc_sites_finalize */
+
+/**
+ * Append a "name": number pair to the output.
+ */
+static void
+jmem_alloc_sites_append_number (vm_output_t *output_p, /**< output */
+                                const char *name_p, /**< name */
+                                uint64_t value) /**< value */
+{
+  vm_output_append_ascii (output_p, ", \"");
+  vm_output_append_ascii (output_p, name_p);
+  vm_output_append_ascii (output_p, "\": ");
+  vm_output_append_uint (output_p, value);
+} /* jmem_alloc_sites_append_number */
+
+/**
+ * Append the script position of a site to the output.
+ */
+static void
+jmem_alloc_sites_append_script (vm_output_t *output_p, /**< output */
+                                const jmem_alloc_site_t *site_p) /**< site */
+{
+  if (site_p->script_id == 0)
+  {
+    vm_output_append_ascii (output_p, "null");
+    return;
+  }
+
+  vm_output_append_ascii (output_p, "\"");
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  ecma_string_t *resource_name_p = ecma_get_string_from_value ((ecma_value_t) site_p->script_id);
+
+  ECMA_STRING_TO_UTF8_STRING (resource_name_p, resource_name_chars_p, resource_name_size);
+
+  for (lit_utf8_size_t i = 0; i < resource_name_size; i++)
+  {
+    lit_utf8_byte_t chr = resource_name_chars_p[i];
+
+    if (chr == LIT_CHAR_DOUBLE_QUOTE || chr == LIT_CHAR_BACKSLASH)
+    {
+      vm_output_append_ascii (output_p, "\\");
+    }
+    else if (chr < LIT_CHAR_SP)
+    {
+      /* Control characters are not expected in names, they are simply replaced. */
+      chr = (lit_utf8_byte_t) LIT_CHAR_SP;
+    }
+
+    vm_output_append (output_p, &chr, 1);
+  }
+
+  ECMA_FINALIZE_UTF8_STRING (resource_name_chars_p, resource_name_size);
+  vm_output_append_ascii (output_p, ":");
+#else /* !JERRY_ENABLE_LINE_INFO */
+  vm_output_append_address (output_p, site_p->script_id);
+  vm_output_append_ascii (output_p, "+");
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+  vm_output_append_uint (output_p, site_p->script_position);
+  vm_output_append_ascii (output_p, "\"");
+} /* jmem_alloc_sites_append_script */
+
+/**
+ * Print the allocation sites in JSON format.
+ *
+ * @return size of the whole output
+ */
+size_t
+jmem_alloc_sites_to_json (uint8_t *buffer_p, /**< [out] output buffer (can be NULL) */
+                          size_t buffer_size) /**< size of the output buffer */
+{
+  vm_output_t output;
+  vm_output_init (&output, buffer_p, buffer_size);
+
+  vm_output_append_ascii (&output, "{\"sites\": [");
+
+  jmem_alloc_site_t *sites_p = JERRY_CONTEXT (jmem_alloc_sites);
+  bool is_first = true;
+
+  for (uint32_t i = JMEM_ALLOC_SITE_OVERFLOW; i < JMEM_ALLOC_SITES_COUNT; i++)
+  {
+    /* Printing the resource name may allocate memory, which updates the sites. */
+    jmem_alloc_site_t site = sites_p[i];
+
+    if (site.live_blocks == 0 && site.allocations == 0)
+    {
+      continue;
+    }
+
+    vm_output_append_ascii (&output, is_first ? "\n  " : ",\n  ");
+    is_first = false;
+
+    vm_output_append_ascii (&output, "{\"engine\": \"");
+    vm_output_append_ascii (&output, (i == JMEM_ALLOC_SITE_OVERFLOW) ? "(other)" : site.engine_name_p);
+    vm_output_append_ascii (&output, "\", \"script\": ");
+    jmem_alloc_sites_append_script (&output, &site);
+    jmem_alloc_sites_append_number (&output, "live_bytes", site.live_bytes);
+    jmem_alloc_sites_append_number (&output, "live_blocks", site.live_blocks);
+    jmem_alloc_sites_append_number (&output, "allocated_bytes", site.allocated_bytes);
+    jmem_alloc_sites_append_number (&output, "allocations", site.allocations);
+    vm_output_append_ascii (&output, "}");
+  }
+
+  vm_output_append_ascii (&output, "\n]}\n");
+  return output.length;
+} /* jmem_alloc_sites_to_json */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JMEM_ALLOC_SITES */
@@ -45,6 +45,83 @@
 #endif /* JERRY_VALGRIND */
 /** @} */
 
+/**
+ * End of list marker.
+ */
+#define JMEM_HEAP_END_OF_LIST ((uint32_t) 0xffffffff)
+
+#ifdef JMEM_HEAP_REGIONS
+#include "jcontext.h"
+
+/**
+ * Hash bucket value of the address slots where more than one part starts.
+ */
+#define JMEM_HEAP_REGION_HASH_COLLISION UINT32_MAX
+
+uint32_t jmem_heap_region_find_offset (const void *pointer_p);
+
+/**
+ * Get the offset of an address in the offset space of the heap regions.
+ *
+ * Note:
+ *      a part of a region starts either in the JMEM_HEAP_REGION_SIZE aligned slot
+ *      of the address or in the previous slot, so at most two buckets are checked
+ *
+ * @return offset - if the address points into a region,
+ *         JMEM_HEAP_END_OF_LIST - otherwise
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_region_get_offset (const void *pointer_p) /**< address */
+{
+  const jmem_heap_region_t *regions_p = JERRY_HEAP_CONTEXT (regions);
+  const uintptr_t slot = (uintptr_t) pointer_p / JMEM_HEAP_REGION_SIZE;
+  bool has_collision = false;
+
+  for (uintptr_t i = 0; i < 2; i++)
+  {
+    const uint32_t bucket = (uint32_t) ((slot - i) & JERRY_HEAP_CONTEXT (region_hash_mask));
+    const uint32_t value = regions_p[bucket >> 1].buckets[bucket & 0x1];
+
+    if (value == JMEM_HEAP_REGION_HASH_COLLISION)
+    {
+      has_collision = true;
+    }
+    else if (value != 0)
+    {
+      const uintptr_t offset = (uintptr_t) pointer_p - (uintptr_t) regions_p[value - 1].start_p;
+
+      if (offset < JMEM_HEAP_REGION_SIZE)
+      {
+        return (uint32_t) ((value - 1) * JMEM_HEAP_REGION_SIZE + offset);
+      }
+    }
+  }
+
+  return has_collision ? jmem_heap_region_find_offset (pointer_p) : JMEM_HEAP_END_OF_LIST;
+} /* jmem_heap_region_get_offset */
+
+/**
+ * Get the address of an offset in the offset space of the heap regions.
+ *
+ * @return address
+ */
+static inline uint8_t * JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_region_get_address (uint32_t offset) /**< offset */
+{
+  JERRY_ASSERT (offset / JMEM_HEAP_REGION_SIZE < JERRY_HEAP_CONTEXT (region_count));
+
+  return JERRY_HEAP_CONTEXT (regions)[offset / JMEM_HEAP_REGION_SIZE].start_p + (offset % JMEM_HEAP_REGION_SIZE);
+} /* jmem_heap_region_get_address */
+#endif /* JMEM_HEAP_REGIONS */
+
+#ifdef JMEM_ALLOC_SITES
+#undef jmem_heap_alloc_block
+#undef jmem_heap_alloc_block_null_on_error
+#undef jmem_heap_free_block
+#undef jmem_pools_alloc
+#undef jmem_pools_free
+#endif /* JMEM_ALLOC_SITES */
+
 #ifdef JMEM_STATS
 void jmem_heap_stats_reset_peak (void);
 void jmem_heap_stats_print (void);
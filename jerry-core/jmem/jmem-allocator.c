@@ -141,6 +141,38 @@ jmem_stats_free_property_bytes (size_t property_size)
   heap_stats->property_bytes -= property_size;
 } /* jmem_stats_free_property_bytes */
 
+/**
+ * Register a lookup in the compiled code cache of eval.
+ */
+void
+jmem_stats_eval_cache_lookup (bool is_hit) /**< true - if the compiled code is found in the cache */
+{
+  jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
+
+  heap_stats->eval_cache_lookups++;
+
+  if (is_hit)
+  {
+    heap_stats->eval_cache_hits++;
+  }
+} /* jmem_stats_eval_cache_lookup */
+
+/**
+ * Register a lookup in the RegExp bytecode cache.
+ */
+void
+jmem_stats_regexp_cache_lookup (bool is_hit) /**< true - if the bytecode is found in the cache */
+{
+  jmem_heap_stats_t *heap_stats = &JERRY_CONTEXT (jmem_heap_stats);
+
+  heap_stats->regexp_cache_lookups++;
+
+  if (is_hit)
+  {
+    heap_stats->regexp_cache_hits++;
+  }
+} /* jmem_stats_regexp_cache_lookup */
+
 #endif /* JMEM_STATS */
 
 /**
@@ -188,9 +220,14 @@ jmem_compress_pointer (const void *pointer_p) /**< pointer to compress */
 #if defined (ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY) && defined (JERRY_CPOINTER_32_BIT)
   JERRY_ASSERT (((jmem_cpointer_t) uint_ptr) == uint_ptr);
 #else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY || !JERRY_CPOINTER_32_BIT */
+#ifdef JMEM_HEAP_REGIONS
+  uint_ptr = jmem_heap_region_get_offset (pointer_p);
+  JERRY_ASSERT (uint_ptr != JMEM_HEAP_END_OF_LIST);
+#else /* !JMEM_HEAP_REGIONS */
   const uintptr_t heap_start = (uintptr_t) &JERRY_HEAP_CONTEXT (first);
 
   uint_ptr -= heap_start;
+#endif /* JMEM_HEAP_REGIONS */
   uint_ptr >>= JMEM_ALIGNMENT_LOG;
 
 #ifdef JERRY_CPOINTER_32_BIT
@@ -221,10 +258,14 @@ jmem_decompress_pointer (uintptr_t compressed_pointer) /**< pointer to decompres
 #if defined (ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY) && defined (JERRY_CPOINTER_32_BIT)
   JERRY_ASSERT (uint_ptr % JMEM_ALIGNMENT == 0);
 #else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY || !JERRY_CPOINTER_32_BIT */
+  uint_ptr <<= JMEM_ALIGNMENT_LOG;
+#ifdef JMEM_HEAP_REGIONS
+  uint_ptr = (uintptr_t) jmem_heap_region_get_address ((uint32_t) uint_ptr);
+#else /* !JMEM_HEAP_REGIONS */
   const uintptr_t heap_start = (uintptr_t) &JERRY_HEAP_CONTEXT (first);
 
-  uint_ptr <<= JMEM_ALIGNMENT_LOG;
   uint_ptr += heap_start;
+#endif /* JMEM_HEAP_REGIONS */
 
   JERRY_ASSERT (jmem_is_heap_pointer ((void *) uint_ptr));
 #endif /* ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY && JERRY_CPOINTER_32_BIT */
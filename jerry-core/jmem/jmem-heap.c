@@ -33,11 +33,6 @@
  */
 
 #ifndef JERRY_SYSTEM_ALLOCATOR
-/**
- * End of list marker.
- */
-#define JMEM_HEAP_END_OF_LIST ((uint32_t) 0xffffffff)
-
 /**
  * @{
  */
@@ -45,7 +40,12 @@
 /* In this case we simply store the pointer, since it fits anyway. */
 #define JMEM_HEAP_GET_OFFSET_FROM_ADDR(p) ((uint32_t) (p))
 #define JMEM_HEAP_GET_ADDR_FROM_OFFSET(u) ((jmem_heap_free_t *) (u))
-#else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
+#elif defined (JMEM_HEAP_REGIONS)
+/* The offset of the end of list marker has no address. */
+#define JMEM_HEAP_GET_OFFSET_FROM_ADDR(p) jmem_heap_region_get_offset (p)
+#define JMEM_HEAP_GET_ADDR_FROM_OFFSET(u) \
+  ((jmem_heap_free_t *) ((u) == JMEM_HEAP_END_OF_LIST ? NULL : jmem_heap_region_get_address (u)))
+#else /* !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY && !JMEM_HEAP_REGIONS */
 #define JMEM_HEAP_GET_OFFSET_FROM_ADDR(p) ((uint32_t) ((uint8_t *) (p) - JERRY_HEAP_CONTEXT (area)))
 #define JMEM_HEAP_GET_ADDR_FROM_OFFSET(u) ((jmem_heap_free_t *) (JERRY_HEAP_CONTEXT (area) + (u)))
 #endif /* ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
@@ -63,6 +63,33 @@ jmem_heap_get_region_end (jmem_heap_free_t *curr_p) /**< current region */
 {
   return (jmem_heap_free_t *)((uint8_t *) curr_p + curr_p->size);
 } /* jmem_heap_get_region_end */
+
+#ifdef JMEM_HEAP_REGIONS
+JERRY_STATIC_ASSERT ((JMEM_HEAP_REGION_SIZE & (JMEM_HEAP_REGION_SIZE - 1)) == 0
+                     && JMEM_HEAP_REGION_SIZE >= 2 * JMEM_ALIGNMENT,
+                     jmem_heap_region_size_must_be_a_power_of_two);
+
+/**
+ * Header of a heap region, stored in its reserved first JMEM_ALIGNMENT bytes.
+ */
+typedef struct
+{
+  uint32_t size; /**< size of the region */
+} jmem_heap_region_header_t;
+
+JERRY_STATIC_ASSERT (sizeof (jmem_heap_region_header_t) <= JMEM_ALIGNMENT,
+                     jmem_heap_region_header_must_fit_into_the_reserved_space);
+#endif /* JMEM_HEAP_REGIONS */
+
+#ifdef JMEM_HEAP_RELEASE_FREE_PAGES
+/**
+ * Size of the pages which are returned to the system
+ */
+#define JMEM_HEAP_PAGE_SIZE ((uintptr_t) (CONFIG_MEM_HEAP_PAGE_SIZE))
+
+JERRY_STATIC_ASSERT ((JMEM_HEAP_PAGE_SIZE & (JMEM_HEAP_PAGE_SIZE - 1)) == 0,
+                     jmem_heap_page_size_must_be_a_power_of_two);
+#endif /* JMEM_HEAP_RELEASE_FREE_PAGES */
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
 
 /**
@@ -103,6 +130,230 @@ static void jmem_heap_stat_free_iter (void);
 #endif /* JMEM_STATS */
 /** @} */
 
+#ifdef JMEM_HEAP_REGIONS
+/**
+ * Get the offset of an address by checking each part of the heap.
+ *
+ * Note:
+ *      used by jmem_heap_region_get_offset when the hash buckets of the address collide
+ *
+ * @return offset - if the address points into a region,
+ *         JMEM_HEAP_END_OF_LIST - otherwise
+ */
+uint32_t
+jmem_heap_region_find_offset (const void *pointer_p) /**< address */
+{
+  const jmem_heap_region_t *regions_p = JERRY_HEAP_CONTEXT (regions);
+  const uint32_t region_count = JERRY_HEAP_CONTEXT (region_count);
+
+  for (uint32_t i = 0; i < region_count; i++)
+  {
+    const uintptr_t offset = (uintptr_t) pointer_p - (uintptr_t) regions_p[i].start_p;
+
+    /* Items of released regions are NULL. */
+    if (offset < JMEM_HEAP_REGION_SIZE && regions_p[i].start_p != NULL)
+    {
+      return (uint32_t) (i * JMEM_HEAP_REGION_SIZE + offset);
+    }
+  }
+
+  return JMEM_HEAP_END_OF_LIST;
+} /* jmem_heap_region_find_offset */
+
+/**
+ * Rebuild the hash table of the address slots after a region is added or released.
+ */
+static void
+jmem_heap_region_rebuild_hash (void)
+{
+  jmem_heap_region_t *regions_p = JERRY_HEAP_CONTEXT (regions);
+  const uint32_t mask = JERRY_HEAP_CONTEXT (region_hash_mask);
+
+  for (uint32_t bucket = 0; bucket <= mask; bucket++)
+  {
+    regions_p[bucket >> 1].buckets[bucket & 0x1] = 0;
+  }
+
+  for (uint32_t i = 0; i < JERRY_HEAP_CONTEXT (region_count); i++)
+  {
+    if (regions_p[i].start_p == NULL)
+    {
+      continue;
+    }
+
+    const uint32_t bucket = (uint32_t) (((uintptr_t) regions_p[i].start_p / JMEM_HEAP_REGION_SIZE) & mask);
+    uint32_t *value_p = regions_p[bucket >> 1].buckets + (bucket & 0x1);
+
+    *value_p = (*value_p == 0) ? i + 1 : JMEM_HEAP_REGION_HASH_COLLISION;
+  }
+} /* jmem_heap_region_rebuild_hash */
+
+/**
+ * Add a new region to the heap, which has a free block of at least the given size.
+ *
+ * @return true - if the region is added,
+ *         false - if the heap size limit is reached or the port cannot allocate the region
+ */
+static bool
+jmem_heap_add_region (const size_t size) /**< required free block size */
+{
+  /* The first JMEM_ALIGNMENT bytes of the region are reserved. */
+  const size_t required_size = JERRY_ALIGNUP (size, JMEM_ALIGNMENT) + JMEM_ALIGNMENT;
+  const size_t region_size = JERRY_ALIGNUP (required_size, JMEM_HEAP_REGION_SIZE);
+  const uint32_t item_count = (uint32_t) (region_size / JMEM_HEAP_REGION_SIZE);
+  jmem_heap_region_t *regions_p = JERRY_HEAP_CONTEXT (regions);
+
+  /* Find the first sequence of unused items, items of released regions are reused. */
+  uint32_t first_index = 0;
+
+  for (uint32_t index = 0;
+       index < JERRY_HEAP_CONTEXT (region_count) && index - first_index < item_count;
+       index++)
+  {
+    if (regions_p[index].start_p != NULL)
+    {
+      first_index = index + 1;
+    }
+  }
+
+  if (item_count > JMEM_HEAP_SIZE / JMEM_HEAP_REGION_SIZE - first_index)
+  {
+    return false;
+  }
+
+  uint8_t *region_p = (uint8_t *) jerry_port_alloc_heap_region (region_size);
+
+  if (region_p == NULL)
+  {
+    return false;
+  }
+
+  JERRY_ASSERT ((uintptr_t) region_p % JMEM_ALIGNMENT == 0);
+
+  ((jmem_heap_region_header_t *) region_p)->size = (uint32_t) region_size;
+
+  for (uint32_t i = 0; i < item_count; i++)
+  {
+    regions_p[first_index + i].start_p = region_p + i * JMEM_HEAP_REGION_SIZE;
+  }
+
+  if (first_index + item_count > JERRY_HEAP_CONTEXT (region_count))
+  {
+    JERRY_HEAP_CONTEXT (region_count) = first_index + item_count;
+  }
+
+  jmem_heap_region_rebuild_hash ();
+
+  jmem_heap_free_t *const block_p = (jmem_heap_free_t *) (region_p + JMEM_ALIGNMENT);
+  const uint32_t block_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+
+  /* Insert the free block of the region into the address ordered free list. */
+  jmem_heap_free_t *prev_p = &JERRY_HEAP_CONTEXT (first);
+
+  JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
+
+  while (prev_p->next_offset < block_offset)
+  {
+    jmem_heap_free_t *next_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
+    JMEM_VALGRIND_DEFINED_SPACE (next_p, sizeof (jmem_heap_free_t));
+    JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
+    prev_p = next_p;
+  }
+
+  block_p->size = (uint32_t) (region_size - JMEM_ALIGNMENT);
+  block_p->next_offset = prev_p->next_offset;
+  prev_p->next_offset = block_offset;
+
+  JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
+  JMEM_VALGRIND_NOACCESS_SPACE (region_p, region_size);
+
+#ifdef JMEM_STATS
+  JERRY_CONTEXT (jmem_heap_stats).size += region_size;
+#endif /* JMEM_STATS */
+
+  return true;
+} /* jmem_heap_add_region */
+
+/**
+ * Return the regions which have no allocated blocks to the port.
+ */
+static void
+jmem_heap_release_empty_regions (void)
+{
+  jmem_heap_region_t *regions_p = JERRY_HEAP_CONTEXT (regions);
+  uint32_t index = 0;
+
+  while (index < JERRY_HEAP_CONTEXT (region_count))
+  {
+    uint8_t *region_p = regions_p[index].start_p;
+
+    if (region_p == NULL)
+    {
+      index++;
+      continue;
+    }
+
+    JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_region_header_t));
+    const uint32_t region_size = ((jmem_heap_region_header_t *) region_p)->size;
+    JMEM_VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_region_header_t));
+
+    const uint32_t item_count = (uint32_t) (region_size / JMEM_HEAP_REGION_SIZE);
+    jmem_heap_free_t *const block_p = (jmem_heap_free_t *) (region_p + JMEM_ALIGNMENT);
+    const uint32_t block_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+
+    /* The region is empty if its first block is free and it covers the whole region. */
+    jmem_heap_free_t *prev_p = &JERRY_HEAP_CONTEXT (first);
+    JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
+
+    while (prev_p->next_offset < block_offset)
+    {
+      jmem_heap_free_t *next_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
+      JMEM_VALGRIND_DEFINED_SPACE (next_p, sizeof (jmem_heap_free_t));
+      JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
+      prev_p = next_p;
+    }
+
+    JMEM_VALGRIND_DEFINED_SPACE (block_p, sizeof (jmem_heap_free_t));
+
+    if (prev_p->next_offset == block_offset && block_p->size == region_size - JMEM_ALIGNMENT)
+    {
+      prev_p->next_offset = block_p->next_offset;
+
+      if (JERRY_CONTEXT (jmem_heap_list_skip_p) == block_p)
+      {
+        JERRY_CONTEXT (jmem_heap_list_skip_p) = prev_p;
+      }
+
+      for (uint32_t i = 0; i < item_count; i++)
+      {
+        regions_p[index + i].start_p = NULL;
+      }
+
+      jmem_heap_region_rebuild_hash ();
+
+      JMEM_VALGRIND_DEFINED_SPACE (region_p, region_size);
+      jerry_port_free_heap_region (region_p, region_size);
+
+#ifdef JMEM_STATS
+      JERRY_CONTEXT (jmem_heap_stats).size -= region_size;
+#endif /* JMEM_STATS */
+    }
+    else
+    {
+      JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
+    }
+
+    JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
+    index += item_count;
+  }
+
+  while (JERRY_HEAP_CONTEXT (region_count) > 0 && regions_p[JERRY_HEAP_CONTEXT (region_count) - 1].start_p == NULL)
+  {
+    JERRY_HEAP_CONTEXT (region_count)--;
+  }
+} /* jmem_heap_release_empty_regions */
+#endif /* JMEM_HEAP_REGIONS */
+
 /**
  * Startup initialization of heap
  */
@@ -114,10 +365,33 @@ jmem_heap_init (void)
   /* the maximum heap size for 16bit compressed pointers should be 512K */
   JERRY_ASSERT (((UINT16_MAX + 1) << JMEM_ALIGNMENT_LOG) >= JMEM_HEAP_SIZE);
 #endif /* !JERRY_CPOINTER_32_BIT */
-  JERRY_ASSERT ((uintptr_t) JERRY_HEAP_CONTEXT (area) % JMEM_ALIGNMENT == 0);
 
   JERRY_CONTEXT (jmem_heap_limit) = CONFIG_MEM_HEAP_DESIRED_LIMIT;
 
+#ifdef JMEM_HEAP_REGIONS
+  JERRY_ASSERT (JMEM_HEAP_SIZE >= JMEM_HEAP_REGION_SIZE);
+
+  JERRY_HEAP_CONTEXT (region_count) = 0;
+
+  /* The buckets are stored in the region table, which has two buckets per item. */
+  const uint32_t item_count = (uint32_t) (JMEM_HEAP_SIZE / JMEM_HEAP_REGION_SIZE);
+  uint32_t bucket_count = 2;
+
+  while (bucket_count <= item_count)
+  {
+    bucket_count *= 2;
+  }
+
+  JERRY_HEAP_CONTEXT (region_hash_mask) = bucket_count - 1;
+  JERRY_HEAP_CONTEXT (first).size = 0;
+  JERRY_HEAP_CONTEXT (first).next_offset = JMEM_HEAP_END_OF_LIST;
+
+  JERRY_CONTEXT (jmem_heap_list_skip_p) = &JERRY_HEAP_CONTEXT (first);
+
+  JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+#else /* !JMEM_HEAP_REGIONS */
+  JERRY_ASSERT ((uintptr_t) JERRY_HEAP_CONTEXT (area) % JMEM_ALIGNMENT == 0);
+
   jmem_heap_free_t *const region_p = (jmem_heap_free_t *) JERRY_HEAP_CONTEXT (area);
 
   region_p->size = JMEM_HEAP_AREA_SIZE;
@@ -129,9 +403,17 @@ jmem_heap_init (void)
   JERRY_CONTEXT (jmem_heap_list_skip_p) = &JERRY_HEAP_CONTEXT (first);
 
   JMEM_VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), JMEM_HEAP_AREA_SIZE);
+#endif /* JMEM_HEAP_REGIONS */
 
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
   JMEM_HEAP_STAT_INIT ();
+
+#ifdef JMEM_HEAP_REGIONS
+  if (!jmem_heap_add_region (JMEM_HEAP_REGION_SIZE - JMEM_ALIGNMENT))
+  {
+    jerry_fatal (ERR_OUT_OF_MEMORY);
+  }
+#endif /* JMEM_HEAP_REGIONS */
 } /* jmem_heap_init */
 
 /**
@@ -141,9 +423,30 @@ void
 jmem_heap_finalize (void)
 {
   JERRY_ASSERT (JERRY_CONTEXT (jmem_heap_allocated_size) == 0);
-#ifndef JERRY_SYSTEM_ALLOCATOR
+#ifdef JMEM_HEAP_REGIONS
+  uint32_t index = 0;
+
+  while (index < JERRY_HEAP_CONTEXT (region_count))
+  {
+    uint8_t *region_p = JERRY_HEAP_CONTEXT (regions)[index].start_p;
+
+    if (region_p == NULL)
+    {
+      index++;
+      continue;
+    }
+
+    JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_region_header_t));
+    const uint32_t region_size = ((jmem_heap_region_header_t *) region_p)->size;
+
+    jerry_port_free_heap_region (region_p, region_size);
+    index += (uint32_t) (region_size / JMEM_HEAP_REGION_SIZE);
+  }
+
+  JERRY_HEAP_CONTEXT (region_count) = 0;
+#elif !defined (JERRY_SYSTEM_ALLOCATOR)
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), JMEM_HEAP_SIZE);
-#endif /* !JERRY_SYSTEM_ALLOCATOR */
+#endif /* JMEM_HEAP_REGIONS */
 } /* jmem_heap_finalize */
 
 /**
@@ -342,6 +645,21 @@ jmem_heap_gc_and_alloc_block (const size_t size,      /**< required memory size
 
   JERRY_ASSERT (data_space_p == NULL);
 
+#ifdef JMEM_HEAP_REGIONS
+  /* Grow the heap when the garbage collection could not free enough memory. The empty
+   * regions are released first, since a single new region might use their space. */
+  jmem_heap_release_empty_regions ();
+
+  if (jmem_heap_add_region (size))
+  {
+    data_space_p = jmem_heap_alloc_block_internal (size);
+    JERRY_ASSERT (data_space_p != NULL);
+
+    JMEM_VALGRIND_MALLOCLIKE_SPACE (data_space_p, size);
+    return data_space_p;
+  }
+#endif /* JMEM_HEAP_REGIONS */
+
   if (!ret_null_on_error)
   {
     jerry_fatal (ERR_OUT_OF_MEMORY);
@@ -405,7 +723,16 @@ jmem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the
 
   JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
 
+  JERRY_ASSERT (jmem_is_heap_pointer (block_p));
+  const uint32_t block_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+
+#if defined (JMEM_HEAP_REGIONS) && !defined (ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY)
+  /* The regions are not ordered by their addresses, so the offsets are compared. The offset
+   * of the first node (and of the end of the list) is JMEM_HEAP_END_OF_LIST. */
+  if (block_offset > JMEM_HEAP_GET_OFFSET_FROM_ADDR (JERRY_CONTEXT (jmem_heap_list_skip_p)))
+#else /* !JMEM_HEAP_REGIONS || ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
   if (block_p > JERRY_CONTEXT (jmem_heap_list_skip_p))
+#endif /* JMEM_HEAP_REGIONS && !ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY */
   {
     prev_p = JERRY_CONTEXT (jmem_heap_list_skip_p);
     JMEM_HEAP_STAT_SKIP ();
@@ -416,9 +743,6 @@ jmem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the
     JMEM_HEAP_STAT_NONSKIP ();
   }
 
-  JERRY_ASSERT (jmem_is_heap_pointer (block_p));
-  const uint32_t block_offset = JMEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
-
   JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
   /* Find position of region in the list. */
   while (prev_p->next_offset < block_offset)
@@ -491,6 +815,127 @@ jmem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
 } /* jmem_heap_free_block */
 
+#ifdef JMEM_HEAP_RELEASE_FREE_PAGES
+/**
+ * Give the physical memory of the free heap pages back to the system.
+ *
+ * Every free block keeps its list node, the pages after the node which are
+ * entirely covered by the block are passed to jerry_port_release_heap_pages.
+ */
+void
+jmem_heap_release_free_pages (void)
+{
+  /* The empty pool chunks are merged into the free blocks first. */
+  jmem_pools_collect_empty ();
+
+  JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+  uint32_t next_offset = JERRY_HEAP_CONTEXT (first).next_offset;
+  JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+
+  while (next_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    jmem_heap_free_t *block_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset);
+    JERRY_ASSERT (jmem_is_heap_pointer (block_p));
+
+    JMEM_VALGRIND_DEFINED_SPACE (block_p, sizeof (jmem_heap_free_t));
+    const uintptr_t pages_start = JERRY_ALIGNUP ((uintptr_t) (block_p + 1), JMEM_HEAP_PAGE_SIZE);
+    const uintptr_t pages_end = ((uintptr_t) block_p + block_p->size) & ~(JMEM_HEAP_PAGE_SIZE - 1);
+    next_offset = block_p->next_offset;
+    JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
+
+    if (pages_start < pages_end)
+    {
+      jerry_port_release_heap_pages ((void *) pages_start, (size_t) (pages_end - pages_start));
+    }
+  }
+} /* jmem_heap_release_free_pages */
+#endif /* JMEM_HEAP_RELEASE_FREE_PAGES */
+
+#ifdef JERRY_HEAP_IMAGE
+/**
+ * Prepare the heap for saving it into a heap image.
+ *
+ * The empty pool chunks are merged into the free blocks, since they are linked by raw pointers.
+ * The free block at the end of the heap is not part of the image, it is recreated by
+ * jmem_heap_init_from_image.
+ *
+ * @return number of bytes from the start of the heap which must be saved
+ */
+size_t
+jmem_heap_prepare_image (void)
+{
+  jmem_pools_collect_empty ();
+
+  jmem_heap_free_t *last_p = &JERRY_HEAP_CONTEXT (first);
+
+  JMEM_VALGRIND_DEFINED_SPACE (last_p, sizeof (jmem_heap_free_t));
+  uint32_t next_offset = last_p->next_offset;
+  JMEM_VALGRIND_NOACCESS_SPACE (last_p, sizeof (jmem_heap_free_t));
+
+  while (next_offset != JMEM_HEAP_END_OF_LIST)
+  {
+    last_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset);
+    JERRY_ASSERT (jmem_is_heap_pointer (last_p));
+
+    JMEM_VALGRIND_DEFINED_SPACE (last_p, sizeof (jmem_heap_free_t));
+    next_offset = last_p->next_offset;
+    JMEM_VALGRIND_NOACCESS_SPACE (last_p, sizeof (jmem_heap_free_t));
+  }
+
+  uint8_t *heap_start_p = (uint8_t *) &JERRY_HEAP_CONTEXT (first);
+
+  if (last_p != &JERRY_HEAP_CONTEXT (first)
+      && (uint8_t *) jmem_heap_get_region_end (last_p) == heap_start_p + JMEM_HEAP_SIZE)
+  {
+    return (size_t) ((uint8_t *) last_p - heap_start_p);
+  }
+
+  return JMEM_HEAP_SIZE;
+} /* jmem_heap_prepare_image */
+
+/**
+ * Initialize the heap from the data saved by jmem_heap_prepare_image.
+ *
+ * Note:
+ *      the free block at the end of the heap, which is not part of the image, is recreated
+ */
+void
+jmem_heap_init_from_image (const uint8_t *heap_image_p, /**< heap data of the image */
+                           size_t heap_image_size, /**< size of the heap data */
+                           size_t allocated_size) /**< size of the allocated blocks in the heap data */
+{
+  JERRY_ASSERT (heap_image_size >= sizeof (jmem_heap_free_t)
+                && heap_image_size <= JMEM_HEAP_SIZE
+                && heap_image_size % JMEM_ALIGNMENT == 0);
+
+  uint8_t *heap_start_p = (uint8_t *) &JERRY_HEAP_CONTEXT (first);
+
+  JMEM_VALGRIND_DEFINED_SPACE (heap_start_p, heap_image_size);
+  memcpy (heap_start_p, heap_image_p, heap_image_size);
+
+  if (heap_image_size < JMEM_HEAP_SIZE)
+  {
+    jmem_heap_free_t *const region_p = (jmem_heap_free_t *) (heap_start_p + heap_image_size);
+
+    region_p->size = (uint32_t) (JMEM_HEAP_SIZE - heap_image_size);
+    region_p->next_offset = JMEM_HEAP_END_OF_LIST;
+
+    JMEM_VALGRIND_NOACCESS_SPACE (region_p, region_p->size);
+  }
+
+  JERRY_CONTEXT (jmem_heap_list_skip_p) = &JERRY_HEAP_CONTEXT (first);
+  JERRY_CONTEXT (jmem_heap_allocated_size) = allocated_size;
+  JERRY_CONTEXT (jmem_heap_limit) = CONFIG_MEM_HEAP_DESIRED_LIMIT;
+
+  while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+  {
+    JERRY_CONTEXT (jmem_heap_limit) += CONFIG_MEM_HEAP_DESIRED_LIMIT;
+  }
+
+  JMEM_HEAP_STAT_INIT ();
+} /* jmem_heap_init_from_image */
+#endif /* JERRY_HEAP_IMAGE */
+
 #ifndef JERRY_NDEBUG
 /**
  * Check whether the pointer points to the heap
@@ -504,7 +949,19 @@ jmem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the
 bool
 jmem_is_heap_pointer (const void *pointer) /**< pointer */
 {
-#ifndef JERRY_SYSTEM_ALLOCATOR
+#ifdef JMEM_HEAP_REGIONS
+  for (uint32_t i = 0; i < JERRY_HEAP_CONTEXT (region_count); i++)
+  {
+    uint8_t *region_p = JERRY_HEAP_CONTEXT (regions)[i].start_p;
+
+    if (region_p != NULL && (uint8_t *) pointer >= region_p && (uint8_t *) pointer <= region_p + JMEM_HEAP_REGION_SIZE)
+    {
+      return true;
+    }
+  }
+
+  return false;
+#elif !defined (JERRY_SYSTEM_ALLOCATOR)
   return ((uint8_t *) pointer >= JERRY_HEAP_CONTEXT (area)
           && (uint8_t *) pointer <= (JERRY_HEAP_CONTEXT (area) + JMEM_HEAP_AREA_SIZE));
 #else /* JERRY_SYSTEM_ALLOCATOR */
@@ -574,6 +1031,16 @@ jmem_heap_stats_print (void)
                    heap_stats->free_iter_count / heap_stats->free_count,
                    heap_stats->free_iter_count % heap_stats->free_count * 10000 / heap_stats->free_count);
 #endif /* !JERRY_SYSTEM_ALLOCATOR */
+#ifndef CONFIG_ECMA_EVAL_CACHE_DISABLE
+  JERRY_DEBUG_MSG ("  Eval cache hits = %zu of %zu lookups\n",
+                   heap_stats->eval_cache_hits,
+                   heap_stats->eval_cache_lookups);
+#endif /* !CONFIG_ECMA_EVAL_CACHE_DISABLE */
+#ifndef CONFIG_DISABLE_REGEXP_BUILTIN
+  JERRY_DEBUG_MSG ("  RegExp cache hits = %zu of %zu lookups\n",
+                   heap_stats->regexp_cache_hits,
+                   heap_stats->regexp_cache_lookups);
+#endif /* !CONFIG_DISABLE_REGEXP_BUILTIN */
 } /* jmem_heap_stats_print */
 
 /**
@@ -582,9 +1049,12 @@ jmem_heap_stats_print (void)
 static void
 jmem_heap_stat_init (void)
 {
-#ifndef JERRY_SYSTEM_ALLOCATOR
+#ifdef JMEM_HEAP_REGIONS
+  /* The size is increased when the regions are added. */
+  JERRY_CONTEXT (jmem_heap_stats).size = 0;
+#elif !defined (JERRY_SYSTEM_ALLOCATOR)
   JERRY_CONTEXT (jmem_heap_stats).size = JMEM_HEAP_AREA_SIZE;
-#endif /* !JERRY_SYSTEM_ALLOCATOR */
+#endif /* JMEM_HEAP_REGIONS */
 } /* jmem_heap_stat_init */
 
 /**
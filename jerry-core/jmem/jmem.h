@@ -108,6 +108,15 @@ void *jmem_heap_alloc_block (const size_t size);
 void *jmem_heap_alloc_block_null_on_error (const size_t size);
 void jmem_heap_free_block (void *ptr, const size_t size);
 
+#ifdef JMEM_HEAP_RELEASE_FREE_PAGES
+void jmem_heap_release_free_pages (void);
+#endif /* JMEM_HEAP_RELEASE_FREE_PAGES */
+
+#ifdef JERRY_HEAP_IMAGE
+size_t jmem_heap_prepare_image (void);
+void jmem_heap_init_from_image (const uint8_t *heap_image_p, size_t heap_image_size, size_t allocated_size);
+#endif /* JERRY_HEAP_IMAGE */
+
 #ifdef JMEM_STATS
 /**
  * Heap memory usage statistics
@@ -142,6 +151,12 @@ typedef struct
   size_t free_count; /**< number of memory frees */
   size_t alloc_iter_count; /**< Number of iterations required for allocations */
   size_t free_iter_count; /**< Number of iterations required for inserting free blocks */
+
+  size_t eval_cache_lookups; /**< number of lookups in the compiled code cache of eval */
+  size_t eval_cache_hits; /**< number of successful lookups in the compiled code cache of eval */
+
+  size_t regexp_cache_lookups; /**< number of lookups in the RegExp bytecode cache */
+  size_t regexp_cache_hits; /**< number of successful lookups in the RegExp bytecode cache */
 } jmem_heap_stats_t;
 
 void jmem_stats_allocate_byte_code_bytes (size_t property_size);
@@ -152,6 +167,8 @@ void jmem_stats_allocate_object_bytes (size_t object_size);
 void jmem_stats_free_object_bytes (size_t string_size);
 void jmem_stats_allocate_property_bytes (size_t property_size);
 void jmem_stats_free_property_bytes (size_t property_size);
+void jmem_stats_eval_cache_lookup (bool is_hit);
+void jmem_stats_regexp_cache_lookup (bool is_hit);
 
 void jmem_heap_get_stats (jmem_heap_stats_t *);
 #endif /* JMEM_STATS */
@@ -246,6 +263,67 @@ void jmem_run_free_unused_memory_callbacks (jmem_free_unused_memory_severity_t s
 void *jmem_pools_alloc (size_t size);
 void jmem_pools_free (void *chunk_p, size_t size);
 
+/**
+ * @}
+ * \addtogroup allocsites Allocation site tracking
+ * @{
+ */
+
+#ifdef JMEM_ALLOC_SITES
+
+/**
+ * Maximum number of allocation sites. Allocations from further
+ * sites are counted in a shared overflow site.
+ */
+#ifndef JMEM_ALLOC_SITES_COUNT
+#define JMEM_ALLOC_SITES_COUNT 1024
+#endif /* !JMEM_ALLOC_SITES_COUNT */
+
+/**
+ * Index of the allocation site of each JMEM_ALIGNMENT sized unit of the heap area.
+ * Only the first unit of the allocated blocks is used, zero means untracked.
+ */
+typedef uint16_t jmem_alloc_site_tag_t;
+
+/**
+ * Allocation site: an engine function which allocates memory, and the
+ * executed position of the innermost script function at the time.
+ */
+typedef struct
+{
+  const char *engine_name_p; /**< name of the allocating engine function (NULL for unused items) */
+  uintptr_t script_id; /**< resource name (with line info) or byte code address of the script function */
+  uint32_t script_position; /**< line (with line info) or byte code offset in the script function */
+  uint32_t live_blocks; /**< number of live blocks */
+  size_t live_bytes; /**< size of the live blocks */
+  uint64_t allocations; /**< number of allocations since the last reset */
+  uint64_t allocated_bytes; /**< size of the allocations since the last reset */
+} jmem_alloc_site_t;
+
+void *jmem_heap_alloc_block_at_site (const size_t size, const char *engine_name_p);
+void *jmem_heap_alloc_block_null_on_error_at_site (const size_t size, const char *engine_name_p);
+void jmem_heap_free_block_at_site (void *ptr, const size_t size);
+void *jmem_pools_alloc_at_site (size_t size, const char *engine_name_p);
+void jmem_pools_free_at_site (void *chunk_p, size_t size);
+
+void jmem_alloc_sites_reset (void);
+void jmem_alloc_sites_finalize (void);
+size_t jmem_alloc_sites_to_json (uint8_t *buffer_p, size_t buffer_size);
+
+/*
+ * The allocation functions record the name of the calling engine function as the
+ * allocation site. The allocator itself uses the untracked functions (see
+ * jmem-allocator-internal.h), so pool chunks are counted when they are handed
+ * out, not when the pool takes them from the heap.
+ */
+#define jmem_heap_alloc_block(size) jmem_heap_alloc_block_at_site ((size), __func__)
+#define jmem_heap_alloc_block_null_on_error(size) jmem_heap_alloc_block_null_on_error_at_site ((size), __func__)
+#define jmem_heap_free_block(ptr, size) jmem_heap_free_block_at_site ((ptr), (size))
+#define jmem_pools_alloc(size) jmem_pools_alloc_at_site ((size), __func__)
+#define jmem_pools_free(chunk_p, size) jmem_pools_free_at_site ((chunk_p), (size))
+
+#endif /* JMEM_ALLOC_SITES */
+
 /**
  * @}
  * @}
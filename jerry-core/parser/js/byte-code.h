@@ -177,6 +177,27 @@
   CBC_OPCODE (name ## _3, CBC_HAS_BRANCH_ARG, stack, \
               (vm_oc) | VM_OC_GET_BRANCH | VM_OC_BACKWARD_BRANCH)
 
+/**
+ * Compare and branch opcodes are superinstructions which combine a relational
+ * or equality operator with a conditional branch. Their layout follows the
+ * branch opcodes above, and the literal arguments precede the branch offset.
+ */
+#define CBC_FORWARD_COMPARE_BRANCH(name, arg_types, stack, vm_oc) \
+  CBC_OPCODE (name, (arg_types) | CBC_HAS_BRANCH_ARG | CBC_FORWARD_BRANCH_ARG, stack, \
+              (vm_oc)) \
+  CBC_OPCODE (name ## _2, (arg_types) | CBC_HAS_BRANCH_ARG | CBC_FORWARD_BRANCH_ARG, stack, \
+              (vm_oc)) \
+  CBC_OPCODE (name ## _3, (arg_types) | CBC_HAS_BRANCH_ARG | CBC_FORWARD_BRANCH_ARG, stack, \
+              (vm_oc))
+
+#define CBC_BACKWARD_COMPARE_BRANCH(name, arg_types, stack, vm_oc) \
+  CBC_OPCODE (name, (arg_types) | CBC_HAS_BRANCH_ARG, stack, \
+              (vm_oc) | VM_OC_BACKWARD_BRANCH) \
+  CBC_OPCODE (name ## _2, (arg_types) | CBC_HAS_BRANCH_ARG, stack, \
+              (vm_oc) | VM_OC_BACKWARD_BRANCH) \
+  CBC_OPCODE (name ## _3, (arg_types) | CBC_HAS_BRANCH_ARG, stack, \
+              (vm_oc) | VM_OC_BACKWARD_BRANCH)
+
 #define CBC_BRANCH_OFFSET_LENGTH(opcode) \
   ((opcode) & 0x3)
 
@@ -243,23 +264,51 @@
   CBC_FORWARD_BRANCH (CBC_BRANCH_IF_STRICT_EQUAL, -1, \
                       VM_OC_BRANCH_IF_STRICT_EQUAL) \
   \
-  /* Basic opcodes. */ \
+  /* Compare and branch opcodes. Some basic opcodes are mixed. */ \
   CBC_OPCODE (CBC_PUSH_LITERAL, CBC_HAS_LITERAL_ARG, 1, \
               VM_OC_PUSH | VM_OC_GET_LITERAL) \
+  CBC_BACKWARD_COMPARE_BRANCH (CBC_BRANCH_IF_LESS_TWO_LITERALS_BACKWARD, \
+                               CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+                               VM_OC_BRANCH_IF_LESS | VM_OC_GET_LITERAL_LITERAL) \
   CBC_OPCODE (CBC_PUSH_TWO_LITERALS, CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 2, \
               VM_OC_PUSH_TWO | VM_OC_GET_LITERAL_LITERAL) \
+  CBC_BACKWARD_COMPARE_BRANCH (CBC_BRANCH_IF_LESS_RIGHT_LITERAL_BACKWARD, \
+                               CBC_HAS_LITERAL_ARG, -1, \
+                               VM_OC_BRANCH_IF_LESS | VM_OC_GET_STACK_LITERAL) \
   CBC_OPCODE (CBC_PUSH_THREE_LITERALS, CBC_HAS_LITERAL_ARG2, 3, \
               VM_OC_PUSH_THREE | VM_OC_GET_LITERAL_LITERAL) \
+  CBC_BACKWARD_COMPARE_BRANCH (CBC_BRANCH_IF_LESS_EQUAL_TWO_LITERALS_BACKWARD, \
+                               CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+                               VM_OC_BRANCH_IF_LESS_EQUAL | VM_OC_GET_LITERAL_LITERAL) \
   CBC_OPCODE (CBC_PUSH_UNDEFINED, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_UNDEFINED | VM_OC_PUT_STACK) \
+  CBC_FORWARD_COMPARE_BRANCH (CBC_BRANCH_IF_NOT_LESS_TWO_LITERALS_FORWARD, \
+                              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+                              VM_OC_BRANCH_IF_LESS | VM_OC_BRANCH_IF_NOT_FLAG | VM_OC_GET_LITERAL_LITERAL) \
   CBC_OPCODE (CBC_PUSH_TRUE, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_TRUE | VM_OC_PUT_STACK) \
+  CBC_FORWARD_COMPARE_BRANCH (CBC_BRANCH_IF_NOT_EQUAL_TWO_LITERALS_FORWARD, \
+                              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+                              VM_OC_BRANCH_IF_EQUAL | VM_OC_BRANCH_IF_NOT_FLAG | VM_OC_GET_LITERAL_LITERAL) \
   CBC_OPCODE (CBC_PUSH_FALSE, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_FALSE | VM_OC_PUT_STACK) \
+  CBC_FORWARD_COMPARE_BRANCH (CBC_BRANCH_IF_NOT_EQUAL_RIGHT_LITERAL_FORWARD, \
+                              CBC_HAS_LITERAL_ARG, -1, \
+                              VM_OC_BRANCH_IF_EQUAL | VM_OC_BRANCH_IF_NOT_FLAG | VM_OC_GET_STACK_LITERAL) \
   CBC_OPCODE (CBC_PUSH_NULL, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_NULL | VM_OC_PUT_STACK) \
+  CBC_FORWARD_COMPARE_BRANCH (CBC_BRANCH_IF_STRICT_NOT_EQUAL_TWO_LITERALS_FORWARD, \
+                              CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2, 0, \
+                              VM_OC_BRANCH_IF_STRICT_EQUAL_VALUES | VM_OC_BRANCH_IF_NOT_FLAG \
+                              | VM_OC_GET_LITERAL_LITERAL) \
   CBC_OPCODE (CBC_PUSH_THIS, CBC_NO_FLAG, 1, \
               VM_OC_PUSH_THIS | VM_OC_PUT_STACK) \
+  CBC_FORWARD_COMPARE_BRANCH (CBC_BRANCH_IF_STRICT_NOT_EQUAL_RIGHT_LITERAL_FORWARD, \
+                              CBC_HAS_LITERAL_ARG, -1, \
+                              VM_OC_BRANCH_IF_STRICT_EQUAL_VALUES | VM_OC_BRANCH_IF_NOT_FLAG \
+                              | VM_OC_GET_STACK_LITERAL) \
+  \
+  /* Basic opcodes. */ \
   CBC_OPCODE (CBC_PUSH_THIS_LITERAL, CBC_HAS_LITERAL_ARG, 2, \
               VM_OC_PUSH_TWO | VM_OC_GET_THIS_LITERAL) \
   CBC_OPCODE (CBC_PUSH_NUMBER_0, CBC_NO_FLAG, 1, \
@@ -521,7 +570,7 @@
   CBC_OPCODE (CBC_EXT_RESOURCE_NAME, CBC_NO_FLAG, 0, \
               VM_OC_RESOURCE_NAME) \
   CBC_OPCODE (CBC_EXT_LINE, CBC_NO_FLAG, 0, \
-              VM_OC_LINE) \
+              VM_OC_NONE) \
   CBC_OPCODE (CBC_EXT_SET_COMPUTED_PROPERTY, CBC_NO_FLAG, -2, \
               VM_OC_SET_COMPUTED_PROPERTY | VM_OC_NON_STATIC_FLAG | VM_OC_GET_STACK_STACK) \
   CBC_OPCODE (CBC_EXT_SET_COMPUTED_PROPERTY_LITERAL, CBC_HAS_LITERAL_ARG, -1, \
@@ -648,6 +697,8 @@ typedef enum
   CBC_CODE_FLAGS_STATIC_FUNCTION = (1u << 7), /**< this function is a static snapshot function */
   CBC_CODE_FLAGS_DEBUGGER_IGNORE = (1u << 8), /**< this function should be ignored by debugger */
   CBC_CODE_FLAGS_CONSTRUCTOR = (1u << 9), /**< this function is a constructor */
+  CBC_CODE_FLAGS_SCOPE_INFO = (1u << 10), /**< this function has a scope info block */
+  CBC_CODE_FLAGS_LINE_INFO = (1u << 11), /**< this function has a resource name and a line info table */
 } cbc_code_flags;
 
 /**
@@ -657,6 +708,55 @@ typedef enum
   (((compiled_code_p)->status_flags & CBC_CODE_FLAGS_ARGUMENTS_NEEDED) \
     && !((compiled_code_p)->status_flags & CBC_CODE_FLAGS_STRICT_MODE))
 
+/**
+ * Size of the scope info block of a function byte code.
+ *
+ * The block is stored before the argument names at the end of the byte code.
+ * Its last item is the end of the variable group (the variables of a function
+ * are stored in the slots of its lexical environment) and it is preceded by
+ * one resolved binding for each identifier between the variable end and ident_end.
+ */
+#define CBC_SCOPE_INFO_SIZE(unresolved_ident_count) \
+  JERRY_ALIGNUP (((size_t) (unresolved_ident_count) + 1) * sizeof (uint16_t), sizeof (ecma_value_t))
+
+/**
+ * Size of the line info block of a function byte code.
+ *
+ * The block is stored before the scope info block (or the argument names).
+ * Its last item is the resource name, which is preceded by the size of the
+ * line info table (uint32_t) and the table itself. The table is a sequence of
+ * (byte code offset delta, line delta) pairs encoded as variable length integers,
+ * and each pair sets the line of the instructions starting from the offset.
+ */
+#define CBC_LINE_INFO_SIZE(table_size) \
+  (JERRY_ALIGNUP ((size_t) (table_size), sizeof (ecma_value_t)) + sizeof (uint32_t) + sizeof (ecma_value_t))
+
+/**
+ * Shift of the lexical environment depth in a resolved binding. The depth
+ * is counted from the lexical environment of the function call.
+ */
+#define CBC_SCOPE_INFO_DEPTH_SHIFT 12
+
+/**
+ * Maximum lexical environment depth of a resolved binding.
+ */
+#define CBC_SCOPE_INFO_MAX_DEPTH 0xe
+
+/**
+ * Mask of the slot index in a resolved binding.
+ */
+#define CBC_SCOPE_INFO_SLOT_MASK 0xfff
+
+/**
+ * Slot index of bindings which are looked up by name.
+ */
+#define CBC_SCOPE_INFO_NO_SLOT CBC_SCOPE_INFO_SLOT_MASK
+
+/**
+ * Binding which must always be looked up by name.
+ */
+#define CBC_SCOPE_INFO_DYNAMIC 0xffff
+
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg1,
 
 /**
@@ -1878,55 +1878,100 @@ lexer_construct_number_object (parser_context_t *context_p, /**< context */
 } /* lexer_construct_number_object */
 
 /**
- * Convert a push number opcode to push literal opcode
+ * Find or create a number literal in the literal pool.
+ *
+ * When no such literal exists and reusable_index refers to the last literal,
+ * that literal is replaced instead of appending a new one.
+ *
+ * @return index of the literal
  */
-void
-lexer_convert_push_number_to_push_literal (parser_context_t *context_p) /**< context */
+uint16_t
+lexer_construct_number_literal (parser_context_t *context_p, /**< context */
+                                ecma_value_t lit_value, /**< number value created by
+                                                         *   ecma_find_or_create_literal_number */
+                                uint16_t reusable_index) /**< index of a literal which is not
+                                                          *   referenced anymore or an invalid index */
 {
-  ecma_integer_value_t value;
-  bool two_literals = !PARSER_IS_BASIC_OPCODE (context_p->last_cbc_opcode);
+  parser_list_iterator_t literal_iterator;
+  parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
 
-  if (context_p->last_cbc_opcode == CBC_PUSH_NUMBER_0
-      || context_p->last_cbc_opcode == PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_LITERAL_PUSH_NUMBER_0))
+  uint32_t literal_index = 0;
+  lexer_literal_t *literal_p;
+
+  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
   {
-    value = 0;
+    if (literal_p->type == LEXER_NUMBER_LITERAL
+        && literal_p->u.value == lit_value)
+    {
+      return (uint16_t) literal_index;
+    }
+
+    literal_index++;
   }
-  else if (context_p->last_cbc_opcode == CBC_PUSH_NUMBER_POS_BYTE
-           || context_p->last_cbc_opcode == PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_LITERAL_PUSH_NUMBER_POS_BYTE))
+
+  JERRY_ASSERT (literal_index == context_p->literal_count);
+
+  if (reusable_index + 1u == literal_index)
   {
-    value = ((ecma_integer_value_t) context_p->last_cbc.value) + 1;
+    literal_p = PARSER_GET_LITERAL (reusable_index);
+    literal_index = reusable_index;
+    util_free_literal (literal_p);
   }
   else
   {
-    JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_NUMBER_NEG_BYTE
-                  || context_p->last_cbc_opcode == PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_LITERAL_PUSH_NUMBER_NEG_BYTE));
-    value = -((ecma_integer_value_t) context_p->last_cbc.value) - 1;
+    if (literal_index >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
+    {
+      parser_raise_error (context_p, PARSER_ERR_LITERAL_LIMIT_REACHED);
+    }
+
+    literal_p = (lexer_literal_t *) parser_list_append (context_p, &context_p->literal_pool);
+    context_p->literal_count++;
   }
 
-  ecma_value_t lit_value = ecma_make_integer_value (value);
+  literal_p->u.value = lit_value;
+  literal_p->prop.length = 0; /* Unused. */
+  literal_p->type = LEXER_NUMBER_LITERAL;
+  literal_p->status_flags = 0;
+  return (uint16_t) literal_index;
+} /* lexer_construct_number_literal */
+
+/**
+ * Find or create a string literal which is the concatenation
+ * of two character sequences. The result must not be empty.
+ *
+ * When no such literal exists and reusable_index refers to the last literal,
+ * that literal is replaced instead of appending a new one. This keeps the
+ * memory consumption of folding long concatenation chains linear.
+ *
+ * @return index of the literal
+ */
+uint16_t
+lexer_construct_string_literal (parser_context_t *context_p, /**< context */
+                                const uint8_t *first_p, /**< first part */
+                                size_t first_length, /**< length of the first part */
+                                const uint8_t *second_p, /**< second part */
+                                size_t second_length, /**< length of the second part */
+                                uint16_t reusable_index) /**< index of a literal which is not
+                                                          *   referenced anymore or an invalid index */
+{
+  size_t length = first_length + second_length;
+
+  JERRY_ASSERT (length > 0 && length <= PARSER_MAXIMUM_STRING_LENGTH);
 
   parser_list_iterator_t literal_iterator;
   parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
 
-  context_p->last_cbc_opcode = two_literals ? CBC_PUSH_TWO_LITERALS : CBC_PUSH_LITERAL;
-
   uint32_t literal_index = 0;
   lexer_literal_t *literal_p;
 
   while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)) != NULL)
   {
-    if (literal_p->type == LEXER_NUMBER_LITERAL
-        && literal_p->u.value == lit_value)
+    if (literal_p->type == LEXER_STRING_LITERAL
+        && literal_p->prop.length == length
+        && memcmp (literal_p->u.char_p, first_p, first_length) == 0
+        && memcmp (literal_p->u.char_p + first_length, second_p, second_length) == 0)
     {
-      if (two_literals)
-      {
-        context_p->last_cbc.value = (uint16_t) literal_index;
-      }
-      else
-      {
-        context_p->last_cbc.literal_index = (uint16_t) literal_index;
-      }
-      return;
+      return (uint16_t) literal_index;
     }
 
     literal_index++;
@@ -1934,26 +1979,77 @@ lexer_convert_push_number_to_push_literal (parser_context_t *context_p) /**< con
 
   JERRY_ASSERT (literal_index == context_p->literal_count);
 
-  if (literal_index >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
+  if (reusable_index + 1u == literal_index)
   {
-    parser_raise_error (context_p, PARSER_ERR_LITERAL_LIMIT_REACHED);
+    literal_p = PARSER_GET_LITERAL (reusable_index);
+    literal_index = reusable_index;
   }
+  else
+  {
+    if (literal_index >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
+    {
+      parser_raise_error (context_p, PARSER_ERR_LITERAL_LIMIT_REACHED);
+    }
 
-  literal_p = (lexer_literal_t *) parser_list_append (context_p, &context_p->literal_pool);
-  literal_p->u.value = lit_value;
-  literal_p->prop.length = 0; /* Unused. */
-  literal_p->type = LEXER_NUMBER_LITERAL;
+    literal_p = (lexer_literal_t *) parser_list_append (context_p, &context_p->literal_pool);
+    /* The new literal has no data to release. */
+    literal_p->type = LEXER_UNUSED_LITERAL;
+    context_p->literal_count++;
+  }
+
+  uint8_t *char_p = (uint8_t *) jmem_heap_alloc_block (length);
+  memcpy (char_p, first_p, first_length);
+  memcpy (char_p + first_length, second_p, second_length);
+
+  /* The parts may point into the buffer of the replaced literal, so it is freed last. */
+  util_free_literal (literal_p);
+
+  literal_p->u.char_p = char_p;
+  literal_p->prop.length = (prop_length_t) length;
+  literal_p->type = LEXER_STRING_LITERAL;
   literal_p->status_flags = 0;
+  return (uint16_t) literal_index;
+} /* lexer_construct_string_literal */
 
-  context_p->literal_count++;
+/**
+ * Convert a push number opcode to push literal opcode
+ */
+void
+lexer_convert_push_number_to_push_literal (parser_context_t *context_p) /**< context */
+{
+  ecma_integer_value_t value;
+  bool two_literals = !PARSER_IS_BASIC_OPCODE (context_p->last_cbc_opcode);
+
+  if (context_p->last_cbc_opcode == CBC_PUSH_NUMBER_0
+      || context_p->last_cbc_opcode == PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_LITERAL_PUSH_NUMBER_0))
+  {
+    value = 0;
+  }
+  else if (context_p->last_cbc_opcode == CBC_PUSH_NUMBER_POS_BYTE
+           || context_p->last_cbc_opcode == PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_LITERAL_PUSH_NUMBER_POS_BYTE))
+  {
+    value = ((ecma_integer_value_t) context_p->last_cbc.value) + 1;
+  }
+  else
+  {
+    JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_NUMBER_NEG_BYTE
+                  || context_p->last_cbc_opcode == PARSER_TO_EXT_OPCODE (CBC_EXT_PUSH_LITERAL_PUSH_NUMBER_NEG_BYTE));
+    value = -((ecma_integer_value_t) context_p->last_cbc.value) - 1;
+  }
+
+  uint16_t literal_index = lexer_construct_number_literal (context_p,
+                                                           ecma_make_integer_value (value),
+                                                           PARSER_MAXIMUM_NUMBER_OF_LITERALS);
 
   if (two_literals)
   {
-    context_p->last_cbc.value = (uint16_t) literal_index;
+    context_p->last_cbc_opcode = CBC_PUSH_TWO_LITERALS;
+    context_p->last_cbc.value = literal_index;
   }
   else
   {
-    context_p->last_cbc.literal_index = (uint16_t) literal_index;
+    context_p->last_cbc_opcode = CBC_PUSH_LITERAL;
+    context_p->last_cbc.literal_index = literal_index;
   }
 } /* lexer_convert_push_number_to_push_literal */
 
@@ -2000,6 +2096,27 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
   compiled_code_p = parser_parse_function (context_p, extra_status_flags);
 #endif /* !CONFIG_DISABLE_ES2015_ARROW_FUNCTION */
 
+  uint32_t dynamic_scope_flags = PARSER_INSIDE_WITH;
+#ifndef CONFIG_DISABLE_ES2015_CLASS
+  dynamic_scope_flags |= PARSER_CLASS_HAS_SUPER;
+#endif /* !CONFIG_DISABLE_ES2015_CLASS */
+
+  if ((context_p->status_flags & dynamic_scope_flags)
+      || parser_statement_is_inside_catch (context_p))
+  {
+    /* The lexical environments created by these blocks are not known
+     * by the function, so its free identifiers are looked up by name. */
+    parser_scope_t scope;
+
+    scope.var_names_p = NULL;
+    scope.var_count = 0;
+    scope.hidden_name = ECMA_VALUE_EMPTY;
+    scope.depth = 0;
+    scope.is_dynamic = true;
+
+    parser_resolve_scope_info (compiled_code_p, &scope);
+  }
+
   literal_p->u.bytecode_p = compiled_code_p;
   literal_p->type = LEXER_FUNCTION_LITERAL;
 
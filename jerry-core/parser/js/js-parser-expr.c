@@ -16,6 +16,9 @@
 #include "js-parser-internal.h"
 
 #ifndef JERRY_DISABLE_JS_PARSER
+#include "ecma-helpers.h"
+#include "ecma-literal-storage.h"
+#include "ecma-number-arithmetic.h"
 #include "jcontext.h"
 #include "lit-char-helpers.h"
 
@@ -958,6 +961,22 @@ parser_parse_function_expression (parser_context_t *context_p, /**< context */
 
   JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
 
+  if (function_name_index != -1)
+  {
+    /* The name of a function expression is declared by an extra lexical environment. */
+    lexer_literal_t *name_literal_p = PARSER_GET_LITERAL ((size_t) function_name_index);
+    parser_scope_t scope;
+
+    scope.var_names_p = NULL;
+    scope.var_count = 0;
+    scope.hidden_name = ecma_find_or_create_literal_string (name_literal_p->u.char_p,
+                                                            name_literal_p->prop.length);
+    scope.depth = 1;
+    scope.is_dynamic = false;
+
+    parser_resolve_scope_info (PARSER_GET_LITERAL (function_literal_index)->u.bytecode_p, &scope);
+  }
+
   if (literals == 1)
   {
     context_p->last_cbc_opcode = CBC_PUSH_TWO_LITERALS;
@@ -1292,6 +1311,13 @@ parser_parse_unary_expression (parser_context_t *context_p, /**< context */
 
       cbc_opcode_t opcode = CBC_PUSH_LITERAL;
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+      if (context_p->token.lit_location.type != LEXER_IDENT_LITERAL)
+      {
+        parser_prepare_constant_operand (context_p);
+      }
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
       if (context_p->lit_object.type != LEXER_LITERAL_OBJECT_EVAL)
       {
         if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
@@ -1472,6 +1498,639 @@ parser_parse_unary_expression (parser_context_t *context_p, /**< context */
   lexer_next_token (context_p);
 } /* parser_parse_unary_expression */
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+
+/**
+ * Types of compile time constants.
+ */
+typedef enum
+{
+  PARSER_CONSTANT_NUMBER,                 /**< number */
+  PARSER_CONSTANT_STRING,                 /**< string */
+  PARSER_CONSTANT_TRUE,                   /**< true */
+  PARSER_CONSTANT_FALSE,                  /**< false */
+  PARSER_CONSTANT_NULL,                   /**< null */
+  PARSER_CONSTANT_UNDEFINED,              /**< undefined */
+} parser_constant_type_t;
+
+/**
+ * Compile time constant.
+ */
+typedef struct
+{
+  parser_constant_type_t type;            /**< type of the constant */
+  ecma_number_t number;                   /**< value of a number constant */
+  const uint8_t *char_p;                  /**< characters of a string constant */
+  prop_length_t length;                   /**< length of a string constant */
+} parser_constant_t;
+
+/**
+ * Get the value of a number or string literal.
+ *
+ * @return true - if the literal is a number or string literal
+ *         false - otherwise
+ */
+static bool
+parser_get_literal_constant (parser_context_t *context_p, /**< context */
+                             uint16_t literal_index, /**< literal index */
+                             parser_constant_t *constant_p) /**< [out] constant */
+{
+  lexer_literal_t *literal_p = PARSER_GET_LITERAL (literal_index);
+
+  if (literal_p->type == LEXER_NUMBER_LITERAL)
+  {
+    constant_p->type = PARSER_CONSTANT_NUMBER;
+    constant_p->number = ecma_get_number_from_value (literal_p->u.value);
+    return true;
+  }
+
+  if (literal_p->type == LEXER_STRING_LITERAL)
+  {
+    constant_p->type = PARSER_CONSTANT_STRING;
+    constant_p->char_p = literal_p->u.char_p;
+    constant_p->length = literal_p->prop.length;
+    return true;
+  }
+
+  return false;
+} /* parser_get_literal_constant */
+
+/**
+ * Get the constant pushed by the last byte code.
+ *
+ * @return true - if the last byte code pushes a constant
+ *         false - otherwise
+ */
+static bool
+parser_get_last_cbc_constant (parser_context_t *context_p, /**< context */
+                              parser_constant_t *constant_p) /**< [out] constant */
+{
+  constant_p->type = PARSER_CONSTANT_NUMBER;
+
+  switch (context_p->last_cbc_opcode)
+  {
+    case CBC_PUSH_LITERAL:
+    {
+      return parser_get_literal_constant (context_p, context_p->last_cbc.literal_index, constant_p);
+    }
+    case CBC_PUSH_NUMBER_0:
+    {
+      constant_p->number = 0;
+      return true;
+    }
+    case CBC_PUSH_NUMBER_POS_BYTE:
+    {
+      constant_p->number = (ecma_number_t) context_p->last_cbc.value + 1;
+      return true;
+    }
+    case CBC_PUSH_NUMBER_NEG_BYTE:
+    {
+      constant_p->number = -((ecma_number_t) context_p->last_cbc.value + 1);
+      return true;
+    }
+    case CBC_PUSH_TRUE:
+    {
+      constant_p->type = PARSER_CONSTANT_TRUE;
+      return true;
+    }
+    case CBC_PUSH_FALSE:
+    {
+      constant_p->type = PARSER_CONSTANT_FALSE;
+      return true;
+    }
+    case CBC_PUSH_NULL:
+    {
+      constant_p->type = PARSER_CONSTANT_NULL;
+      return true;
+    }
+    case CBC_PUSH_UNDEFINED:
+    {
+      constant_p->type = PARSER_CONSTANT_UNDEFINED;
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* parser_get_last_cbc_constant */
+
+/**
+ * Convert a constant to boolean (see: ECMA-262 v5, 9.2).
+ *
+ * @return boolean value of the constant
+ */
+static bool
+parser_constant_to_boolean (const parser_constant_t *constant_p) /**< constant */
+{
+  switch (constant_p->type)
+  {
+    case PARSER_CONSTANT_NUMBER:
+    {
+      return !ecma_number_is_nan (constant_p->number) && !ecma_number_is_zero (constant_p->number);
+    }
+    case PARSER_CONSTANT_STRING:
+    {
+      return constant_p->length > 0;
+    }
+    default:
+    {
+      return constant_p->type == PARSER_CONSTANT_TRUE;
+    }
+  }
+} /* parser_constant_to_boolean */
+
+/**
+ * Replace the last byte code with a byte code which pushes a boolean value.
+ */
+static void
+parser_replace_last_cbc_with_boolean (parser_context_t *context_p, /**< context */
+                                      bool value) /**< boolean value */
+{
+  context_p->last_cbc_opcode = value ? CBC_PUSH_TRUE : CBC_PUSH_FALSE;
+} /* parser_replace_last_cbc_with_boolean */
+
+/**
+ * Get the literal which is consumed by the folded last byte code and can be
+ * replaced by the result. Only a literal created by the previous folding
+ * can be replaced, if the byte code has not been flushed since then.
+ *
+ * @return literal index or PARSER_MAXIMUM_NUMBER_OF_LITERALS
+ */
+static uint16_t
+parser_get_reusable_literal_index (parser_context_t *context_p) /**< context */
+{
+  uint16_t literal_index = context_p->folded_literal_index;
+
+  if (context_p->byte_code_size == context_p->folded_literal_byte_code_size
+      && context_p->last_cbc.literal_index == literal_index
+      && (context_p->last_cbc_opcode == CBC_PUSH_LITERAL
+          || (context_p->last_cbc_opcode == CBC_PUSH_TWO_LITERALS
+              && context_p->last_cbc.value != literal_index)))
+  {
+    return literal_index;
+  }
+
+  return PARSER_MAXIMUM_NUMBER_OF_LITERALS;
+} /* parser_get_reusable_literal_index */
+
+/**
+ * Replace the last byte code with a byte code which pushes a literal.
+ */
+static void
+parser_replace_last_cbc_with_literal (parser_context_t *context_p, /**< context */
+                                      uint16_t literal_index, /**< literal index */
+                                      uint8_t literal_type) /**< literal type */
+{
+  context_p->last_cbc_opcode = CBC_PUSH_LITERAL;
+  context_p->last_cbc.literal_index = literal_index;
+  context_p->last_cbc.literal_type = literal_type;
+  context_p->last_cbc.literal_object_type = LEXER_LITERAL_OBJECT_ANY;
+} /* parser_replace_last_cbc_with_literal */
+
+/**
+ * Replace the last byte code with a byte code which pushes a number value.
+ */
+static void
+parser_replace_last_cbc_with_number (parser_context_t *context_p, /**< context */
+                                     ecma_number_t number) /**< number value */
+{
+  if (number >= -CBC_PUSH_NUMBER_BYTE_RANGE_END
+      && number <= CBC_PUSH_NUMBER_BYTE_RANGE_END
+      && (ecma_number_t) (int32_t) number == number
+      && (number != 0 || !ecma_number_is_negative (number)))
+  {
+    int32_t int_num = (int32_t) number;
+
+    if (int_num == 0)
+    {
+      context_p->last_cbc_opcode = CBC_PUSH_NUMBER_0;
+    }
+    else if (int_num > 0)
+    {
+      context_p->last_cbc_opcode = CBC_PUSH_NUMBER_POS_BYTE;
+      context_p->last_cbc.value = (uint16_t) (int_num - 1);
+    }
+    else
+    {
+      context_p->last_cbc_opcode = CBC_PUSH_NUMBER_NEG_BYTE;
+      context_p->last_cbc.value = (uint16_t) (-int_num - 1);
+    }
+    return;
+  }
+
+  uint16_t reusable_index = parser_get_reusable_literal_index (context_p);
+  uint32_t literal_count = context_p->literal_count;
+  uint16_t literal_index = lexer_construct_number_literal (context_p,
+                                                           ecma_find_or_create_literal_number (number),
+                                                           reusable_index);
+
+  if (context_p->literal_count > literal_count || literal_index == reusable_index)
+  {
+    context_p->folded_literal_index = literal_index;
+    context_p->folded_literal_byte_code_size = context_p->byte_code_size;
+  }
+
+  parser_replace_last_cbc_with_literal (context_p, literal_index, LEXER_NUMBER_LITERAL);
+} /* parser_replace_last_cbc_with_number */
+
+/**
+ * Replace the last byte code with a byte code which pushes
+ * the concatenation of two character sequences.
+ *
+ * @return true - if the last byte code is replaced
+ *         false - if the resulting string is empty or too long
+ */
+static bool
+parser_replace_last_cbc_with_string (parser_context_t *context_p, /**< context */
+                                     const uint8_t *first_p, /**< first part */
+                                     size_t first_length, /**< length of the first part */
+                                     const uint8_t *second_p, /**< second part */
+                                     size_t second_length) /**< length of the second part */
+{
+  size_t length = first_length + second_length;
+
+  if (length == 0 || length > PARSER_MAXIMUM_STRING_LENGTH)
+  {
+    return false;
+  }
+
+  uint16_t reusable_index = parser_get_reusable_literal_index (context_p);
+  uint32_t literal_count = context_p->literal_count;
+  uint16_t literal_index = lexer_construct_string_literal (context_p,
+                                                           first_p,
+                                                           first_length,
+                                                           second_p,
+                                                           second_length,
+                                                           reusable_index);
+
+  if (context_p->literal_count > literal_count || literal_index == reusable_index)
+  {
+    context_p->folded_literal_index = literal_index;
+    context_p->folded_literal_byte_code_size = context_p->byte_code_size;
+  }
+
+  parser_replace_last_cbc_with_literal (context_p, literal_index, LEXER_STRING_LITERAL);
+  return true;
+} /* parser_replace_last_cbc_with_string */
+
+/**
+ * Fold the string concatenation of two constants (see: ECMA-262 v5, 11.6.1).
+ *
+ * @return true - if the constants are folded
+ *         false - otherwise
+ */
+static bool
+parser_fold_string_concatenation (parser_context_t *context_p, /**< context */
+                                  const parser_constant_t *left_p, /**< left operand */
+                                  const parser_constant_t *right_p) /**< right operand */
+{
+  lit_utf8_byte_t number_buffer[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+  const uint8_t *left_char_p = left_p->char_p;
+  size_t left_length = left_p->length;
+  const uint8_t *right_char_p = right_p->char_p;
+  size_t right_length = right_p->length;
+
+  JERRY_ASSERT (left_p->type == PARSER_CONSTANT_STRING || right_p->type == PARSER_CONSTANT_STRING);
+
+  /* At most one of the operands is a number. */
+  if (left_p->type == PARSER_CONSTANT_NUMBER)
+  {
+    left_char_p = number_buffer;
+    left_length = ecma_number_to_utf8_string (left_p->number, number_buffer, sizeof (number_buffer));
+  }
+  else if (right_p->type == PARSER_CONSTANT_NUMBER)
+  {
+    right_char_p = number_buffer;
+    right_length = ecma_number_to_utf8_string (right_p->number, number_buffer, sizeof (number_buffer));
+  }
+
+  return parser_replace_last_cbc_with_string (context_p, left_char_p, left_length, right_char_p, right_length);
+} /* parser_fold_string_concatenation */
+
+/**
+ * Fold a binary operator whose operands are pushed by the last byte code.
+ *
+ * Only those operators are folded whose result does not depend on the
+ * run-time environment and which cannot throw an error or call user code.
+ *
+ * @return true - if the operation is folded
+ *         false - otherwise
+ */
+static bool
+parser_fold_binary_constants (parser_context_t *context_p, /**< context */
+                              cbc_opcode_t opcode) /**< binary opcode */
+{
+  parser_constant_t left;
+  parser_constant_t right;
+
+  JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_TWO_LITERALS);
+
+  if (!parser_get_literal_constant (context_p, context_p->last_cbc.literal_index, &left)
+      || !parser_get_literal_constant (context_p, context_p->last_cbc.value, &right))
+  {
+    return false;
+  }
+
+  if (left.type == PARSER_CONSTANT_STRING || right.type == PARSER_CONSTANT_STRING)
+  {
+    bool is_equal;
+
+    switch (opcode)
+    {
+      case CBC_ADD:
+      {
+        return parser_fold_string_concatenation (context_p, &left, &right);
+      }
+      case CBC_STRICT_EQUAL:
+      case CBC_STRICT_NOT_EQUAL:
+      {
+        is_equal = (left.type == right.type
+                    && left.length == right.length
+                    && memcmp (left.char_p, right.char_p, left.length) == 0);
+        break;
+      }
+      case CBC_EQUAL:
+      case CBC_NOT_EQUAL:
+      {
+        /* Comparing a string to a number requires string to number conversion. */
+        if (left.type != right.type)
+        {
+          return false;
+        }
+
+        is_equal = (left.length == right.length
+                    && memcmp (left.char_p, right.char_p, left.length) == 0);
+        break;
+      }
+      default:
+      {
+        return false;
+      }
+    }
+
+    parser_replace_last_cbc_with_boolean (context_p,
+                                          is_equal != (opcode == CBC_NOT_EQUAL || opcode == CBC_STRICT_NOT_EQUAL));
+    return true;
+  }
+
+  ecma_number_t left_number = left.number;
+  ecma_number_t right_number = right.number;
+  ecma_number_t result;
+
+  switch (opcode)
+  {
+    case CBC_ADD:
+    {
+      result = left_number + right_number;
+      break;
+    }
+    case CBC_SUBTRACT:
+    {
+      result = left_number - right_number;
+      break;
+    }
+    case CBC_MULTIPLY:
+    {
+      result = left_number * right_number;
+      break;
+    }
+    case CBC_DIVIDE:
+    {
+      result = left_number / right_number;
+      break;
+    }
+    case CBC_MODULO:
+    {
+      result = ecma_op_number_remainder (left_number, right_number);
+      break;
+    }
+    case CBC_BIT_OR:
+    {
+      result = (ecma_number_t) (ecma_number_to_int32 (left_number) | ecma_number_to_int32 (right_number));
+      break;
+    }
+    case CBC_BIT_XOR:
+    {
+      result = (ecma_number_t) (ecma_number_to_int32 (left_number) ^ ecma_number_to_int32 (right_number));
+      break;
+    }
+    case CBC_BIT_AND:
+    {
+      result = (ecma_number_t) (ecma_number_to_int32 (left_number) & ecma_number_to_int32 (right_number));
+      break;
+    }
+    case CBC_LEFT_SHIFT:
+    {
+      uint32_t shifted = ecma_number_to_uint32 (left_number) << (ecma_number_to_uint32 (right_number) & 0x1f);
+      result = (ecma_number_t) (int32_t) shifted;
+      break;
+    }
+    case CBC_RIGHT_SHIFT:
+    {
+      result = (ecma_number_t) (ecma_number_to_int32 (left_number) >> (ecma_number_to_uint32 (right_number) & 0x1f));
+      break;
+    }
+    case CBC_UNS_RIGHT_SHIFT:
+    {
+      result = (ecma_number_t) (ecma_number_to_uint32 (left_number) >> (ecma_number_to_uint32 (right_number) & 0x1f));
+      break;
+    }
+    case CBC_EQUAL:
+    case CBC_STRICT_EQUAL:
+    {
+      parser_replace_last_cbc_with_boolean (context_p, left_number == right_number);
+      return true;
+    }
+    case CBC_NOT_EQUAL:
+    case CBC_STRICT_NOT_EQUAL:
+    {
+      parser_replace_last_cbc_with_boolean (context_p, left_number != right_number);
+      return true;
+    }
+    case CBC_LESS:
+    {
+      parser_replace_last_cbc_with_boolean (context_p, left_number < right_number);
+      return true;
+    }
+    case CBC_GREATER:
+    {
+      parser_replace_last_cbc_with_boolean (context_p, left_number > right_number);
+      return true;
+    }
+    case CBC_LESS_EQUAL:
+    {
+      parser_replace_last_cbc_with_boolean (context_p, left_number <= right_number);
+      return true;
+    }
+    case CBC_GREATER_EQUAL:
+    {
+      parser_replace_last_cbc_with_boolean (context_p, left_number >= right_number);
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+
+  parser_replace_last_cbc_with_number (context_p, result);
+  return true;
+} /* parser_fold_binary_constants */
+
+/**
+ * Fold a unary operator whose operand is pushed by the last byte code.
+ *
+ * @return true - if the operation is folded
+ *         false - otherwise
+ */
+static bool
+parser_fold_unary_constant (parser_context_t *context_p, /**< context */
+                            uint8_t token) /**< unary operator token */
+{
+  parser_constant_t constant;
+
+  if (!parser_get_last_cbc_constant (context_p, &constant))
+  {
+    return false;
+  }
+
+  switch (token)
+  {
+    case LEXER_LOGICAL_NOT:
+    {
+      parser_replace_last_cbc_with_boolean (context_p, !parser_constant_to_boolean (&constant));
+      return true;
+    }
+    case LEXER_KEYW_VOID:
+    {
+      context_p->last_cbc_opcode = CBC_PUSH_UNDEFINED;
+      return true;
+    }
+    case LEXER_KEYW_TYPEOF:
+    {
+      const char *type_p;
+
+      switch (constant.type)
+      {
+        case PARSER_CONSTANT_NUMBER:
+        {
+          type_p = "number";
+          break;
+        }
+        case PARSER_CONSTANT_STRING:
+        {
+          type_p = "string";
+          break;
+        }
+        case PARSER_CONSTANT_NULL:
+        {
+          type_p = "object";
+          break;
+        }
+        case PARSER_CONSTANT_UNDEFINED:
+        {
+          type_p = "undefined";
+          break;
+        }
+        default:
+        {
+          type_p = "boolean";
+          break;
+        }
+      }
+
+      return parser_replace_last_cbc_with_string (context_p,
+                                                  (const uint8_t *) type_p,
+                                                  strlen (type_p),
+                                                  (const uint8_t *) type_p,
+                                                  0);
+    }
+    default:
+    {
+      break;
+    }
+  }
+
+  /* The remaining operators convert their operand to number (see: ECMA-262 v5, 9.3). */
+  ecma_number_t number;
+
+  switch (constant.type)
+  {
+    case PARSER_CONSTANT_NUMBER:
+    {
+      number = constant.number;
+      break;
+    }
+    case PARSER_CONSTANT_STRING:
+    {
+      return false;
+    }
+    case PARSER_CONSTANT_TRUE:
+    {
+      number = 1;
+      break;
+    }
+    case PARSER_CONSTANT_UNDEFINED:
+    {
+      number = ecma_number_make_nan ();
+      break;
+    }
+    default:
+    {
+      number = 0;
+      break;
+    }
+  }
+
+  switch (token)
+  {
+    case LEXER_PLUS:
+    {
+      break;
+    }
+    case LEXER_NEGATE:
+    {
+      number = -number;
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (token == LEXER_BIT_NOT);
+      number = (ecma_number_t) (~ecma_number_to_int32 (number));
+      break;
+    }
+  }
+
+  parser_replace_last_cbc_with_number (context_p, number);
+  return true;
+} /* parser_fold_unary_constant */
+
+/**
+ * Remove the last byte code if it pushes a constant value
+ * whose boolean value is known at compile time.
+ *
+ * @return true - if the byte code is removed and the boolean value is stored into value_p
+ *         false - otherwise
+ */
+bool
+parser_pop_constant_condition (parser_context_t *context_p, /**< context */
+                               bool *value_p) /**< [out] boolean value of the constant */
+{
+  parser_constant_t constant;
+
+  if (!parser_get_last_cbc_constant (context_p, &constant))
+  {
+    return false;
+  }
+
+  *value_p = parser_constant_to_boolean (&constant);
+  context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+  return true;
+} /* parser_pop_constant_condition */
+
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
 /**
  * Parse the postfix part of unary operators, and
  * generate byte code for the whole expression.
@@ -1565,7 +2224,10 @@ parser_process_unary_expression (parser_context_t *context_p) /**< context */
               && context_p->last_cbc.literal_object_type == LEXER_LITERAL_OBJECT_EVAL
               && context_p->last_cbc.literal_type == LEXER_IDENT_LITERAL)
           {
-            context_p->status_flags |= PARSER_ARGUMENTS_NEEDED | PARSER_LEXICAL_ENV_NEEDED | PARSER_NO_REG_STORE;
+            context_p->status_flags |= (PARSER_ARGUMENTS_NEEDED
+                                        | PARSER_LEXICAL_ENV_NEEDED
+                                        | PARSER_NO_REG_STORE
+                                        | PARSER_HAS_DIRECT_EVAL);
             is_eval = true;
           }
 
@@ -1790,6 +2452,13 @@ parser_process_unary_expression (parser_context_t *context_p) /**< context */
     }
     else
     {
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+      if (parser_fold_unary_constant (context_p, token))
+      {
+        continue;
+      }
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
       token = (uint8_t) (LEXER_UNARY_OP_TOKEN_TO_OPCODE (token));
 
       if (token == CBC_TYPEOF)
@@ -2132,6 +2801,14 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
         lexer_convert_push_number_to_push_literal (context_p);
       }
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+      if (context_p->last_cbc_opcode == CBC_PUSH_TWO_LITERALS
+          && parser_fold_binary_constants (context_p, opcode))
+      {
+        continue;
+      }
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
       if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
       {
         JERRY_ASSERT (CBC_SAME_ARGS (context_p->last_cbc_opcode, opcode + CBC_BINARY_WITH_LITERAL));
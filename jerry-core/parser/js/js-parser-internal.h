@@ -45,6 +45,8 @@ typedef enum
   PARSER_IS_FUNC_EXPRESSION = (1u << 3),      /**< a function expression is parsed */
   PARSER_IS_PROPERTY_GETTER = (1u << 4),      /**< a property getter function is parsed */
   PARSER_IS_PROPERTY_SETTER = (1u << 5),      /**< a property setter function is parsed */
+  PARSER_HAS_DIRECT_EVAL = (1u << 6),         /**< the code contains a direct eval call, which
+                                               *   may declare variables at runtime */
   PARSER_HAS_NON_STRICT_ARG = (1u << 7),      /**< the function has arguments which
                                                *   are not supported in strict mode */
   PARSER_ARGUMENTS_NEEDED = (1u << 8),        /**< arguments object must be created */
@@ -219,6 +221,42 @@ typedef struct
   uint32_t last_position;                     /**< position of the last allocated byte */
 } parser_mem_data_t;
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+
+/**
+ * Position in the byte code stream. The byte code
+ * emitted after this position can be removed later.
+ */
+typedef struct
+{
+  parser_mem_page_t *page_p;                  /**< last page of the byte code stream */
+  uint32_t last_position;                     /**< position of the last byte on the page */
+  uint32_t byte_code_size;                    /**< byte code size */
+  uint32_t status_flags;                      /**< saved PARSER_NO_END_LABEL status flag */
+#ifdef JERRY_ENABLE_LINE_INFO
+  parser_line_counter_t last_line_info_line;  /**< last line where line info has been inserted */
+#endif /* JERRY_ENABLE_LINE_INFO */
+} parser_byte_code_mark_t;
+
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Line info table writer of the post processing.
+ */
+typedef struct
+{
+  uint8_t *buffer_p;                          /**< table buffer (NULL if only the size is computed) */
+  uint32_t size;                              /**< size of the table */
+  uint32_t last_offset;                       /**< byte code offset of the last table entry */
+  uint32_t last_line;                         /**< line of the last table entry */
+  uint32_t pending_offset;                    /**< byte code offset of the pending entry */
+  uint32_t pending_line;                      /**< line of the pending entry (0 if there is no pending entry) */
+} parser_line_info_writer_t;
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 /**
  * Parser memory list.
  */
@@ -276,6 +314,21 @@ typedef struct parser_branch_node_t
   parser_branch_t branch;                     /**< branch */
 } parser_branch_node_t;
 
+/**
+ * Lexical environment which encloses nested functions. Used for
+ * resolving the free identifiers of the nested functions.
+ */
+typedef struct
+{
+  const ecma_value_t *var_names_p;            /**< names of the slots of the lexical environment */
+  uint32_t var_count;                         /**< number of slots */
+  ecma_value_t hidden_name;                   /**< a binding which is not stored in a slot
+                                               *   (ECMA_VALUE_EMPTY if there is no such binding) */
+  uint16_t depth;                             /**< 1 - if the lexical environment is created at
+                                               *   runtime, 0 - otherwise */
+  bool is_dynamic;                            /**< bindings may be declared at runtime */
+} parser_scope_t;
+
 #ifdef JERRY_DEBUGGER
 /**
  * Extra information for each breakpoint.
@@ -350,6 +403,11 @@ typedef struct
   /* Compact byte code members. */
   cbc_argument_t last_cbc;                    /**< argument of the last cbc */
   uint16_t last_cbc_opcode;                   /**< opcode of the last cbc */
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  uint32_t folded_literal_byte_code_size;     /**< byte code size when folded_literal_index is set */
+  uint16_t folded_literal_index;              /**< literal created by constant folding, which is
+                                               *   referenced only by the last cbc (if it is valid) */
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
 
   /* Literal types */
   uint16_t argument_count;                    /**< number of function arguments */
@@ -409,6 +467,9 @@ void parser_free_local (void *ptr, size_t size);
 void parser_cbc_stream_init (parser_mem_data_t *data_p);
 void parser_cbc_stream_free (parser_mem_data_t *data_p);
 void parser_cbc_stream_alloc_page (parser_context_t *context_p, parser_mem_data_t *data_p);
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+void parser_cbc_stream_truncate (parser_mem_data_t *data_p, parser_mem_page_t *page_p, uint32_t last_position);
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
 
 /* Parser list. Ensures pointer alignment. */
 
@@ -464,6 +525,11 @@ void parser_emit_cbc_backward_branch (parser_context_t *context_p, uint16_t opco
 void parser_set_branch_to_current_position (parser_context_t *context_p, parser_branch_t *branch_p);
 void parser_set_breaks_to_current_position (parser_context_t *context_p, parser_branch_node_t *current_p);
 void parser_set_continues_to_current_position (parser_context_t *context_p, parser_branch_node_t *current_p);
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+void parser_prepare_constant_operand (parser_context_t *context_p);
+void parser_set_byte_code_mark (parser_context_t *context_p, parser_byte_code_mark_t *mark_p);
+void parser_truncate_byte_code (parser_context_t *context_p, const parser_byte_code_mark_t *mark_p);
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
 
 /* Convenience macros. */
 #define parser_emit_cbc_ext(context_p, opcode) \
@@ -502,6 +568,9 @@ void lexer_expect_object_literal_id (parser_context_t *context_p, uint32_t ident
 void lexer_construct_literal_object (parser_context_t *context_p, lexer_lit_location_t *literal_p,
                                      uint8_t literal_type);
 bool lexer_construct_number_object (parser_context_t *context_p, bool is_expr, bool is_negative_number);
+uint16_t lexer_construct_number_literal (parser_context_t *context_p, ecma_value_t lit_value, uint16_t reusable_index);
+uint16_t lexer_construct_string_literal (parser_context_t *context_p, const uint8_t *first_p, size_t first_length,
+                                         const uint8_t *second_p, size_t second_length, uint16_t reusable_index);
 void lexer_convert_push_number_to_push_literal (parser_context_t *context_p);
 uint16_t lexer_construct_function_object (parser_context_t *context_p, uint32_t extra_status_flags);
 void lexer_construct_regexp_object (parser_context_t *context_p, bool parse_only);
@@ -520,6 +589,9 @@ uint8_t lexer_convert_binary_lvalue_token_to_binary (uint8_t token);
 /* Parser functions. */
 
 void parser_parse_expression (parser_context_t *context_p, int options);
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+bool parser_pop_constant_condition (parser_context_t *context_p, bool *value_p);
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
 #ifndef CONFIG_DISABLE_ES2015_CLASS
 void parser_parse_class (parser_context_t *context_p, bool is_statement);
 void parser_parse_super_class_context_start (parser_context_t *context_p);
@@ -544,6 +616,7 @@ void parser_scan_until (parser_context_t *context_p, lexer_range_t *range_p, lex
 
 void parser_parse_statements (parser_context_t *context_p);
 void parser_free_jumps (parser_stack_iterator_t iterator);
+bool parser_statement_is_inside_catch (parser_context_t *context_p);
 
 /**
  * @}
@@ -556,6 +629,7 @@ ecma_compiled_code_t *parser_parse_function (parser_context_t *context_p, uint32
 #ifndef CONFIG_DISABLE_ES2015_ARROW_FUNCTION
 ecma_compiled_code_t *parser_parse_arrow_function (parser_context_t *context_p, uint32_t status_flags);
 #endif /* !CONFIG_DISABLE_ES2015_ARROW_FUNCTION */
+void parser_resolve_scope_info (ecma_compiled_code_t *compiled_code_p, const parser_scope_t *scope_p);
 
 /* Error management. */
 
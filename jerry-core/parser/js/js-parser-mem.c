@@ -168,6 +168,41 @@ parser_cbc_stream_alloc_page (parser_context_t *context_p, /**< context */
   data_p->last_p = page_p;
 } /* parser_cbc_stream_alloc_page */
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+
+/**
+ * Removes the bytes after the given position from the byte stream.
+ */
+void
+parser_cbc_stream_truncate (parser_mem_data_t *data_p, /**< memory manager */
+                            parser_mem_page_t *page_p, /**< last page which is kept (can be NULL) */
+                            uint32_t last_position) /**< position of the last byte on that page */
+{
+  parser_mem_page_t *next_p = (page_p != NULL) ? page_p->next_p : data_p->first_p;
+
+  while (next_p != NULL)
+  {
+    parser_mem_page_t *current_p = next_p;
+
+    next_p = current_p->next_p;
+    parser_free (current_p, sizeof (parser_mem_page_t *) + PARSER_CBC_STREAM_PAGE_SIZE);
+  }
+
+  if (page_p != NULL)
+  {
+    page_p->next_p = NULL;
+  }
+  else
+  {
+    data_p->first_p = NULL;
+  }
+
+  data_p->last_p = page_p;
+  data_p->last_position = last_position;
+} /* parser_cbc_stream_truncate */
+
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
 /**********************************************************************/
 /* Parser list management functions                                   */
 /**********************************************************************/
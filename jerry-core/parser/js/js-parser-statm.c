@@ -95,7 +95,12 @@ typedef struct
  */
 typedef struct
 {
-  parser_branch_t branch;                 /**< branch to the end */
+  parser_branch_t branch;                 /**< branch to the end (page_p is NULL if
+                                           *   the block is always executed) */
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  parser_byte_code_mark_t dead_code_mark; /**< start of the byte code which is never executed */
+  bool has_dead_code;                     /**< dead_code_mark is valid */
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
 } parser_if_else_statement_t;
 
 /**
@@ -463,6 +468,112 @@ parser_parse_function_statement (parser_context_t *context_p) /**< context */
   lexer_next_token (context_p);
 } /* parser_parse_function_statement */
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+
+/**
+ * Remove the byte code emitted after a mark unless
+ * it contains jumps to the enclosing statements.
+ *
+ * @return true - if the byte code is removed
+ *         false - otherwise
+ */
+static bool
+parser_remove_dead_code (parser_context_t *context_p, /**< context */
+                         const parser_byte_code_mark_t *mark_p) /**< start of the dead code */
+{
+  parser_stack_iterator_t iterator;
+
+#ifdef JERRY_DEBUGGER
+  if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+  {
+    /* Breakpoints may already refer to the byte code. */
+    return false;
+  }
+#endif /* JERRY_DEBUGGER */
+
+  parser_stack_iterator_init (context_p, &iterator);
+
+  while (true)
+  {
+    uint8_t type = parser_stack_iterator_read_uint8 (&iterator);
+    parser_branch_node_t *branch_list_p;
+
+    if (type == PARSER_STATEMENT_START)
+    {
+      break;
+    }
+
+    if (type == PARSER_STATEMENT_LABEL)
+    {
+      parser_label_statement_t label_statement;
+
+      parser_stack_iterator_skip (&iterator, 1);
+      parser_stack_iterator_read (&iterator, &label_statement, sizeof (parser_label_statement_t));
+      parser_stack_iterator_skip (&iterator, sizeof (parser_label_statement_t));
+      branch_list_p = label_statement.break_list_p;
+    }
+    else if (type == PARSER_STATEMENT_SWITCH
+             || type == PARSER_STATEMENT_SWITCH_NO_DEFAULT
+             || type == PARSER_STATEMENT_DO_WHILE
+             || type == PARSER_STATEMENT_WHILE
+             || type == PARSER_STATEMENT_FOR
+             || type == PARSER_STATEMENT_FOR_IN)
+    {
+      parser_loop_statement_t loop;
+
+      parser_stack_iterator_skip (&iterator, 1);
+      parser_stack_iterator_read (&iterator, &loop, sizeof (parser_loop_statement_t));
+      parser_stack_iterator_skip (&iterator, parser_statement_length (type) - 1);
+      branch_list_p = loop.branch_list_p;
+    }
+    else
+    {
+      parser_stack_iterator_skip (&iterator, parser_statement_length (type));
+      continue;
+    }
+
+    /* Break and continue statements of the dead code cannot be removed
+     * from the branch lists of the enclosing statements. */
+    while (branch_list_p != NULL)
+    {
+      if ((branch_list_p->branch.offset >> 8) >= mark_p->byte_code_size)
+      {
+        return false;
+      }
+      branch_list_p = branch_list_p->next_p;
+    }
+  }
+
+  parser_truncate_byte_code (context_p, mark_p);
+  return true;
+} /* parser_remove_dead_code */
+
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
+/**
+ * Finish an if or else block: its byte code is removed when it is never
+ * executed, otherwise the branch over the block is set to the current position.
+ */
+static void
+parser_finish_if_else_block (parser_context_t *context_p, /**< context */
+                             parser_if_else_statement_t *statement_p) /**< if or else statement */
+{
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  if (statement_p->has_dead_code
+      && parser_remove_dead_code (context_p, &statement_p->dead_code_mark))
+  {
+    return;
+  }
+
+  if (statement_p->branch.page_p == NULL)
+  {
+    return;
+  }
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
+  parser_set_branch_to_current_position (context_p, &statement_p->branch);
+} /* parser_finish_if_else_block */
+
 /**
  * Parse if statement (starting part).
  */
@@ -473,9 +584,41 @@ parser_parse_if_statement_start (parser_context_t *context_p) /**< context */
 
   parser_parse_enclosed_expr (context_p);
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  bool condition;
+
+  if_statement.has_dead_code = false;
+
+  if (parser_pop_constant_condition (context_p, &condition))
+  {
+    if (condition)
+    {
+      /* The if block is always executed. */
+      if_statement.branch.page_p = NULL;
+    }
+    else
+    {
+      /* The if block is never executed. It is skipped by an unconditional
+       * jump, which is removed together with the block if possible. */
+      parser_set_byte_code_mark (context_p, &if_statement.dead_code_mark);
+      if_statement.has_dead_code = true;
+
+      parser_emit_cbc_forward_branch (context_p,
+                                      CBC_JUMP_FORWARD,
+                                      &if_statement.branch);
+    }
+  }
+  else
+  {
+    parser_emit_cbc_forward_branch (context_p,
+                                    CBC_BRANCH_IF_FALSE_FORWARD,
+                                    &if_statement.branch);
+  }
+#else /* JERRY_DISABLE_PARSER_PEEPHOLE */
   parser_emit_cbc_forward_branch (context_p,
                                   CBC_BRANCH_IF_FALSE_FORWARD,
                                   &if_statement.branch);
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
 
   parser_stack_push (context_p, &if_statement, sizeof (parser_if_else_statement_t));
   parser_stack_push_uint8 (context_p, PARSER_STATEMENT_IF);
@@ -503,7 +646,7 @@ parser_parse_if_statement_end (parser_context_t *context_p) /**< context */
     parser_stack_pop (context_p, &if_statement, sizeof (parser_if_else_statement_t));
     parser_stack_iterator_init (context_p, &context_p->last_statement);
 
-    parser_set_branch_to_current_position (context_p, &if_statement.branch);
+    parser_finish_if_else_block (context_p, &if_statement);
 
     return false;
   }
@@ -513,11 +656,40 @@ parser_parse_if_statement_end (parser_context_t *context_p) /**< context */
   parser_stack_iterator_skip (&iterator, 1);
   parser_stack_iterator_read (&iterator, &if_statement, sizeof (parser_if_else_statement_t));
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  else_statement.has_dead_code = false;
+
+  if (if_statement.has_dead_code
+      && parser_remove_dead_code (context_p, &if_statement.dead_code_mark))
+  {
+    /* The if block is removed, so the else block is always executed. */
+    else_statement.branch.page_p = NULL;
+  }
+  else
+  {
+    if (if_statement.branch.page_p == NULL)
+    {
+      /* The if block is always executed, so the else block is never executed. */
+      parser_set_byte_code_mark (context_p, &else_statement.dead_code_mark);
+      else_statement.has_dead_code = true;
+    }
+
+    parser_emit_cbc_forward_branch (context_p,
+                                    CBC_JUMP_FORWARD,
+                                    &else_statement.branch);
+
+    if (if_statement.branch.page_p != NULL)
+    {
+      parser_set_branch_to_current_position (context_p, &if_statement.branch);
+    }
+  }
+#else /* JERRY_DISABLE_PARSER_PEEPHOLE */
   parser_emit_cbc_forward_branch (context_p,
                                   CBC_JUMP_FORWARD,
                                   &else_statement.branch);
 
   parser_set_branch_to_current_position (context_p, &if_statement.branch);
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
 
   parser_stack_iterator_write (&iterator, &else_statement, sizeof (parser_if_else_statement_t));
 
@@ -599,6 +771,52 @@ parser_parse_with_statement_end (parser_context_t *context_p) /**< context */
   }
 } /* parser_parse_with_statement_end */
 
+/**
+ * Checks whether the current statement is inside a catch block.
+ *
+ * @return true - if the current statement is inside a catch block,
+ *         false - otherwise
+ */
+bool
+parser_statement_is_inside_catch (parser_context_t *context_p) /**< context */
+{
+  parser_stack_iterator_t iterator = context_p->last_statement;
+
+  if (iterator.current_p == NULL)
+  {
+    /* The statements are not parsed yet (e.g. argument initializers). */
+    return false;
+  }
+
+  while (true)
+  {
+    uint8_t type = parser_stack_iterator_read_uint8 (&iterator);
+
+    if (type == PARSER_STATEMENT_START)
+    {
+      return false;
+    }
+
+    if (type == PARSER_STATEMENT_TRY)
+    {
+      parser_try_statement_t try_statement;
+
+      parser_stack_iterator_skip (&iterator, 1);
+      parser_stack_iterator_read (&iterator, &try_statement, sizeof (parser_try_statement_t));
+
+      if (try_statement.type == parser_catch_block)
+      {
+        return true;
+      }
+
+      parser_stack_iterator_skip (&iterator, sizeof (parser_try_statement_t));
+      continue;
+    }
+
+    parser_stack_iterator_skip (&iterator, parser_statement_length (type));
+  }
+} /* parser_statement_is_inside_catch */
+
 #ifndef CONFIG_DISABLE_ES2015_CLASS
 /**
  * Parse super class context like a with statement (starting part).
@@ -2240,7 +2458,7 @@ parser_parse_statements (parser_context_t *context_p) /**< context */
           parser_stack_pop (context_p, &else_statement, sizeof (parser_if_else_statement_t));
           parser_stack_iterator_init (context_p, &context_p->last_statement);
 
-          parser_set_branch_to_current_position (context_p, &else_statement.branch);
+          parser_finish_if_else_block (context_p, &else_statement);
           continue;
         }
 
@@ -238,6 +238,117 @@ parser_flush_cbc (parser_context_t *context_p) /**< context */
   context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
 } /* parser_flush_cbc */
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+
+/**
+ * Checks whether the last byte code only pushes a value without side effects.
+ *
+ * @return true - if the last byte code can be removed together with a following CBC_POP
+ *         false - otherwise
+ */
+static bool
+parser_last_cbc_is_pure_push (parser_context_t *context_p) /**< context */
+{
+  switch (context_p->last_cbc_opcode)
+  {
+    case CBC_PUSH_UNDEFINED:
+    case CBC_PUSH_TRUE:
+    case CBC_PUSH_FALSE:
+    case CBC_PUSH_NULL:
+    case CBC_PUSH_THIS:
+    case CBC_PUSH_NUMBER_0:
+    case CBC_PUSH_NUMBER_POS_BYTE:
+    case CBC_PUSH_NUMBER_NEG_BYTE:
+    {
+      return true;
+    }
+    case CBC_PUSH_LITERAL:
+    {
+      /* Identifier references may have side effects (e.g. getters of with statements). */
+      return (context_p->last_cbc.literal_type == LEXER_STRING_LITERAL
+              || context_p->last_cbc.literal_type == LEXER_NUMBER_LITERAL);
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* parser_last_cbc_is_pure_push */
+
+/**
+ * Get the compare and branch superinstruction which is equal to
+ * the last byte code followed by the conditional branch opcode.
+ *
+ * Note:
+ *   the last byte code is never a branch target, since setting
+ *   a branch target always flushes the last byte code
+ *
+ * @return compare and branch opcode - if the byte codes can be fused
+ *         PARSER_CBC_UNAVAILABLE - otherwise
+ */
+static uint16_t
+parser_get_compare_branch_opcode (parser_context_t *context_p, /**< context */
+                                  uint16_t opcode) /**< conditional branch opcode */
+{
+  if (opcode == CBC_BRANCH_IF_TRUE_BACKWARD)
+  {
+    switch (context_p->last_cbc_opcode)
+    {
+      case CBC_LESS_TWO_LITERALS:
+      {
+        return CBC_BRANCH_IF_LESS_TWO_LITERALS_BACKWARD;
+      }
+      case CBC_LESS_RIGHT_LITERAL:
+      {
+        return CBC_BRANCH_IF_LESS_RIGHT_LITERAL_BACKWARD;
+      }
+      case CBC_LESS_EQUAL_TWO_LITERALS:
+      {
+        return CBC_BRANCH_IF_LESS_EQUAL_TWO_LITERALS_BACKWARD;
+      }
+      default:
+      {
+        return PARSER_CBC_UNAVAILABLE;
+      }
+    }
+  }
+
+  if (opcode == CBC_BRANCH_IF_FALSE_FORWARD)
+  {
+    switch (context_p->last_cbc_opcode)
+    {
+      case CBC_LESS_TWO_LITERALS:
+      {
+        return CBC_BRANCH_IF_NOT_LESS_TWO_LITERALS_FORWARD;
+      }
+      case CBC_EQUAL_TWO_LITERALS:
+      {
+        return CBC_BRANCH_IF_NOT_EQUAL_TWO_LITERALS_FORWARD;
+      }
+      case CBC_EQUAL_RIGHT_LITERAL:
+      {
+        return CBC_BRANCH_IF_NOT_EQUAL_RIGHT_LITERAL_FORWARD;
+      }
+      case CBC_STRICT_EQUAL_TWO_LITERALS:
+      {
+        return CBC_BRANCH_IF_STRICT_NOT_EQUAL_TWO_LITERALS_FORWARD;
+      }
+      case CBC_STRICT_EQUAL_RIGHT_LITERAL:
+      {
+        return CBC_BRANCH_IF_STRICT_NOT_EQUAL_RIGHT_LITERAL_FORWARD;
+      }
+      default:
+      {
+        return PARSER_CBC_UNAVAILABLE;
+      }
+    }
+  }
+
+  return PARSER_CBC_UNAVAILABLE;
+} /* parser_get_compare_branch_opcode */
+
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
 /**
  * Append a byte code
  */
@@ -247,6 +358,15 @@ parser_emit_cbc (parser_context_t *context_p, /**< context */
 {
   JERRY_ASSERT (PARSER_ARGS_EQ (opcode, 0));
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  if (opcode == CBC_POP && parser_last_cbc_is_pure_push (context_p))
+  {
+    /* The pushed value is discarded immediately, so both byte codes are dropped. */
+    context_p->last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+    return;
+  }
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
     parser_flush_cbc (context_p);
@@ -326,6 +446,10 @@ parser_emit_cbc_push_number (parser_context_t *context_p, /**< context */
   uint16_t value = context_p->lit_object.index;
   uint16_t lit_value = UINT16_MAX;
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  parser_prepare_constant_operand (context_p);
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
     if (context_p->last_cbc_opcode == CBC_PUSH_LITERAL)
@@ -456,6 +580,38 @@ parser_emit_cbc_forward_branch (parser_context_t *context_p, /**< context */
   uint8_t flags;
   uint32_t extra_byte_code_increase;
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  uint16_t compare_branch_opcode = parser_get_compare_branch_opcode (context_p, opcode);
+
+  if (compare_branch_opcode != PARSER_CBC_UNAVAILABLE)
+  {
+    uint32_t instruction_start = context_p->byte_code_size;
+
+#if PARSER_MAXIMUM_CODE_SIZE <= 65535
+    compare_branch_opcode++;
+#else /* PARSER_MAXIMUM_CODE_SIZE > 65535 */
+    PARSER_PLUS_EQUAL_U16 (compare_branch_opcode, 2);
+#endif /* PARSER_MAXIMUM_CODE_SIZE <= 65535 */
+
+    /* The literal arguments of the compare opcode are kept, only the opcode is replaced. */
+    context_p->last_cbc_opcode = compare_branch_opcode;
+    parser_flush_cbc (context_p);
+
+    PARSER_APPEND_TO_BYTE_CODE (context_p, 0);
+    branch_p->page_p = context_p->byte_code.last_p;
+    branch_p->offset = (context_p->byte_code.last_position - 1) | (instruction_start << 8);
+
+#if PARSER_MAXIMUM_CODE_SIZE <= 65535
+    PARSER_APPEND_TO_BYTE_CODE (context_p, 0);
+    context_p->byte_code_size += 2;
+#else /* PARSER_MAXIMUM_CODE_SIZE > 65535 */
+    parser_emit_two_bytes (context_p, 0, 0);
+    context_p->byte_code_size += 3;
+#endif /* PARSER_MAXIMUM_CODE_SIZE <= 65535 */
+    return;
+  }
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
     parser_flush_cbc (context_p);
@@ -563,6 +719,53 @@ parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
   const char *name;
 #endif /* PARSER_DUMP_BYTE_CODE */
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  uint16_t compare_branch_opcode = parser_get_compare_branch_opcode (context_p, opcode);
+
+  if (compare_branch_opcode != PARSER_CBC_UNAVAILABLE)
+  {
+    offset = context_p->byte_code_size - offset;
+
+#if PARSER_MAXIMUM_CODE_SIZE > 65535
+    if (offset > 65535)
+    {
+      PARSER_PLUS_EQUAL_U16 (compare_branch_opcode, 2);
+    }
+    else if (offset > 255)
+    {
+      compare_branch_opcode++;
+    }
+#else /* PARSER_MAXIMUM_CODE_SIZE <= 65535 */
+    if (offset > 255)
+    {
+      compare_branch_opcode++;
+    }
+#endif /* PARSER_MAXIMUM_CODE_SIZE > 65535 */
+
+    /* The literal arguments of the compare opcode are kept, only the opcode is replaced. */
+    context_p->last_cbc_opcode = compare_branch_opcode;
+    parser_flush_cbc (context_p);
+
+#if PARSER_MAXIMUM_CODE_SIZE > 65535
+    if (offset > 65535)
+    {
+      PARSER_APPEND_TO_BYTE_CODE (context_p, offset >> 16);
+      context_p->byte_code_size++;
+    }
+#endif /* PARSER_MAXIMUM_CODE_SIZE > 65535 */
+
+    if (offset > 255)
+    {
+      PARSER_APPEND_TO_BYTE_CODE (context_p, (offset >> 8) & 0xff);
+      context_p->byte_code_size++;
+    }
+
+    PARSER_APPEND_TO_BYTE_CODE (context_p, offset & 0xff);
+    context_p->byte_code_size++;
+    return;
+  }
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
   if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
   {
     parser_flush_cbc (context_p);
@@ -651,6 +854,89 @@ parser_emit_cbc_backward_branch (parser_context_t *context_p, /**< context */
 #undef PARSER_CHECK_LAST_POSITION
 #undef PARSER_APPEND_TO_BYTE_CODE
 
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+
+/**
+ * Converts the pending push number byte code into a push literal byte code
+ * when a constant right operand of a binary operator is parsed. This allows
+ * merging the two operands into a push two literals byte code, which can be
+ * folded into a single constant by parser_process_binary_opcodes.
+ */
+void
+parser_prepare_constant_operand (parser_context_t *context_p) /**< context */
+{
+  uint8_t token = context_p->stack_top_uint8;
+
+  if ((context_p->last_cbc_opcode == CBC_PUSH_NUMBER_0
+       || context_p->last_cbc_opcode == CBC_PUSH_NUMBER_POS_BYTE
+       || context_p->last_cbc_opcode == CBC_PUSH_NUMBER_NEG_BYTE)
+      && token >= LEXER_BIT_OR
+      && token <= LEXER_MODULO
+      && token != LEXER_KEYW_IN
+      && token != LEXER_KEYW_INSTANCEOF)
+  {
+    lexer_convert_push_number_to_push_literal (context_p);
+  }
+} /* parser_prepare_constant_operand */
+
+/**
+ * Save the current byte code position. The pending byte code is flushed first.
+ */
+void
+parser_set_byte_code_mark (parser_context_t *context_p, /**< context */
+                           parser_byte_code_mark_t *mark_p) /**< [out] byte code position */
+{
+  if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
+  {
+    parser_flush_cbc (context_p);
+  }
+
+  mark_p->page_p = context_p->byte_code.last_p;
+  mark_p->last_position = context_p->byte_code.last_position;
+  mark_p->byte_code_size = context_p->byte_code_size;
+  mark_p->status_flags = context_p->status_flags & PARSER_NO_END_LABEL;
+#ifdef JERRY_ENABLE_LINE_INFO
+  mark_p->last_line_info_line = context_p->last_line_info_line;
+#endif /* JERRY_ENABLE_LINE_INFO */
+} /* parser_set_byte_code_mark */
+
+/**
+ * Remove the byte code emitted after a saved byte code position.
+ *
+ * Note:
+ *   the caller must ensure that no branch refers to the removed byte code
+ */
+void
+parser_truncate_byte_code (parser_context_t *context_p, /**< context */
+                           const parser_byte_code_mark_t *mark_p) /**< byte code position */
+{
+  /* Flushing keeps the stack depth in sync with the removed byte code. */
+  if (context_p->last_cbc_opcode != PARSER_CBC_UNAVAILABLE)
+  {
+    parser_flush_cbc (context_p);
+  }
+
+  JERRY_ASSERT (context_p->byte_code_size >= mark_p->byte_code_size);
+
+#ifdef PARSER_DUMP_BYTE_CODE
+  if (context_p->is_show_opcodes)
+  {
+    JERRY_DEBUG_MSG ("  [removed %d bytes of unreachable byte code]\n",
+                     (int) (context_p->byte_code_size - mark_p->byte_code_size));
+  }
+#endif /* PARSER_DUMP_BYTE_CODE */
+
+  parser_cbc_stream_truncate (&context_p->byte_code, mark_p->page_p, mark_p->last_position);
+
+  context_p->byte_code_size = mark_p->byte_code_size;
+  context_p->status_flags = (context_p->status_flags & (uint32_t) ~PARSER_NO_END_LABEL) | mark_p->status_flags;
+#ifdef JERRY_ENABLE_LINE_INFO
+  context_p->last_line_info_line = mark_p->last_line_info_line;
+#endif /* JERRY_ENABLE_LINE_INFO */
+} /* parser_truncate_byte_code */
+
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
+
 /**
  * Set a branch to the current byte code position
  */
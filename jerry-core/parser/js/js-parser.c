@@ -811,7 +811,9 @@ parser_update_backward_branch (parser_mem_page_t *page_p, /**< current page */
  */
 static void
 parse_update_branches (parser_context_t *context_p, /**< context */
-                       uint8_t *byte_code_p) /**< byte code */
+                       uint8_t *byte_code_p, /**< byte code */
+                       uint16_t literal_one_byte_limit) /**< maximum value of a literal
+                                                         *   encoded in one byte */
 {
   parser_mem_page_t *page_p = context_p->byte_code.first_p;
   parser_mem_page_t *prev_page_p = NULL;
@@ -858,6 +860,17 @@ parse_update_branches (parser_context_t *context_p, /**< context */
       branch_argument_length = CBC_BRANCH_OFFSET_LENGTH (*bytes_p);
       bytes_p++;
 
+      /* The literal arguments of compare and branch opcodes precede the branch offset. */
+      if (flags & CBC_HAS_LITERAL_ARG)
+      {
+        bytes_p += (*bytes_p > literal_one_byte_limit) ? 2 : 1;
+
+        if (flags & CBC_HAS_LITERAL_ARG2)
+        {
+          bytes_p += (*bytes_p > literal_one_byte_limit) ? 2 : 1;
+        }
+      }
+
       /* Decoding target. */
       length = branch_argument_length;
       target_distance = 0;
@@ -1264,23 +1277,6 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
       JERRY_DEBUG_MSG (" %3d : %s", (int) cbc_offset, cbc_ext_names[ext_opcode]);
       byte_code_p += 2;
 
-#ifdef JERRY_ENABLE_LINE_INFO
-      if (ext_opcode == CBC_EXT_LINE)
-      {
-        uint32_t value = 0;
-        uint8_t byte;
-
-        do
-        {
-          byte = *byte_code_p++;
-          value = (value << 7) | (byte & CBC_LOWER_SEVEN_BIT_MASK);
-        }
-        while (byte & CBC_HIGHEST_BIT_MASK);
-
-        JERRY_DEBUG_MSG (" %d\n", (int) value);
-        continue;
-      }
-#endif /* JERRY_ENABLE_LINE_INFO */
     }
 
     if (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
@@ -1424,6 +1420,240 @@ parser_append_breakpoint_info (parser_context_t *context_p, /**< context */
     } \
   } while (0)
 
+/**
+ * Resolve the free identifiers of a function and its nested functions
+ * which are declared by an enclosing lexical environment.
+ *
+ * The free identifiers are stored in the scope info block. A resolved
+ * identifier has a slot index and a depth: the number of lexical
+ * environments between the lexical environment of the function call
+ * and the lexical environment which contains the slot. Unresolved
+ * identifiers have no slot index, and the depth is increased whenever
+ * an enclosing lexical environment does not declare them.
+ *
+ * Note:
+ *      literal strings are unique, so the names are compared by their values
+ */
+void
+parser_resolve_scope_info (ecma_compiled_code_t *compiled_code_p, /**< function byte code */
+                           const parser_scope_t *scope_p) /**< enclosing lexical environment */
+{
+  if (!(compiled_code_p->status_flags & CBC_CODE_FLAGS_FUNCTION)
+      || !(compiled_code_p->status_flags & CBC_CODE_FLAGS_SCOPE_INFO))
+  {
+    return;
+  }
+
+  ecma_value_t *literal_start_p;
+  uint32_t ident_end;
+  uint32_t const_literal_end;
+  uint32_t literal_end;
+
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) compiled_code_p;
+
+    literal_start_p = (ecma_value_t *) (args_p + 1);
+    literal_start_p -= args_p->register_end;
+    ident_end = args_p->ident_end;
+    const_literal_end = args_p->const_literal_end;
+    literal_end = args_p->literal_end;
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) compiled_code_p;
+
+    literal_start_p = (ecma_value_t *) (args_p + 1);
+    literal_start_p -= args_p->register_end;
+    ident_end = args_p->ident_end;
+    const_literal_end = args_p->const_literal_end;
+    literal_end = args_p->literal_end;
+  }
+
+  uint16_t *scope_info_end_p = (uint16_t *) ecma_compiled_code_get_scope_info_end (compiled_code_p);
+  uint32_t var_end = scope_info_end_p[-1];
+  uint16_t *binding_p = scope_info_end_p - 1 - (ident_end - var_end);
+
+  for (uint32_t i = var_end; i < ident_end; i++, binding_p++)
+  {
+    uint32_t binding = *binding_p;
+
+    if ((binding & CBC_SCOPE_INFO_SLOT_MASK) != CBC_SCOPE_INFO_NO_SLOT
+        || binding == CBC_SCOPE_INFO_DYNAMIC)
+    {
+      continue;
+    }
+
+    if (scope_p->is_dynamic || literal_start_p[i] == scope_p->hidden_name)
+    {
+      *binding_p = CBC_SCOPE_INFO_DYNAMIC;
+      continue;
+    }
+
+    uint32_t depth = binding >> CBC_SCOPE_INFO_DEPTH_SHIFT;
+    uint32_t slot;
+
+    for (slot = 0; slot < scope_p->var_count; slot++)
+    {
+      if (scope_p->var_names_p[slot] == literal_start_p[i])
+      {
+        break;
+      }
+    }
+
+    if (slot < scope_p->var_count)
+    {
+      /* Slot indices which cannot be encoded are looked up by name. */
+      binding = (depth << CBC_SCOPE_INFO_DEPTH_SHIFT) | slot;
+
+      if (slot >= CBC_SCOPE_INFO_NO_SLOT)
+      {
+        binding = CBC_SCOPE_INFO_DYNAMIC;
+      }
+    }
+    else
+    {
+      depth += scope_p->depth;
+      binding = (depth << CBC_SCOPE_INFO_DEPTH_SHIFT) | CBC_SCOPE_INFO_NO_SLOT;
+
+      if (depth > CBC_SCOPE_INFO_MAX_DEPTH)
+      {
+        binding = CBC_SCOPE_INFO_DYNAMIC;
+      }
+    }
+
+    *binding_p = (uint16_t) binding;
+  }
+
+  for (uint32_t i = const_literal_end; i < literal_end; i++)
+  {
+    parser_resolve_scope_info (ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t, literal_start_p[i]),
+                               scope_p);
+  }
+} /* parser_resolve_scope_info */
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Append a variable length integer to the line info table.
+ */
+static void
+parser_line_info_encode (parser_line_info_writer_t *writer_p, /**< line info writer */
+                         uint32_t value) /**< encoded value */
+{
+  uint32_t shift = 0;
+
+  while (shift < 28 && (value >> (shift + 7)) > 0)
+  {
+    shift += 7;
+  }
+
+  while (true)
+  {
+    uint8_t byte = (uint8_t) ((value >> shift) & CBC_LOWER_SEVEN_BIT_MASK);
+
+    if (shift > 0)
+    {
+      byte |= CBC_HIGHEST_BIT_MASK;
+    }
+
+    if (writer_p->buffer_p != NULL)
+    {
+      writer_p->buffer_p[writer_p->size] = byte;
+    }
+
+    writer_p->size++;
+
+    if (shift == 0)
+    {
+      return;
+    }
+
+    shift -= 7;
+  }
+} /* parser_line_info_encode */
+
+/**
+ * Append the pending entry to the line info table.
+ *
+ * Note:
+ *   entries which do not change the line are dropped
+ */
+static void
+parser_line_info_flush (parser_line_info_writer_t *writer_p) /**< line info writer */
+{
+  uint32_t line = writer_p->pending_line;
+
+  if (line == 0 || line == writer_p->last_line)
+  {
+    writer_p->pending_line = 0;
+    return;
+  }
+
+  parser_line_info_encode (writer_p, writer_p->pending_offset - writer_p->last_offset);
+
+  /* The line deltas are zigzag encoded. */
+  if (line > writer_p->last_line)
+  {
+    parser_line_info_encode (writer_p, (line - writer_p->last_line) << 1);
+  }
+  else
+  {
+    parser_line_info_encode (writer_p, ((writer_p->last_line - line) << 1) - 1);
+  }
+
+  writer_p->last_offset = writer_p->pending_offset;
+  writer_p->last_line = line;
+  writer_p->pending_line = 0;
+} /* parser_line_info_flush */
+
+/**
+ * Set the line of the instructions starting from a byte code offset.
+ */
+static void
+parser_line_info_append (parser_line_info_writer_t *writer_p, /**< line info writer */
+                         uint32_t offset, /**< byte code offset */
+                         uint32_t line) /**< line */
+{
+  /* Only the last line info is kept when no instructions are emitted between them. */
+  if (writer_p->pending_line != 0 && writer_p->pending_offset != offset)
+  {
+    parser_line_info_flush (writer_p);
+  }
+
+  writer_p->pending_offset = offset;
+  writer_p->pending_line = line;
+} /* parser_line_info_append */
+
+/**
+ * Decode the line of a line info byte code and move to the next byte code.
+ *
+ * @return line
+ */
+static uint32_t
+parser_line_info_decode (parser_mem_page_t **page_p, /**< [in, out] current page */
+                         size_t *offset_p) /**< [in, out] offset on the current page */
+{
+  parser_mem_page_t *current_page_p = *page_p;
+  size_t offset = *offset_p;
+  uint32_t line = 0;
+  uint8_t byte;
+
+  do
+  {
+    byte = current_page_p->bytes[offset];
+    line = (line << 7) | (byte & CBC_LOWER_SEVEN_BIT_MASK);
+    PARSER_NEXT_BYTE (current_page_p, offset);
+  }
+  while (byte & CBC_HIGHEST_BIT_MASK);
+
+  *page_p = current_page_p;
+  *offset_p = offset;
+  return line;
+} /* parser_line_info_decode */
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
 /**
  * Post processing main function.
  *
@@ -1444,6 +1674,7 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   size_t length;
   size_t literal_length;
   size_t total_size;
+  size_t scope_info_size = 0;
 #ifdef JERRY_ENABLE_SNAPSHOT_SAVE
   size_t total_size_used;
 #endif
@@ -1455,6 +1686,13 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   ecma_compiled_code_t *compiled_code_p;
   ecma_value_t *literal_pool_p;
   uint8_t *dst_p;
+#ifdef JERRY_ENABLE_LINE_INFO
+  parser_line_info_writer_t line_info_writer;
+  uint32_t line_info_size = 0;
+  ecma_value_t *resource_name_p = NULL;
+
+  memset (&line_info_writer, 0, sizeof (parser_line_info_writer_t));
+#endif /* JERRY_ENABLE_LINE_INFO */
 
   if ((size_t) context_p->stack_limit + (size_t) context_p->register_count > PARSER_MAXIMUM_STACK_LIMIT)
   {
@@ -1547,16 +1785,11 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 #ifdef JERRY_ENABLE_LINE_INFO
       if (ext_opcode == CBC_EXT_LINE)
       {
-        uint8_t last_byte = 0;
-
-        do
-        {
-          last_byte = page_p->bytes[offset];
-          PARSER_NEXT_BYTE (page_p, offset);
-          length++;
-        }
-        while (last_byte & CBC_HIGHEST_BIT_MASK);
+        /* Line info is moved into the line info table. */
+        length -= 2;
 
+        uint32_t line = parser_line_info_decode (&page_p, &offset);
+        parser_line_info_append (&line_info_writer, (uint32_t) length, line);
         continue;
       }
 #endif /* JERRY_ENABLE_LINE_INFO */
@@ -1609,13 +1842,14 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
       if (flags & CBC_HAS_LITERAL_ARG2)
       {
+        /* Other argument flags (e.g. branch argument) are kept. */
         if (flags & CBC_HAS_LITERAL_ARG)
         {
-          flags = CBC_HAS_LITERAL_ARG;
+          flags = (uint8_t) (flags & ~CBC_HAS_LITERAL_ARG2);
         }
         else
         {
-          flags = CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2;
+          flags = (uint8_t) (flags | CBC_HAS_LITERAL_ARG);
         }
       }
       else
@@ -1705,6 +1939,22 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
   total_size += literal_length + length;
 
+  if (context_p->status_flags & PARSER_IS_FUNCTION)
+  {
+    scope_info_size = CBC_SCOPE_INFO_SIZE (ident_end - initialized_var_end);
+
+#ifdef JERRY_DEBUGGER
+    if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED)
+    {
+      /* The debugger lists the variables of the lexical environments by
+       * their properties, and its eval operations may declare variables. */
+      scope_info_size = 0;
+    }
+#endif /* JERRY_DEBUGGER */
+
+    total_size += scope_info_size;
+  }
+
   if ((context_p->status_flags & PARSER_ARGUMENTS_NEEDED)
       && !(context_p->status_flags & PARSER_IS_STRICT))
   {
@@ -1714,7 +1964,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 #ifdef JERRY_ENABLE_LINE_INFO
   if (JERRY_CONTEXT (resource_name) != ECMA_VALUE_UNDEFINED)
   {
-    total_size += sizeof (ecma_value_t);
+    parser_line_info_flush (&line_info_writer);
+    line_info_size = line_info_writer.size;
+    total_size += CBC_LINE_INFO_SIZE (line_info_size);
   }
 #endif /* JERRY_ENABLE_LINE_INFO */
 
@@ -1775,6 +2027,11 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_FULL_LITERAL_ENCODING;
   }
 
+  if (scope_info_size > 0)
+  {
+    compiled_code_p->status_flags |= CBC_CODE_FLAGS_SCOPE_INFO;
+  }
+
   if (context_p->status_flags & PARSER_IS_STRICT)
   {
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_STRICT_MODE;
@@ -1807,6 +2064,30 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   }
 #endif /* !CONFIG_DISABLE_ES2015_CLASS */
 
+#ifdef JERRY_ENABLE_LINE_INFO
+  if (JERRY_CONTEXT (resource_name) != ECMA_VALUE_UNDEFINED)
+  {
+    compiled_code_p->status_flags |= CBC_CODE_FLAGS_LINE_INFO;
+
+    resource_name_p = (ecma_value_t *) (((uint8_t *) compiled_code_p) + total_size);
+
+    if ((context_p->status_flags & PARSER_ARGUMENTS_NEEDED)
+        && !(context_p->status_flags & PARSER_IS_STRICT))
+    {
+      resource_name_p -= context_p->argument_count;
+    }
+
+    resource_name_p = (ecma_value_t *) (((uint8_t *) resource_name_p) - scope_info_size) - 1;
+
+    /* The table is generated again during the copy. */
+    uint8_t *line_info_p = ((uint8_t *) (resource_name_p + 1)) - CBC_LINE_INFO_SIZE (line_info_size);
+    memset (line_info_p, 0, JERRY_ALIGNUP (line_info_size, sizeof (ecma_value_t)));
+
+    memset (&line_info_writer, 0, sizeof (parser_line_info_writer_t));
+    line_info_writer.buffer_p = line_info_p;
+  }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
   literal_pool_p = (ecma_value_t *) byte_code_p;
   literal_pool_p -= context_p->register_count;
   byte_code_p += literal_length;
@@ -1837,6 +2118,31 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     opcode = (cbc_opcode_t) (*branch_mark_p);
     branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
 
+#ifdef JERRY_ENABLE_LINE_INFO
+    if (opcode == CBC_EXT_OPCODE)
+    {
+      parser_mem_page_t *ext_page_p = page_p;
+      size_t ext_offset = offset;
+
+      PARSER_NEXT_BYTE (ext_page_p, ext_offset);
+
+      if (ext_page_p->bytes[ext_offset] == CBC_EXT_LINE)
+      {
+        /* These opcodes are moved into the line info table. */
+        PARSER_NEXT_BYTE (ext_page_p, ext_offset);
+
+        uint32_t line = parser_line_info_decode (&ext_page_p, &ext_offset);
+        parser_line_info_append (&line_info_writer, (uint32_t) (dst_p - byte_code_p), line);
+
+        while (page_p != ext_page_p || offset != ext_offset)
+        {
+          PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
+        }
+        continue;
+      }
+    }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
     if (opcode == CBC_JUMP_FORWARD)
     {
       /* These opcodes are deleted from the stream. */
@@ -1882,25 +2188,6 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       opcode_p++;
       real_offset++;
       PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
-
-#ifdef JERRY_ENABLE_LINE_INFO
-      if (ext_opcode == CBC_EXT_LINE)
-      {
-        uint8_t last_byte = 0;
-
-        do
-        {
-          last_byte = page_p->bytes[offset];
-          *dst_p++ = last_byte;
-
-          real_offset++;
-          PARSER_NEXT_BYTE_UPDATE (page_p, offset, real_offset);
-        }
-        while (last_byte & CBC_HIGHEST_BIT_MASK);
-
-        continue;
-      }
-#endif /* JERRY_ENABLE_LINE_INFO */
     }
 
     if (flags & CBC_HAS_BRANCH_ARG)
@@ -1908,9 +2195,10 @@ parser_post_processing (parser_context_t *context_p) /**< context */
       *branch_mark_p |= CBC_HIGHEST_BIT_MASK;
     }
 
-    /* Only literal and call arguments can be combined. */
+    /* Only literal and call arguments can be combined with each other,
+     * and only literal arguments can be combined with branch arguments. */
     JERRY_ASSERT (!(flags & CBC_HAS_BRANCH_ARG)
-                   || !(flags & (CBC_HAS_BYTE_ARG | CBC_HAS_LITERAL_ARG)));
+                   || !(flags & CBC_HAS_BYTE_ARG));
 
     while (flags & (CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2))
     {
@@ -1929,13 +2217,14 @@ parser_post_processing (parser_context_t *context_p) /**< context */
 
       if (flags & CBC_HAS_LITERAL_ARG2)
       {
+        /* Other argument flags (e.g. branch argument) are kept. */
         if (flags & CBC_HAS_LITERAL_ARG)
         {
-          flags = CBC_HAS_LITERAL_ARG;
+          flags = (uint8_t) (flags & ~CBC_HAS_LITERAL_ARG2);
         }
         else
         {
-          flags = CBC_HAS_LITERAL_ARG | CBC_HAS_LITERAL_ARG2;
+          flags = (uint8_t) (flags | CBC_HAS_LITERAL_ARG);
         }
       }
       else
@@ -1999,7 +2288,8 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   JERRY_ASSERT (dst_p == byte_code_p + length);
 
   parse_update_branches (context_p,
-                         byte_code_p + initializers_length);
+                         byte_code_p + initializers_length,
+                         literal_one_byte_limit);
 
   parser_cbc_stream_free (&context_p->byte_code);
 
@@ -2093,18 +2383,45 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     }
   }
 
-#ifdef JERRY_ENABLE_LINE_INFO
-  if (JERRY_CONTEXT (resource_name) != ECMA_VALUE_UNDEFINED)
+  if (scope_info_size > 0)
   {
-    ecma_value_t *resource_name_p = (ecma_value_t *) (((uint8_t *) compiled_code_p) + total_size);
+    uint16_t *scope_info_end_p = (uint16_t *) ecma_compiled_code_get_scope_info_end (compiled_code_p);
+    uint16_t *binding_p = scope_info_end_p - 1 - (ident_end - initialized_var_end);
 
-    if ((context_p->status_flags & PARSER_ARGUMENTS_NEEDED)
-        && !(context_p->status_flags & PARSER_IS_STRICT))
+    scope_info_end_p[-1] = initialized_var_end;
+
+    while (binding_p < scope_info_end_p - 1)
     {
-      resource_name_p -= context_p->argument_count;
+      *binding_p++ = CBC_SCOPE_INFO_NO_SLOT;
+    }
+
+    /* The free identifiers of this function and its nested functions are resolved
+     * to the variables of this function. The nested functions are already resolved
+     * to the lexical environments created by this function (e.g. with statements). */
+    parser_scope_t scope;
+
+    scope.var_names_p = literal_pool_p + context_p->register_count;
+    scope.var_count = (uint32_t) (initialized_var_end - context_p->register_count);
+    scope.hidden_name = ECMA_VALUE_EMPTY;
+    scope.depth = (context_p->status_flags & PARSER_LEXICAL_ENV_NEEDED) ? 1 : 0;
+    scope.is_dynamic = (context_p->status_flags & PARSER_HAS_DIRECT_EVAL) != 0;
+
+    if (context_p->status_flags & PARSER_ARGUMENTS_NEEDED)
+    {
+      scope.hidden_name = ecma_make_magic_string_value (LIT_MAGIC_STRING_ARGUMENTS);
     }
 
-    resource_name_p[-1] = JERRY_CONTEXT (resource_name);
+    parser_resolve_scope_info (compiled_code_p, &scope);
+  }
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  if (resource_name_p != NULL)
+  {
+    parser_line_info_flush (&line_info_writer);
+    JERRY_ASSERT (line_info_writer.size == line_info_size);
+
+    ((uint32_t *) resource_name_p)[-1] = line_info_size;
+    *resource_name_p = JERRY_CONTEXT (resource_name);
   }
 #endif /* JERRY_ENABLE_LINE_INFO */
 
@@ -2340,6 +2657,9 @@ parser_parse_source (const uint8_t *arg_list_p, /**< function argument list */
   context.column = 1;
 
   context.last_cbc_opcode = PARSER_CBC_UNAVAILABLE;
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  context.folded_literal_index = PARSER_MAXIMUM_NUMBER_OF_LITERALS;
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
 
   context.argument_count = 0;
   context.register_count = 0;
@@ -2514,6 +2834,9 @@ parser_save_context (parser_context_t *context_p, /**< context */
   parser_cbc_stream_init (&context_p->byte_code);
   context_p->byte_code_size = 0;
   parser_list_reset (&context_p->literal_pool);
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  context_p->folded_literal_index = PARSER_MAXIMUM_NUMBER_OF_LITERALS;
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
 
 #ifndef JERRY_NDEBUG
   context_p->context_stack_depth = 0;
@@ -2546,6 +2869,9 @@ parser_restore_context (parser_context_t *context_p, /**< context */
   context_p->byte_code = saved_context_p->byte_code;
   context_p->byte_code_size = saved_context_p->byte_code_size;
   context_p->literal_pool.data = saved_context_p->literal_pool_data;
+#ifndef JERRY_DISABLE_PARSER_PEEPHOLE
+  context_p->folded_literal_index = PARSER_MAXIMUM_NUMBER_OF_LITERALS;
+#endif /* !JERRY_DISABLE_PARSER_PEEPHOLE */
 
 #ifndef JERRY_NDEBUG
   context_p->context_stack_depth = saved_context_p->context_stack_depth;
@@ -31,9 +31,14 @@
  */
 
 /**
-  * Size of the RegExp bytecode cache
+  * Maximum number of bytecodes in the RegExp bytecode cache
   */
-#define RE_CACHE_SIZE 8u
+#define RE_CACHE_SIZE ((uint32_t) CONFIG_REGEXP_CACHE_SIZE)
+
+/**
+  * Number of slots of the hash table of the RegExp bytecode cache
+  */
+#define RE_CACHE_TABLE_SIZE (2 * RE_CACHE_SIZE)
 
 /**
   * RegExp flags mask (first 10 bits are for reference count and the rest for the actual RegExp flags)
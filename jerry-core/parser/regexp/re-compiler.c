@@ -472,64 +472,184 @@ re_parse_alternative (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context
   return ret_value;
 } /* re_parse_alternative */
 
+JERRY_STATIC_ASSERT ((RE_CACHE_SIZE & (RE_CACHE_SIZE - 1)) == 0 && RE_CACHE_SIZE > 0,
+                     regexp_cache_size_must_be_a_power_of_2);
+
+/**
+ * Get the slot of the RegExp cache where the search for a pattern starts.
+ *
+ * @return slot index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+re_cache_get_index (const ecma_string_t *pattern_str_p, /**< pattern string */
+                    uint16_t flags) /**< flags */
+{
+  return ((uint32_t) ecma_string_hash (pattern_str_p) + (uint32_t) flags * 31u) & (RE_CACHE_TABLE_SIZE - 1);
+} /* re_cache_get_index */
+
 /**
  * Search for the given pattern in the RegExp cache
  *
- * @return index of bytecode in cache - if found
- *         RE_CACHE_SIZE              - otherwise
+ * Note:
+ *      the cache is an open addressing hash table which is at most half full,
+ *      so the search always ends at a slot which holds the pattern or a free slot
+ *
+ * @return index of the slot of the pattern - if found
+ *         index of a free slot             - otherwise
  */
-static uint8_t
-re_find_bytecode_in_cache (ecma_string_t *pattern_str_p, /**< pattern string */
-                           uint16_t flags) /**< flags */
+static uint32_t
+re_cache_find (ecma_string_t *pattern_str_p, /**< pattern string */
+               uint16_t flags) /**< flags */
 {
-  uint8_t free_idx = RE_CACHE_SIZE;
+  uint32_t idx = re_cache_get_index (pattern_str_p, flags);
 
-  for (uint8_t idx = 0u; idx < RE_CACHE_SIZE; idx++)
+  while (true)
   {
     const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[idx];
 
-    if (cached_bytecode_p != NULL)
+    if (cached_bytecode_p == NULL
+        || ((cached_bytecode_p->header.status_flags & RE_FLAGS_MASK) == flags
+            && ecma_compare_ecma_strings (ecma_get_string_from_value (cached_bytecode_p->pattern), pattern_str_p)))
     {
-      ecma_string_t *cached_pattern_str_p = ecma_get_string_from_value (cached_bytecode_p->pattern);
+      return idx;
+    }
+
+    idx = (idx + 1) & (RE_CACHE_TABLE_SIZE - 1);
+  }
+} /* re_cache_find */
 
-      if ((cached_bytecode_p->header.status_flags & RE_FLAGS_MASK) == flags
-          && ecma_compare_ecma_strings (cached_pattern_str_p, pattern_str_p))
+/**
+ * Mark an entry of the RegExp cache as the most recently used one.
+ */
+static void
+re_cache_touch (uint32_t idx) /**< slot index */
+{
+  if (JERRY_UNLIKELY (++JERRY_CONTEXT (re_cache_clock) == 0))
+  {
+    /* The order of the entries is forgotten when the clock overflows. */
+    memset (JERRY_CONTEXT (re_cache_last_used), 0, sizeof (JERRY_CONTEXT (re_cache_last_used)));
+    JERRY_CONTEXT (re_cache_clock) = 1;
+  }
+
+  JERRY_CONTEXT (re_cache_last_used)[idx] = JERRY_CONTEXT (re_cache_clock);
+} /* re_cache_touch */
+
+/**
+ * Remove an entry from the RegExp cache, and move the following entries
+ * of its cluster to the slots where they are found by re_cache_find.
+ */
+static void
+re_cache_remove (uint32_t idx) /**< slot index */
+{
+  ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[idx]);
+  JERRY_CONTEXT (re_cache)[idx] = NULL;
+  JERRY_CONTEXT (re_cache_count)--;
+
+  idx = (idx + 1) & (RE_CACHE_TABLE_SIZE - 1);
+
+  while (JERRY_CONTEXT (re_cache)[idx] != NULL)
+  {
+    const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[idx];
+    uint32_t last_used = JERRY_CONTEXT (re_cache_last_used)[idx];
+
+    JERRY_CONTEXT (re_cache)[idx] = NULL;
+
+    uint32_t new_idx = re_cache_find (ecma_get_string_from_value (cached_bytecode_p->pattern),
+                                      (uint16_t) (cached_bytecode_p->header.status_flags & RE_FLAGS_MASK));
+
+    JERRY_CONTEXT (re_cache)[new_idx] = cached_bytecode_p;
+    JERRY_CONTEXT (re_cache_last_used)[new_idx] = last_used;
+
+    idx = (idx + 1) & (RE_CACHE_TABLE_SIZE - 1);
+  }
+} /* re_cache_remove */
+
+/**
+ * Insert a bytecode into the RegExp cache, and evict the least recently used entry when the cache is full.
+ */
+static void
+re_cache_insert (const re_compiled_code_t *bytecode_p, /**< bytecode */
+                 ecma_string_t *pattern_str_p, /**< pattern string */
+                 uint16_t flags) /**< flags */
+{
+  if (JERRY_CONTEXT (re_cache_count) >= RE_CACHE_SIZE)
+  {
+    uint32_t lru_idx = 0;
+    uint32_t lru_age = 0;
+
+    for (uint32_t i = 0; i < RE_CACHE_TABLE_SIZE; i++)
+    {
+      uint32_t age = JERRY_CONTEXT (re_cache_clock) - JERRY_CONTEXT (re_cache_last_used)[i];
+
+      if (JERRY_CONTEXT (re_cache)[i] != NULL && age >= lru_age)
       {
-        JERRY_TRACE_MSG ("RegExp is found in cache\n");
-        return idx;
+        lru_idx = i;
+        lru_age = age;
       }
     }
-    else
-    {
-      /* mark as free, so it can be overridden if the cache is full */
-      free_idx = idx;
-    }
+
+    JERRY_TRACE_MSG ("RegExp cache is full! Remove the element on idx: %d\n", (int) lru_idx);
+    re_cache_remove (lru_idx);
   }
 
-  JERRY_TRACE_MSG ("RegExp is NOT found in cache\n");
-  return free_idx;
-} /* re_find_bytecode_in_cache */
+  /* The garbage collector might run during the byte code allocations
+   * and the entries may be removed, so the slot is searched again. */
+  uint32_t idx = re_cache_find (pattern_str_p, flags);
+  JERRY_ASSERT (JERRY_CONTEXT (re_cache)[idx] == NULL);
+
+  JERRY_TRACE_MSG ("Insert bytecode into RegExp cache (idx: %d).\n", (int) idx);
+  ecma_bytecode_ref ((ecma_compiled_code_t *) bytecode_p);
+  JERRY_CONTEXT (re_cache)[idx] = bytecode_p;
+  JERRY_CONTEXT (re_cache_count)++;
+  re_cache_touch (idx);
+} /* re_cache_insert */
 
 /**
  * Run gerbage collection in RegExp cache
+ *
+ * Note:
+ *      the bytecodes which are referenced only by the cache are freed
  */
 void
 re_cache_gc_run (void)
 {
-  for (uint32_t i = 0u; i < RE_CACHE_SIZE; i++)
+  uint32_t i = 0;
+
+  while (i < RE_CACHE_TABLE_SIZE)
   {
     const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[i];
 
     if (cached_bytecode_p != NULL
         && cached_bytecode_p->header.refs == 1)
     {
-      /* Only the cache has reference for the bytecode */
-      ecma_bytecode_deref ((ecma_compiled_code_t *) cached_bytecode_p);
-      JERRY_CONTEXT (re_cache)[i] = NULL;
+      /* Only the cache has reference for the bytecode. Another
+       * entry may be moved into this slot, so it is checked again. */
+      re_cache_remove (i);
+      continue;
     }
+
+    i++;
   }
 } /* re_cache_gc_run */
 
+/**
+ * Free all entries of the RegExp cache.
+ */
+void
+re_cache_clear (void)
+{
+  for (uint32_t i = 0; i < RE_CACHE_TABLE_SIZE; i++)
+  {
+    if (JERRY_CONTEXT (re_cache)[i] != NULL)
+    {
+      ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[i]);
+      JERRY_CONTEXT (re_cache)[i] = NULL;
+    }
+  }
+
+  JERRY_CONTEXT (re_cache_count) = 0;
+} /* re_cache_clear */
+
 /**
  * Compilation of RegExp bytecode
  *
@@ -544,17 +664,20 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
                      uint16_t flags) /**< flags */
 {
   ecma_value_t ret_value = ECMA_VALUE_EMPTY;
-  uint8_t cache_idx = re_find_bytecode_in_cache (pattern_str_p, flags);
+  uint32_t cache_idx = re_cache_find (pattern_str_p, flags);
+  const re_compiled_code_t *cached_bytecode_p = JERRY_CONTEXT (re_cache)[cache_idx];
 
-  if (cache_idx < RE_CACHE_SIZE)
-  {
-    *out_bytecode_p = JERRY_CONTEXT (re_cache)[cache_idx];
+#ifdef JMEM_STATS
+  jmem_stats_regexp_cache_lookup (cached_bytecode_p != NULL);
+#endif /* JMEM_STATS */
 
-    if (*out_bytecode_p != NULL)
-    {
-      ecma_bytecode_ref ((ecma_compiled_code_t *) *out_bytecode_p);
-      return ret_value;
-    }
+  if (cached_bytecode_p != NULL)
+  {
+    JERRY_TRACE_MSG ("RegExp is found in cache\n");
+    re_cache_touch (cache_idx);
+    ecma_bytecode_ref ((ecma_compiled_code_t *) cached_bytecode_p);
+    *out_bytecode_p = cached_bytecode_p;
+    return ret_value;
   }
 
   /* not in the RegExp cache, so compile it */
@@ -642,28 +765,7 @@ re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, /**< [out] point
 
     ((re_compiled_code_t *) bc_ctx.block_start_p)->header.size = (uint16_t) (byte_code_size >> JMEM_ALIGNMENT_LOG);
 
-    if (cache_idx == RE_CACHE_SIZE)
-    {
-      if (JERRY_CONTEXT (re_cache_idx) == RE_CACHE_SIZE)
-      {
-        JERRY_CONTEXT (re_cache_idx) = 0;
-      }
-
-      JERRY_TRACE_MSG ("RegExp cache is full! Remove the element on idx: %d\n", JERRY_CONTEXT (re_cache_idx));
-
-      cache_idx = JERRY_CONTEXT (re_cache_idx)++;
-
-      /* The garbage collector might run during the byte code
-       * allocations above and it may free this entry. */
-      if (JERRY_CONTEXT (re_cache)[cache_idx] != NULL)
-      {
-        ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[cache_idx]);
-      }
-    }
-
-    JERRY_TRACE_MSG ("Insert bytecode into RegExp cache (idx: %d).\n", cache_idx);
-    ecma_bytecode_ref ((ecma_compiled_code_t *) *out_bytecode_p);
-    JERRY_CONTEXT (re_cache)[cache_idx] = *out_bytecode_p;
+    re_cache_insert (*out_bytecode_p, pattern_str_p, flags);
   }
 
   return ret_value;
@@ -53,6 +53,7 @@ ecma_value_t
 re_compile_bytecode (const re_compiled_code_t **out_bytecode_p, ecma_string_t *pattern_str_p, uint16_t flags);
 
 void re_cache_gc_run (void);
+void re_cache_clear (void);
 
 /**
  * @}
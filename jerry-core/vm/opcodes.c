@@ -220,19 +220,18 @@ vm_op_delete_var (ecma_value_t name_literal, /**< name literal */
  * See also:
  *          ECMA-262 v5, 12.6.4
  *
- * @return chain list of property names
+ * @return collection of property names - if the object has enumerable properties,
+ *         NULL - otherwise
  */
-ecma_collection_chunk_t *
+ecma_collection_header_t *
 opfunc_for_in (ecma_value_t left_value, /**< left value */
                ecma_value_t *result_obj_p) /**< expression object */
 {
-  ecma_collection_chunk_t *prop_names_p = NULL;
-
   /* 3. */
   if (ecma_is_value_undefined (left_value)
       || ecma_is_value_null (left_value))
   {
-    return prop_names_p;
+    return NULL;
   }
 
   /* 4. */
@@ -240,19 +239,19 @@ opfunc_for_in (ecma_value_t left_value, /**< left value */
   /* ecma_op_to_object will only raise error on null/undefined values but those are handled above. */
   JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (obj_expr_value));
   ecma_object_t *obj_p = ecma_get_object_from_value (obj_expr_value);
-  ecma_collection_header_t *prop_names_coll_p;
-  prop_names_coll_p = ecma_op_object_get_property_names (obj_p, ECMA_LIST_ENUMERABLE_PROTOTYPE);
+  ecma_collection_header_t *prop_names_p = ecma_op_object_get_property_names (obj_p, ECMA_LIST_ENUMERABLE_PROTOTYPE);
 
-  if (prop_names_coll_p->item_count != 0)
+  if (prop_names_p->item_count != 0)
   {
-    prop_names_p = ECMA_GET_POINTER (ecma_collection_chunk_t,
-                                     prop_names_coll_p->first_chunk_cp);
-
     ecma_ref_object (obj_p);
     *result_obj_p = ecma_make_object_value (obj_p);
   }
+  else
+  {
+    ecma_free_values_collection (prop_names_p, 0);
+    prop_names_p = NULL;
+  }
 
-  jmem_heap_free_block (prop_names_coll_p, sizeof (ecma_collection_header_t));
   ecma_free_value (obj_expr_value);
 
   return prop_names_p;
@@ -52,14 +52,27 @@ typedef struct vm_frame_ctx_t
   ecma_value_t *stack_top_p;                          /**< stack top pointer */
   ecma_value_t *literal_start_p;                      /**< literal list start pointer */
   ecma_object_t *lex_env_p;                           /**< current lexical environment */
+  ecma_object_t *scope_base_p;                        /**< lexical environment of the function call which
+                                                       *   is the base of the scope info (NULL if the byte
+                                                       *   code has no scope info) */
+  ecma_value_t *slots_p;                              /**< variable slots of the function call (NULL if
+                                                       *   the variables are not stored in slots) */
+  const uint16_t *scope_info_p;                       /**< scope info entries indexed by literal index */
   struct vm_frame_ctx_t *prev_context_p;              /**< previous context */
   ecma_value_t this_binding;                          /**< this binding */
   ecma_value_t block_result;                          /**< block result */
 #ifdef JERRY_ENABLE_LINE_INFO
   ecma_value_t resource_name;                         /**< current resource name (usually a file name) */
-  uint32_t current_line;                              /**< currently executed line */
 #endif /* JERRY_ENABLE_LINE_INFO */
+#ifdef JERRY_VM_STATS
+  struct vm_stats_function_t *stats_p;                /**< execution statistics of the byte code */
+#endif /* JERRY_VM_STATS */
+#if defined (JERRY_ENABLE_LINE_INFO) || defined (JMEM_ALLOC_SITES)
+  const uint8_t *current_byte_code_p;                 /**< currently executed instruction (its line is
+                                                       *   looked up in the line info table on demand) */
+#endif /* JERRY_ENABLE_LINE_INFO || JMEM_ALLOC_SITES */
   uint16_t context_depth;                             /**< current context depth */
+  uint16_t var_end;                                   /**< end of the variable group of the literals */
   uint8_t is_eval_code;                               /**< eval mode flag */
   uint8_t call_operation;                             /**< perform a call or construct operation */
 } vm_frame_ctx_t;
@@ -0,0 +1,328 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "jmem.h"
+#include "lit-char-helpers.h"
+#include "vm.h"
+#include "vm-profiler.h"
+
+#ifdef JERRY_PROFILER
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup profiler Sampling profiler
+ * @{
+ */
+
+/**
+ * Get the frames of a collected stack.
+ */
+#define VM_PROFILER_GET_FRAMES(stack_p) ((vm_profiler_frame_t *) ((stack_p) + 1))
+
+/**
+ * Compute the allocation size of a collected stack.
+ */
+#define VM_PROFILER_STACK_SIZE(depth) (sizeof (vm_profiler_stack_t) + (depth) * sizeof (vm_profiler_frame_t))
+
+/**
+ * Compare two recorded frames.
+ *
+ * @return true - if the frames are equal,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_profiler_frames_are_equal (const vm_profiler_frame_t *left_p, /**< left frame */
+                              const vm_profiler_frame_t *right_p) /**< right frame */
+{
+#ifdef JERRY_ENABLE_LINE_INFO
+  return (left_p->resource_name == right_p->resource_name
+          && left_p->line == right_p->line);
+#else /* !JERRY_ENABLE_LINE_INFO */
+  return (left_p->bytecode_id == right_p->bytecode_id
+          && left_p->offset == right_p->offset);
+#endif /* JERRY_ENABLE_LINE_INFO */
+} /* vm_profiler_frames_are_equal */
+
+/**
+ * Record a sample of the currently executed call stack.
+ *
+ * Called by the byte code interpreter when the sample countdown reaches zero.
+ * Samples are aggregated by their call stacks, so memory is only needed for
+ * each unique stack. Samples are dropped (and counted) when there is not
+ * enough memory to store a new stack.
+ */
+void JERRY_ATTR_NOINLINE
+vm_profiler_sample (const vm_frame_ctx_t *frame_ctx_p, /**< currently executed frame */
+                    const uint8_t *byte_code_p) /**< currently executed instruction */
+{
+  if (!JERRY_CONTEXT (profiler_is_running))
+  {
+    JERRY_CONTEXT (profiler_countdown) = VM_PROFILER_NO_INTERVAL;
+    return;
+  }
+
+  JERRY_CONTEXT (profiler_countdown) = JERRY_CONTEXT (profiler_interval);
+
+  vm_profiler_frame_t frames[JERRY_PROFILER_MAX_DEPTH];
+  uint32_t depth = 0;
+  uint32_t hash = 0;
+  bool is_truncated = false;
+
+  while (frame_ctx_p != NULL)
+  {
+#ifdef JERRY_ENABLE_LINE_INFO
+    /* Frames without resource name are skipped, similar to backtraces. */
+    if (frame_ctx_p->resource_name == ECMA_VALUE_UNDEFINED)
+    {
+      frame_ctx_p = frame_ctx_p->prev_context_p;
+      continue;
+    }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+    if (depth >= JERRY_PROFILER_MAX_DEPTH)
+    {
+      is_truncated = true;
+      break;
+    }
+
+    vm_profiler_frame_t *frame_p = frames + depth;
+
+#ifdef JERRY_ENABLE_LINE_INFO
+    /* The line info is used instead of the byte offset. */
+    const uint8_t *position_p = (depth == 0) ? byte_code_p : frame_ctx_p->current_byte_code_p;
+    uint32_t offset = (uint32_t) (position_p - frame_ctx_p->byte_code_start_p);
+
+    frame_p->resource_name = frame_ctx_p->resource_name;
+    frame_p->line = ecma_compiled_code_get_line (frame_ctx_p->bytecode_header_p, offset);
+    hash = (hash * 31) + frame_p->resource_name;
+    hash = (hash * 31) + frame_p->line;
+#else /* !JERRY_ENABLE_LINE_INFO */
+    const uint8_t *position_p = (depth == 0) ? byte_code_p : frame_ctx_p->byte_code_p;
+
+    frame_p->bytecode_id = (uintptr_t) frame_ctx_p->bytecode_header_p;
+    frame_p->offset = (uint32_t) (position_p - frame_ctx_p->byte_code_start_p);
+    hash = (hash * 31) + (uint32_t) frame_p->bytecode_id;
+    hash = (hash * 31) + frame_p->offset;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+    depth++;
+    frame_ctx_p = frame_ctx_p->prev_context_p;
+  }
+
+  vm_profiler_stack_t **bucket_p = JERRY_CONTEXT (profiler_stacks) + (hash & (VM_PROFILER_HASH_SIZE - 1));
+  vm_profiler_stack_t *stack_p = *bucket_p;
+
+  while (stack_p != NULL)
+  {
+    if (stack_p->hash == hash
+        && stack_p->depth == depth
+        && stack_p->is_truncated == is_truncated)
+    {
+      vm_profiler_frame_t *stack_frames_p = VM_PROFILER_GET_FRAMES (stack_p);
+      uint32_t i = 0;
+
+      while (i < depth && vm_profiler_frames_are_equal (stack_frames_p + i, frames + i))
+      {
+        i++;
+      }
+
+      if (i == depth)
+      {
+        stack_p->count++;
+        return;
+      }
+    }
+
+    stack_p = stack_p->next_p;
+  }
+
+  stack_p = (vm_profiler_stack_t *) jmem_heap_alloc_block_null_on_error (VM_PROFILER_STACK_SIZE (depth));
+
+  if (stack_p == NULL)
+  {
+    JERRY_CONTEXT (profiler_dropped_samples)++;
+    return;
+  }
+
+  stack_p->hash = hash;
+  stack_p->count = 1;
+  stack_p->depth = (uint16_t) depth;
+  stack_p->is_truncated = is_truncated;
+
+  vm_profiler_frame_t *stack_frames_p = VM_PROFILER_GET_FRAMES (stack_p);
+
+  for (uint32_t i = 0; i < depth; i++)
+  {
+    stack_frames_p[i] = frames[i];
+#ifdef JERRY_ENABLE_LINE_INFO
+    ecma_ref_ecma_string (ecma_get_string_from_value (frames[i].resource_name));
+#endif /* JERRY_ENABLE_LINE_INFO */
+  }
+
+  stack_p->next_p = *bucket_p;
+  *bucket_p = stack_p;
+} /* vm_profiler_sample */
+
+/**
+ * Free all collected stacks.
+ */
+void
+vm_profiler_free_stacks (void)
+{
+  for (uint32_t i = 0; i < VM_PROFILER_HASH_SIZE; i++)
+  {
+    vm_profiler_stack_t *stack_p = JERRY_CONTEXT (profiler_stacks)[i];
+
+    while (stack_p != NULL)
+    {
+      vm_profiler_stack_t *next_p = stack_p->next_p;
+
+#ifdef JERRY_ENABLE_LINE_INFO
+      vm_profiler_frame_t *stack_frames_p = VM_PROFILER_GET_FRAMES (stack_p);
+
+      for (uint32_t j = 0; j < stack_p->depth; j++)
+      {
+        ecma_deref_ecma_string (ecma_get_string_from_value (stack_frames_p[j].resource_name));
+      }
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+      jmem_heap_free_block (stack_p, VM_PROFILER_STACK_SIZE (stack_p->depth));
+      stack_p = next_p;
+    }
+
+    JERRY_CONTEXT (profiler_stacks)[i] = NULL;
+  }
+
+  JERRY_CONTEXT (profiler_dropped_samples) = 0;
+} /* vm_profiler_free_stacks */
+
+/**
+ * Append the name of a recorded frame to the output.
+ *
+ * The name is "resource:line" when line info is available, and
+ * "0x<byte code address>:<byte offset>" otherwise.
+ */
+static void
+vm_profiler_append_frame (vm_output_t *output_p, /**< output */
+                          const vm_profiler_frame_t *frame_p) /**< recorded frame */
+{
+#ifdef JERRY_ENABLE_LINE_INFO
+  ecma_string_t *resource_name_p = ecma_get_string_from_value (frame_p->resource_name);
+
+  if (ecma_string_is_empty (resource_name_p))
+  {
+    vm_output_append_ascii (output_p, "<unknown>");
+  }
+  else
+  {
+    ECMA_STRING_TO_UTF8_STRING (resource_name_p, resource_name_chars_p, resource_name_size);
+
+    /* Separators of the collapsed stack format are replaced. */
+    for (lit_utf8_size_t i = 0; i < resource_name_size; i++)
+    {
+      lit_utf8_byte_t chr = resource_name_chars_p[i];
+
+      if (chr == LIT_CHAR_SEMICOLON || chr == LIT_CHAR_LF || chr == LIT_CHAR_CR)
+      {
+        chr = (lit_utf8_byte_t) LIT_CHAR_UNDERSCORE;
+      }
+
+      vm_output_append (output_p, &chr, 1);
+    }
+
+    ECMA_FINALIZE_UTF8_STRING (resource_name_chars_p, resource_name_size);
+  }
+
+  vm_output_append_ascii (output_p, ":");
+  vm_output_append_uint (output_p, frame_p->line);
+#else /* !JERRY_ENABLE_LINE_INFO */
+  vm_output_append_address (output_p, frame_p->bytecode_id);
+  vm_output_append_ascii (output_p, ":");
+  vm_output_append_uint (output_p, frame_p->offset);
+#endif /* JERRY_ENABLE_LINE_INFO */
+} /* vm_profiler_append_frame */
+
+/**
+ * Print the collected stacks in collapsed stack format: each line contains
+ * the frames of a stack separated by semicolons, starting with the outermost
+ * frame, followed by a space and the number of samples. Stacks deeper than
+ * JERRY_PROFILER_MAX_DEPTH start with a "[truncated]" frame, and samples
+ * dropped because of memory shortage are reported as a "[dropped]" stack.
+ *
+ * @return length of the whole output - if it is greater than buffer_size,
+ *         the output is truncated
+ */
+size_t
+vm_profiler_get_collapsed_stacks (lit_utf8_byte_t *buffer_p, /**< [out] output buffer */
+                                  size_t buffer_size) /**< size of the output buffer */
+{
+  vm_output_t output;
+  vm_output_init (&output, buffer_p, buffer_size);
+
+  for (uint32_t i = 0; i < VM_PROFILER_HASH_SIZE; i++)
+  {
+    for (vm_profiler_stack_t *stack_p = JERRY_CONTEXT (profiler_stacks)[i];
+         stack_p != NULL;
+         stack_p = stack_p->next_p)
+    {
+      vm_profiler_frame_t *stack_frames_p = VM_PROFILER_GET_FRAMES (stack_p);
+      uint32_t depth = stack_p->depth;
+
+      if (stack_p->is_truncated)
+      {
+        vm_output_append_ascii (&output, "[truncated];");
+      }
+
+      if (depth == 0)
+      {
+        vm_output_append_ascii (&output, "[native]");
+      }
+
+      while (depth > 0)
+      {
+        depth--;
+        vm_profiler_append_frame (&output, stack_frames_p + depth);
+
+        if (depth > 0)
+        {
+          vm_output_append_ascii (&output, ";");
+        }
+      }
+
+      vm_output_append_ascii (&output, " ");
+      vm_output_append_uint (&output, stack_p->count);
+      vm_output_append_ascii (&output, "\n");
+    }
+  }
+
+  if (JERRY_CONTEXT (profiler_dropped_samples) > 0)
+  {
+    vm_output_append_ascii (&output, "[dropped] ");
+    vm_output_append_uint (&output, JERRY_CONTEXT (profiler_dropped_samples));
+    vm_output_append_ascii (&output, "\n");
+  }
+
+  return output.length;
+} /* vm_profiler_get_collapsed_stacks */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_PROFILER */
@@ -0,0 +1,87 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_PROFILER_H
+#define VM_PROFILER_H
+
+#ifdef JERRY_PROFILER
+
+#include "ecma-globals.h"
+#include "vm-defines.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup profiler Sampling profiler
+ * @{
+ */
+
+/**
+ * Maximum number of frames recorded for a sample (the innermost frames are kept).
+ */
+#ifndef JERRY_PROFILER_MAX_DEPTH
+#define JERRY_PROFILER_MAX_DEPTH 32
+#endif /* !JERRY_PROFILER_MAX_DEPTH */
+
+/**
+ * Number of hash buckets of the collected stacks (must be a power of 2).
+ */
+#define VM_PROFILER_HASH_SIZE 64
+
+/**
+ * Value of the sample countdown when no periodic sampling is requested.
+ */
+#define VM_PROFILER_NO_INTERVAL UINT32_MAX
+
+/**
+ * A recorded frame of a sample.
+ */
+typedef struct
+{
+#ifdef JERRY_ENABLE_LINE_INFO
+  ecma_value_t resource_name; /**< resource name of the frame */
+  uint32_t line; /**< line of the executed byte code */
+#else /* !JERRY_ENABLE_LINE_INFO */
+  uintptr_t bytecode_id; /**< address of the executed byte code data (used only as an identifier) */
+  uint32_t offset; /**< byte offset of the executed instruction */
+#endif /* JERRY_ENABLE_LINE_INFO */
+} vm_profiler_frame_t;
+
+/**
+ * A unique call stack and the number of samples taken from it.
+ * The header is followed by depth number of vm_profiler_frame_t items,
+ * starting with the innermost frame.
+ */
+typedef struct vm_profiler_stack_t
+{
+  struct vm_profiler_stack_t *next_p; /**< next stack in the same hash bucket */
+  uint32_t hash; /**< hash of the frames */
+  uint32_t count; /**< number of samples */
+  uint16_t depth; /**< number of recorded frames */
+  uint16_t is_truncated; /**< true, if the outer frames were dropped */
+} vm_profiler_stack_t;
+
+void vm_profiler_sample (const vm_frame_ctx_t *frame_ctx_p, const uint8_t *byte_code_p);
+void vm_profiler_free_stacks (void);
+size_t vm_profiler_get_collapsed_stacks (lit_utf8_byte_t *buffer_p, size_t buffer_size);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_PROFILER */
+
+#endif /* !VM_PROFILER_H */
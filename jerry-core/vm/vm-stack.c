@@ -83,30 +83,18 @@ vm_stack_context_abort (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
     {
       JERRY_ASSERT (VM_GET_CONTEXT_TYPE (vm_stack_top_p[-1]) == VM_CONTEXT_FOR_IN);
 
-      ecma_collection_chunk_t *chunk_p;
-      chunk_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_collection_chunk_t, vm_stack_top_p[-2]);
-      uint32_t index = vm_stack_top_p[-3];
+      ecma_collection_header_t *prop_names_p;
+      prop_names_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_collection_header_t, vm_stack_top_p[-2]);
+      ecma_value_t *buffer_p = ecma_collection_get_buffer (prop_names_p);
 
-      while (chunk_p != NULL)
+      /* The names before the index are already consumed. */
+      for (uint32_t index = vm_stack_top_p[-3]; index < prop_names_p->item_count; index++)
       {
-        ecma_value_t value = chunk_p->items[index];
-
-        if (JERRY_UNLIKELY (ecma_is_value_pointer (value)))
-        {
-          ecma_collection_chunk_t *next_chunk_p;
-          next_chunk_p = (ecma_collection_chunk_t *) ecma_get_pointer_from_value (value);
-          jmem_heap_free_block (chunk_p, sizeof (ecma_collection_chunk_t));
-
-          chunk_p = next_chunk_p;
-          index = 0;
-        }
-        else
-        {
-          ecma_free_value (value);
-          index++;
-        }
+        ecma_free_value (buffer_p[index]);
       }
 
+      ecma_free_values_collection (prop_names_p, ECMA_COLLECTION_NO_COPY);
+
       ecma_free_value (vm_stack_top_p[-4]);
 
       VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
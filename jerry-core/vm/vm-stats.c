@@ -0,0 +1,392 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "jmem.h"
+#include "lit-char-helpers.h"
+#include "vm.h"
+#include "vm-stats.h"
+
+#ifdef JERRY_VM_STATS
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vmstats VM statistics
+ * @{
+ */
+
+#define CBC_OPCODE(arg1, arg2, arg3, arg4) #arg1,
+
+/**
+ * Names of the opcodes in the order of the opcode counters.
+ */
+static const char * const vm_stats_opcode_names[] =
+{
+  CBC_OPCODE_LIST
+  CBC_EXT_OPCODE_LIST
+};
+
+#undef CBC_OPCODE
+
+JERRY_STATIC_ASSERT (sizeof (vm_stats_opcode_names) / sizeof (const char *) == VM_STATS_OPCODE_COUNT,
+                     vm_stats_opcode_names_must_have_an_item_for_each_opcode);
+
+/**
+ * Get the hash bucket of a byte code.
+ *
+ * @return pointer to the first item of the bucket
+ */
+static inline vm_stats_function_t ** JERRY_ATTR_ALWAYS_INLINE
+vm_stats_get_bucket (const ecma_compiled_code_t *bytecode_p) /**< byte code */
+{
+  uintptr_t hash = ((uintptr_t) bytecode_p) >> JMEM_ALIGNMENT_LOG;
+  return JERRY_CONTEXT (vm_stats_functions) + (hash & (VM_STATS_HASH_SIZE - 1));
+} /* vm_stats_get_bucket */
+
+/**
+ * Find or create the statistics of a byte code.
+ *
+ * Note:
+ *      if there is not enough memory, a shared item is returned
+ *
+ * @return pointer to the statistics
+ */
+vm_stats_function_t *
+vm_stats_get_function (const ecma_compiled_code_t *bytecode_p) /**< byte code */
+{
+  vm_stats_function_t **bucket_p = vm_stats_get_bucket (bytecode_p);
+  vm_stats_function_t *function_p = *bucket_p;
+
+  while (function_p != NULL)
+  {
+    if (function_p->bytecode_p == bytecode_p)
+    {
+      return function_p;
+    }
+
+    function_p = function_p->next_p;
+  }
+
+  function_p = (vm_stats_function_t *) jmem_heap_alloc_block_null_on_error (sizeof (vm_stats_function_t));
+
+  if (function_p == NULL)
+  {
+    return &JERRY_CONTEXT (vm_stats_unknown_function);
+  }
+
+  function_p->bytecode_p = bytecode_p;
+  function_p->bytecode_id = (uintptr_t) bytecode_p;
+  function_p->calls = 0;
+  function_p->steps = 0;
+#ifdef JERRY_ENABLE_LINE_INFO
+  function_p->resource_name = ECMA_VALUE_UNDEFINED;
+  function_p->line = 0;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+  function_p->next_p = *bucket_p;
+  *bucket_p = function_p;
+  return function_p;
+} /* vm_stats_get_function */
+
+/**
+ * Detach the statistics of a byte code which is going to be freed,
+ * so a new byte code allocated at the same address gets new statistics.
+ */
+void
+vm_stats_bytecode_freed (const ecma_compiled_code_t *bytecode_p) /**< byte code */
+{
+  for (vm_stats_function_t *function_p = *vm_stats_get_bucket (bytecode_p);
+       function_p != NULL;
+       function_p = function_p->next_p)
+  {
+    if (function_p->bytecode_p == bytecode_p)
+    {
+      function_p->bytecode_p = NULL;
+      return;
+    }
+  }
+} /* vm_stats_bytecode_freed */
+
+/**
+ * Free the function statistics and reset all counters.
+ */
+void
+vm_stats_reset (void)
+{
+  for (uint32_t i = 0; i < VM_STATS_HASH_SIZE; i++)
+  {
+    vm_stats_function_t *function_p = JERRY_CONTEXT (vm_stats_functions)[i];
+
+    while (function_p != NULL)
+    {
+      vm_stats_function_t *next_p = function_p->next_p;
+
+#ifdef JERRY_ENABLE_LINE_INFO
+      ecma_free_value (function_p->resource_name);
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+      jmem_heap_free_block (function_p, sizeof (vm_stats_function_t));
+      function_p = next_p;
+    }
+
+    JERRY_CONTEXT (vm_stats_functions)[i] = NULL;
+  }
+
+  /* Frames which are currently executed keep using the shared item. */
+  vm_stats_function_t *unknown_function_p = &JERRY_CONTEXT (vm_stats_unknown_function);
+
+#ifdef JERRY_ENABLE_LINE_INFO
+  ecma_free_value (unknown_function_p->resource_name);
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+  memset (unknown_function_p, 0, sizeof (vm_stats_function_t));
+#ifdef JERRY_ENABLE_LINE_INFO
+  unknown_function_p->resource_name = ECMA_VALUE_UNDEFINED;
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+  for (vm_frame_ctx_t *frame_ctx_p = JERRY_CONTEXT (vm_top_context_p);
+       frame_ctx_p != NULL;
+       frame_ctx_p = frame_ctx_p->prev_context_p)
+  {
+    frame_ctx_p->stats_p = unknown_function_p;
+  }
+
+  memset (JERRY_CONTEXT (vm_stats_opcodes), 0, sizeof (JERRY_CONTEXT (vm_stats_opcodes)));
+  JERRY_CONTEXT (vm_stats_lcache_lookups) = 0;
+  JERRY_CONTEXT (vm_stats_lcache_hits) = 0;
+  JERRY_CONTEXT (vm_stats_hashmap_lookups) = 0;
+  JERRY_CONTEXT (vm_stats_hashmap_hits) = 0;
+} /* vm_stats_reset */
+
+#ifdef JERRY_ENABLE_LINE_INFO
+
+/**
+ * Append a JSON string to the output.
+ */
+static void
+vm_stats_append_json_string (vm_output_t *output_p, /**< output */
+                             const lit_utf8_byte_t *chars_p, /**< characters */
+                             lit_utf8_size_t size) /**< number of characters */
+{
+  vm_output_append_ascii (output_p, "\"");
+
+  for (lit_utf8_size_t i = 0; i < size; i++)
+  {
+    lit_utf8_byte_t chr = chars_p[i];
+
+    if (chr == LIT_CHAR_DOUBLE_QUOTE || chr == LIT_CHAR_BACKSLASH)
+    {
+      vm_output_append_ascii (output_p, "\\");
+    }
+    else if (chr < LIT_CHAR_SP)
+    {
+      /* Control characters are not expected in names, they are simply replaced. */
+      chr = (lit_utf8_byte_t) LIT_CHAR_SP;
+    }
+
+    vm_output_append (output_p, &chr, 1);
+  }
+
+  vm_output_append_ascii (output_p, "\"");
+} /* vm_stats_append_json_string */
+
+#endif /* JERRY_ENABLE_LINE_INFO */
+
+/**
+ * Append a "name": number pair to the output.
+ */
+static void
+vm_stats_append_json_number (vm_output_t *output_p, /**< output */
+                             const char *name_p, /**< name */
+                             uint64_t value) /**< value */
+{
+  vm_output_append_ascii (output_p, "\"");
+  vm_output_append_ascii (output_p, name_p);
+  vm_output_append_ascii (output_p, "\": ");
+  vm_output_append_uint (output_p, value);
+} /* vm_stats_append_json_number */
+
+/**
+ * Append the statistics of a function to the output.
+ */
+static void
+vm_stats_append_function (vm_output_t *output_p, /**< output */
+                          const vm_stats_function_t *function_p) /**< function statistics */
+{
+  vm_output_append_ascii (output_p, "    {\"id\": ");
+
+  if (function_p == &JERRY_CONTEXT (vm_stats_unknown_function))
+  {
+    vm_output_append_ascii (output_p, "\"unknown\"");
+  }
+  else
+  {
+    vm_output_append_ascii (output_p, "\"");
+    vm_output_append_address (output_p, function_p->bytecode_id);
+    vm_output_append_ascii (output_p, "\"");
+
+#ifdef JERRY_ENABLE_LINE_INFO
+    if (ecma_is_value_string (function_p->resource_name))
+    {
+      ECMA_STRING_TO_UTF8_STRING (ecma_get_string_from_value (function_p->resource_name),
+                                  resource_name_chars_p,
+                                  resource_name_size);
+
+      vm_output_append_ascii (output_p, ", \"resource\": ");
+      vm_stats_append_json_string (output_p, resource_name_chars_p, resource_name_size);
+
+      ECMA_FINALIZE_UTF8_STRING (resource_name_chars_p, resource_name_size);
+    }
+
+    vm_output_append_ascii (output_p, ", ");
+    vm_stats_append_json_number (output_p, "line", function_p->line);
+#endif /* JERRY_ENABLE_LINE_INFO */
+  }
+
+  vm_output_append_ascii (output_p, ", ");
+  vm_stats_append_json_number (output_p, "calls", function_p->calls);
+  vm_output_append_ascii (output_p, ", ");
+  vm_stats_append_json_number (output_p, "steps", function_p->steps);
+  vm_output_append_ascii (output_p, function_p->bytecode_p == NULL ? ", \"freed\": true}" : ", \"freed\": false}");
+} /* vm_stats_append_function */
+
+/**
+ * Print the collected statistics in JSON format. Only non-zero
+ * opcode and group counters are printed.
+ *
+ * @return length of the whole output - if it is greater than buffer_size,
+ *         the output is truncated
+ */
+size_t
+vm_stats_to_json (lit_utf8_byte_t *buffer_p, /**< [out] output buffer */
+                  size_t buffer_size) /**< size of the output buffer */
+{
+  vm_output_t output;
+  vm_output_init (&output, buffer_p, buffer_size);
+
+  uint64_t *opcodes_p = JERRY_CONTEXT (vm_stats_opcodes);
+  uint64_t steps = 0;
+
+  for (uint32_t i = 0; i < VM_STATS_OPCODE_COUNT; i++)
+  {
+    steps += opcodes_p[i];
+  }
+
+  vm_output_append_ascii (&output, "{\n  ");
+  vm_stats_append_json_number (&output, "steps", steps);
+  vm_output_append_ascii (&output, ",\n  \"opcodes\": {");
+
+  const char *separator_p = "\n";
+
+  for (uint32_t i = 0; i < VM_STATS_OPCODE_COUNT; i++)
+  {
+    if (opcodes_p[i] > 0)
+    {
+      vm_output_append_ascii (&output, separator_p);
+      vm_output_append_ascii (&output, "    ");
+      vm_stats_append_json_number (&output, vm_stats_opcode_names[i], opcodes_p[i]);
+      separator_p = ",\n";
+    }
+  }
+
+  vm_output_append_ascii (&output, "\n  },\n  \"groups\": [");
+  separator_p = "\n";
+
+  for (uint32_t group = 0; group <= VM_OC_NONE; group++)
+  {
+    uint64_t count = 0;
+
+    for (uint32_t i = 0; i < VM_STATS_OPCODE_COUNT; i++)
+    {
+      if (vm_get_opcode_group (i) == group)
+      {
+        count += opcodes_p[i];
+      }
+    }
+
+    if (count == 0)
+    {
+      continue;
+    }
+
+    vm_output_append_ascii (&output, separator_p);
+    vm_output_append_ascii (&output, "    {");
+    vm_stats_append_json_number (&output, "group", group);
+    vm_output_append_ascii (&output, ", ");
+    vm_stats_append_json_number (&output, "count", count);
+    vm_output_append_ascii (&output, ", \"opcodes\": [");
+
+    const char *opcode_separator_p = "";
+
+    for (uint32_t i = 0; i < VM_STATS_OPCODE_COUNT; i++)
+    {
+      if (vm_get_opcode_group (i) == group)
+      {
+        vm_output_append_ascii (&output, opcode_separator_p);
+        vm_output_append_ascii (&output, "\"");
+        vm_output_append_ascii (&output, vm_stats_opcode_names[i]);
+        vm_output_append_ascii (&output, "\"");
+        opcode_separator_p = ", ";
+      }
+    }
+
+    vm_output_append_ascii (&output, "]}");
+    separator_p = ",\n";
+  }
+
+  vm_output_append_ascii (&output, "\n  ],\n  \"functions\": [");
+  separator_p = "\n";
+
+  for (uint32_t i = 0; i < VM_STATS_HASH_SIZE; i++)
+  {
+    for (vm_stats_function_t *function_p = JERRY_CONTEXT (vm_stats_functions)[i];
+         function_p != NULL;
+         function_p = function_p->next_p)
+    {
+      vm_output_append_ascii (&output, separator_p);
+      vm_stats_append_function (&output, function_p);
+      separator_p = ",\n";
+    }
+  }
+
+  vm_stats_function_t *unknown_function_p = &JERRY_CONTEXT (vm_stats_unknown_function);
+
+  if (unknown_function_p->calls > 0 || unknown_function_p->steps > 0)
+  {
+    vm_output_append_ascii (&output, separator_p);
+    vm_stats_append_function (&output, unknown_function_p);
+  }
+
+  vm_output_append_ascii (&output, "\n  ],\n  \"lcache\": {");
+  vm_stats_append_json_number (&output, "lookups", JERRY_CONTEXT (vm_stats_lcache_lookups));
+  vm_output_append_ascii (&output, ", ");
+  vm_stats_append_json_number (&output, "hits", JERRY_CONTEXT (vm_stats_lcache_hits));
+  vm_output_append_ascii (&output, "},\n  \"property_hashmap\": {");
+  vm_stats_append_json_number (&output, "lookups", JERRY_CONTEXT (vm_stats_hashmap_lookups));
+  vm_output_append_ascii (&output, ", ");
+  vm_stats_append_json_number (&output, "hits", JERRY_CONTEXT (vm_stats_hashmap_hits));
+  vm_output_append_ascii (&output, "}\n}\n");
+
+  return output.length;
+} /* vm_stats_to_json */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_VM_STATS */
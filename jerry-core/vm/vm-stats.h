@@ -0,0 +1,69 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_STATS_H
+#define VM_STATS_H
+
+#ifdef JERRY_VM_STATS
+
+#include "byte-code.h"
+#include "ecma-globals.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vmstats VM statistics
+ * @{
+ */
+
+/**
+ * Number of counted opcodes: the extended opcodes follow the basic ones (same as in vm_decode_table).
+ */
+#define VM_STATS_OPCODE_COUNT ((CBC_END + 1) + (CBC_EXT_END + 1))
+
+/**
+ * Number of hash buckets of the function statistics (must be a power of 2).
+ */
+#define VM_STATS_HASH_SIZE 64
+
+/**
+ * Execution statistics of a compiled code.
+ */
+typedef struct vm_stats_function_t
+{
+  struct vm_stats_function_t *next_p; /**< next item in the same hash bucket */
+  const ecma_compiled_code_t *bytecode_p; /**< byte code (NULL after the byte code is freed) */
+  uintptr_t bytecode_id; /**< address of the byte code (used only as an identifier) */
+  uint64_t calls; /**< number of times the byte code is executed */
+  uint64_t steps; /**< number of executed instructions */
+#ifdef JERRY_ENABLE_LINE_INFO
+  ecma_value_t resource_name; /**< resource name of the byte code */
+  uint32_t line; /**< first executed line of the byte code */
+#endif /* JERRY_ENABLE_LINE_INFO */
+} vm_stats_function_t;
+
+vm_stats_function_t *vm_stats_get_function (const ecma_compiled_code_t *bytecode_p);
+void vm_stats_bytecode_freed (const ecma_compiled_code_t *bytecode_p);
+void vm_stats_reset (void);
+size_t vm_stats_to_json (lit_utf8_byte_t *buffer_p, size_t buffer_size);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* JERRY_VM_STATS */
+
+#endif /* !VM_STATS_H */
@@ -16,6 +16,7 @@
 #include "ecma-array-object.h"
 #include "ecma-helpers.h"
 #include "jcontext.h"
+#include "lit-char-helpers.h"
 #include "vm.h"
 
 /**
@@ -93,7 +94,10 @@ vm_get_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimite
       str_p = ecma_append_magic_string_to_string (str_p, LIT_MAGIC_STRING_COLON_CHAR);
     }
 
-    ecma_string_t *line_str_p = ecma_new_ecma_string_from_uint32 (context_p->current_line);
+    uint32_t offset = (uint32_t) (context_p->current_byte_code_p - context_p->byte_code_start_p);
+    uint32_t line = ecma_compiled_code_get_line (context_p->bytecode_header_p, offset);
+
+    ecma_string_t *line_str_p = ecma_new_ecma_string_from_uint32 (line);
     str_p = ecma_concat_ecma_strings (str_p, line_str_p);
     ecma_deref_ecma_string (line_str_p);
 
@@ -130,3 +134,93 @@ vm_get_backtrace (uint32_t max_depth) /**< maximum backtrace depth, 0 = unlimite
   return ecma_op_create_array_object (NULL, 0, false);
 #endif /* JERRY_ENABLE_LINE_INFO */
 } /* vm_get_backtrace */
+
+#if defined (JERRY_PROFILER) || defined (JERRY_VM_STATS) || defined (JMEM_ALLOC_SITES)
+
+/**
+ * Initialize a text output buffer.
+ */
+void
+vm_output_init (vm_output_t *output_p, /**< [out] output */
+                lit_utf8_byte_t *buffer_p, /**< output buffer (can be NULL) */
+                size_t buffer_size) /**< size of the output buffer */
+{
+  output_p->buffer_p = buffer_p;
+  output_p->buffer_size = (buffer_p != NULL) ? buffer_size : 0;
+  output_p->length = 0;
+} /* vm_output_init */
+
+/**
+ * Append characters to the output. Characters which do not fit into
+ * the buffer are only counted.
+ */
+void
+vm_output_append (vm_output_t *output_p, /**< output */
+                  const lit_utf8_byte_t *chars_p, /**< characters */
+                  lit_utf8_size_t size) /**< number of characters */
+{
+  if (output_p->length < output_p->buffer_size)
+  {
+    size_t copy_size = JERRY_MIN (size, output_p->buffer_size - output_p->length);
+    memcpy (output_p->buffer_p + output_p->length, chars_p, copy_size);
+  }
+
+  output_p->length += size;
+} /* vm_output_append */
+
+/**
+ * Append a zero terminated ascii string to the output.
+ */
+void
+vm_output_append_ascii (vm_output_t *output_p, /**< output */
+                        const char *str_p) /**< string */
+{
+  vm_output_append (output_p, (const lit_utf8_byte_t *) str_p, (lit_utf8_size_t) strlen (str_p));
+} /* vm_output_append_ascii */
+
+/**
+ * Append an unsigned decimal number to the output.
+ */
+void
+vm_output_append_uint (vm_output_t *output_p, /**< output */
+                       uint64_t value) /**< number */
+{
+  lit_utf8_byte_t buffer[20];
+  lit_utf8_byte_t *buffer_end_p = buffer + sizeof (buffer);
+  lit_utf8_byte_t *buffer_p = buffer_end_p;
+
+  do
+  {
+    *(--buffer_p) = (lit_utf8_byte_t) (LIT_CHAR_0 + (value % 10));
+    value /= 10;
+  }
+  while (value != 0);
+
+  vm_output_append (output_p, buffer_p, (lit_utf8_size_t) (buffer_end_p - buffer_p));
+} /* vm_output_append_uint */
+
+/**
+ * Append an address in hexadecimal format (0x...) to the output.
+ */
+void
+vm_output_append_address (vm_output_t *output_p, /**< output */
+                          uintptr_t address) /**< address */
+{
+  lit_utf8_byte_t buffer[2 + 2 * sizeof (uintptr_t)];
+  lit_utf8_byte_t *buffer_end_p = buffer + sizeof (buffer);
+  lit_utf8_byte_t *buffer_p = buffer_end_p;
+
+  do
+  {
+    *(--buffer_p) = (lit_utf8_byte_t) "0123456789abcdef"[address & 0xf];
+    address >>= 4;
+  }
+  while (address != 0);
+
+  *(--buffer_p) = (lit_utf8_byte_t) LIT_CHAR_LOWERCASE_X;
+  *(--buffer_p) = (lit_utf8_byte_t) LIT_CHAR_0;
+
+  vm_output_append (output_p, buffer_p, (lit_utf8_size_t) (buffer_end_p - buffer_p));
+} /* vm_output_append_address */
+
+#endif /* JERRY_PROFILER || JERRY_VM_STATS || JMEM_ALLOC_SITES */
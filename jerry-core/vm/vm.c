@@ -23,6 +23,7 @@
 #include "ecma-exceptions.h"
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
+#include "ecma-global-cache.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
 #include "ecma-lex-env.h"
@@ -219,6 +220,24 @@ static const uint16_t vm_decode_table[] JERRY_CONST_DATA =
 
 #undef CBC_OPCODE
 
+#ifdef JERRY_VM_STATS
+
+/**
+ * Get the VM_OC_* group of an opcode. The extended opcodes follow the
+ * basic opcodes, so their index is (CBC_END + 1) + extended opcode.
+ *
+ * @return group index
+ */
+uint32_t
+vm_get_opcode_group (uint32_t opcode_index) /**< opcode index */
+{
+  JERRY_ASSERT (opcode_index < VM_STATS_OPCODE_COUNT);
+
+  return VM_OC_GROUP_GET_INDEX (vm_decode_table[opcode_index]);
+} /* vm_get_opcode_group */
+
+#endif /* JERRY_VM_STATS */
+
 /**
  * Run global code
  *
@@ -271,7 +290,7 @@ vm_run_eval (ecma_compiled_code_t *bytecode_data_p, /**< byte-code data */
       }
 
       if ((ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_THIS_OBJECT_BOUND)
-          || (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE))
+          || (ecma_get_lex_env_type (lex_env_p) <= ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_END))
       {
         chain_index--;
       }
@@ -644,6 +663,148 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   frame_ctx_p->stack_top_p = stack_top_p;
 } /* opfunc_construct */
 
+/**
+ * Get the slot of an identifier which is resolved by the scope info of the byte code.
+ *
+ * Note:
+ *      the slots can only be used when the current lexical environment is the
+ *      lexical environment of the function call (e.g. not inside a with block)
+ *
+ * @return pointer to the slot - if the identifier is stored in a slot,
+ *         NULL - otherwise
+ */
+static inline ecma_value_t * JERRY_ATTR_ALWAYS_INLINE
+vm_get_slot (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+             uint32_t literal_index, /**< literal index of the identifier */
+             uint32_t register_end, /**< end of the register group */
+             ecma_object_t **lex_env_p) /**< [out] lexical environment of the slot (can be NULL) */
+{
+  if (frame_ctx_p->lex_env_p != frame_ctx_p->scope_base_p)
+  {
+    return NULL;
+  }
+
+  if (literal_index < frame_ctx_p->var_end)
+  {
+    if (frame_ctx_p->slots_p == NULL)
+    {
+      return NULL;
+    }
+
+    if (lex_env_p != NULL)
+    {
+      *lex_env_p = frame_ctx_p->scope_base_p;
+    }
+
+    return frame_ctx_p->slots_p + (literal_index - register_end);
+  }
+
+  uint32_t binding = frame_ctx_p->scope_info_p[literal_index];
+  uint32_t slot = binding & CBC_SCOPE_INFO_SLOT_MASK;
+
+  if (slot == CBC_SCOPE_INFO_NO_SLOT)
+  {
+    return NULL;
+  }
+
+  ecma_object_t *slot_lex_env_p = frame_ctx_p->scope_base_p;
+
+  for (uint32_t depth = binding >> CBC_SCOPE_INFO_DEPTH_SHIFT; depth > 0; depth--)
+  {
+    slot_lex_env_p = ecma_get_lex_env_outer_reference (slot_lex_env_p);
+  }
+
+  JERRY_ASSERT (ecma_get_lex_env_type (slot_lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS);
+  JERRY_ASSERT (slot < ((ecma_slot_lex_env_t *) slot_lex_env_p)->slot_count);
+
+  if (lex_env_p != NULL)
+  {
+    *lex_env_p = slot_lex_env_p;
+  }
+
+  return ECMA_SLOT_LEX_ENV_GET_SLOTS (slot_lex_env_p) + slot;
+} /* vm_get_slot */
+
+/**
+ * Find the property of the global object which is referenced by an identifier.
+ *
+ * Note:
+ *      the identifier is resolved without a lookup in the lexical environment chain when the
+ *      current lexical environment is the global one, or the scope info of the byte code shows
+ *      that none of the lexical environments between them declares the identifier
+ *
+ * @return pointer to the named data property - if found,
+ *         NULL - otherwise (the identifier must be resolved by the lexical environment chain)
+ */
+static inline ecma_property_t * JERRY_ATTR_ALWAYS_INLINE
+vm_find_global_property (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                         uint32_t literal_index) /**< literal index of the identifier */
+{
+  ecma_object_t *lex_env_p = frame_ctx_p->lex_env_p;
+  ecma_object_t *global_lex_env_p = JERRY_CONTEXT (ecma_global_lex_env_p);
+
+  if (lex_env_p != global_lex_env_p)
+  {
+    if (lex_env_p != frame_ctx_p->scope_base_p || literal_index < frame_ctx_p->var_end)
+    {
+      return NULL;
+    }
+
+    uint32_t binding = frame_ctx_p->scope_info_p[literal_index];
+
+    if (binding == CBC_SCOPE_INFO_DYNAMIC)
+    {
+      return NULL;
+    }
+
+    JERRY_ASSERT ((binding & CBC_SCOPE_INFO_SLOT_MASK) == CBC_SCOPE_INFO_NO_SLOT);
+
+    for (uint32_t depth = binding >> CBC_SCOPE_INFO_DEPTH_SHIFT; depth > 0; depth--)
+    {
+      lex_env_p = ecma_get_lex_env_outer_reference (lex_env_p);
+    }
+
+    if (lex_env_p != global_lex_env_p)
+    {
+      return NULL;
+    }
+  }
+
+  ecma_value_t name = frame_ctx_p->literal_start_p[literal_index];
+  ecma_property_t *property_p;
+
+#ifndef CONFIG_ECMA_GLOBAL_CACHE_DISABLE
+  property_p = ecma_global_cache_lookup (name);
+
+  if (JERRY_LIKELY (property_p != NULL))
+  {
+    /* The type of the property may be changed by defineProperty. */
+    return (ECMA_PROPERTY_GET_TYPE (*property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA) ? property_p : NULL;
+  }
+#endif /* !CONFIG_ECMA_GLOBAL_CACHE_DISABLE */
+
+  ecma_object_t *global_obj_p = ecma_get_lex_env_binding_object (global_lex_env_p);
+  ecma_string_t *name_p = ecma_get_string_from_value (name);
+
+  property_p = ecma_find_named_property (global_obj_p, name_p);
+
+  if (property_p == NULL)
+  {
+    property_p = ecma_builtin_try_to_instantiate_property (global_obj_p, name_p);
+  }
+
+  if (property_p == NULL || ECMA_PROPERTY_GET_TYPE (*property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA)
+  {
+    return NULL;
+  }
+
+#ifndef CONFIG_ECMA_GLOBAL_CACHE_DISABLE
+  ecma_global_cache_insert (name, property_p);
+#endif /* !CONFIG_ECMA_GLOBAL_CACHE_DISABLE */
+
+  return property_p;
+} /* vm_find_global_property */
+
 /**
  * Read literal index from the byte code stream into destination.
  *
@@ -682,16 +843,31 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       } \
       else \
       { \
-        ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]); \
+        ecma_value_t *slot_p = vm_get_slot (frame_ctx_p, (literal_index), register_end, NULL); \
         \
-        result = ecma_op_resolve_reference_value (frame_ctx_p->lex_env_p, \
-                                                  name_p); \
+        ecma_property_t *global_property_p; \
         \
-        if (ECMA_IS_VALUE_ERROR (result)) \
+        if (slot_p != NULL) \
+        { \
+          (target_value) = ecma_fast_copy_value (*slot_p); \
+        } \
+        else if ((global_property_p = vm_find_global_property (frame_ctx_p, (literal_index))) != NULL) \
         { \
-          goto error; \
+          (target_value) = ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (global_property_p)->value); \
+        } \
+        else \
+        { \
+          ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]); \
+          \
+          result = ecma_op_resolve_reference_value (frame_ctx_p->lex_env_p, \
+                                                    name_p); \
+          \
+          if (ECMA_IS_VALUE_ERROR (result)) \
+          { \
+            goto error; \
+          } \
+          (target_value) = result; \
         } \
-        (target_value) = result; \
       } \
     } \
     else if (literal_index < const_literal_end) \
@@ -758,6 +934,12 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         byte_code_p++;
         READ_LITERAL_INDEX (literal_index_end);
 
+        if (frame_ctx_p->slots_p != NULL)
+        {
+          /* The slots are already initialized to undefined. */
+          break;
+        }
+
         while (literal_index <= literal_index_end)
         {
           ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]);
@@ -807,6 +989,15 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           {
             frame_ctx_p->registers_p[literal_index] = lit_value;
           }
+          else if (frame_ctx_p->slots_p != NULL)
+          {
+            ecma_value_assign_value (frame_ctx_p->slots_p + (literal_index - register_end), lit_value);
+
+            if (value_index >= register_end)
+            {
+              ecma_free_value (lit_value);
+            }
+          }
           else
           {
             ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]);
@@ -858,6 +1049,43 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   }
 } /* vm_init_loop */
 
+#ifdef JERRY_VM_EXEC_STOP
+
+/**
+ * Call the user provided exec stop callback when the counter of
+ * backward branches reaches zero.
+ *
+ * @return ECMA_VALUE_ERROR - if the execution must be aborted
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t JERRY_ATTR_NOINLINE
+vm_run_exec_stop_callback (void)
+{
+  ecma_value_t result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
+
+  if (ecma_is_value_undefined (result))
+  {
+    JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
+    return ECMA_VALUE_EMPTY;
+  }
+
+  JERRY_CONTEXT (vm_exec_stop_counter) = 1;
+
+  if (!ecma_is_value_error_reference (result))
+  {
+    JERRY_CONTEXT (error_value) = result;
+  }
+  else
+  {
+    JERRY_CONTEXT (error_value) = ecma_clear_error_reference (result, false);
+  }
+
+  JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_EXCEPTION;
+  return ECMA_VALUE_ERROR;
+} /* vm_run_exec_stop_callback */
+
+#endif /* JERRY_VM_EXEC_STOP */
+
 /**
  * Run generic byte code.
  *
@@ -919,6 +1147,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     while (true)
     {
       uint8_t *byte_code_start_p = byte_code_p;
+
+#ifdef JERRY_PROFILER
+      if (JERRY_UNLIKELY (--JERRY_CONTEXT (profiler_countdown) == 0))
+      {
+        vm_profiler_sample (frame_ctx_p, byte_code_start_p);
+      }
+#endif /* JERRY_PROFILER */
+
       uint8_t opcode = *byte_code_p++;
       uint32_t opcode_data = opcode;
 
@@ -928,6 +1164,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         opcode_data = (uint32_t) ((CBC_END + 1) + opcode);
       }
 
+#ifdef JERRY_VM_STATS
+      JERRY_CONTEXT (vm_stats_opcodes)[opcode_data]++;
+      frame_ctx_p->stats_p->steps++;
+#endif /* JERRY_VM_STATS */
+
+#if defined (JERRY_ENABLE_LINE_INFO) || defined (JMEM_ALLOC_SITES)
+      frame_ctx_p->current_byte_code_p = byte_code_start_p;
+#endif /* JERRY_ENABLE_LINE_INFO || JMEM_ALLOC_SITES */
+
       opcode_data = vm_decode_table[opcode_data];
 
       left_value = ECMA_VALUE_UNDEFINED;
@@ -1010,27 +1255,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL
               && --JERRY_CONTEXT (vm_exec_stop_counter) == 0)
           {
-            result = JERRY_CONTEXT (vm_exec_stop_cb) (JERRY_CONTEXT (vm_exec_stop_user_p));
+            result = vm_run_exec_stop_callback ();
 
-            if (ecma_is_value_undefined (result))
-            {
-              JERRY_CONTEXT (vm_exec_stop_counter) = JERRY_CONTEXT (vm_exec_stop_frequency);
-            }
-            else
+            if (ECMA_IS_VALUE_ERROR (result))
             {
-              JERRY_CONTEXT (vm_exec_stop_counter) = 1;
-
-              if (!ecma_is_value_error_reference (result))
-              {
-                JERRY_CONTEXT (error_value) = result;
-              }
-              else
-              {
-                JERRY_CONTEXT (error_value) = ecma_clear_error_reference (result, false);
-              }
-
-              JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_EXCEPTION;
-              result = ECMA_VALUE_ERROR;
               goto error;
             }
           }
@@ -1658,17 +1886,40 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (literal_index < ident_end);
 
+          ecma_object_t *ref_base_lex_env_p;
+          ecma_value_t *slot_p;
+          ecma_property_t *global_property_p;
+
           if (literal_index < register_end)
           {
             *stack_top_p++ = ECMA_VALUE_REGISTER_REF;
             *stack_top_p++ = literal_index;
             *stack_top_p++ = ecma_fast_copy_value (frame_ctx_p->registers_p[literal_index]);
           }
+          else if ((slot_p = vm_get_slot (frame_ctx_p, literal_index, register_end, &ref_base_lex_env_p)) != NULL)
+          {
+            ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]);
+
+            ecma_ref_object (ref_base_lex_env_p);
+            ecma_ref_ecma_string (name_p);
+            *stack_top_p++ = ecma_make_object_value (ref_base_lex_env_p);
+            *stack_top_p++ = ecma_make_string_value (name_p);
+            *stack_top_p++ = ecma_fast_copy_value (*slot_p);
+          }
+          else if ((global_property_p = vm_find_global_property (frame_ctx_p, literal_index)) != NULL)
+          {
+            ref_base_lex_env_p = JERRY_CONTEXT (ecma_global_lex_env_p);
+
+            ecma_ref_object (ref_base_lex_env_p);
+            ecma_ref_ecma_string (ecma_get_string_from_value (literal_start_p[literal_index]));
+            *stack_top_p++ = ecma_make_object_value (ref_base_lex_env_p);
+            *stack_top_p++ = literal_start_p[literal_index];
+            *stack_top_p++ = ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (global_property_p)->value);
+          }
           else
           {
             ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]);
 
-            ecma_object_t *ref_base_lex_env_p;
             ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p,
                                                                  name_p);
 
@@ -2079,6 +2330,118 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_fast_free_value (value);
           continue;
         }
+        case VM_OC_BRANCH_IF_LESS:
+        case VM_OC_BRANCH_IF_LESS_EQUAL:
+        case VM_OC_BRANCH_IF_EQUAL:
+        case VM_OC_BRANCH_IF_STRICT_EQUAL_VALUES:
+        {
+          uint32_t group = VM_OC_GROUP_GET_INDEX (opcode_data);
+          bool condition;
+
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = (ecma_integer_value_t) left_value;
+            ecma_integer_value_t right_integer = (ecma_integer_value_t) right_value;
+
+            if (group == VM_OC_BRANCH_IF_LESS)
+            {
+              condition = (left_integer < right_integer);
+            }
+            else if (group == VM_OC_BRANCH_IF_LESS_EQUAL)
+            {
+              condition = (left_integer <= right_integer);
+            }
+            else
+            {
+              condition = (left_integer == right_integer);
+            }
+          }
+          else if (group == VM_OC_BRANCH_IF_STRICT_EQUAL_VALUES)
+          {
+            condition = ecma_op_strict_equality_compare (left_value, right_value);
+          }
+          else if (group != VM_OC_BRANCH_IF_EQUAL
+                   && ecma_is_value_number (left_value)
+                   && ecma_is_value_number (right_value))
+          {
+            ecma_number_t left_number = ecma_get_number_from_value (left_value);
+            ecma_number_t right_number = ecma_get_number_from_value (right_value);
+
+            condition = (group == VM_OC_BRANCH_IF_LESS ? (left_number < right_number)
+                                                       : (left_number <= right_number));
+          }
+          else
+          {
+            if (group == VM_OC_BRANCH_IF_LESS)
+            {
+              result = opfunc_relation (left_value, right_value, true, false);
+            }
+            else if (group == VM_OC_BRANCH_IF_LESS_EQUAL)
+            {
+              result = opfunc_relation (left_value, right_value, false, true);
+            }
+            else
+            {
+              result = opfunc_equality (left_value, right_value);
+            }
+
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
+
+            condition = ecma_is_value_true (result);
+          }
+
+          if (opcode_data & VM_OC_BRANCH_IF_NOT_FLAG)
+          {
+            condition = !condition;
+          }
+
+          branch_offset_length = CBC_BRANCH_OFFSET_LENGTH (opcode);
+          JERRY_ASSERT (branch_offset_length >= 1 && branch_offset_length <= 3);
+
+          if (!condition)
+          {
+            byte_code_p += branch_offset_length;
+            goto free_both_values;
+          }
+
+          branch_offset = *(byte_code_p++);
+
+          if (JERRY_UNLIKELY (branch_offset_length != 1))
+          {
+            branch_offset <<= 8;
+            branch_offset |= *(byte_code_p++);
+
+            if (JERRY_UNLIKELY (branch_offset_length == 3))
+            {
+              branch_offset <<= 8;
+              branch_offset |= *(byte_code_p++);
+            }
+          }
+
+          if (opcode_data & VM_OC_BACKWARD_BRANCH)
+          {
+#ifdef JERRY_VM_EXEC_STOP
+            if (JERRY_CONTEXT (vm_exec_stop_cb) != NULL
+                && --JERRY_CONTEXT (vm_exec_stop_counter) == 0)
+            {
+              result = vm_run_exec_stop_callback ();
+
+              if (ECMA_IS_VALUE_ERROR (result))
+              {
+                goto error;
+              }
+            }
+#endif /* JERRY_VM_EXEC_STOP */
+
+            branch_offset = -branch_offset;
+          }
+
+          byte_code_p = byte_code_start_p + branch_offset;
+          goto free_both_values;
+        }
         case VM_OC_PLUS:
         case VM_OC_MINUS:
         {
@@ -2134,10 +2497,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           JERRY_ASSERT (literal_index < ident_end);
 
+          ecma_value_t *slot_p;
+          ecma_property_t *global_property_p;
+
           if (literal_index < register_end)
           {
             left_value = ecma_copy_value (frame_ctx_p->registers_p[literal_index]);
           }
+          else if ((slot_p = vm_get_slot (frame_ctx_p, literal_index, register_end, NULL)) != NULL)
+          {
+            left_value = ecma_copy_value (*slot_p);
+          }
+          else if ((global_property_p = vm_find_global_property (frame_ctx_p, literal_index)) != NULL)
+          {
+            left_value = ecma_copy_value (ECMA_PROPERTY_VALUE_PTR (global_property_p)->value);
+          }
           else
           {
             ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]);
@@ -2786,7 +3160,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
           ecma_value_t expr_obj_value = ECMA_VALUE_UNDEFINED;
-          ecma_collection_chunk_t *prop_names_p = opfunc_for_in (value, &expr_obj_value);
+          ecma_collection_header_t *prop_names_p = opfunc_for_in (value, &expr_obj_value);
           ecma_free_value (value);
 
           if (prop_names_p == NULL)
@@ -2810,47 +3184,37 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           ecma_value_t *context_top_p = frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth;
 
-          ecma_collection_chunk_t *chunk_p;
-          chunk_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_collection_chunk_t, context_top_p[-2]);
+          ecma_collection_header_t *prop_names_p;
+          prop_names_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_collection_header_t, context_top_p[-2]);
 
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_IN);
 
           uint32_t index = context_top_p[-3];
 
-          JERRY_ASSERT (!ecma_is_value_pointer (chunk_p->items[index]));
-
-          *stack_top_p++ = chunk_p->items[index];
-          index++;
+          JERRY_ASSERT (index < prop_names_p->item_count);
 
-          if (JERRY_LIKELY (!ecma_is_value_pointer (chunk_p->items[index])))
-          {
-            context_top_p[-3] = index;
-            continue;
-          }
-
-          context_top_p[-3] = 0;
-
-          ecma_collection_chunk_t *next_chunk_p;
-          next_chunk_p = (ecma_collection_chunk_t *) ecma_get_pointer_from_value (chunk_p->items[index]);
-          ECMA_SET_INTERNAL_VALUE_ANY_POINTER (context_top_p[-2], next_chunk_p);
-
-          jmem_heap_free_block (chunk_p, sizeof (ecma_collection_chunk_t));
+          /* The ownership of the name is transferred to the stack. */
+          *stack_top_p++ = ecma_collection_get_buffer (prop_names_p)[index];
+          context_top_p[-3] = index + 1;
           continue;
         }
         case VM_OC_FOR_IN_HAS_NEXT:
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
-          ecma_collection_chunk_t *chunk_p;
-          chunk_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_collection_chunk_t, stack_top_p[-2]);
+          ecma_collection_header_t *prop_names_p;
+          prop_names_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_collection_header_t, stack_top_p[-2]);
 
+          ecma_value_t *buffer_p = ecma_collection_get_buffer (prop_names_p);
           uint32_t index = stack_top_p[-3];
           ecma_object_t *object_p = ecma_get_object_from_value (stack_top_p[-4]);
 
           while (true)
           {
-            if (chunk_p == NULL)
+            if (index >= prop_names_p->item_count)
             {
+              /* All names are consumed, only the buffer is freed. */
+              ecma_free_values_collection (prop_names_p, ECMA_COLLECTION_NO_COPY);
               ecma_deref_object (object_p);
 
               VM_MINUS_EQUAL_U16 (frame_ctx_p->context_depth, PARSER_FOR_IN_CONTEXT_STACK_ALLOCATION);
@@ -2858,7 +3222,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               break;
             }
 
-            ecma_string_t *prop_name_p = ecma_get_string_from_value (chunk_p->items[index]);
+            ecma_string_t *prop_name_p = ecma_get_string_from_value (buffer_p[index]);
 
             if (JERRY_LIKELY (ecma_op_object_has_property (object_p, prop_name_p)))
             {
@@ -2867,24 +3231,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             }
 
             index++;
-            ecma_value_t value = chunk_p->items[index];
-
-            if (JERRY_LIKELY (!ecma_is_value_pointer (value)))
-            {
-              stack_top_p[-3] = index;
-            }
-            else
-            {
-              index = 0;
-              stack_top_p[-3] = 0;
-
-              ecma_collection_chunk_t *next_chunk_p;
-              next_chunk_p = (ecma_collection_chunk_t *) ecma_get_pointer_from_value (value);
-              ECMA_SET_INTERNAL_VALUE_ANY_POINTER (stack_top_p[-2], next_chunk_p);
-
-              jmem_heap_free_block (chunk_p, sizeof (ecma_collection_chunk_t));
-              chunk_p = next_chunk_p;
-            }
+            stack_top_p[-3] = index;
 
             ecma_deref_ecma_string (prop_name_p);
           }
@@ -3095,46 +3442,15 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #ifdef JERRY_ENABLE_LINE_INFO
         case VM_OC_RESOURCE_NAME:
         {
-          ecma_length_t formal_params_number = 0;
-
-          if (CBC_NON_STRICT_ARGUMENTS_NEEDED (bytecode_header_p))
-          {
-            if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
-            {
-              cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
-
-              formal_params_number = args_p->argument_end;
-            }
-            else
-            {
-              cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
-
-              formal_params_number = args_p->argument_end;
-            }
-          }
-
-          uint8_t *byte_p = (uint8_t *) bytecode_header_p;
-          byte_p += ((size_t) bytecode_header_p->size) << JMEM_ALIGNMENT_LOG;
-
-          ecma_value_t *resource_name_p = (ecma_value_t *) byte_p;
-          resource_name_p -= formal_params_number;
-
-          frame_ctx_p->resource_name = resource_name_p[-1];
-          continue;
-        }
-        case VM_OC_LINE:
-        {
-          uint32_t value = 0;
-          uint8_t byte;
+          frame_ctx_p->resource_name = *ecma_compiled_code_get_resource_name_p (bytecode_header_p);
 
-          do
+#ifdef JERRY_VM_STATS
+          if (frame_ctx_p->stats_p->resource_name == ECMA_VALUE_UNDEFINED)
           {
-            byte = *byte_code_p++;
-            value = (value << 7) | (byte & CBC_LOWER_SEVEN_BIT_MASK);
+            frame_ctx_p->stats_p->resource_name = ecma_copy_value (frame_ctx_p->resource_name);
+            frame_ctx_p->stats_p->line = ecma_compiled_code_get_line (bytecode_header_p, 0);
           }
-          while (byte & CBC_HIGHEST_BIT_MASK);
-
-          frame_ctx_p->current_line = value;
+#endif /* JERRY_VM_STATS */
           continue;
         }
 #endif /* JERRY_ENABLE_LINE_INFO */
@@ -3151,6 +3467,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       if (opcode_data & VM_OC_PUT_IDENT)
       {
         uint16_t literal_index;
+        ecma_value_t *slot_p;
+        ecma_property_t *global_property_p;
 
         READ_LITERAL_INDEX (literal_index);
 
@@ -3165,6 +3483,27 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             result = ecma_fast_copy_value (result);
           }
         }
+        else if ((slot_p = vm_get_slot (frame_ctx_p, literal_index, register_end, NULL)) != NULL)
+        {
+          ecma_value_assign_value (slot_p, result);
+
+          if (!(opcode_data & (VM_OC_PUT_STACK | VM_OC_PUT_BLOCK)))
+          {
+            ecma_fast_free_value (result);
+          }
+        }
+        else if ((global_property_p = vm_find_global_property (frame_ctx_p, literal_index)) != NULL
+                 && ecma_is_property_writable (*global_property_p))
+        {
+          ecma_object_t *global_obj_p = ecma_get_lex_env_binding_object (JERRY_CONTEXT (ecma_global_lex_env_p));
+
+          ecma_named_data_property_assign_value (global_obj_p, ECMA_PROPERTY_VALUE_PTR (global_property_p), result);
+
+          if (!(opcode_data & (VM_OC_PUT_STACK | VM_OC_PUT_BLOCK)))
+          {
+            ecma_fast_free_value (result);
+          }
+        }
         else
         {
           ecma_string_t *var_name_str_p = ecma_get_string_from_value (literal_start_p[literal_index]);
@@ -3452,6 +3791,11 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
 
   JERRY_CONTEXT (status_flags) &= (uint32_t) ~ECMA_STATUS_DIRECT_EVAL;
 
+#ifdef JERRY_VM_STATS
+  frame_ctx_p->stats_p = vm_stats_get_function (bytecode_header_p);
+  frame_ctx_p->stats_p->calls++;
+#endif /* JERRY_VM_STATS */
+
   JERRY_CONTEXT (vm_top_context_p) = frame_ctx_p;
 
   vm_init_loop (frame_ctx_p);
@@ -3521,11 +3865,15 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
   ecma_value_t *literal_p;
   vm_frame_ctx_t frame_ctx;
   uint32_t call_stack_size;
+  uint32_t register_end;
+  uint32_t ident_end;
 
   if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
     cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_header_p;
     call_stack_size = (uint32_t) (args_p->register_end + args_p->stack_limit);
+    register_end = args_p->register_end;
+    ident_end = args_p->ident_end;
 
     literal_p = (ecma_value_t *) ((uint8_t *) bytecode_header_p + sizeof (cbc_uint16_arguments_t));
     literal_p -= args_p->register_end;
@@ -3536,6 +3884,8 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
   {
     cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_header_p;
     call_stack_size = (uint32_t) (args_p->register_end + args_p->stack_limit);
+    register_end = args_p->register_end;
+    ident_end = args_p->ident_end;
 
     literal_p = (ecma_value_t *) ((uint8_t *) bytecode_header_p + sizeof (cbc_uint8_arguments_t));
     literal_p -= args_p->register_end;
@@ -3547,13 +3897,37 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
   frame_ctx.byte_code_p = (uint8_t *) literal_p;
   frame_ctx.byte_code_start_p = (uint8_t *) literal_p;
   frame_ctx.lex_env_p = lex_env_p;
+  frame_ctx.scope_base_p = NULL;
+  frame_ctx.slots_p = NULL;
+  frame_ctx.scope_info_p = NULL;
+  frame_ctx.var_end = 0;
+
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_SCOPE_INFO)
+  {
+    const uint16_t *scope_info_end_p = ecma_compiled_code_get_scope_info_end (bytecode_header_p);
+    uint16_t var_end = scope_info_end_p[-1];
+
+    frame_ctx.scope_base_p = lex_env_p;
+    frame_ctx.scope_info_p = scope_info_end_p - 1 - (ident_end - var_end) - var_end;
+    frame_ctx.var_end = var_end;
+
+    if (var_end > register_end
+        && ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE_SLOTS
+        && ((ecma_slot_lex_env_t *) lex_env_p)->bytecode_p == bytecode_header_p)
+    {
+      frame_ctx.slots_p = ECMA_SLOT_LEX_ENV_GET_SLOTS (lex_env_p);
+    }
+  }
+
   frame_ctx.prev_context_p = JERRY_CONTEXT (vm_top_context_p);
   frame_ctx.this_binding = this_binding_value;
   frame_ctx.block_result = ECMA_VALUE_UNDEFINED;
 #ifdef JERRY_ENABLE_LINE_INFO
   frame_ctx.resource_name = ECMA_VALUE_UNDEFINED;
-  frame_ctx.current_line = 0;
 #endif /* JERRY_ENABLE_LINE_INFO */
+#if defined (JERRY_ENABLE_LINE_INFO) || defined (JMEM_ALLOC_SITES)
+  frame_ctx.current_byte_code_p = frame_ctx.byte_code_start_p;
+#endif /* JERRY_ENABLE_LINE_INFO || JMEM_ALLOC_SITES */
   frame_ctx.context_depth = 0;
   frame_ctx.is_eval_code = parse_opts & ECMA_PARSE_DIRECT_EVAL;
 
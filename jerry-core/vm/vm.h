@@ -171,6 +171,11 @@ typedef enum
   VM_OC_BRANCH_IF_LOGICAL_TRUE,  /**< branch if logical true */
   VM_OC_BRANCH_IF_LOGICAL_FALSE, /**< branch if logical false */
 
+  VM_OC_BRANCH_IF_LESS,          /**< branch if less */
+  VM_OC_BRANCH_IF_LESS_EQUAL,    /**< branch if less equal */
+  VM_OC_BRANCH_IF_EQUAL,         /**< branch if equal */
+  VM_OC_BRANCH_IF_STRICT_EQUAL_VALUES, /**< branch if the two operands are strict equal */
+
   VM_OC_PLUS,                    /**< unary plus */
   VM_OC_MINUS,                   /**< unary minus */
   VM_OC_NOT,                     /**< not */
@@ -233,7 +238,6 @@ typedef enum
 #endif /* JERRY_DEBUGGER */
 #ifdef JERRY_ENABLE_LINE_INFO
   VM_OC_RESOURCE_NAME,           /**< resource name of the current function */
-  VM_OC_LINE,                    /**< line number of the next statement */
 #endif /* JERRY_ENABLE_LINE_INFO */
   VM_OC_NONE,                    /**< a special opcode for unsupported byte codes */
 } vm_oc_types;
@@ -252,7 +256,6 @@ typedef enum
 #endif /* !JERRY_DEBUGGER */
 #ifndef JERRY_ENABLE_LINE_INFO
   VM_OC_RESOURCE_NAME = VM_OC_NONE,           /**< resource name of the current function is unused */
-  VM_OC_LINE = VM_OC_NONE,                    /**< line number of the next statement is unused */
 #endif /* !JERRY_ENABLE_LINE_INFO */
 #ifdef CONFIG_DISABLE_ES2015_CLASS
   VM_OC_CLASS_HERITAGE = VM_OC_NONE,          /**< create a super class context */
@@ -297,6 +300,11 @@ typedef enum
  */
 #define VM_OC_LOGICAL_BRANCH_FLAG 0x2
 
+/**
+ * Compare and branch opcodes: jump to target offset if the comparison is false.
+ */
+#define VM_OC_BRANCH_IF_NOT_FLAG 0x8000
+
 /**
  * Bit index shift for non-static property initializers.
  */
@@ -364,6 +372,30 @@ bool vm_is_direct_eval_form_call (void);
 
 ecma_value_t vm_get_backtrace (uint32_t max_depth);
 
+#ifdef JERRY_VM_STATS
+uint32_t vm_get_opcode_group (uint32_t opcode_index);
+#endif /* JERRY_VM_STATS */
+
+#if defined (JERRY_PROFILER) || defined (JERRY_VM_STATS) || defined (JMEM_ALLOC_SITES)
+
+/**
+ * Text output buffer of the profiler and statistics dumps.
+ */
+typedef struct
+{
+  lit_utf8_byte_t *buffer_p; /**< output buffer */
+  size_t buffer_size; /**< size of the output buffer */
+  size_t length; /**< length of the output (may exceed buffer_size) */
+} vm_output_t;
+
+void vm_output_init (vm_output_t *output_p, lit_utf8_byte_t *buffer_p, size_t buffer_size);
+void vm_output_append (vm_output_t *output_p, const lit_utf8_byte_t *chars_p, lit_utf8_size_t size);
+void vm_output_append_ascii (vm_output_t *output_p, const char *str_p);
+void vm_output_append_uint (vm_output_t *output_p, uint64_t value);
+void vm_output_append_address (vm_output_t *output_p, uintptr_t address);
+
+#endif /* JERRY_PROFILER || JERRY_VM_STATS || JMEM_ALLOC_SITES */
+
 /**
  * @}
  * @}
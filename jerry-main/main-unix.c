@@ -13,11 +13,24 @@
  * limitations under the License.
  */
 
+#ifndef WIN32
+#if !defined (_XOPEN_SOURCE) || _XOPEN_SOURCE < 500
+#undef _XOPEN_SOURCE
+/* Required macro for the profiling timer (setitimer and sigaction) */
+#define _XOPEN_SOURCE 500
+#endif
+#endif /* !WIN32 */
+
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef WIN32
+#include <signal.h>
+#include <sys/time.h>
+#endif /* !WIN32 */
+
 #include "jerryscript.h"
 #include "jerryscript-ext/debugger.h"
 #include "jerryscript-ext/handler.h"
@@ -36,6 +49,17 @@
  */
 #define JERRY_SNAPSHOT_BUFFER_SIZE (JERRY_BUFFER_SIZE / sizeof (uint32_t))
 
+/**
+ * Sampling frequency of the CPU profiler (in Hz)
+ */
+#define JERRY_PROFILER_FREQUENCY (1000)
+
+/**
+ * Number of byte code instructions between two samples of the CPU profiler
+ * if no profiling timer is available
+ */
+#define JERRY_PROFILER_INSTRUCTION_INTERVAL (10000)
+
 /**
  * Standalone Jerry exit codes
  */
@@ -273,6 +297,61 @@ register_js_function (const char *name_p, /**< name of the function */
   jerry_release_value (result_val);
 } /* register_js_function */
 
+/**
+ * Size of the buffer used by the structuredClone function.
+ */
+#define STRUCTURED_CLONE_BUFFER_SIZE 4096
+
+/**
+ * Clone a value with jerry_serialize and jerry_deserialize.
+ *
+ * @return cloned value
+ */
+static jerry_value_t
+structured_clone_handler (const jerry_value_t func_obj_val, /**< function object */
+                          const jerry_value_t this_p, /**< this arg */
+                          const jerry_value_t args_p[], /**< function arguments */
+                          const jerry_length_t args_cnt) /**< number of function arguments */
+{
+  (void) func_obj_val; /* unused */
+  (void) this_p; /* unused */
+
+  static uint8_t clone_buffer[STRUCTURED_CLONE_BUFFER_SIZE];
+  jerry_value_t value = (args_cnt > 0) ? args_p[0] : jerry_create_undefined ();
+  jerry_value_t size_val = jerry_serialize (value, clone_buffer, sizeof (clone_buffer));
+
+  if (jerry_value_is_error (size_val))
+  {
+    return size_val;
+  }
+
+  size_t size = (size_t) jerry_get_number_value (size_val);
+  jerry_release_value (size_val);
+
+  if (size <= sizeof (clone_buffer))
+  {
+    return jerry_deserialize (clone_buffer, size);
+  }
+
+  uint8_t *buffer_p = (uint8_t *) malloc (size);
+
+  if (buffer_p == NULL)
+  {
+    return jerry_create_error (JERRY_ERROR_RANGE, (const jerry_char_t *) "Out of memory.");
+  }
+
+  jerry_value_t result = jerry_serialize (value, buffer_p, size);
+
+  if (!jerry_value_is_error (result))
+  {
+    jerry_release_value (result);
+    result = jerry_deserialize (buffer_p, size);
+  }
+
+  free (buffer_p);
+  return result;
+} /* structured_clone_handler */
+
 
 /**
  * Runs the source code received by jerry_debugger_wait_for_client_source.
@@ -304,6 +383,263 @@ wait_for_source_callback (const jerry_char_t *resource_name_p, /**< resource nam
 } /* wait_for_source_callback */
 
 
+#ifndef WIN32
+
+/**
+ * Signal handler of the profiling timer
+ */
+static void
+profiler_signal_handler (int signal_number) /**< signal number */
+{
+  (void) signal_number; /* unused */
+  jerry_profiler_request_sample ();
+} /* profiler_signal_handler */
+
+#endif /* !WIN32 */
+
+/**
+ * Start the CPU profiler
+ */
+static void
+start_cpu_profiler (void)
+{
+#ifndef WIN32
+  struct itimerval timer;
+  timer.it_interval.tv_sec = 0;
+  timer.it_interval.tv_usec = 1000000 / JERRY_PROFILER_FREQUENCY;
+  timer.it_value = timer.it_interval;
+
+  struct sigaction action;
+  memset (&action, 0, sizeof (action));
+  action.sa_handler = profiler_signal_handler;
+  action.sa_flags = SA_RESTART;
+  sigemptyset (&action.sa_mask);
+
+  jerry_profiler_start (0);
+  sigaction (SIGPROF, &action, NULL);
+  setitimer (ITIMER_PROF, &timer, NULL);
+#else /* WIN32 */
+  jerry_profiler_start (JERRY_PROFILER_INSTRUCTION_INTERVAL);
+#endif /* !WIN32 */
+} /* start_cpu_profiler */
+
+/**
+ * Stop the CPU profiler and save the collected samples in collapsed stack format
+ */
+static void
+stop_cpu_profiler (const char *file_name) /**< output file name */
+{
+#ifndef WIN32
+  struct itimerval timer;
+  memset (&timer, 0, sizeof (timer));
+
+  setitimer (ITIMER_PROF, &timer, NULL);
+#endif /* !WIN32 */
+
+  jerry_profiler_stop ();
+
+  size_t size = jerry_profiler_get_collapsed_stacks (NULL, 0);
+  jerry_char_t *buffer_p = (jerry_char_t *) malloc (size + 1);
+  FILE *file_p = fopen (file_name, "wb");
+
+  if (buffer_p == NULL || file_p == NULL)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to save CPU profile to '%s'\n", file_name);
+  }
+  else
+  {
+    jerry_profiler_get_collapsed_stacks (buffer_p, size);
+    fwrite (buffer_p, 1, size, file_p);
+  }
+
+  if (file_p != NULL)
+  {
+    fclose (file_p);
+  }
+
+  free (buffer_p);
+} /* stop_cpu_profiler */
+
+/**
+ * Print the VM execution statistics in JSON format to stderr
+ */
+static void
+print_vm_statistics (void)
+{
+  size_t size = jerry_get_vm_stats_json (NULL, 0);
+  jerry_char_t *buffer_p = (jerry_char_t *) malloc (size + 1);
+
+  if (buffer_p == NULL)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: not enough memory to print VM statistics\n");
+    return;
+  }
+
+  jerry_get_vm_stats_json (buffer_p, size);
+  fwrite (buffer_p, 1, size, stderr);
+  free (buffer_p);
+} /* print_vm_statistics */
+
+/**
+ * Print the allocation sites in JSON format to stderr
+ */
+static void
+print_alloc_sites (void)
+{
+  size_t size = jerry_get_alloc_sites_json (NULL, 0);
+  jerry_char_t *buffer_p = (jerry_char_t *) malloc (size + 1);
+
+  if (buffer_p == NULL)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: not enough memory to print allocation sites\n");
+    return;
+  }
+
+  /* Printing may create new sites, so the output can be longer the second time. */
+  size_t output_size = jerry_get_alloc_sites_json (buffer_p, size);
+  fwrite (buffer_p, 1, (output_size < size) ? output_size : size, stderr);
+  free (buffer_p);
+} /* print_alloc_sites */
+
+/**
+ * Heap snapshot callback which writes the stream into a file
+ *
+ * @return true - if the data is written successfully, false - otherwise
+ */
+static bool
+heap_snapshot_write_cb (const jerry_char_t *buffer_p, /**< stream data */
+                        size_t buffer_size, /**< size of the data */
+                        void *user_p) /**< output file */
+{
+  return fwrite (buffer_p, 1, buffer_size, (FILE *) user_p) == buffer_size;
+} /* heap_snapshot_write_cb */
+
+/**
+ * Save a heap snapshot of the live objects into a file
+ */
+static void
+save_heap_snapshot (const char *file_name) /**< output file name */
+{
+  FILE *file_p = fopen (file_name, "wb");
+
+  if (file_p == NULL || !jerry_heap_snapshot (heap_snapshot_write_cb, file_p))
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to save heap snapshot to '%s'\n", file_name);
+  }
+
+  if (file_p != NULL)
+  {
+    fclose (file_p);
+  }
+} /* save_heap_snapshot */
+
+/**
+ * Native handlers which can be stored in heap images
+ */
+static const jerry_external_handler_t heap_image_handlers[] =
+{
+  jerryx_handler_assert,
+  jerryx_handler_gc,
+  jerryx_handler_print,
+  structured_clone_handler
+};
+
+/**
+ * Number of native handlers which can be stored in heap images
+ */
+#define HEAP_IMAGE_HANDLER_COUNT (sizeof (heap_image_handlers) / sizeof (heap_image_handlers[0]))
+
+/**
+ * Map a native pointer of the heap to an index of heap_image_handlers (plus one)
+ *
+ * @return mapped value, or 0 for unknown pointers
+ */
+static uintptr_t
+heap_image_save_pointer_cb (uintptr_t pointer, /**< native pointer */
+                            void *user_p) /**< [out] set to true for unknown pointers */
+{
+  for (uintptr_t i = 0; i < HEAP_IMAGE_HANDLER_COUNT; i++)
+  {
+    if ((uintptr_t) heap_image_handlers[i] == pointer)
+    {
+      return i + 1;
+    }
+  }
+
+  *(bool *) user_p = true;
+  return 0;
+} /* heap_image_save_pointer_cb */
+
+/**
+ * Map a value saved by heap_image_save_pointer_cb back to a native pointer
+ *
+ * @return native pointer
+ */
+static uintptr_t
+heap_image_restore_pointer_cb (uintptr_t value, /**< saved value */
+                               void *user_p) /**< unused */
+{
+  (void) user_p; /* unused */
+
+  if (value == 0 || value > HEAP_IMAGE_HANDLER_COUNT)
+  {
+    return 0;
+  }
+
+  return (uintptr_t) heap_image_handlers[value - 1];
+} /* heap_image_restore_pointer_cb */
+
+/**
+ * Save a heap image of the engine into a file
+ */
+static void
+save_heap_image (const char *file_name) /**< output file name */
+{
+  bool has_unknown_pointer = false;
+  jerry_value_t size_val = jerry_save_heap_image (NULL, 0, heap_image_save_pointer_cb, &has_unknown_pointer);
+  uint8_t *buffer_p = NULL;
+  size_t size = 0;
+
+  if (!jerry_value_is_error (size_val))
+  {
+    size = (size_t) jerry_get_number_value (size_val);
+    buffer_p = (uint8_t *) malloc (size);
+  }
+
+  jerry_release_value (size_val);
+
+  if (buffer_p != NULL)
+  {
+    size_val = jerry_save_heap_image (buffer_p, size, heap_image_save_pointer_cb, &has_unknown_pointer);
+
+    if (jerry_value_is_error (size_val) || jerry_get_number_value (size_val) != (double) size)
+    {
+      size = 0;
+    }
+
+    jerry_release_value (size_val);
+  }
+
+  FILE *file_p = NULL;
+
+  if (buffer_p != NULL && size > 0 && !has_unknown_pointer)
+  {
+    file_p = fopen (file_name, "wb");
+  }
+
+  if (file_p == NULL || fwrite (buffer_p, 1, size, file_p) != size)
+  {
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to save heap image to '%s'\n", file_name);
+  }
+
+  if (file_p != NULL)
+  {
+    fclose (file_p);
+  }
+
+  free (buffer_p);
+} /* save_heap_image */
+
 /**
  * Command line option IDs
  */
@@ -312,6 +648,13 @@ typedef enum
   OPT_HELP,
   OPT_VERSION,
   OPT_MEM_STATS,
+  OPT_CPU_PROFILE,
+  OPT_VM_STATS,
+  OPT_HEAP_SNAPSHOT,
+  OPT_ALLOC_SITES,
+  OPT_HEAP_IMAGE,
+  OPT_SAVE_HEAP_IMAGE,
+  OPT_EXPOSE_STRUCTURED_CLONE,
   OPT_PARSE_ONLY,
   OPT_SHOW_OP,
   OPT_SHOW_RE_OP,
@@ -336,6 +679,20 @@ static const cli_opt_t main_opts[] =
                .help = "print tool and library version and exit"),
   CLI_OPT_DEF (.id = OPT_MEM_STATS, .longopt = "mem-stats",
                .help = "dump memory statistics"),
+  CLI_OPT_DEF (.id = OPT_CPU_PROFILE, .longopt = "cpu-profile", .meta = "FILE",
+               .help = "save sampled call stacks in collapsed stack format (for flame graphs)"),
+  CLI_OPT_DEF (.id = OPT_VM_STATS, .longopt = "vm-stats",
+               .help = "dump VM execution statistics in JSON format to stderr"),
+  CLI_OPT_DEF (.id = OPT_HEAP_SNAPSHOT, .longopt = "heap-snapshot", .meta = "FILE",
+               .help = "save a snapshot of the live objects after the execution"),
+  CLI_OPT_DEF (.id = OPT_ALLOC_SITES, .longopt = "alloc-sites",
+               .help = "dump allocation sites in JSON format to stderr"),
+  CLI_OPT_DEF (.id = OPT_HEAP_IMAGE, .longopt = "heap-image", .meta = "FILE",
+               .help = "initialize the engine from a heap image"),
+  CLI_OPT_DEF (.id = OPT_SAVE_HEAP_IMAGE, .longopt = "save-heap-image", .meta = "FILE",
+               .help = "save a heap image after the execution"),
+  CLI_OPT_DEF (.id = OPT_EXPOSE_STRUCTURED_CLONE, .longopt = "expose-structured-clone",
+               .help = "add the structuredClone function to the global object"),
   CLI_OPT_DEF (.id = OPT_PARSE_ONLY, .longopt = "parse-only",
                .help = "don't execute JS input"),
   CLI_OPT_DEF (.id = OPT_SHOW_OP, .longopt = "show-opcodes",
@@ -418,9 +775,27 @@ context_alloc (size_t size,
  */
 static void
 init_engine (jerry_init_flag_t flags, /**< initialized flags for the engine */
+             const char *heap_image_file_name, /**< heap image to restore (can be NULL) */
+             bool expose_structured_clone, /**< register the structuredClone function or not */
              bool debug_server, /**< enable the debugger init or not */
              uint16_t debug_port) /**< the debugger port */
 {
+  if (heap_image_file_name != NULL)
+  {
+    size_t image_size;
+    const uint8_t *image_p = (const uint8_t *) read_file (heap_image_file_name, &image_size);
+
+    if (image_p != NULL
+        && jerry_init_from_heap_image (flags, image_p, image_size, heap_image_restore_pointer_cb, NULL))
+    {
+      /* The global functions are part of the image. */
+      return;
+    }
+
+    jerry_port_log (JERRY_LOG_LEVEL_ERROR, "Error: failed to load heap image from '%s'\n", heap_image_file_name);
+    exit (JERRY_STANDALONE_EXIT_CODE_FAIL);
+  }
+
   jerry_init (flags);
   if (debug_server)
   {
@@ -431,6 +806,11 @@ init_engine (jerry_init_flag_t flags, /**< initialized flags for the engine */
   register_js_function ("assert", jerryx_handler_assert);
   register_js_function ("gc", jerryx_handler_gc);
   register_js_function ("print", jerryx_handler_print);
+
+  if (expose_structured_clone)
+  {
+    register_js_function ("structuredClone", structured_clone_handler);
+  }
 } /* init_engine */
 
 int
@@ -448,6 +828,13 @@ main (int argc,
   int exec_snapshots_count = 0;
 
   bool is_parse_only = false;
+  const char *cpu_profile_file_name = NULL;
+  bool print_vm_stats = false;
+  const char *heap_snapshot_file_name = NULL;
+  bool print_alloc_sites_json = false;
+  const char *heap_image_file_name = NULL;
+  const char *save_heap_image_file_name = NULL;
+  bool expose_structured_clone = false;
 
   bool start_debug_server = false;
   uint16_t debug_port = 5001;
@@ -480,6 +867,78 @@ main (int argc,
         }
         break;
       }
+      case OPT_CPU_PROFILE:
+      {
+        if (check_feature (JERRY_FEATURE_PROFILER, cli_state.arg))
+        {
+          cpu_profile_file_name = cli_consume_string (&cli_state);
+        }
+        else
+        {
+          cli_consume_string (&cli_state);
+        }
+        break;
+      }
+      case OPT_VM_STATS:
+      {
+        if (check_feature (JERRY_FEATURE_VM_STATS, cli_state.arg))
+        {
+          print_vm_stats = true;
+        }
+        break;
+      }
+      case OPT_HEAP_SNAPSHOT:
+      {
+        if (check_feature (JERRY_FEATURE_HEAP_SNAPSHOT, cli_state.arg))
+        {
+          heap_snapshot_file_name = cli_consume_string (&cli_state);
+        }
+        else
+        {
+          cli_consume_string (&cli_state);
+        }
+        break;
+      }
+      case OPT_ALLOC_SITES:
+      {
+        if (check_feature (JERRY_FEATURE_MEM_ALLOC_SITES, cli_state.arg))
+        {
+          print_alloc_sites_json = true;
+        }
+        break;
+      }
+      case OPT_HEAP_IMAGE:
+      {
+        if (check_feature (JERRY_FEATURE_HEAP_IMAGE, cli_state.arg))
+        {
+          heap_image_file_name = cli_consume_string (&cli_state);
+        }
+        else
+        {
+          cli_consume_string (&cli_state);
+        }
+        break;
+      }
+      case OPT_SAVE_HEAP_IMAGE:
+      {
+        if (check_feature (JERRY_FEATURE_HEAP_IMAGE, cli_state.arg))
+        {
+          save_heap_image_file_name = cli_consume_string (&cli_state);
+        }
+        else
+        {
+          cli_consume_string (&cli_state);
+        }
+        break;
+      }
+      case OPT_EXPOSE_STRUCTURED_CLONE:
+      {
+        if (check_feature (JERRY_FEATURE_STRUCTURED_CLONE, cli_state.arg))
+        {
+          expose_structured_clone = true;
+        }
+        break;
+      }
       case OPT_PARSE_ONLY:
       {
         is_parse_only = true;
@@ -612,7 +1071,12 @@ main (int argc,
 
 #endif /* JERRY_ENABLE_EXTERNAL_CONTEXT */
 
-  init_engine (flags, start_debug_server, debug_port);
+  init_engine (flags, heap_image_file_name, expose_structured_clone, start_debug_server, debug_port);
+
+  if (cpu_profile_file_name != NULL)
+  {
+    start_cpu_profiler ();
+  }
 
   jerry_value_t ret_value = jerry_create_undefined ();
 
@@ -730,7 +1194,7 @@ main (int argc,
             break;
           }
 
-          init_engine (flags, true, debug_port);
+          init_engine (flags, NULL, expose_structured_clone, true, debug_port);
 
           ret_value = jerry_create_undefined ();
         }
@@ -774,7 +1238,7 @@ main (int argc,
 
     jerry_cleanup ();
 
-    init_engine (flags, true, debug_port);
+    init_engine (flags, NULL, expose_structured_clone, true, debug_port);
 
     ret_value = jerry_create_undefined ();
   }
@@ -871,6 +1335,31 @@ main (int argc,
 
   jerry_release_value (ret_value);
 
+  if (cpu_profile_file_name != NULL)
+  {
+    stop_cpu_profiler (cpu_profile_file_name);
+  }
+
+  if (print_vm_stats)
+  {
+    print_vm_statistics ();
+  }
+
+  if (heap_snapshot_file_name != NULL)
+  {
+    save_heap_snapshot (heap_snapshot_file_name);
+  }
+
+  if (print_alloc_sites_json)
+  {
+    print_alloc_sites ();
+  }
+
+  if (save_heap_image_file_name != NULL && ret_code == JERRY_STANDALONE_EXIT_CODE_OK)
+  {
+    save_heap_image (save_heap_image_file_name);
+  }
+
   jerry_cleanup ();
 #ifdef JERRY_ENABLE_EXTERNAL_CONTEXT
   free (context_p);
@@ -0,0 +1,39 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+
+/**
+ * Default implementation of jerry_port_alloc_arraybuffer. Uses 'malloc'.
+ *
+ * @return pointer to the memory, or NULL if there is not enough memory
+ */
+void *
+jerry_port_alloc_arraybuffer (size_t size) /**< size of the memory */
+{
+  return malloc (size);
+} /* jerry_port_alloc_arraybuffer */
+
+/**
+ * Default implementation of jerry_port_free_arraybuffer. Uses 'free'.
+ */
+void
+jerry_port_free_arraybuffer (void *buffer_p) /**< memory */
+{
+  free (buffer_p);
+} /* jerry_port_free_arraybuffer */
@@ -0,0 +1,37 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#endif /* HAVE_SYS_MMAN_H */
+
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+
+/**
+ * Default implementation of jerry_port_release_heap_pages. Uses 'madvise'
+ * with MADV_DONTNEED if it is available, does nothing otherwise.
+ */
+void
+jerry_port_release_heap_pages (void *start_p, /**< start of the pages */
+                               size_t size) /**< size of the pages */
+{
+#if defined (HAVE_SYS_MMAN_H) && defined (MADV_DONTNEED)
+  madvise (start_p, size, MADV_DONTNEED);
+#else /* !HAVE_SYS_MMAN_H || !MADV_DONTNEED */
+  (void) start_p;
+  (void) size;
+#endif /* HAVE_SYS_MMAN_H && MADV_DONTNEED */
+} /* jerry_port_release_heap_pages */
@@ -0,0 +1,42 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "jerryscript-port.h"
+#include "jerryscript-port-default.h"
+
+/**
+ * Default implementation of jerry_port_alloc_heap_region. Uses 'malloc',
+ * which returns suitably aligned memory.
+ *
+ * @return pointer to the region, or NULL if there is not enough memory
+ */
+void *
+jerry_port_alloc_heap_region (size_t size) /**< size of the region */
+{
+  return malloc (size);
+} /* jerry_port_alloc_heap_region */
+
+/**
+ * Default implementation of jerry_port_free_heap_region. Uses 'free'.
+ */
+void
+jerry_port_free_heap_region (void *region_p, /**< region */
+                             size_t size) /**< size of the region */
+{
+  (void) size;
+  free (region_p);
+} /* jerry_port_free_heap_region */
@@ -0,0 +1,42 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* A short load spike fills most of the heap, then the engine idles with a
+ * small live set. Run it with "tools/rss-measure.sh JERRY transient-load.js --final":
+ * the final RSS drops after the spike if the free heap pages are returned
+ * to the system (--mem-release-pages=on). */
+
+var spike = [];
+
+for (var i = 0; i < 6000; i++)
+{
+  spike.push ({ index: i, name: "item" + i });
+}
+
+function idle ()
+{
+  var sum = 0;
+
+  for (var i = 0; i < 3000000; i++)
+  {
+    sum = (sum + i) % 1000;
+  }
+
+  return sum;
+}
+
+idle ();
+spike = undefined;
+gc (true);
+idle ();
@@ -0,0 +1,35 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Array.prototype builtins with callbacks, sorting and slicing. */
+
+var data = [];
+for (var i = 0; i < 200; i++)
+{
+  data.push ((i * 7919) % 200);
+}
+
+var result = 0;
+for (var round = 0; round < 100; round++)
+{
+  var doubled = data.map (function (value) { return value * 2; });
+  var even = doubled.filter (function (value) { return value % 4 === 0; });
+  var sum = even.reduce (function (acc, value) { return acc + value; }, 0);
+  var sorted = data.slice ().sort (function (a, b) { return a - b; });
+
+  result += sum + sorted[round] + sorted.indexOf (round) + (data.some (function (value) { return value > 198; }) ? 1 : 0);
+}
+
+assert (result === 100 * 19800 + 2 * (99 * 100 / 2) + 100);
@@ -0,0 +1,44 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Closure creation and calls that read and update captured variables. */
+
+function make_counter (step)
+{
+  var value = 0;
+  return function ()
+  {
+    value += step;
+    return value;
+  };
+}
+
+var total = 0;
+for (var i = 0; i < 2000; i++)
+{
+  var counter = make_counter (i % 7);
+  for (var j = 0; j < 50; j++)
+  {
+    total += counter ();
+  }
+}
+
+var expected = 0;
+for (var i = 0; i < 2000; i++)
+{
+  expected += (i % 7) * (50 * 51 / 2);
+}
+
+assert (total === expected);
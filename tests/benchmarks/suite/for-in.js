@@ -0,0 +1,46 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Enumerating the properties of records which have the same properties. */
+
+var records = [];
+
+for (var i = 0; i < 200; i++)
+{
+  records.push ({ id: i, name: "record", x: i * 2, y: i * 3, visible: (i % 2) === 0 });
+}
+
+var total = 0;
+var key_count = 0;
+
+for (var round = 0; round < 50; round++)
+{
+  for (var j = 0; j < records.length; j++)
+  {
+    var record = records[j];
+
+    for (var key in record)
+    {
+      if (typeof record[key] === "number")
+      {
+        total += record[key];
+      }
+    }
+
+    key_count += Object.keys (record).length;
+  }
+}
+
+assert (total === 50 * (199 * 200 / 2) * 6);
+assert (key_count === 50 * 200 * 5);
@@ -0,0 +1,55 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Functions which read built-in objects and top level variables in loops. */
+
+var scale = 3;
+var total = 0;
+
+function sum_floors (length)
+{
+  var sum = 0;
+
+  for (var i = 0; i < length; i++)
+  {
+    sum += Math.floor (i / scale) + Math.abs (-scale);
+  }
+
+  return sum;
+}
+
+function update_total (length)
+{
+  for (var i = 0; i < length; i++)
+  {
+    total += i % scale;
+  }
+}
+
+var result = 0;
+
+for (var round = 0; round < 20; round++)
+{
+  result += sum_floors (3000);
+  update_total (3000);
+}
+
+var expected_sum = 0;
+for (var j = 0; j < 3000; j++)
+{
+  expected_sum += Math.floor (j / 3) + 3;
+}
+
+assert (result === 20 * expected_sum);
+assert (total === 20 * 3000);
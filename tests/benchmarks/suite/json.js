@@ -0,0 +1,38 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* JSON serialization and parsing of nested records. */
+
+var records = [];
+for (var i = 0; i < 30; i++)
+{
+  records.push ({
+    id: i,
+    name: 'record' + i,
+    active: (i % 2) === 0,
+    tags: ['a', 'b', 'c'],
+    position: { x: i * 1.5, y: -i }
+  });
+}
+
+var checksum = 0;
+for (var round = 0; round < 150; round++)
+{
+  var text = JSON.stringify (records);
+  var parsed = JSON.parse (text);
+  checksum += parsed[round % parsed.length].id + parsed.length;
+}
+
+assert (checksum === 150 * 30 + 5 * (29 * 30 / 2));
@@ -0,0 +1,44 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Map insertion, lookup and deletion with string and number keys. */
+
+var found = 0;
+for (var round = 0; round < 40; round++)
+{
+  var map = new Map ();
+  for (var i = 0; i < 200; i++)
+  {
+    map.set ('key' + i, i);
+    map.set (i, 'value' + i);
+  }
+
+  for (var i = 0; i < 200; i++)
+  {
+    if (map.get ('key' + i) === i && map.has (i))
+    {
+      found++;
+    }
+  }
+
+  for (var i = 0; i < 200; i += 2)
+  {
+    map.delete (i);
+  }
+
+  found += map.size;
+}
+
+assert (found === 40 * (200 + 300));
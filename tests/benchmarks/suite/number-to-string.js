@@ -0,0 +1,38 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Number to string conversion: JSON serialization of numeric arrays and
+ * string concatenation with non-integer numbers. */
+
+var values = [];
+for (var i = 0; i < 200; i++)
+{
+  values.push (i * 1.25 + i / 3);
+}
+
+var length = 0;
+for (var round = 0; round < 300; round++)
+{
+  length += JSON.stringify (values).length;
+}
+
+var text = '';
+for (var i = 0; i < 30000; i++)
+{
+  text = 'v' + (i % 50) / 8 + ',' + (1 / (i + 1));
+  length += text.length;
+}
+
+assert (JSON.stringify ([0.1, 1e21, 1.5e-7, 123.456]) === '[0.1,1e+21,1.5e-7,123.456]');
+assert (length > 0);
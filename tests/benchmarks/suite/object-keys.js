@@ -0,0 +1,39 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Listing the property names of objects with many properties. */
+
+var table = {};
+
+for (var i = 0; i < 2000; i++)
+{
+  table["key" + i] = i;
+}
+
+var count = 0;
+var sum = 0;
+
+for (var round = 0; round < 20; round++)
+{
+  var keys = Object.keys (table);
+  count += keys.length;
+
+  for (var key in table)
+  {
+    sum += table[key];
+  }
+}
+
+assert (count === 20 * 2000);
+assert (sum === 20 * (1999 * 2000 / 2));
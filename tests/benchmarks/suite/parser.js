@@ -0,0 +1,33 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Parsing of generated source code through the Function constructor. */
+
+var source = '';
+for (var i = 0; i < 40; i++)
+{
+  source += 'var v' + i + ' = { a: ' + i + ', b: "str' + i + '", c: [1, 2, 3] };\n';
+  source += 'function f' + i + ' (x, y) { if (x > y) { return x - y; } else { for (var k = 0; k < y; k++) { x += k; } return x; } }\n';
+  source += 'v' + i + '.a = f' + i + ' (v' + i + '.a, ' + (i % 5) + ');\n';
+}
+source += 'return v39.a;';
+
+var result = 0;
+for (var round = 0; round < 100; round++)
+{
+  result += new Function (source + ' // ' + round) ();
+}
+
+assert (result === 100 * 35);
@@ -0,0 +1,42 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Promise creation, resolution and chaining through the job queue. */
+
+var settled = 0;
+var chained = 0;
+
+function run_batch (batch)
+{
+  var chains = [];
+  for (var i = 0; i < 200; i++)
+  {
+    chains.push (new Promise (function (resolve) { resolve (i); })
+      .then (function (value) { return value + 1; })
+      .then (function (value) { chained += value; settled++; }));
+  }
+
+  /* Start the next batch only after this one has settled to bound the number of live promises. */
+  return Promise.all (chains).then (function ()
+  {
+    return batch > 1 ? run_batch (batch - 1) : undefined;
+  });
+}
+
+run_batch (10).then (function ()
+{
+  assert (settled === 10 * 200);
+  assert (chained === 10 * (200 * 201 / 2));
+});
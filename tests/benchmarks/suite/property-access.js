@@ -0,0 +1,41 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Named property reads and writes on objects sharing the same layout. */
+
+function Point (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+var points = [];
+for (var i = 0; i < 64; i++)
+{
+  points.push (new Point (i, 2 * i));
+}
+
+var sum = 0;
+for (var round = 0; round < 2000; round++)
+{
+  for (var i = 0; i < points.length; i++)
+  {
+    var p = points[i];
+    p.x = p.x + 1;
+    sum += p.x - p.y;
+  }
+}
+
+assert (sum === -2000 * (63 * 64 / 2) + 64 * (2000 * 2001 / 2));
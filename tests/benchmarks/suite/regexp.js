@@ -0,0 +1,41 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Regular expression matching, capturing and replacing. */
+
+var text = 'name=alpha; id=17; name=beta; id=42; name=gamma; id=1008';
+var matches = 0;
+var ids = 0;
+
+for (var round = 0; round < 1000; round++)
+{
+  var name_re = /name=(\w+)/g;
+  var match;
+  while ((match = name_re.exec (text)) !== null)
+  {
+    matches += match[1].length;
+  }
+
+  var id_list = text.match (/\d+/g);
+  for (var i = 0; i < id_list.length; i++)
+  {
+    ids += parseInt (id_list[i], 10);
+  }
+
+  text = text.replace (/; /g, ';  ').replace (/;\s+/g, '; ');
+}
+
+assert (matches === 1000 * 14);
+assert (ids === 1000 * 1067);
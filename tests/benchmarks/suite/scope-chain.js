@@ -0,0 +1,64 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Callbacks which read and update variables of several enclosing functions. */
+
+function make_accumulator (scale)
+{
+  var sum = 0;
+  var count = 0;
+
+  function make_callback (offset)
+  {
+    var weight = offset + 1;
+
+    return function (value)
+    {
+      sum += (value + offset) * weight * scale;
+      count++;
+    };
+  }
+
+  return {
+    callbacks: [make_callback (0), make_callback (1), make_callback (2)],
+    result: function () { return sum + count; }
+  };
+}
+
+function for_each (length, callback)
+{
+  for (var i = 0; i < length; i++)
+  {
+    callback (i);
+  }
+}
+
+var accumulator = make_accumulator (2);
+
+for (var round = 0; round < 40; round++)
+{
+  for (var k = 0; k < accumulator.callbacks.length; k++)
+  {
+    for_each (1000, accumulator.callbacks[k]);
+  }
+}
+
+var expected = 0;
+for (var offset = 0; offset < 3; offset++)
+{
+  expected += 40 * 2 * (offset + 1) * (999 * 1000 / 2 + 1000 * offset);
+}
+expected += 40 * 3 * 1000;
+
+assert (accumulator.result () === expected);
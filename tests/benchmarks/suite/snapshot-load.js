@@ -0,0 +1,43 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Many small function declarations, executed from a snapshot to measure snapshot loading. */
+
+function add (a, b) { return a + b; }
+function sub (a, b) { return a - b; }
+function mul (a, b) { return a * b; }
+function div (a, b) { return a / b; }
+function min (a, b) { return a < b ? a : b; }
+function max (a, b) { return a > b ? a : b; }
+function clamp (v, lo, hi) { return min (max (v, lo), hi); }
+function sum (list) { var s = 0; for (var i = 0; i < list.length; i++) { s = add (s, list[i]); } return s; }
+function mean (list) { return div (sum (list), list.length); }
+function square (x) { return mul (x, x); }
+function variance (list) { var m = mean (list); var s = 0; for (var i = 0; i < list.length; i++) { s += square (sub (list[i], m)); } return div (s, list.length); }
+function Vector (x, y) { this.x = x; this.y = y; }
+Vector.prototype.add = function (other) { return new Vector (add (this.x, other.x), add (this.y, other.y)); };
+Vector.prototype.scale = function (f) { return new Vector (mul (this.x, f), mul (this.y, f)); };
+Vector.prototype.length = function () { return Math.sqrt (add (square (this.x), square (this.y))); };
+function Stack () { this.items = []; }
+Stack.prototype.push = function (v) { this.items.push (v); return this; };
+Stack.prototype.pop = function () { return this.items.pop (); };
+Stack.prototype.peek = function () { return this.items[this.items.length - 1]; };
+Stack.prototype.isEmpty = function () { return this.items.length === 0; };
+function tokenize (text) { var tokens = []; var current = ''; for (var i = 0; i < text.length; i++) { var c = text.charAt (i); if (c === ' ') { if (current) { tokens.push (current); } current = ''; } else { current += c; } } if (current) { tokens.push (current); } return tokens; }
+function evaluate (text) { var stack = new Stack (); var tokens = tokenize (text); for (var i = 0; i < tokens.length; i++) { var t = tokens[i]; if (t === '+') { stack.push (add (stack.pop (), stack.pop ())); } else if (t === '*') { stack.push (mul (stack.pop (), stack.pop ())); } else { stack.push (parseInt (t, 10)); } } return stack.pop (); }
+
+var check = evaluate ('1 2 + 3 *') + clamp (variance ([1, 2, 3, 4]), 0, 1) + new Vector (3, 4).scale (2).length ();
+
+assert (check === 9 + 1 + 10);
@@ -0,0 +1,37 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* String concatenation, joining and character access. */
+
+var length = 0;
+for (var round = 0; round < 200; round++)
+{
+  var str = '';
+  for (var i = 0; i < 100; i++)
+  {
+    str += 'item' + i + ',';
+  }
+
+  var parts = [];
+  for (var i = 0; i < 100; i++)
+  {
+    parts.push (String.fromCharCode (97 + i % 26));
+  }
+
+  var joined = parts.join ('-');
+  length += str.length + joined.length + str.charCodeAt (str.length - 1) - 44;
+}
+
+assert (length === 200 * (690 + 199));
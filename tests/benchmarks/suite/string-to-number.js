@@ -0,0 +1,43 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* String to number conversion: JSON parsing of numeric arrays and explicit
+ * conversion of short decimals, long decimals and large exponents. */
+
+var strings = [];
+for (var i = 0; i < 200; i++)
+{
+  strings.push ((i * 1.25 + i / 3).toString ());
+  strings.push ('-' + (i % 97) + '.' + (i % 13) + 'e' + (i % 40 - 20));
+  strings.push ((i / 7).toString () + 'e' + (i % 300 - 150));
+}
+
+var json = '[' + strings.slice (0, 200).join (',') + ']';
+
+var sum = 0;
+for (var round = 0; round < 300; round++)
+{
+  sum += JSON.parse (json).length;
+}
+
+for (var round = 0; round < 500; round++)
+{
+  for (var i = 0; i < strings.length; i++)
+  {
+    sum += +strings[i];
+  }
+}
+
+assert (+'0.1' === 0.1 && +'1e23' === 1e23 && +'2.2250738585072011e-308' === 2.225073858507201e-308);
+assert (!isNaN (sum));
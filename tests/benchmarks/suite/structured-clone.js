@@ -0,0 +1,47 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Passing records between contexts with the binary structured clone
+ * serializer, compare with structured-clone-json.js. */
+
+var records = [];
+for (var i = 0; i < 40; i++)
+{
+  records.push ({
+    id: i,
+    name: 'record' + i,
+    active: (i % 2) === 0,
+    score: i * 0.25,
+    tags: ['alpha', 'beta', 'gamma'],
+    position: { x: i * 1.5, y: -i, z: { depth: i % 7 } }
+  });
+}
+
+var checksum = 0;
+var expected = 0;
+for (var round = 0; round < 150; round++)
+{
+  var copy = structuredClone (records);
+  var record = copy[round % copy.length];
+  checksum += record.id + record.position.z.depth + copy.length;
+  expected += (round % 40) + (round % 40) % 7 + 40;
+}
+
+var graph = { records: records, first: records[0] };
+graph.self = graph;
+var graph_copy = structuredClone (graph);
+
+assert (checksum === expected);
+assert (graph_copy.self === graph_copy && graph_copy.first === graph_copy.records[0]);
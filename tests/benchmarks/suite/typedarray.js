@@ -0,0 +1,47 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Element access and bulk operations on typed arrays. */
+
+var buffer = new ArrayBuffer (4096);
+var bytes = new Uint8Array (buffer);
+var words = new Int32Array (buffer);
+var floats = new Float64Array (256);
+
+var sum = 0;
+for (var round = 0; round < 50; round++)
+{
+  for (var i = 0; i < bytes.length; i++)
+  {
+    bytes[i] = (i + round) & 0xff;
+  }
+
+  for (var i = 0; i < floats.length; i++)
+  {
+    floats[i] = words[i] / 256;
+  }
+
+  var copy = new Uint8Array (bytes.subarray (16, 32));
+  sum += copy[round % 16] + words[1] % 2;
+}
+
+var expected = 0;
+for (var round = 0; round < 50; round++)
+{
+  /* Little endian layout is assumed for the low bit of words[1]. */
+  expected += ((16 + round % 16 + round) & 0xff) + (round & 1);
+}
+
+assert (sum === expected);
@@ -0,0 +1,63 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Values read from the built-in property tables. */
+assert (Math.PI === 3.141592653589793);
+assert (Number.MAX_VALUE === 1.7976931348623157e308);
+assert (Number.POSITIVE_INFINITY === Infinity);
+assert (isNaN (Number.NaN));
+assert (Object.prototype.constructor === Object);
+assert (Math.max.length === 2);
+assert (Math.max.length === 2);
+assert (Error.prototype.name === "Error");
+assert (Error.prototype.name === "Error");
+assert (Array.prototype === Array.prototype);
+
+/* Non-writable properties keep their value. */
+Math.PI = 3;
+assert (Math.PI === 3.141592653589793);
+assert (!delete Math.PI);
+
+var desc = Object.getOwnPropertyDescriptor (Math, "E");
+assert (desc.value === Math.E && !desc.writable && !desc.enumerable && !desc.configurable);
+
+/* Writes and deletes are visible to later reads. */
+assert (RegExp.prototype.lastIndex === 0);
+RegExp.prototype.lastIndex = 5;
+assert (RegExp.prototype.lastIndex === 5);
+RegExp.prototype.lastIndex = 0;
+
+Error.prototype.name = "MyError";
+assert (Error.prototype.name === "MyError");
+assert (new Error ("x").toString () === "MyError: x");
+Error.prototype.name = "Error";
+
+assert (Function.prototype.constructor === Function);
+assert (delete Function.prototype.constructor);
+assert (Function.prototype.constructor === Object);
+assert (!Function.prototype.hasOwnProperty ("constructor"));
+Function.prototype.constructor = Function;
+
+Object.defineProperty (Number, "MIN_VALUE", { enumerable: false });
+assert (Number.MIN_VALUE === 5e-324);
+
+/* Names which are not built-in properties. */
+assert (Math.notAProperty === undefined);
+assert (!("notAProperty" in Array.prototype));
+assert (Array.prototype.hasOwnProperty === Object.prototype.hasOwnProperty);
+
+/* Lazy properties are listed once. */
+var names = Object.getOwnPropertyNames (Math);
+assert (names.indexOf ("PI") >= 0);
+assert (names.indexOf ("PI") === names.lastIndexOf ("PI"));
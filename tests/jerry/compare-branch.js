@@ -0,0 +1,152 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function count_less (limit) {
+  var count = 0;
+  for (var i = 0; i < limit; i++) {
+    count++;
+  }
+  return count;
+}
+
+assert(count_less(10) === 10);
+assert(count_less(0) === 0);
+assert(count_less(NaN) === 0);
+assert(count_less(2.5) === 3);
+assert(count_less("4") === 4);
+
+function count_less_equal (limit) {
+  var count = 0;
+  var i = 0;
+  do {
+    count++;
+    i++;
+  } while (i <= limit);
+  return count;
+}
+
+assert(count_less_equal(3) === 4);
+assert(count_less_equal(NaN) === 1);
+assert(count_less_equal(-1) === 1);
+
+function count_less_member (obj) {
+  var count = 0;
+  for (var i = 0; obj.value < 5; obj.value++) {
+    count++;
+  }
+  return count;
+}
+
+assert(count_less_member({ value: 0 }) === 5);
+assert(count_less_member({ value: NaN }) === 0);
+
+function compare (a, b) {
+  var result = "";
+
+  if (a === b) {
+    result += "s";
+  }
+
+  if (a == b) {
+    result += "e";
+  }
+
+  if (a < b) {
+    result += "l";
+  }
+
+  if (a === 1) {
+    result += "1";
+  }
+
+  if (a.x == 2) {
+    result += "2";
+  }
+
+  if (a.x === "x") {
+    result += "x";
+  }
+
+  return result;
+}
+
+assert(compare(1, 1) === "se1");
+assert(compare(1, 2) === "l1");
+assert(compare(1, "1") === "e1");
+assert(compare(NaN, NaN) === "");
+assert(compare(0.5, 1.5) === "l");
+assert(compare("a", "b") === "l");
+assert((function (a, b) { if (a == b) { return 1; } return 0; }) (null, undefined) === 1);
+assert(compare({ x: 2 }, 3) === "2");
+assert(compare({ x: "x" }, 3) === "x");
+
+var value_of_calls = 0;
+var obj = { valueOf: function () { value_of_calls++; return 3; } };
+assert(compare(obj, 4) === "l");
+assert(value_of_calls === 2);
+
+var thrower = { valueOf: function () { throw new ReferenceError("foo"); } };
+
+try {
+  count_less(thrower);
+  assert(false);
+} catch (e) {
+  assert(e instanceof ReferenceError);
+}
+
+try {
+  compare(thrower, 4);
+  assert(false);
+} catch (e) {
+  assert(e instanceof ReferenceError);
+}
+
+/* Long loop bodies require longer branch offsets. */
+function long_body (limit) {
+  var a = 0, b = 0, c = 0;
+  for (var i = 0; i < limit; i++) {
+    if (i === 3) {
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+      a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+    }
+    a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+    a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+    a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+    a = a + 1; b = b + 2; c = c + 3; a = a + 1; b = b + 2; c = c + 3;
+  }
+  return a + b + c;
+}
+
+assert(long_body(5) === 24 * 6 + 5 * 8 * 6);
+
+/* Discarded values. */
+function discarded () {
+  "not a directive";
+  1;
+  true;
+  this;
+  return (0, "a", 5);
+}
+
+assert(discarded() === 5);
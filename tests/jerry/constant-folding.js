@@ -0,0 +1,240 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Arithmetic. */
+assert (60 * 60 * 1000 === 3600000);
+assert (1 + 2 + 3 === 6);
+assert (7 - 10 === -3);
+assert (1 / 4 === 0.25);
+assert (1 / 0 === Infinity);
+assert (-1 / 0 === -Infinity);
+assert (isNaN (0 / 0));
+assert (7 % -3 === 1);
+assert (-7 % 3 === -1);
+assert (1 / (-7 % 7) === -Infinity);
+assert (0.1 + 0.2 === 0.30000000000000004);
+
+/* Negative zero. */
+assert (1 / (0 * -1) === -Infinity);
+assert (1 / -(0) === -Infinity);
+assert (1 / (-0 + 0) === Infinity);
+assert (1 / (-0 - 0) === -Infinity);
+assert (0 === -0);
+
+/* Bitwise operators and shifts. */
+assert ((5 | 2) === 7);
+assert ((5 & 6) === 4);
+assert ((5 ^ 6) === 3);
+assert (~5 === -6);
+assert (~(-1) === 0);
+assert ((1 << 31) === -2147483648);
+assert ((1 << 32) === 1);
+assert ((-1 >>> 0) === 4294967295);
+assert ((-16 >> 2) === -4);
+assert ((4294967296.5 | 0) === 0);
+assert ((2147483648 | 0) === -2147483648);
+
+/* Comparison. */
+assert (1 < 2);
+assert (!(2 < 1));
+assert (2 >= 2);
+assert (!(0 / 0 < 1) && !(0 / 0 >= 1));
+assert (!(0 / 0 == 0 / 0));
+assert (0 / 0 != 0 / 0);
+assert ("a" == "a");
+assert ("a" !== "b");
+assert (!("1" === 1));
+assert ("1" == 1);
+assert ("abc" < "abd");
+
+/* String concatenation and number to string conversion. */
+assert ("a" + "b" + "c" === "abc");
+assert ("x" + 1.5 === "x1.5");
+assert (1 + "x" === "1x");
+assert (1 + 2 + "x" === "3x");
+assert ("x" + 1 + 2 === "x12");
+assert ("" + -0 === "0");
+assert ("" + 0 / 0 === "NaN");
+assert ("" + 1e21 === "1e+21");
+assert ("" + 1 / 3 === "0.3333333333333333");
+assert ("" + -1 / 0 === "-Infinity");
+assert (("" + "") === "");
+assert ("é" + "\ud800" + "\udc00" === "é𐀀");
+assert (("\ud800" + "\udc00").length === 2);
+
+/* Unary operators. */
+assert (!0 === true);
+assert (!"" === true);
+assert (!"0" === false);
+assert (!(0 / 0) === true);
+assert (typeof 1 === "number");
+assert (typeof "s" === "string");
+assert (typeof true === "boolean");
+assert (typeof null === "object");
+assert (typeof void 0 === "undefined");
+assert (+true === 1);
+assert (isNaN (+void 0));
+assert (-null === 0);
+assert (+"5" === 5);
+assert (-"" === 0);
+
+/* Dead branches. */
+var log = [];
+
+if (false) {
+  log.push ("if false");
+} else {
+  log.push ("else of false");
+}
+
+if (1) {
+  log.push ("if true");
+} else {
+  log.push ("else of true");
+}
+
+if (0) log.push ("no else");
+if ("") log.push ("empty string");
+if ("0") log.push ("string zero");
+if (null) log.push ("null");
+if (!1) log.push ("not one");
+if (2 > 3) log.push ("compare"); else if (3 > 2) log.push ("else if");
+
+assert (log.join () === "else of false,if true,string zero,else if");
+
+/* Declarations in dead code are still hoisted. */
+if (false) {
+  var hoisted_var = 5;
+}
+
+assert (hoisted_var === undefined);
+assert ("hoisted_var" in this);
+
+/* Jumps inside the removed block. */
+function dead_loops () {
+  var result = 0;
+
+  if (false) {
+    for (var i = 0; i < 10; i++) {
+      if (i == 5) {
+        break;
+      }
+      continue;
+    }
+
+    switch (result) {
+      case 0:
+        result = 10;
+        break;
+      default:
+        result = 20;
+    }
+
+    try {
+      throw result;
+    } catch (e) {
+      result = e;
+    }
+  }
+
+  return result;
+}
+
+assert (dead_loops () === 0);
+
+/* Jumps from the dead block to enclosing statements. */
+function escaping_jumps () {
+  var count = 0;
+
+  for (var i = 0; i < 5; i++) {
+    count++;
+    if (false) {
+      continue;
+    }
+    if (0) {
+      break;
+    }
+  }
+
+  outer: do {
+    count++;
+    if (false) {
+      break outer;
+    } else {
+      count++;
+    }
+  } while (false);
+
+  while (true) {
+    if (true) {
+      break;
+    } else {
+      count = -1;
+      break;
+    }
+  }
+
+  return count;
+}
+
+assert (escaping_jumps () === 7);
+
+/* Side effects of the condition must be kept. */
+var side_effect = 0;
+
+if ((side_effect++, false)) {
+  side_effect = 100;
+}
+
+if ((side_effect++, 1)) {
+  side_effect += 10;
+}
+
+assert (side_effect === 12);
+
+/* The completion value of a dead if statement is empty. */
+assert (eval ("1; if (false) { 2; }") === 1);
+assert (eval ("3; if (true) { 4; } else { 5; }") === 4);
+assert (eval ("if (false) { 6; } else { 7; }") === 7);
+
+/* Nested dead code. */
+function nested () {
+  if (true) {
+    if (false) {
+      return 1;
+    }
+    return 2;
+  } else {
+    if (true) {
+      return 3;
+    }
+  }
+  return 4;
+}
+
+assert (nested () === 2);
+
+/* Function declarations inside dead code. */
+function dead_function () {
+  if (false) {
+    return inner ();
+  }
+  return typeof inner;
+
+  function inner () {
+    return 1;
+  }
+}
+
+assert (dead_function () === "function");
@@ -0,0 +1,48 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The stack property is only present when line info is enabled.
+// Errors thrown by the engine itself (not by a call) must report
+// the line of the failing instruction in the top frame.
+
+function g() {}
+
+function type_error() {
+  g();
+  var a = null;
+  var b = 1;
+  return a.x;
+}
+
+function reference_error() {
+  g();
+  var b = 1;
+  return undefined_variable;
+}
+
+function check_line (func, type, line) {
+  try {
+    func();
+    assert(false);
+  } catch (e) {
+    assert(e instanceof type);
+
+    if (e.stack !== undefined) {
+      assert(new RegExp(":" + line + "$").test(e.stack[0]));
+    }
+  }
+}
+
+check_line(type_error, TypeError, 25);
+check_line(reference_error, ReferenceError, 31);
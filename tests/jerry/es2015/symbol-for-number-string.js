@@ -0,0 +1,19 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* The registry keeps the cached number strings alive until the engine is finalized. */
+var sym = Symbol.for (String (5.58));
+assert (Symbol.keyFor (sym) === "5.58");
+assert (Symbol.for (5.58) === sym);
+assert (Symbol.keyFor (Symbol.for (String (-0.125))) === "-0.125");
@@ -0,0 +1,82 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var indirectEval = eval;
+
+/* The same source code evaluated repeatedly. */
+var counter = 0;
+for (var i = 0; i < 5; i++) {
+  assert (indirectEval ("counter++; counter * 2") === (i + 1) * 2);
+}
+assert (counter === 5);
+
+/* Each evaluation creates new function objects. */
+var f1 = indirectEval ("(function () { return 'f'; })");
+var f2 = indirectEval ("(function () { return 'f'; })");
+assert (f1 !== f2 && f1 () === "f" && f2 () === "f");
+
+/* Indirect eval runs in the global scope. */
+var scope = "global";
+function localEval () {
+  var scope = "local";
+  return [indirectEval ("scope"), eval ("scope")];
+}
+for (var i = 0; i < 3; i++) {
+  var result = localEval ();
+  assert (result[0] === "global" && result[1] === "local");
+}
+
+/* Strict mode of the source code. */
+for (var i = 0; i < 3; i++) {
+  assert (indirectEval ("'use strict'; (function () { return this; }) ()") === undefined);
+  assert (indirectEval ("(function () { return this; }) ()") !== undefined);
+}
+
+/* Syntax errors are reported every time. */
+for (var i = 0; i < 3; i++) {
+  try {
+    indirectEval ("var = 1");
+    assert (false);
+  } catch (e) {
+    assert (e instanceof SyntaxError);
+  }
+}
+
+/* Functions created by the Function constructor. */
+var functions = [];
+for (var i = 0; i < 5; i++) {
+  functions.push (new Function ("a", "b", "return a + b * " + (i % 2)));
+}
+assert (functions[0] !== functions[2]);
+assert (functions[0] (2, 3) === 2 && functions[2] (2, 3) === 2 && functions[4] (2, 3) === 2);
+assert (functions[1] (2, 3) === 5 && functions[3] (2, 3) === 5);
+
+/* The same body with different arguments is a different function. */
+var g1 = new Function ("a", "return typeof a");
+var g2 = new Function ("b", "return typeof a");
+var g3 = new Function ("a", "return typeof a");
+assert (g1 (1) === "number" && g2 (1) === "undefined" && g3 (1) === "number");
+assert (g1.length === 1 && g3.length === 1);
+
+/* Properties of the created functions are not shared. */
+g1.prototype.x = 5;
+assert (g3.prototype.x === undefined && new g3 ().x === undefined);
+
+/* More sources than the cache can hold. */
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < 300; i++) {
+    assert (indirectEval ("" + i + " * 3") === i * 3);
+    assert (new Function ("return " + i) () === i);
+  }
+}
@@ -0,0 +1,129 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function keys (obj) {
+  var result = [];
+  for (var name in obj) {
+    result.push (name);
+  }
+  return result.join ();
+}
+
+/* Objects with the same properties. */
+for (var i = 0; i < 5; i++) {
+  var record = { id: i, name: "n" + i, value: i * 2 };
+  assert (keys (record) === "id,name,value");
+  assert (Object.keys (record).join () === "id,name,value");
+}
+
+/* Objects with the same property names but different attributes. */
+var a = { x: 1, y: 2 };
+var b = { x: 1, y: 2 };
+Object.defineProperty (b, "x", { enumerable: false });
+assert (keys (a) === "x,y");
+assert (keys (b) === "y");
+assert (Object.getOwnPropertyNames (b).join () === "x,y");
+
+/* Array index names are listed first. */
+var c = { b: 1, 2: 2, a: 3, 1: 4 };
+assert (keys (c) === "1,2,b,a");
+assert (keys ({ b: 5, 2: 6, a: 7, 1: 8 }) === "1,2,b,a");
+
+/* Adding and deleting properties. */
+var d = { p: 1 };
+assert (keys (d) === "p");
+d.q = 2;
+assert (keys (d) === "p,q");
+delete d.p;
+assert (keys (d) === "q");
+d.p = 3;
+assert (keys (d) === "q,p");
+
+/* Enumerable properties of the prototype. */
+function Point (x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+var p1 = new Point (1, 2);
+assert (keys (p1) === "x,y");
+Point.prototype.z = 3;
+assert (keys (p1) === "x,y,z");
+assert (keys (new Point (3, 4)) === "x,y,z");
+assert (Object.keys (p1).join () === "x,y");
+Object.defineProperty (Point.prototype, "z", { enumerable: false });
+assert (keys (p1) === "x,y");
+Object.defineProperty (Point.prototype, "z", { enumerable: true });
+assert (keys (p1) === "x,y,z");
+delete Point.prototype.z;
+assert (keys (p1) === "x,y");
+
+/* Own properties shadow the properties of the prototype. */
+Point.prototype.x = 0;
+assert (keys (p1) === "x,y");
+Object.defineProperty (p1, "x", { enumerable: false });
+assert (keys (p1) === "y");
+assert (keys (new Point (5, 6)) === "x,y");
+delete Point.prototype.x;
+
+/* Objects with different prototypes. */
+var proto1 = { fromProto1: true };
+var proto2 = { fromProto2: true };
+var o1 = Object.create (proto1);
+var o2 = Object.create (proto2);
+o1.own = 1;
+o2.own = 1;
+assert (keys (o1) === "own,fromProto1");
+assert (keys (o2) === "own,fromProto2");
+assert (keys (Object.create (proto1)) === "fromProto1");
+
+/* Enumerable properties added to Object.prototype. */
+var plain = { k: 1 };
+assert (keys (plain) === "k");
+Object.prototype.extra = 1;
+assert (keys (plain) === "k,extra");
+assert (keys ({ k: 2 }) === "k,extra");
+delete Object.prototype.extra;
+assert (keys (plain) === "k");
+
+/* Accessor properties. */
+var e = { get g () { return 1; }, h: 2 };
+assert (keys (e) === "g,h");
+Object.defineProperty (e, "g", { value: 3 });
+assert (keys (e) === "g,h");
+
+/* Many properties. */
+var big = {};
+var expected = [];
+for (var i = 0; i < 100; i++) {
+  big["p" + i] = i;
+  expected.push ("p" + i);
+}
+assert (keys (big) === expected.join ());
+assert (keys (big) === expected.join ());
+
+/* Modifying the object during the enumeration. */
+var f = { a: 1, b: 2, c: 3 };
+var visited = [];
+for (var name in f) {
+  visited.push (name);
+  delete f.b;
+}
+assert (visited.join () === "a,c");
+assert (keys (f) === "a,c");
+
+/* Objects which are not general objects. */
+assert (keys ([1, 2]) === "0,1");
+assert (keys (new String ("ab")) === "0,1");
+assert (keys (new String ("abc")) === "0,1,2");
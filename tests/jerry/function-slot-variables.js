@@ -0,0 +1,188 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Variables captured by nested functions. */
+function counter (start) {
+  var count = start;
+  return {
+    inc: function () { return ++count; },
+    add: function (n) { count += n; return count; },
+    get: function () { return count; },
+    type: function () { return typeof count; }
+  };
+}
+
+var c = counter (5);
+assert (c.inc () === 6);
+assert (c.add (4) === 10);
+assert (c.get () === 10);
+assert (c.type () === "number");
+
+/* Deeply nested functions. */
+function outer (a) {
+  var x = a;
+  function middle (b) {
+    var y = b;
+    return function inner (c) {
+      var z = c;
+      return function () {
+        x++;
+        return x + y + z;
+      };
+    };
+  }
+  return middle;
+}
+
+var f = outer (1) (10) (100);
+assert (f () === 112);
+assert (f () === 113);
+
+/* Shadowing variables. */
+function shadow () {
+  var v = "outer";
+  function g () {
+    var v = "inner";
+    return function () { return v; };
+  }
+  return g () () + v;
+}
+
+assert (shadow () === "innerouter");
+
+/* Direct eval can declare new variables. */
+function evalScope () {
+  var v = "outer";
+  return function () {
+    eval ("var v = 'eval'");
+    return v;
+  };
+}
+
+assert (evalScope () () === "eval");
+
+function evalOuter () {
+  var v = "outer";
+  eval ("var w = 'eval'");
+  return function () { return v + w; };
+}
+
+assert (evalOuter () () === "outereval");
+
+/* With and catch blocks create lexical environments. */
+function withScope () {
+  var v = "var";
+  var o = { v: "with" };
+  with (o) {
+    return function () { return v; };
+  }
+}
+
+assert (withScope () () === "with");
+
+function catchScope () {
+  var e = "var";
+  try {
+    throw "catch";
+  } catch (e) {
+    return function () { return e; };
+  }
+}
+
+assert (catchScope () () === "catch");
+
+/* Named function expressions. */
+function namedExpr () {
+  var fact = "var";
+  var g = function fact (n) {
+    return n <= 1 ? 1 : n * fact (n - 1);
+  };
+  return g (5) + fact;
+}
+
+assert (namedExpr () === "120var");
+
+/* Arguments object. */
+function args (a, b) {
+  var g = function () { return a + arguments.length; };
+  a = 10;
+  assert (arguments[0] === 10);
+  arguments[1] = 20;
+  assert (b === 20);
+  return g (1, 2, 3);
+}
+
+assert (args (1, 2) === 13);
+
+function dupArgs (a, a) {
+  return function () { return a; };
+}
+
+assert (dupArgs (1, 2) () === 2);
+
+/* Function declarations are hoisted. */
+function hoisted () {
+  var v = 4;
+  return h ();
+  function h () { return v * 2; }
+}
+
+assert (hoisted () === 8);
+
+/* Closures created in loops share the same variable. */
+function loop () {
+  var fns = [];
+  for (var i = 0; i < 3; i++) {
+    fns.push (function () { return i; });
+  }
+  return fns[0] () + fns[1] () + fns[2] ();
+}
+
+assert (loop () === 9);
+
+/* The delete operator cannot delete variables. */
+function deleteVar () {
+  var v = 1;
+  return function () {
+    assert (!delete v);
+    return v;
+  };
+}
+
+assert (deleteVar () () === 1);
+
+/* Unresolvable references. */
+function unresolved () {
+  var v = 1;
+  return function () {
+    try {
+      return undefinedReference;
+    } catch (e) {
+      assert (e instanceof ReferenceError);
+      return typeof undefinedReference;
+    }
+  };
+}
+
+assert (unresolved () () === "undefined");
+
+/* Global variables. */
+var globalVar = 5;
+function readGlobal () {
+  var v = 1;
+  return function () { globalVar++; return globalVar + v; };
+}
+
+assert (readGlobal () () === 7);
+assert (globalVar === 6);
@@ -0,0 +1,112 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Reading and writing global variables. */
+var g = 1;
+
+function readG () { return g; }
+function writeG (v) { g = v; }
+function incG () { g++; return g; }
+
+assert (readG () === 1);
+writeG (2);
+assert (g === 2);
+assert (readG () === 2);
+assert (incG () === 3);
+assert (typeof g === "number");
+
+for (var i = 0; i < 10; i++) {
+  g += i;
+}
+assert (g === 48);
+
+/* Deleting and re-creating global properties. */
+this.h = "first";
+assert ((function () { return h; }) () === "first");
+assert (delete h);
+
+try {
+  (function () { return h; }) ();
+  assert (false);
+} catch (e) {
+  assert (e instanceof ReferenceError);
+}
+
+assert (typeof h === "undefined");
+this.h = "second";
+assert ((function () { return h; }) () === "second");
+
+/* Converting a global data property to an accessor property. */
+this.acc = 5;
+assert (acc === 5);
+var getterCalls = 0;
+Object.defineProperty (this, "acc", { get: function () { getterCalls++; return 6; }, set: function (v) {} });
+assert (acc === 6);
+acc = 7;
+assert ((function () { return acc; }) () === 6);
+assert (getterCalls === 2);
+
+/* Lazily instantiated built-in objects. */
+function useBuiltins () {
+  return Math.max (1, 2) + JSON.stringify ([1]).length;
+}
+assert (useBuiltins () === 5);
+assert (typeof Math === "object");
+
+var savedMath = Math;
+Math = { max: function () { return 10; } };
+assert (useBuiltins () === 13);
+Math = savedMath;
+assert (useBuiltins () === 5);
+
+/* Shadowing global variables. */
+var s = "global";
+
+function shadowVar () {
+  var s = "local";
+  return function () { return s; };
+}
+assert (shadowVar () () === "local");
+
+function shadowWith () {
+  with ({ s: "with" }) {
+    return s;
+  }
+}
+assert (shadowWith () === "with");
+
+function shadowEval () {
+  eval ("var s = 'eval'");
+  return function () { return s; };
+}
+assert (shadowEval () () === "eval");
+assert (s === "global");
+
+/* Non-writable global properties. */
+NaN = 5;
+assert (NaN !== NaN);
+undefined = 5;
+assert (undefined === void 0);
+
+function strictWrite () {
+  "use strict";
+  NaN = 5;
+}
+
+try {
+  strictWrite ();
+  assert (false);
+} catch (e) {
+  assert (e instanceof TypeError);
+}
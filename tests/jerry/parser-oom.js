@@ -13,7 +13,7 @@
 // limitations under the License.
 
 /* String which is 32 bytes long. */
-var str = "1+1+1+1+1+1+1+1+1+1+1+1+1+1+1+1+";
+var str = "a+1+a+1+a+1+a+1+a+1+a+1+a+1+a+1+";
 
 for (var i = 0; i < 10; i++) {
   str = str + str;
@@ -13,7 +13,7 @@
 // limitations under the License.
 
 /* String which is 32 bytes long. */
-var str = "'\\t' +'\\t' +'\\t'+'\\t'+'\\t'+'\\t'+";
+var str = "'\\t' +a +'\\t' +a +'\\t'+a+'\\t'+a+";
 
 for (var i = 0; i < 10; i++) {
   str = str + str;
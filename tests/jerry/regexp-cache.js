@@ -0,0 +1,58 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* More distinct patterns than the cache can hold. */
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < 40; i++) {
+    var re = new RegExp ("^/route" + i + "/(\\d+)$");
+    var match = re.exec ("/route" + i + "/" + (i * 7));
+    assert (match !== null && match[1] === String (i * 7));
+    assert (!re.test ("/route" + (i + 1) + "/1"));
+  }
+}
+
+/* The same pattern with different flags. */
+for (var i = 0; i < 3; i++) {
+  var plain = new RegExp ("abc");
+  var ignoreCase = new RegExp ("abc", "i");
+  var global = new RegExp ("abc", "g");
+  assert (!plain.test ("ABC") && ignoreCase.test ("ABC"));
+  assert (!plain.global && !ignoreCase.global && global.global);
+  assert (ignoreCase.ignoreCase && !plain.ignoreCase);
+}
+
+/* RegExp objects which share a compiled pattern have their own state. */
+var first = new RegExp ("a", "g");
+var second = new RegExp ("a", "g");
+assert (first.exec ("aaa").index === 0 && first.lastIndex === 1);
+assert (second.lastIndex === 0 && second.exec ("aaa").index === 0);
+assert (first.exec ("aaa").index === 1);
+
+/* A few hot patterns mixed with many one-off patterns. */
+var hot = [/^[a-z]+$/, /^\d+$/, /^\s*$/];
+for (var i = 0; i < 50; i++) {
+  var once = new RegExp ("x" + i + "y");
+  assert (once.test ("ax" + i + "yb"));
+  assert (new RegExp (hot[i % 3].source).test (["abc", "123", "  "][i % 3]));
+}
+
+/* Invalid patterns are not cached. */
+for (var i = 0; i < 3; i++) {
+  try {
+    new RegExp ("(a");
+    assert (false);
+  } catch (e) {
+    assert (e instanceof SyntaxError);
+  }
+}
@@ -0,0 +1,137 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/**
+ * Maximum size of the JSON output
+ */
+#define OUTPUT_BUFFER_SIZE (64 * 1024)
+
+static char output_buffer[OUTPUT_BUFFER_SIZE + 1];
+
+static void
+run_source (const char *source_p)
+{
+  const jerry_char_t resource_name[] = "sites.js";
+  jerry_value_t parsed_code_val = jerry_parse (resource_name,
+                                               sizeof (resource_name) - 1,
+                                               (const jerry_char_t *) source_p,
+                                               strlen (source_p),
+                                               JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (parsed_code_val));
+
+  jerry_value_t res = jerry_run (parsed_code_val);
+  TEST_ASSERT (!jerry_value_is_error (res));
+
+  jerry_release_value (res);
+  jerry_release_value (parsed_code_val);
+} /* run_source */
+
+static void
+get_alloc_sites (void)
+{
+  size_t size = jerry_get_alloc_sites_json ((jerry_char_t *) output_buffer, OUTPUT_BUFFER_SIZE);
+  TEST_ASSERT (size > 0 && size <= OUTPUT_BUFFER_SIZE);
+
+  output_buffer[size] = '\0';
+} /* get_alloc_sites */
+
+/**
+ * Sum a counter of the sites of an engine function which were reached from script code.
+ *
+ * @return sum of the counters
+ */
+static uint64_t
+sum_script_counter (const char *engine_name_p, /**< name of the engine function */
+                    const char *counter_name_p) /**< name of the counter */
+{
+  char site_prefix[64];
+  char counter_prefix[64];
+  snprintf (site_prefix, sizeof (site_prefix), "{\"engine\": \"%s\", \"script\": \"", engine_name_p);
+  snprintf (counter_prefix, sizeof (counter_prefix), "\"%s\": ", counter_name_p);
+
+  uint64_t sum = 0;
+  const char *site_p = output_buffer;
+
+  while ((site_p = strstr (site_p, site_prefix)) != NULL)
+  {
+    const char *counter_p = strstr (site_p, counter_prefix);
+    TEST_ASSERT (counter_p != NULL && counter_p < strchr (site_p, '}'));
+
+    sum += strtoull (counter_p + strlen (counter_prefix), NULL, 10);
+    site_p++;
+  }
+
+  return sum;
+} /* sum_script_counter */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_MEM_ALLOC_SITES))
+  {
+    TEST_ASSERT (jerry_get_alloc_sites_json ((jerry_char_t *) output_buffer, OUTPUT_BUFFER_SIZE) == 0);
+    jerry_cleanup ();
+    return 0;
+  }
+
+  run_source (TEST_STRING_LITERAL (
+    "var keep = [];\n"
+    "for (var i = 0; i < 100; i++) keep.push ({ value: i });\n"
+  ));
+
+  get_alloc_sites ();
+
+  TEST_ASSERT (strncmp (output_buffer, "{\"sites\": [", 11) == 0);
+  TEST_ASSERT (sum_script_counter ("ecma_alloc_object", "live_blocks") >= 100);
+  TEST_ASSERT (sum_script_counter ("ecma_alloc_object", "allocations") >= 100);
+
+  if (jerry_is_feature_enabled (JERRY_FEATURE_LINE_INFO))
+  {
+    TEST_ASSERT (strstr (output_buffer, "{\"engine\": \"ecma_alloc_object\", \"script\": \"sites.js:2\", "
+                                        "\"live_bytes\": ") != NULL);
+  }
+
+  /* Freed blocks are removed from the live counters, but the allocation counters are kept. */
+  run_source ("keep = undefined;");
+  jerry_gc (JERRY_GC_SEVERITY_LOW);
+
+  get_alloc_sites ();
+  TEST_ASSERT (sum_script_counter ("ecma_alloc_object", "live_blocks") < 100);
+  TEST_ASSERT (sum_script_counter ("ecma_alloc_object", "allocations") >= 100);
+
+  jerry_reset_alloc_sites ();
+  get_alloc_sites ();
+  TEST_ASSERT (sum_script_counter ("ecma_alloc_object", "allocations") == 0);
+
+  /* Truncated output. */
+  size_t size = jerry_get_alloc_sites_json (NULL, 0);
+  output_buffer[2] = 'x';
+  TEST_ASSERT (jerry_get_alloc_sites_json ((jerry_char_t *) output_buffer, 2) == size);
+  TEST_ASSERT (output_buffer[2] == 'x');
+
+  run_source ("var x = { a: 1 };");
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
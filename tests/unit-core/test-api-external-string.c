@@ -0,0 +1,166 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static int free_count = 0;
+static const void *last_freed_p = NULL;
+
+static void
+external_string_free (void *native_p) /**< string buffer */
+{
+  free_count++;
+  last_freed_p = native_p;
+} /* external_string_free */
+
+static jerry_value_t
+call_function (const char *source_p, /**< function source */
+               jerry_value_t arg) /**< function argument */
+{
+  jerry_value_t func_val = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_function (func_val));
+
+  jerry_value_t undefined_val = jerry_create_undefined ();
+  jerry_value_t result = jerry_call_function (func_val, undefined_val, &arg, 1);
+  TEST_ASSERT (!jerry_value_is_error (result));
+
+  jerry_release_value (undefined_val);
+  jerry_release_value (func_val);
+  return result;
+} /* call_function */
+
+static bool
+call_boolean_function (const char *source_p, /**< function source */
+                       jerry_value_t arg) /**< function argument */
+{
+  jerry_value_t result = call_function (source_p, arg);
+  TEST_ASSERT (jerry_value_is_boolean (result));
+
+  bool value = jerry_get_boolean_value (result);
+  jerry_release_value (result);
+  return value;
+} /* call_boolean_function */
+
+int
+main (void)
+{
+  static const char long_text[] = "The quick brown fox jumps over the lazy dog: external strings are not copied";
+  static const char unicode_text[] = "external \xc3\xa1rv\xc3\xadzt\xc5\xb1r\xc5\x91 "
+                                     "t\xc3\xbck\xc3\xb6rf\xc3\xbar\xc3\xb3g\xc3\xa9p";
+  static const char short_text[] = "short";
+  static const char magic_text[] = "getOwnPropertyDescriptor";
+
+  TEST_INIT ();
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* The characters of a long string are not copied. */
+  jerry_value_t external_val = jerry_create_external_string ((const jerry_char_t *) long_text,
+                                                             external_string_free);
+  TEST_ASSERT (jerry_value_is_string (external_val));
+  TEST_ASSERT (free_count == 0);
+  TEST_ASSERT (jerry_get_string_size (external_val) == sizeof (long_text) - 1);
+  TEST_ASSERT (jerry_get_string_length (external_val) == sizeof (long_text) - 1);
+
+  jerry_char_t buffer[128];
+  jerry_size_t size = jerry_string_to_char_buffer (external_val, buffer, sizeof (buffer));
+  TEST_ASSERT (size == sizeof (long_text) - 1);
+  TEST_ASSERT (memcmp (buffer, long_text, size) == 0);
+
+  /* External strings are equal to heap strings with the same characters. */
+  jerry_value_t copy_val = jerry_create_string ((const jerry_char_t *) long_text);
+  jerry_value_t global_val = jerry_get_global_object ();
+
+  jerry_value_t result = jerry_set_property (global_val, copy_val, copy_val);
+  TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+  jerry_release_value (result);
+
+  result = jerry_get_property (global_val, external_val);
+  TEST_ASSERT (jerry_value_is_string (result));
+  size = jerry_string_to_char_buffer (result, buffer, sizeof (buffer));
+  TEST_ASSERT (size == sizeof (long_text) - 1);
+  jerry_release_value (result);
+
+  TEST_ASSERT (call_boolean_function ("(function (s) { return s === this[s] && s == this[s]; })", external_val));
+  TEST_ASSERT (call_boolean_function ("(function (s) { return s.length === 76 && s.indexOf ('fox') === 16; })",
+                                      external_val));
+  TEST_ASSERT (call_boolean_function ("(function (s) { return s.substr (4, 5) === 'quick' && s.charAt (4) === 'q'; })",
+                                      external_val));
+  TEST_ASSERT (call_boolean_function ("(function (s) { var o = {}; o[s] = 1;"
+                                      "  return o[this[s]] === 1 && Object.keys (o)[0] === s; })",
+                                      external_val));
+  TEST_ASSERT (call_boolean_function ("(function (s) { return s + '!' === this[s] + '!' && s < s + 'a'; })",
+                                      external_val));
+
+  TEST_ASSERT (jerry_delete_property (global_val, copy_val));
+  jerry_release_value (copy_val);
+  jerry_release_value (global_val);
+
+  /* The buffer is released when the last reference is gone. */
+  jerry_value_t array_val = call_function ("(function (s) { return [s, s]; })", external_val);
+  jerry_release_value (external_val);
+  TEST_ASSERT (free_count == 0);
+
+  jerry_release_value (array_val);
+  jerry_gc (JERRY_GC_SEVERITY_LOW);
+  TEST_ASSERT (free_count == 1);
+  TEST_ASSERT (last_freed_p == long_text);
+
+  /* Non-ascii characters. */
+  external_val = jerry_create_external_string ((const jerry_char_t *) unicode_text, external_string_free);
+  TEST_ASSERT (jerry_get_string_size (external_val) == sizeof (unicode_text) - 1);
+  TEST_ASSERT (jerry_get_string_length (external_val) == 31);
+  TEST_ASSERT (call_boolean_function ("(function (s) { return s.charCodeAt (9) === 0xe1"
+                                      "  && s.slice (-3) === 'g\\u00e9p'"
+                                      "  && s === 'external \\u00e1rv\\u00edzt\\u0171r\\u0151 "
+                                      "t\\u00fck\\u00f6rf\\u00far\\u00f3g\\u00e9p'; })",
+                                      external_val));
+  jerry_release_value (external_val);
+  jerry_gc (JERRY_GC_SEVERITY_LOW);
+  TEST_ASSERT (free_count == 2);
+  TEST_ASSERT (last_freed_p == unicode_text);
+
+  /* Short strings are copied and the buffer is released immediately. */
+  external_val = jerry_create_external_string ((const jerry_char_t *) short_text, external_string_free);
+  TEST_ASSERT (free_count == 3);
+  TEST_ASSERT (last_freed_p == short_text);
+  TEST_ASSERT (call_boolean_function ("(function (s) { return s === 'short'; })", external_val));
+  jerry_release_value (external_val);
+
+  /* Magic strings do not need a buffer either. */
+  external_val = jerry_create_external_string_sz ((const jerry_char_t *) magic_text,
+                                                  sizeof (magic_text) - 1,
+                                                  external_string_free);
+  TEST_ASSERT (free_count == 4);
+  TEST_ASSERT (call_boolean_function ("(function (s) { return typeof Object[s] === 'function'; })", external_val));
+  jerry_release_value (external_val);
+
+  /* Strings without a free callback. */
+  external_val = jerry_create_external_string_sz ((const jerry_char_t *) long_text, 19, NULL);
+  TEST_ASSERT (call_boolean_function ("(function (s) { return s === 'The quick brown fox'; })", external_val));
+  jerry_release_value (external_val);
+
+  /* Strings which are still alive at cleanup are released by the engine. */
+  external_val = jerry_create_external_string ((const jerry_char_t *) long_text, external_string_free);
+  jerry_value_t object_val = call_function ("(function (s) { globalThis_s = s; return {}; })", external_val);
+  jerry_release_value (object_val);
+  jerry_release_value (external_val);
+  TEST_ASSERT (free_count == 4);
+
+  jerry_cleanup ();
+  TEST_ASSERT (free_count == 5);
+  return 0;
+} /* main */
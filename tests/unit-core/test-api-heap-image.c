@@ -0,0 +1,270 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static int native_data;
+static int native_free_count;
+
+static void
+native_free_cb (void *native_p) /**< native pointer */
+{
+  TEST_ASSERT (native_p == &native_data);
+  native_free_count++;
+} /* native_free_cb */
+
+static const jerry_object_native_info_t native_info =
+{
+  .free_cb = native_free_cb
+};
+
+static jerry_value_t
+native_handler (const jerry_value_t func_obj_val, /**< function object */
+                const jerry_value_t this_val, /**< this value */
+                const jerry_value_t args_p[], /**< arguments list */
+                const jerry_length_t args_cnt) /**< arguments length */
+{
+  JERRY_UNUSED (func_obj_val);
+  JERRY_UNUSED (this_val);
+
+  TEST_ASSERT (args_cnt == 1 && jerry_value_is_number (args_p[0]));
+  return jerry_create_number (jerry_get_number_value (args_p[0]) * 2);
+} /* native_handler */
+
+static jerry_value_t
+save_from_handler (const jerry_value_t func_obj_val, /**< function object */
+                   const jerry_value_t this_val, /**< this value */
+                   const jerry_value_t args_p[], /**< arguments list */
+                   const jerry_length_t args_cnt) /**< arguments length */
+{
+  JERRY_UNUSED (func_obj_val);
+  JERRY_UNUSED (this_val);
+  JERRY_UNUSED (args_p);
+  JERRY_UNUSED (args_cnt);
+
+  return jerry_save_heap_image (NULL, 0, NULL, NULL);
+} /* save_from_handler */
+
+/**
+ * Native pointers of the heap, the saved value of a pointer is its index plus one.
+ */
+static uintptr_t native_pointers[4];
+
+static uintptr_t
+save_pointer_cb (uintptr_t pointer, /**< native pointer */
+                 void *user_p) /**< user pointer */
+{
+  TEST_ASSERT (user_p == (void *) &native_data);
+
+  for (uintptr_t i = 0; i < sizeof (native_pointers) / sizeof (native_pointers[0]); i++)
+  {
+    if (native_pointers[i] == pointer)
+    {
+      return i + 1;
+    }
+  }
+
+  TEST_ASSERT (false);
+  return 0;
+} /* save_pointer_cb */
+
+static uintptr_t
+restore_pointer_cb (uintptr_t value, /**< saved value */
+                    void *user_p) /**< user pointer */
+{
+  TEST_ASSERT (user_p == (void *) &native_data);
+  TEST_ASSERT (value >= 1 && value <= sizeof (native_pointers) / sizeof (native_pointers[0]));
+
+  return native_pointers[value - 1];
+} /* restore_pointer_cb */
+
+static void
+set_global_function (const char *name_p, /**< property name */
+                     jerry_external_handler_t handler_p) /**< function handler */
+{
+  jerry_value_t global_obj_val = jerry_get_global_object ();
+  jerry_value_t func_val = jerry_create_external_function (handler_p);
+  jerry_value_t name_val = jerry_create_string ((const jerry_char_t *) name_p);
+  jerry_value_t result = jerry_set_property (global_obj_val, name_val, func_val);
+
+  TEST_ASSERT (jerry_value_is_boolean (result));
+
+  jerry_release_value (result);
+  jerry_release_value (name_val);
+  jerry_release_value (func_val);
+  jerry_release_value (global_obj_val);
+} /* set_global_function */
+
+static jerry_value_t
+eval_source (const char *source_p) /**< source code */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  return result;
+} /* eval_source */
+
+static bool
+eval_boolean (const char *source_p) /**< source code */
+{
+  jerry_value_t result = eval_source (source_p);
+  TEST_ASSERT (jerry_value_is_boolean (result));
+
+  bool value = jerry_get_boolean_value (result);
+  jerry_release_value (result);
+  return value;
+} /* eval_boolean */
+
+static bool
+is_thrown_error (jerry_value_t value, /**< value */
+                 jerry_error_t error_type) /**< expected error type */
+{
+  bool is_error = jerry_value_is_error (value) && jerry_get_error_type (value) == error_type;
+  jerry_release_value (value);
+  return is_error;
+} /* is_thrown_error */
+
+/**
+ * Save the heap image.
+ *
+ * @return size of the image
+ */
+static size_t
+save_heap_image (uint8_t *buffer_p, /**< [out] buffer */
+                 size_t buffer_size) /**< size of the buffer */
+{
+  jerry_value_t result = jerry_save_heap_image (buffer_p, buffer_size, save_pointer_cb, &native_data);
+  TEST_ASSERT (jerry_value_is_number (result));
+
+  size_t size = (size_t) jerry_get_number_value (result);
+  jerry_release_value (result);
+  return size;
+} /* save_heap_image */
+
+static void
+check_restored_context (void)
+{
+  TEST_ASSERT (eval_boolean ("counter () === 2 && counter () === 3"));
+  TEST_ASSERT (eval_boolean ("config.name === 'app' && config.list.length === 3 && config.list[1] === 2.5"
+                             "  && config.list[2] === 'three' && Object.keys (config).join () === 'name,list'"));
+  TEST_ASSERT (eval_boolean ("callNative (5) === 11 && typeof nativeHandler === 'function'"));
+  TEST_ASSERT (eval_boolean ("var m = /a(b+)c/g.exec ('xabbc'); m[1] === 'bb' && re.global"));
+  TEST_ASSERT (eval_boolean ("date.getTime () === 1000 && Math.max (1, 2) === 2"));
+
+  /* New code and new properties work in the restored context. */
+  TEST_ASSERT (eval_boolean ("config.extra = [1, 2, 3].map (function (x) { return x * 1.5; });"
+                             "config.extra[2] === 4.5 && String (config.extra) === '1.5,3,4.5'"));
+
+  jerry_value_t holder_val = eval_source ("holder");
+  void *native_p;
+  const jerry_object_native_info_t *info_p;
+
+  TEST_ASSERT (jerry_get_object_native_pointer (holder_val, &native_p, &info_p));
+  TEST_ASSERT (native_p == &native_data && info_p == &native_info);
+  jerry_release_value (holder_val);
+} /* check_restored_context */
+
+int
+main (void)
+{
+  TEST_INIT ();
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_HEAP_IMAGE))
+  {
+    TEST_ASSERT (is_thrown_error (jerry_save_heap_image (NULL, 0, NULL, NULL), JERRY_ERROR_TYPE));
+    jerry_cleanup ();
+
+    TEST_ASSERT (!jerry_init_from_heap_image (JERRY_INIT_EMPTY, (const uint8_t *) "", 0, NULL, NULL));
+    return 0;
+  }
+
+  native_pointers[0] = (uintptr_t) native_handler;
+  native_pointers[1] = (uintptr_t) save_from_handler;
+  native_pointers[2] = (uintptr_t) &native_data;
+  native_pointers[3] = (uintptr_t) &native_info;
+
+  /* Bootstrap the context. */
+  set_global_function ("nativeHandler", native_handler);
+  set_global_function ("saveFromHandler", save_from_handler);
+
+  jerry_release_value (eval_source ("var counter = (function () { var c = 0; return function () { return ++c; }; }) ();"
+                                    "var config = { name: 'app', list: [1, 2.5, 'three'] };"
+                                    "var re = /a(b+)c/g; var date = new Date (1000);"
+                                    "function callNative (x) { return nativeHandler (x) + 1; }"
+                                    "var holder = {}; counter ();"));
+
+  jerry_value_t holder_val = eval_source ("holder");
+  jerry_set_object_native_pointer (holder_val, &native_data, &native_info);
+  jerry_release_value (holder_val);
+
+  /* The image cannot be saved while code is running. */
+  TEST_ASSERT (eval_boolean ("(function () { try { saveFromHandler (); return false; }"
+                             "  catch (e) { return e instanceof TypeError; } }) ()"));
+
+  /* External strings cannot be saved. */
+  const char *external_string_p = "an external string, which is not copied";
+  jerry_value_t string_val = jerry_create_external_string ((const jerry_char_t *) external_string_p, NULL);
+  TEST_ASSERT (is_thrown_error (jerry_save_heap_image (NULL, 0, NULL, NULL), JERRY_ERROR_TYPE));
+  jerry_release_value (string_val);
+
+  if (jerry_is_feature_enabled (JERRY_FEATURE_PROMISE))
+  {
+    /* Pending jobs cannot be saved. */
+    jerry_release_value (eval_source ("Promise.resolve (1).then (function () {})"));
+    TEST_ASSERT (is_thrown_error (jerry_save_heap_image (NULL, 0, NULL, NULL), JERRY_ERROR_TYPE));
+
+    jerry_value_t result = jerry_run_all_enqueued_jobs ();
+    TEST_ASSERT (!jerry_value_is_error (result));
+    jerry_release_value (result);
+  }
+
+  /* The size is reported when the buffer is too small. */
+  size_t size = save_heap_image (NULL, 0);
+  TEST_ASSERT (size > 0);
+
+  uint8_t *image_p = (uint8_t *) malloc (size);
+  TEST_ASSERT (save_heap_image (image_p, size - 1) == size);
+  TEST_ASSERT (save_heap_image (image_p, size) == size);
+
+  jerry_cleanup ();
+  TEST_ASSERT (native_free_count == 1);
+
+  /* Every restored context starts from the same state. */
+  for (int i = 0; i < 2; i++)
+  {
+    TEST_ASSERT (jerry_init_from_heap_image (JERRY_INIT_EMPTY, image_p, size, restore_pointer_cb, &native_data));
+    check_restored_context ();
+    jerry_cleanup ();
+    TEST_ASSERT (native_free_count == i + 2);
+  }
+
+  /* Invalid images are rejected. */
+  TEST_ASSERT (!jerry_init_from_heap_image (JERRY_INIT_EMPTY, NULL, 0, NULL, NULL));
+  TEST_ASSERT (!jerry_init_from_heap_image (JERRY_INIT_EMPTY, image_p, size - 1, NULL, NULL));
+  TEST_ASSERT (!jerry_init_from_heap_image (JERRY_INIT_EMPTY, image_p, 16, NULL, NULL));
+
+  image_p[0] = (uint8_t) (image_p[0] ^ 0xff);
+  TEST_ASSERT (!jerry_init_from_heap_image (JERRY_INIT_EMPTY, image_p, size, NULL, NULL));
+
+  free (image_p);
+
+  /* The engine can be initialized normally after a rejected image. */
+  jerry_init (JERRY_INIT_EMPTY);
+  TEST_ASSERT (eval_boolean ("typeof counter === 'undefined'"));
+  jerry_cleanup ();
+  return 0;
+} /* main */
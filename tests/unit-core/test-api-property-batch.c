@@ -0,0 +1,189 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+#define FIELD_COUNT 40
+
+static jerry_value_t
+eval_source (const char *source_p) /**< source code */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  return result;
+} /* eval_source */
+
+static bool
+check_value (const char *source_p, /**< checker function source */
+             jerry_value_t value) /**< value to check */
+{
+  jerry_value_t func_val = eval_source (source_p);
+  TEST_ASSERT (jerry_value_is_function (func_val));
+
+  jerry_value_t undefined_val = jerry_create_undefined ();
+  jerry_value_t result = jerry_call_function (func_val, undefined_val, &value, 1);
+  TEST_ASSERT (jerry_value_is_boolean (result));
+
+  bool is_ok = jerry_get_boolean_value (result);
+
+  jerry_release_value (result);
+  jerry_release_value (undefined_val);
+  jerry_release_value (func_val);
+  return is_ok;
+} /* check_value */
+
+static bool
+is_thrown_error (jerry_value_t value, /**< value */
+                 jerry_error_t error_type) /**< expected error type */
+{
+  bool is_error = jerry_value_is_error (value) && jerry_get_error_type (value) == error_type;
+  jerry_release_value (value);
+  return is_error;
+} /* is_thrown_error */
+
+static jerry_value_t
+create_name (const char *name_p) /**< property name */
+{
+  jerry_value_t name_val = jerry_create_property_name ((const jerry_char_t *) name_p, (jerry_size_t) strlen (name_p));
+  TEST_ASSERT (jerry_value_is_string (name_val));
+  return name_val;
+} /* create_name */
+
+static jerry_value_t names[FIELD_COUNT];
+static jerry_value_t values[FIELD_COUNT];
+
+int
+main (void)
+{
+  TEST_INIT ();
+  jerry_init (JERRY_INIT_EMPTY);
+
+  for (int i = 0; i < FIELD_COUNT; i++)
+  {
+    char name[16];
+    snprintf (name, sizeof (name), "field%d", i);
+    names[i] = create_name (name);
+    values[i] = jerry_create_number (i * 3);
+  }
+
+  /* A record with many fields. */
+  jerry_value_t object_val = jerry_create_object_from_properties (names, values, FIELD_COUNT);
+  TEST_ASSERT (jerry_value_is_object (object_val));
+  TEST_ASSERT (check_value ("(function (o) { var keys = Object.keys (o); if (keys.length !== 40) return false;"
+                            "  for (var i = 0; i < 40; i++)"
+                            "    if (keys[i] !== 'field' + i || o[keys[i]] !== i * 3) return false;"
+                            "  var desc = Object.getOwnPropertyDescriptor (o, 'field7');"
+                            "  return desc.writable && desc.enumerable && desc.configurable"
+                            "    && Object.getPrototypeOf (o) === Object.prototype; })",
+                            object_val));
+
+  /* Reading the fields back. */
+  jerry_value_t result_values[FIELD_COUNT];
+  jerry_value_t result = jerry_get_properties (object_val, names, result_values, FIELD_COUNT);
+  TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+  jerry_release_value (result);
+
+  for (int i = 0; i < FIELD_COUNT; i++)
+  {
+    TEST_ASSERT (jerry_value_is_number (result_values[i]) && jerry_get_number_value (result_values[i]) == i * 3);
+    jerry_release_value (result_values[i]);
+  }
+
+  jerry_release_value (object_val);
+
+  /* The names are shared with the parsed source code and work with the other property functions. */
+  object_val = eval_source ("({ field1: 'literal', get field2 () { return 'getter'; } })");
+  result = jerry_get_properties (object_val, names, result_values, 4);
+  TEST_ASSERT (jerry_value_is_boolean (result));
+  jerry_release_value (result);
+
+  TEST_ASSERT (jerry_value_is_undefined (result_values[0]));
+  TEST_ASSERT (check_value ("(function (v) { return v === 'literal'; })", result_values[1]));
+  TEST_ASSERT (check_value ("(function (v) { return v === 'getter'; })", result_values[2]));
+  TEST_ASSERT (jerry_value_is_undefined (result_values[3]));
+
+  for (int i = 0; i < 4; i++)
+  {
+    jerry_release_value (result_values[i]);
+  }
+
+  jerry_value_t string_val = jerry_get_property (object_val, names[1]);
+  TEST_ASSERT (jerry_value_is_string (string_val));
+  jerry_release_value (string_val);
+  jerry_release_value (object_val);
+
+  /* Duplicated names keep their first position and their last value. */
+  jerry_value_t dup_names[3] = { names[0], names[1], names[0] };
+  object_val = jerry_create_object_from_properties (dup_names, values + 1, 3);
+  TEST_ASSERT (check_value ("(function (o) { return Object.keys (o).join () === 'field0,field1'"
+                            "  && o.field0 === 9 && o.field1 === 6; })",
+                            object_val));
+  jerry_release_value (object_val);
+
+  /* The properties are defined, so the setters of the prototype are not called. */
+  jerry_release_value (eval_source ("Object.defineProperty (Object.prototype, 'field5', {"
+                                    "  set: function () { throw new RangeError ('setter'); }, configurable: true })"));
+  object_val = jerry_create_object_from_properties (names, values, 6);
+  TEST_ASSERT (check_value ("(function (o) { return o.hasOwnProperty ('field5') && o.field5 === 15; })",
+                            object_val));
+
+  /* Exceptions of getters are propagated and no values are returned. */
+  jerry_release_value (eval_source ("delete Object.prototype.field5;"
+                                    "Object.defineProperty (Object.prototype, 'field8', {"
+                                    "  get: function () { throw new RangeError ('getter'); }, configurable: true })"));
+  for (int i = 0; i < FIELD_COUNT; i++)
+  {
+    result_values[i] = jerry_create_number (-1);
+  }
+
+  TEST_ASSERT (is_thrown_error (jerry_get_properties (object_val, names, result_values, 10), JERRY_ERROR_RANGE));
+
+  for (int i = 0; i < 10; i++)
+  {
+    TEST_ASSERT (jerry_value_is_undefined (result_values[i]));
+  }
+
+  /* Invalid arguments. */
+  jerry_value_t number_val = jerry_create_number (1);
+  jerry_value_t bad_names[2] = { names[0], number_val };
+
+  TEST_ASSERT (is_thrown_error (jerry_get_properties (number_val, names, result_values, 1), JERRY_ERROR_TYPE));
+  TEST_ASSERT (jerry_value_is_undefined (result_values[0]));
+  TEST_ASSERT (is_thrown_error (jerry_get_properties (object_val, bad_names, result_values, 2), JERRY_ERROR_TYPE));
+  TEST_ASSERT (is_thrown_error (jerry_create_object_from_properties (bad_names, values, 2), JERRY_ERROR_TYPE));
+  TEST_ASSERT (is_thrown_error (jerry_create_object_from_properties (NULL, NULL, 1), JERRY_ERROR_TYPE));
+  jerry_release_value (number_val);
+  jerry_release_value (object_val);
+
+  /* Empty batches. */
+  object_val = jerry_create_object_from_properties (NULL, NULL, 0);
+  TEST_ASSERT (check_value ("(function (o) { return Object.keys (o).length === 0; })", object_val));
+
+  result = jerry_get_properties (object_val, NULL, NULL, 0);
+  TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+  jerry_release_value (result);
+  jerry_release_value (object_val);
+
+  for (int i = 0; i < FIELD_COUNT; i++)
+  {
+    jerry_release_value (names[i]);
+    jerry_release_value (values[i]);
+  }
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
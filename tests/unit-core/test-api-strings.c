@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include "config.h"
 #include "jerryscript.h"
 
 #include "test-common.h"
@@ -294,6 +295,95 @@ main (void)
 
   jerry_release_value (args[0]);
 
+  /* Test jerry_string_borrow_utf8: contiguous strings are not copied */
+  const jerry_char_t *borrowed_p;
+  const jerry_char_t *borrowed2_p;
+  jerry_size_t borrowed2_sz;
+
+  args[0] = jerry_create_string ((jerry_char_t *) "borrowed string");
+  borrowed_p = jerry_string_borrow_utf8 (args[0], &sz);
+  borrowed2_p = jerry_string_borrow_utf8 (args[0], &borrowed2_sz);
+  TEST_ASSERT (sz == 15 && borrowed2_sz == 15);
+  TEST_ASSERT (borrowed_p == borrowed2_p);
+  TEST_ASSERT (!strncmp ((const char *) borrowed_p, "borrowed string", sz));
+  jerry_string_release_utf8 (args[0], borrowed2_p, borrowed2_sz);
+  jerry_string_release_utf8 (args[0], borrowed_p, sz);
+  jerry_release_value (args[0]);
+
+  /* Magic strings are not copied either */
+  args[0] = jerry_create_string ((jerry_char_t *) "prototype");
+  borrowed_p = jerry_string_borrow_utf8 (args[0], &sz);
+  borrowed2_p = jerry_string_borrow_utf8 (args[0], &borrowed2_sz);
+  TEST_ASSERT (sz == 9 && borrowed_p == borrowed2_p);
+  TEST_ASSERT (!strncmp ((const char *) borrowed_p, "prototype", sz));
+  jerry_string_release_utf8 (args[0], borrowed2_p, borrowed2_sz);
+  jerry_string_release_utf8 (args[0], borrowed_p, sz);
+  jerry_release_value (args[0]);
+
+  /* Number strings are copied */
+  args[0] = jerry_create_string ((jerry_char_t *) "4294967295");
+  args[1] = jerry_create_string ((jerry_char_t *) "12");
+  borrowed_p = jerry_string_borrow_utf8 (args[0], &sz);
+  borrowed2_p = jerry_string_borrow_utf8 (args[1], &borrowed2_sz);
+  TEST_ASSERT (sz == 10 && !strncmp ((const char *) borrowed_p, "4294967295", sz));
+  TEST_ASSERT (borrowed2_sz == 2 && !strncmp ((const char *) borrowed2_p, "12", borrowed2_sz));
+  jerry_string_release_utf8 (args[1], borrowed2_p, borrowed2_sz);
+  jerry_string_release_utf8 (args[0], borrowed_p, sz);
+  jerry_release_value (args[1]);
+  jerry_release_value (args[0]);
+
+  /* Surrogate pairs are converted to 4-byte long utf-8 sequences */
+  args[0] = jerry_create_string ((jerry_char_t *) "\x73\x74\x72\x3a \xed\xa0\x81\xed\xb0\x80");
+  borrowed_p = jerry_string_borrow_utf8 (args[0], &sz);
+  TEST_ASSERT (sz == 9);
+  TEST_ASSERT (!strncmp ((const char *) borrowed_p, "\x73\x74\x72\x3a \xf0\x90\x90\x80", sz));
+  jerry_string_release_utf8 (args[0], borrowed_p, sz);
+  jerry_release_value (args[0]);
+
+  /* Long strings with non-ascii characters */
+  const jerry_size_t long_sz = 70000;
+  jerry_char_t *long_string_p = (jerry_char_t *) malloc (long_sz);
+  memset (long_string_p, 'a', long_sz);
+  long_string_p[long_sz - 2] = 0xc3;
+  long_string_p[long_sz - 1] = 0xa1;
+  args[0] = jerry_create_string_sz (long_string_p, long_sz);
+  TEST_ASSERT (jerry_get_utf8_string_size (args[0]) == long_sz);
+  borrowed_p = jerry_string_borrow_utf8 (args[0], &sz);
+  borrowed2_p = jerry_string_borrow_utf8 (args[0], &borrowed2_sz);
+  TEST_ASSERT (sz == long_sz && borrowed_p == borrowed2_p);
+  TEST_ASSERT (!memcmp (borrowed_p, long_string_p, sz));
+  jerry_string_release_utf8 (args[0], borrowed2_p, borrowed2_sz);
+  jerry_string_release_utf8 (args[0], borrowed_p, sz);
+  jerry_release_value (args[0]);
+  free (long_string_p);
+
+  /* Not a string */
+  args[0] = jerry_create_number (12);
+  borrowed_p = jerry_string_borrow_utf8 (args[0], &sz);
+  TEST_ASSERT (borrowed_p == NULL && sz == 0);
+  jerry_string_release_utf8 (args[0], borrowed_p, sz);
+  jerry_release_value (args[0]);
+
+#ifndef JERRY_SYSTEM_ALLOCATOR
+  /* The copy of a string which fills 60% of the heap does not fit into the rest of the heap */
+  const jerry_size_t surrogate_count = (jerry_size_t) (CONFIG_MEM_HEAP_AREA_SIZE / 10);
+  jerry_char_t *surrogate_string_p = (jerry_char_t *) malloc (surrogate_count * 6);
+
+  for (jerry_size_t i = 0; i < surrogate_count; i++)
+  {
+    memcpy (surrogate_string_p + i * 6, "\xed\xa0\x81\xed\xb0\x80", 6);
+  }
+
+  args[0] = jerry_create_string_sz (surrogate_string_p, surrogate_count * 6);
+  free (surrogate_string_p);
+
+  sz = 1;
+  borrowed_p = jerry_string_borrow_utf8 (args[0], &sz);
+  TEST_ASSERT (borrowed_p == NULL && sz == 0);
+  jerry_string_release_utf8 (args[0], borrowed_p, sz);
+  jerry_release_value (args[0]);
+#endif /* !JERRY_SYSTEM_ALLOCATOR */
+
   jerry_cleanup ();
 
   return 0;
@@ -0,0 +1,238 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static jerry_value_t
+eval_source (const char *source_p) /**< source code */
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  return result;
+} /* eval_source */
+
+static bool
+check_value (const char *source_p, /**< checker function source */
+             jerry_value_t value) /**< value to check */
+{
+  jerry_value_t func_val = eval_source (source_p);
+  TEST_ASSERT (jerry_value_is_function (func_val));
+
+  jerry_value_t undefined_val = jerry_create_undefined ();
+  jerry_value_t result = jerry_call_function (func_val, undefined_val, &value, 1);
+  TEST_ASSERT (jerry_value_is_boolean (result));
+
+  bool is_ok = jerry_get_boolean_value (result);
+
+  jerry_release_value (result);
+  jerry_release_value (undefined_val);
+  jerry_release_value (func_val);
+  return is_ok;
+} /* check_value */
+
+/**
+ * Serialize the result of the source code into the buffer.
+ *
+ * @return size of the serialized data
+ */
+static size_t
+serialize_source (const char *source_p, /**< source code */
+                  uint8_t *buffer_p, /**< [out] buffer */
+                  size_t buffer_size) /**< size of the buffer */
+{
+  jerry_value_t value = eval_source (source_p);
+  jerry_value_t result = jerry_serialize (value, buffer_p, buffer_size);
+  jerry_release_value (value);
+
+  TEST_ASSERT (jerry_value_is_number (result));
+
+  size_t size = (size_t) jerry_get_number_value (result);
+  jerry_release_value (result);
+
+  TEST_ASSERT (size <= buffer_size);
+  return size;
+} /* serialize_source */
+
+static bool
+is_thrown_error (jerry_value_t value, /**< value */
+                 jerry_error_t error_type) /**< expected error type */
+{
+  bool is_error = jerry_value_is_error (value) && jerry_get_error_type (value) == error_type;
+  jerry_release_value (value);
+  return is_error;
+} /* is_thrown_error */
+
+static uint8_t buffer[4096];
+static uint8_t corrupted_buffer[4096];
+
+int
+main (void)
+{
+  TEST_INIT ();
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_STRUCTURED_CLONE))
+  {
+    jerry_value_t undefined_val = jerry_create_undefined ();
+    TEST_ASSERT (is_thrown_error (jerry_serialize (undefined_val, buffer, sizeof (buffer)), JERRY_ERROR_TYPE));
+    TEST_ASSERT (is_thrown_error (jerry_deserialize (buffer, sizeof (buffer)), JERRY_ERROR_TYPE));
+    jerry_release_value (undefined_val);
+
+    jerry_cleanup ();
+    return 0;
+  }
+
+  /* Primitive values and plain objects, passed to a new context. */
+  const char *object_source_p = ("({ i: -5, big: 1e9, f: 0.5, nz: -0, nan: NaN, s: '\\u00e1rv\\u00edz',"
+                                 "   b: true, n: null, u: undefined, 123: 'index',"
+                                 "   arr: [1, , 'x', [2, [3]]], nested: { a: { b: { c: 'deep' } } } })");
+  size_t size = serialize_source (object_source_p, buffer, sizeof (buffer));
+
+  jerry_cleanup ();
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t value = jerry_deserialize (buffer, size);
+  TEST_ASSERT (jerry_value_is_object (value));
+  TEST_ASSERT (check_value ("(function (o) { return o.i === -5 && o.big === 1e9 && o.f === 0.5"
+                            "  && 1 / o.nz === -Infinity && o.nan !== o.nan && o.s === '\\u00e1rv\\u00edz'"
+                            "  && o.b === true && o.n === null && o.hasOwnProperty ('u') && o.u === undefined"
+                            "  && o[123] === 'index' && Object.getPrototypeOf (o) === Object.prototype; })",
+                            value));
+  TEST_ASSERT (check_value ("(function (o) { var a = o.arr; return Array.isArray (a) && a.length === 4"
+                            "  && a[0] === 1 && !(1 in a) && a[2] === 'x' && a[3][1][0] === 3"
+                            "  && o.nested.a.b.c === 'deep'; })",
+                            value));
+  jerry_release_value (value);
+
+  /* The size is reported when the buffer is too small. */
+  jerry_value_t source_val = eval_source (object_source_p);
+  jerry_value_t result = jerry_serialize (source_val, NULL, 0);
+  TEST_ASSERT (jerry_value_is_number (result) && (size_t) jerry_get_number_value (result) == size);
+  jerry_release_value (result);
+
+  result = jerry_serialize (source_val, buffer, size - 1);
+  TEST_ASSERT (jerry_value_is_number (result) && (size_t) jerry_get_number_value (result) == size);
+  jerry_release_value (result);
+  jerry_release_value (source_val);
+
+  /* Shared subgraphs and cycles are restored. */
+  size = serialize_source ("var shared = { x: 1 }; var o = { p: shared, q: [shared, shared] }; o.self = o; o",
+                           buffer,
+                           sizeof (buffer));
+  value = jerry_deserialize (buffer, size);
+  TEST_ASSERT (check_value ("(function (o) { return o.p === o.q[0] && o.p === o.q[1] && o.self === o"
+                            "  && o.p.x === 1 && o.p !== shared; })",
+                            value));
+  jerry_release_value (value);
+
+  /* Builtin objects. */
+  size = serialize_source ("[new Boolean (true), new Number (2.5), new String ('str'),"
+                           " new Date (1234567), /a+b/gi]",
+                           buffer,
+                           sizeof (buffer));
+  value = jerry_deserialize (buffer, size);
+  TEST_ASSERT (check_value ("(function (a) { return a[0] instanceof Boolean && a[0].valueOf () === true"
+                            "  && a[1] instanceof Number && a[1].valueOf () === 2.5"
+                            "  && a[2] instanceof String && a[2].valueOf () === 'str'"
+                            "  && a[3] instanceof Date && a[3].getTime () === 1234567"
+                            "  && a[4] instanceof RegExp && a[4].source === 'a+b' && a[4].global"
+                            "  && a[4].ignoreCase && !a[4].multiline && a[4].test ('xAAB'); })",
+                            value));
+  jerry_release_value (value);
+
+  if (jerry_is_feature_enabled (JERRY_FEATURE_TYPEDARRAY))
+  {
+    /* The views share the cloned ArrayBuffer. */
+    size = serialize_source ("var ab = new ArrayBuffer (16); var u8 = new Uint8Array (ab);"
+                             "for (var i = 0; i < 16; i++) u8[i] = i * 3;"
+                             "[ab, new Uint16Array (ab, 4, 2), u8, new Float32Array ([1.5, -2])]",
+                             buffer,
+                             sizeof (buffer));
+    value = jerry_deserialize (buffer, size);
+    TEST_ASSERT (check_value ("(function (a) { var ab = a[0], u16 = a[1], u8 = a[2];"
+                              "  if (!(ab instanceof ArrayBuffer) || ab.byteLength !== 16) return false;"
+                              "  if (!(u16 instanceof Uint16Array) || u16.buffer !== ab || u16.byteOffset !== 4"
+                              "      || u16.length !== 2 || u8.buffer !== ab || u8[15] !== 45) return false;"
+                              "  u8[4] = 0xff; u8[5] = 0;"
+                              "  return u16[0] === 0xff && a[3][0] === 1.5 && a[3][1] === -2; })",
+                              value));
+    jerry_release_value (value);
+  }
+
+  value = eval_source ("typeof Map === 'function'");
+  bool has_map = jerry_get_boolean_value (value);
+  jerry_release_value (value);
+
+  if (has_map)
+  {
+    size = serialize_source ("var key = { k: 1 }; var m = new Map ();"
+                             "m.set ('a', 1); m.set (key, 'object'); m.set ('key', key); m.set (2.5, 'float');"
+                             "m.set ('del', 0); m.delete ('del'); m.set ('self', m); m",
+                             buffer,
+                             sizeof (buffer));
+    value = jerry_deserialize (buffer, size);
+    TEST_ASSERT (check_value ("(function (m) { var key = m.get ('key');"
+                              "  return m instanceof Map && m.size === 5 && m.get ('a') === 1"
+                              "  && key.k === 1 && m.get (key) === 'object' && m.get (2.5) === 'float'"
+                              "  && !m.has ('del') && m.get ('self') === m; })",
+                              value));
+    jerry_release_value (value);
+  }
+
+  /* Functions cannot be cloned. */
+  value = eval_source ("({ f: function () {} })");
+  TEST_ASSERT (is_thrown_error (jerry_serialize (value, buffer, sizeof (buffer)), JERRY_ERROR_TYPE));
+  jerry_release_value (value);
+
+  /* Getters are invoked, and their exceptions are propagated. */
+  value = eval_source ("({ get g () { throw new RangeError ('getter'); } })");
+  TEST_ASSERT (is_thrown_error (jerry_serialize (value, buffer, sizeof (buffer)), JERRY_ERROR_RANGE));
+  jerry_release_value (value);
+
+  /* The nesting depth is limited. */
+  value = eval_source ("var a = []; for (var i = 0; i < 1000; i++) a = [a]; a");
+  TEST_ASSERT (is_thrown_error (jerry_serialize (value, buffer, sizeof (buffer)), JERRY_ERROR_RANGE));
+  jerry_release_value (value);
+
+  /* Malformed data is rejected. */
+  size = serialize_source ("({ a: [1, 2, { b: 'text' }], c: 'more text' })", buffer, sizeof (buffer));
+
+  for (size_t i = 0; i < size; i++)
+  {
+    TEST_ASSERT (is_thrown_error (jerry_deserialize (buffer, i), JERRY_ERROR_TYPE));
+  }
+
+  buffer[size] = 0;
+  TEST_ASSERT (is_thrown_error (jerry_deserialize (buffer, size + 1), JERRY_ERROR_TYPE));
+
+  buffer[0] = 'X';
+  TEST_ASSERT (is_thrown_error (jerry_deserialize (buffer, size), JERRY_ERROR_TYPE));
+
+  /* Corrupted bytes must not crash the engine. */
+  size = serialize_source ("({ a: [1, 2, { b: 'text' }], c: new Date (0), d: /x/ })", buffer, sizeof (buffer));
+
+  for (size_t i = 4; i < size; i++)
+  {
+    memcpy (corrupted_buffer, buffer, size);
+    corrupted_buffer[i] = (uint8_t) (corrupted_buffer[i] ^ 0x5a);
+
+    jerry_release_value (jerry_deserialize (corrupted_buffer, size));
+  }
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -161,6 +161,216 @@ static void test_free_cb (void *buffer) /**< buffer to free (if needed) */
   callback_called = true;
 } /* test_free_cb */
 
+static int detached_free_count = 0;
+static void *detached_freed_p = NULL;
+
+static void detached_free_cb (void *buffer) /**< buffer to free */
+{
+  detached_free_count++;
+  detached_freed_p = buffer;
+} /* detached_free_cb */
+
+static jerry_value_t
+detach_handler (const jerry_value_t func_obj_val, /**< function object */
+                const jerry_value_t this_val, /**< this arg */
+                const jerry_value_t args_p[], /**< function arguments */
+                const jerry_length_t args_cnt) /**< number of function arguments */
+{
+  JERRY_UNUSED (func_obj_val);
+  JERRY_UNUSED (this_val);
+  TEST_ASSERT (args_cnt == 1);
+
+  return jerry_detach_arraybuffer (args_p[0], NULL);
+} /* detach_handler */
+
+/**
+ * Evaluate a script which must return true.
+ */
+static void
+test_eval_true (const char *source_p) /**< source code */
+{
+  jerry_value_t res = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_STRICT_MODE);
+  TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+  jerry_release_value (res);
+} /* test_eval_true */
+
+/**
+ * Test detaching ArrayBuffer memory.
+ */
+static void
+test_detach (uint8_t *buffer_p, /**< external buffer */
+             jerry_length_t buffer_size, /**< size of the buffer */
+             jerry_arraybuffer_contents_t *contents_p, /**< [out] detached memory */
+             jerry_arraybuffer_contents_t *script_contents_p) /**< [out] detached memory of a script buffer */
+{
+  /* The memory of ArrayBuffers created by scripts is copied when it is detached. */
+  const char *script_buffer_src_p = ("var script_buffer = new ArrayBuffer (12);"
+                                     "var script_u8 = new Uint8Array (script_buffer);"
+                                     "for (var i = 0; i < script_u8.length; i++) script_u8[i] = i + 100;"
+                                     "script_buffer");
+  jerry_value_t arraybuffer = jerry_eval ((const jerry_char_t *) script_buffer_src_p,
+                                          strlen (script_buffer_src_p),
+                                          JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_arraybuffer (arraybuffer));
+  TEST_ASSERT (jerry_is_arraybuffer_detachable (arraybuffer));
+
+  jerry_value_t res = jerry_detach_arraybuffer (arraybuffer, script_contents_p);
+  TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+  jerry_release_value (res);
+
+  /* The copy is not part of the engine heap, so it can be passed to another context. */
+  TEST_ASSERT (script_contents_p->length == 12);
+  TEST_ASSERT (script_contents_p->buffer_p != NULL);
+  TEST_ASSERT (script_contents_p->free_cb == jerry_port_free_arraybuffer);
+
+  for (uint8_t i = 0; i < 12; i++)
+  {
+    TEST_ASSERT (script_contents_p->buffer_p[i] == i + 100);
+  }
+
+  TEST_ASSERT (!jerry_is_arraybuffer_detachable (arraybuffer));
+  TEST_ASSERT (jerry_get_arraybuffer_byte_length (arraybuffer) == 0);
+  jerry_release_value (arraybuffer);
+
+  test_eval_true ("script_buffer.byteLength === 0 && script_u8.length === 0 && script_u8[0] === undefined");
+
+  /* An empty ArrayBuffer has no memory to pass. */
+  const char *empty_buffer_src_p = "new ArrayBuffer (0)";
+  arraybuffer = jerry_eval ((const jerry_char_t *) empty_buffer_src_p,
+                           strlen (empty_buffer_src_p),
+                           JERRY_PARSE_NO_OPTS);
+  res = jerry_detach_arraybuffer (arraybuffer, contents_p);
+  TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+  jerry_release_value (res);
+  jerry_release_value (arraybuffer);
+
+  TEST_ASSERT (contents_p->length == 0 && contents_p->buffer_p == NULL && contents_p->free_cb == NULL);
+
+  /* Without contents, the memory of the buffer is dropped. */
+  arraybuffer = jerry_create_arraybuffer (buffer_size);
+  TEST_ASSERT (jerry_is_arraybuffer_detachable (arraybuffer));
+  res = jerry_detach_arraybuffer (arraybuffer, NULL);
+  TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+  jerry_release_value (res);
+  TEST_ASSERT (jerry_get_arraybuffer_byte_length (arraybuffer) == 0);
+
+  res = jerry_detach_arraybuffer (arraybuffer, contents_p);
+  TEST_ASSERT (jerry_value_is_error (res) && jerry_get_error_type (res) == JERRY_ERROR_TYPE);
+  jerry_release_value (res);
+  jerry_release_value (arraybuffer);
+
+  jerry_value_t number = jerry_create_number (1);
+  TEST_ASSERT (!jerry_is_arraybuffer_detachable (number));
+  res = jerry_detach_arraybuffer (number, contents_p);
+  TEST_ASSERT (jerry_value_is_error (res) && jerry_get_error_type (res) == JERRY_ERROR_TYPE);
+  jerry_release_value (res);
+  jerry_release_value (number);
+
+  arraybuffer = jerry_create_arraybuffer_external (buffer_size, buffer_p, detached_free_cb);
+  TEST_ASSERT (jerry_is_arraybuffer_detachable (arraybuffer));
+  register_js_value ("transfer_buffer", arraybuffer);
+
+  test_eval_true ("var u8 = new Uint8Array (transfer_buffer);"
+                  "var u16 = new Uint16Array (transfer_buffer, 4, 2);"
+                  "for (var i = 0; i < u8.length; i++) u8[i] = i * 5;"
+                  "u16.length === 2");
+
+  /* The ownership of the memory is passed to the caller. */
+  res = jerry_detach_arraybuffer (arraybuffer, contents_p);
+  TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+  jerry_release_value (res);
+
+  TEST_ASSERT (contents_p->buffer_p == buffer_p);
+  TEST_ASSERT (contents_p->length == buffer_size);
+  TEST_ASSERT (contents_p->free_cb == detached_free_cb);
+  TEST_ASSERT (detached_free_count == 0);
+
+  TEST_ASSERT (!jerry_is_arraybuffer_detachable (arraybuffer));
+  TEST_ASSERT (jerry_get_arraybuffer_byte_length (arraybuffer) == 0);
+  TEST_ASSERT (jerry_get_arraybuffer_pointer (arraybuffer) == NULL);
+
+  res = jerry_detach_arraybuffer (arraybuffer, contents_p);
+  TEST_ASSERT (jerry_value_is_error (res));
+  jerry_release_value (res);
+  jerry_release_value (arraybuffer);
+
+  /* The buffer and its views become zero-length. */
+  test_eval_true ("transfer_buffer.byteLength === 0 && u8.length === 0 && u8.byteLength === 0"
+                  "  && u16.length === 0 && u16.byteOffset === 0 && u16.byteLength === 0"
+                  "  && u8[0] === undefined && (u8[0] = 5, u8[0] === undefined)"
+                  "  && u8.buffer === transfer_buffer");
+
+  test_eval_true ("var errors = 0;"
+                  "try { new Uint8Array (transfer_buffer); } catch (e) { errors += e instanceof TypeError; }"
+                  "try { new Uint8Array (u16); } catch (e) { errors += e instanceof TypeError; }"
+                  "try { transfer_buffer.slice (0); } catch (e) { errors += e instanceof TypeError; }"
+                  "try { new Uint8Array (4).set (u8); } catch (e) { errors += e instanceof TypeError; }"
+                  "errors === 4");
+
+  /* Detaching from callbacks. */
+  jerry_value_t function_val = jerry_create_external_function (detach_handler);
+  register_js_value ("detach", function_val);
+  jerry_release_value (function_val);
+
+  static uint8_t callback_buffer[8];
+
+  const char *callback_tests_p[] =
+  {
+    "var a = new Uint8Array (buffer), seen = [];"
+    "a.forEach (function (v, i) { if (i === 1) detach (buffer); seen.push (v); });"
+    "seen.length === 8 && seen[1] === 1 && seen[2] === undefined",
+
+    "var a = new Uint8Array (buffer);"
+    "var b = a.filter (function (v, i) { if (i === 1) detach (buffer); return i < 3; });"
+    "b.length === 3 && b[0] === 0 && b[1] === 1 && b[2] === 0",
+
+    "var a = new Uint8Array (buffer);"
+    "a.sort (function (x, y) { if (a.length) detach (buffer); return x - y; }).length === 0",
+
+    "var a = new Uint8Array (buffer);"
+    "a.find (function (v, i) { if (i === 0) detach (buffer); return i === 7; }) === undefined",
+
+    "var a = new Uint8Array (buffer);"
+    "a[0] = { valueOf: function () { detach (buffer); return 1; } }; a.length === 0",
+
+    "var a = new Uint8Array (buffer);"
+    "try { a.fill (1, { valueOf: function () { detach (buffer); return 0; } }); false; }"
+    "catch (e) { e instanceof TypeError; }",
+
+    "var a = new Uint8Array (buffer);"
+    "try { a.set ([1, { valueOf: function () { detach (buffer); return 2; } }, 3]); false; }"
+    "catch (e) { e instanceof TypeError; }",
+
+    "try { buffer.slice ({ valueOf: function () { detach (buffer); return 0; } }); false; }"
+    "catch (e) { e instanceof TypeError; }",
+
+    "var own = new ArrayBuffer (8), a = new Uint8Array (own), seen = [];"
+    "a[1] = 7; a.forEach (function (v, i) { if (i === 0) detach (own); seen.push (v); });"
+    "detach (buffer); seen.length === 8 && seen[0] === 0 && seen[1] === undefined && own.byteLength === 0",
+  };
+
+  for (size_t i = 0; i < sizeof (callback_tests_p) / sizeof (callback_tests_p[0]); i++)
+  {
+    for (uint8_t j = 0; j < sizeof (callback_buffer); j++)
+    {
+      callback_buffer[j] = j;
+    }
+
+    arraybuffer = jerry_create_arraybuffer_external (sizeof (callback_buffer), callback_buffer, detached_free_cb);
+    register_js_value ("buffer", arraybuffer);
+    jerry_release_value (arraybuffer);
+
+    detached_free_count = 0;
+    test_eval_true (callback_tests_p[i]);
+
+    /* Without contents, the memory is released by its free callback. */
+    TEST_ASSERT (detached_free_count == 1);
+    TEST_ASSERT (detached_freed_p == callback_buffer);
+  }
+
+  detached_free_count = 0;
+} /* test_detach */
+
 int
 main (void)
 {
@@ -356,9 +566,40 @@ main (void)
     jerry_release_value (input_buffer);
   }
 
+  /* Test transferring ArrayBuffer memory to another context */
+  static uint8_t transfer_buffer[16];
+  jerry_arraybuffer_contents_t contents;
+  jerry_arraybuffer_contents_t script_contents;
+
+  test_detach (transfer_buffer, sizeof (transfer_buffer), &contents, &script_contents);
+
   jerry_cleanup ();
 
   TEST_ASSERT (callback_called == true);
+  TEST_ASSERT (detached_free_count == 0);
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t arraybuffer = jerry_create_arraybuffer_external (contents.length, contents.buffer_p, contents.free_cb);
+  register_js_value ("transfer_buffer", arraybuffer);
+  jerry_release_value (arraybuffer);
+
+  test_eval_true ("var u8 = new Uint8Array (transfer_buffer);"
+                  "u8.length === 16 && u8[0] === 0 && u8[1] === 5 && u8[15] === 75");
+
+  arraybuffer = jerry_create_arraybuffer_external (script_contents.length,
+                                                   script_contents.buffer_p,
+                                                   script_contents.free_cb);
+  register_js_value ("script_buffer", arraybuffer);
+  jerry_release_value (arraybuffer);
+
+  test_eval_true ("var script_u8 = new Uint8Array (script_buffer);"
+                  "script_u8.length === 12 && script_u8[0] === 100 && script_u8[11] === 111");
+
+  jerry_cleanup ();
+
+  TEST_ASSERT (detached_free_count == 1);
+  TEST_ASSERT (detached_freed_p == transfer_buffer);
 
   return 0;
 } /* main */
@@ -244,6 +244,84 @@ test_large_line_count (void)
   jerry_cleanup ();
 } /* test_large_line_count */
 
+static void
+check_snapshot_backtrace (jerry_value_t error) /**< error thrown by the snapshot */
+{
+  TEST_ASSERT (jerry_value_is_error (error));
+
+  error = jerry_get_value_from_error (error, true);
+
+  TEST_ASSERT (jerry_value_is_object (error));
+
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) "stack");
+  jerry_value_t backtrace = jerry_get_property (error, name);
+
+  jerry_release_value (name);
+  jerry_release_value (error);
+
+  TEST_ASSERT (!jerry_value_is_error (backtrace)
+               && jerry_value_is_array (backtrace));
+
+  TEST_ASSERT (jerry_get_array_length (backtrace) == 3);
+
+  compare (backtrace, 0, "snapshot.js:4");
+  compare (backtrace, 1, "snapshot.js:9");
+  compare (backtrace, 2, "snapshot.js:12");
+
+  jerry_release_value (backtrace);
+} /* check_snapshot_backtrace */
+
+static void
+test_snapshot_backtrace (void)
+{
+  static uint32_t snapshot_buffer[1024];
+  const char *resource_name_p = "snapshot.js";
+  const char *source = ("function f(i) {\n"
+                        "  var a = i + 1;\n"
+                        "  a = a * 2;\n"
+                        "  if (a > 4) throw new Error('end');\n"
+                        "  return a;\n"
+                        "}\n"
+                        "\n"
+                        "function g() {\n"
+                        "  for (var i = 0; i < 4; i++) f(i);\n"
+                        "}\n"
+                        "\n"
+                        "g();\n");
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_SAVE)
+      || !jerry_is_feature_enabled (JERRY_FEATURE_SNAPSHOT_EXEC))
+  {
+    return;
+  }
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  jerry_value_t result = jerry_generate_snapshot ((const jerry_char_t *) resource_name_p,
+                                                  strlen (resource_name_p),
+                                                  (const jerry_char_t *) source,
+                                                  strlen (source),
+                                                  0,
+                                                  snapshot_buffer,
+                                                  sizeof (snapshot_buffer));
+
+  TEST_ASSERT (jerry_value_is_number (result));
+
+  size_t snapshot_size = (size_t) jerry_get_number_value (result);
+  jerry_release_value (result);
+
+  jerry_cleanup ();
+
+  /* The line info table is used by both the copied and the referenced byte code. */
+  jerry_init (JERRY_INIT_EMPTY);
+  check_snapshot_backtrace (jerry_exec_snapshot (snapshot_buffer, snapshot_size, 0, 0));
+  jerry_cleanup ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+  check_snapshot_backtrace (jerry_exec_snapshot (snapshot_buffer, snapshot_size, 0, JERRY_SNAPSHOT_EXEC_COPY_DATA));
+  jerry_cleanup ();
+} /* test_snapshot_backtrace */
+
 int
 main (void)
 {
@@ -254,6 +332,7 @@ main (void)
   test_get_backtrace_api_call ();
   test_exception_backtrace ();
   test_large_line_count ();
+  test_snapshot_backtrace ();
 
   return 0;
 } /* main */
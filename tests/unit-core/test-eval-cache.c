@@ -0,0 +1,72 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unit test for the reference counters of the compiled code shared by the eval cache.
+ */
+
+#include "config.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/**
+ * Number of function objects which are kept alive, more than the limit of the reference counters
+ */
+#define FUNCTION_COUNT 70000
+
+static void
+run_source (const char *source_p)
+{
+  jerry_value_t res = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+  jerry_release_value (res);
+} /* run_source */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* The function literals of a cached compiled code are shared by the evaluations. */
+  run_source ("var indirectEval = eval;\n"
+              "var f1 = indirectEval ('(function () { return function () { return 1; }; })');\n"
+              "var f2 = indirectEval ('(function () { return function () { return 1; }; })');\n"
+              "f1 !== f2 && f1 () !== f2 () && f1 () () === 1 && f2 () () === 1;");
+
+  /* Many function objects are created from the nested function literals. Each of them holds a reference
+   * to its compiled code, which must not exceed the limit of the reference counter. The heap is large
+   * enough for these objects in the builds with a big heap only. */
+#if CONFIG_MEM_HEAP_AREA_SIZE >= (16 * 1024 * 1024)
+  char source[512];
+  snprintf (source,
+            sizeof (source),
+            "var keep = [];\n"
+            "for (var i = 0; i < %u; i++) {\n"
+            "  keep.push (indirectEval ('(function () { return 1; })'));\n"
+            "  keep.push (new Function ('return function () { return 2; }') ());\n"
+            "}\n"
+            "keep.length === %u && keep[0] () === 1 && keep[%u] () === 2;",
+            (unsigned int) FUNCTION_COUNT,
+            (unsigned int) FUNCTION_COUNT * 2,
+            (unsigned int) FUNCTION_COUNT * 2 - 1);
+  run_source (source);
+#endif /* CONFIG_MEM_HEAP_AREA_SIZE >= (16 * 1024 * 1024) */
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -0,0 +1,99 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unit test for the heap allocated in regions.
+ */
+
+#include "jcontext.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+#ifdef JMEM_HEAP_REGIONS
+
+static void
+run_source (const char *source_p)
+{
+  jerry_value_t res = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+  jerry_release_value (res);
+} /* run_source */
+
+static size_t
+get_heap_size (void)
+{
+  jerry_heap_stats_t stats;
+
+  if (!jerry_get_memory_stats (&stats))
+  {
+    return 0;
+  }
+
+  return stats.size;
+} /* get_heap_size */
+
+#endif /* JMEM_HEAP_REGIONS */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+#ifdef JMEM_HEAP_REGIONS
+  for (int i = 0; i < 2; i++)
+  {
+    jerry_init (JERRY_INIT_EMPTY);
+
+    /* The heap starts with a single region. */
+    TEST_ASSERT (JERRY_HEAP_CONTEXT (region_count) == 1);
+    size_t initial_heap_size = get_heap_size ();
+
+    /* Objects referencing each other across the regions. Each item takes more than
+     * 16 bytes, so the items do not fit into a single region. */
+    char source[256];
+    const unsigned int item_count = (unsigned int) (JMEM_HEAP_REGION_SIZE / 16);
+    snprintf (source,
+              sizeof (source),
+              "var list = [];\n"
+              "for (var i = 0; i < %u; i++) list.push ({ value: i, prev: list[i - 1] });\n"
+              "var sum = 0;\n"
+              "for (var item = list[list.length - 1]; item; item = item.prev) sum += item.value;\n"
+              "sum === %u * %u / 2;",
+              item_count,
+              item_count - 1,
+              item_count);
+    run_source (source);
+
+    TEST_ASSERT (JERRY_HEAP_CONTEXT (region_count) > 1);
+    TEST_ASSERT (initial_heap_size == 0 || get_heap_size () > initial_heap_size);
+
+    /* The regions of the list are returned when the heap is short of memory. */
+    run_source ("list = undefined; true;");
+
+    /* A block which is larger than a region: the characters of the last string
+     * and the header of the block take more than JMEM_HEAP_REGION_SIZE bytes. */
+    snprintf (source,
+              sizeof (source),
+              "var str = 'x'; while (str.length < %u) str += str; str.charAt (str.length - 1) === 'x';",
+              (unsigned int) JMEM_HEAP_REGION_SIZE);
+    run_source (source);
+
+    jerry_cleanup ();
+  }
+#endif /* JMEM_HEAP_REGIONS */
+
+  return 0;
+} /* main */
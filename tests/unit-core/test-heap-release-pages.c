@@ -0,0 +1,67 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unit test for returning the free heap pages to the system.
+ */
+
+#include "config.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+static void
+run_source (const char *source_p)
+{
+  jerry_value_t res = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (jerry_value_is_boolean (res) && jerry_get_boolean_value (res));
+  jerry_release_value (res);
+} /* run_source */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  run_source ("var keep = { value: 'kept' }; true;");
+
+  for (int i = 0; i < 3; i++)
+  {
+    /* Fill a large part of the heap, then free it. The released pages may be replaced by zero
+     * pages, which must not break the free list or the live objects. */
+    run_source ("var spike = [];\n"
+                "for (var i = 0; i < 3000; i++) spike.push ({ index: i, name: 'item' + i });\n"
+                "spike[2999].index === 2999;");
+    run_source ("spike = undefined; true;");
+
+    jerry_gc (JERRY_GC_SEVERITY_HIGH);
+
+    run_source ("var list = [];\n"
+                "for (var i = 0; i < 1000; i++) list.push ({ value: i });\n"
+                "var sum = 0;\n"
+                "for (var i = 0; i < list.length; i++) sum += list[i].value;\n"
+                "list = undefined;\n"
+                "sum === 999 * 1000 / 2 && keep.value === 'kept';");
+  }
+
+  jerry_gc (JERRY_GC_SEVERITY_LOW);
+  jerry_gc (JERRY_GC_SEVERITY_HIGH);
+  run_source ("keep.value === 'kept';");
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -0,0 +1,161 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/**
+ * Maximum size of the snapshot stream
+ */
+#define OUTPUT_BUFFER_SIZE (256 * 1024)
+
+static char output_buffer[OUTPUT_BUFFER_SIZE + 1];
+static size_t output_size;
+static int callback_count;
+
+static bool
+collect_cb (const jerry_char_t *buffer_p, /**< stream data */
+            size_t buffer_size, /**< size of the data */
+            void *user_p) /**< user pointer */
+{
+  TEST_ASSERT (user_p == (void *) &output_size);
+  TEST_ASSERT (buffer_size > 0);
+  TEST_ASSERT (output_size + buffer_size <= OUTPUT_BUFFER_SIZE);
+
+  memcpy (output_buffer + output_size, buffer_p, buffer_size);
+  output_size += buffer_size;
+  callback_count++;
+  return true;
+} /* collect_cb */
+
+static bool
+abort_cb (const jerry_char_t *buffer_p, /**< stream data */
+          size_t buffer_size, /**< size of the data */
+          void *user_p) /**< user pointer */
+{
+  JERRY_UNUSED (buffer_p);
+  JERRY_UNUSED (buffer_size);
+  JERRY_UNUSED (user_p);
+
+  callback_count++;
+  return false;
+} /* abort_cb */
+
+static const jerry_object_native_info_t native_info =
+{
+  .free_cb = NULL
+};
+
+static int native_data;
+
+static void
+run_source (const char *source_p)
+{
+  jerry_value_t res = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (res));
+  jerry_release_value (res);
+} /* run_source */
+
+static void
+take_snapshot (void)
+{
+  output_size = 0;
+  callback_count = 0;
+
+  TEST_ASSERT (jerry_heap_snapshot (collect_cb, &output_size));
+  TEST_ASSERT (callback_count > 0);
+
+  output_buffer[output_size] = '\0';
+} /* take_snapshot */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_HEAP_SNAPSHOT))
+  {
+    TEST_ASSERT (!jerry_heap_snapshot (collect_cb, &output_size));
+    jerry_cleanup ();
+    return 0;
+  }
+
+  run_source ("var marker_object = { text: 'heap snapshot marker', 5: 'element', \"quote\\\"d\": {} };\n"
+              "function make_closure () {\n"
+              "  var captured_var = { x: 'captured' };\n"
+              "  return function () { return captured_var; };\n"
+              "}\n"
+              "var closure = make_closure ();\n"
+              "var garbage = { text: 'garbage marker' };\n"
+              "garbage = undefined;\n"
+              "var long_name = {};\n"
+              "long_name['\\u00e9' + new Array (40).join ('\\u20ac')] = {};\n");
+
+  jerry_value_t native_object = jerry_create_object ();
+  jerry_set_object_native_pointer (native_object, &native_data, &native_info);
+
+  take_snapshot ();
+
+  TEST_ASSERT (strncmp (output_buffer, "JERRY-HEAP-SNAPSHOT 1\n", 22) == 0);
+  TEST_ASSERT (output_buffer[output_size - 1] == '\n');
+
+  /* Objects, strings and their edges. */
+  TEST_ASSERT (strstr (output_buffer, " object ") != NULL);
+  TEST_ASSERT (strstr (output_buffer, " string ") != NULL);
+  TEST_ASSERT (strstr (output_buffer, " \"heap snapshot marker\"\n") != NULL);
+  TEST_ASSERT (strstr (output_buffer, " property \"marker_object\"\n") != NULL);
+  TEST_ASSERT (strstr (output_buffer, " property \"text\"\n") != NULL);
+  TEST_ASSERT (strstr (output_buffer, " element \"5\"\n") != NULL);
+  TEST_ASSERT (strstr (output_buffer, " property \"quote\\\"d\"\n") != NULL);
+  TEST_ASSERT (strstr (output_buffer, " prototype \"__proto__\"\n") != NULL);
+
+  /* Long names are truncated at a character boundary: 2 + 20 * 3 bytes. */
+  const char *long_name_p = strstr (output_buffer, " property \"\xc3\xa9\xe2\x82\xac");
+  TEST_ASSERT (long_name_p != NULL);
+  long_name_p += strlen (" property \"");
+
+  for (int i = 0; i < 62; i++)
+  {
+    TEST_ASSERT (long_name_p[i] == (i < 2 ? "\xc3\xa9"[i] : "\xe2\x82\xac"[(i - 2) % 3]));
+  }
+
+  TEST_ASSERT (strncmp (long_name_p + 62, "\"\n", 2) == 0);
+
+  /* Unreachable objects are not reported. */
+  TEST_ASSERT (strstr (output_buffer, "\"garbage marker\"") == NULL);
+
+  /* Closures reference their scope and byte code. */
+  TEST_ASSERT (strstr (output_buffer, " scope \"scope\"\n") != NULL);
+  TEST_ASSERT (strstr (output_buffer, " bytecode \"bytecode\"\n") != NULL);
+  TEST_ASSERT (strstr (output_buffer, " variable \"captured_var\"\n") != NULL);
+  TEST_ASSERT (strstr (output_buffer, " scope ") != NULL);
+
+  /* Native pointers and roots. */
+  TEST_ASSERT (strstr (output_buffer, " native \"native\"\n") != NULL);
+  TEST_ASSERT (strstr (output_buffer, "\nR ") != NULL);
+
+  /* The callback can abort the snapshot. */
+  callback_count = 0;
+  TEST_ASSERT (!jerry_heap_snapshot (abort_cb, NULL));
+  TEST_ASSERT (callback_count == 1);
+
+  jerry_release_value (native_object);
+  jerry_cleanup ();
+  return 0;
+} /* main */
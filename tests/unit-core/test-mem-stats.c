@@ -45,7 +45,12 @@ int main (void)
   bool get_stats_ret = jerry_get_memory_stats (&stats);
   TEST_ASSERT (get_stats_ret);
   TEST_ASSERT (stats.version == 1);
+#ifdef JMEM_HEAP_REGIONS
+  /* The size of the allocated heap regions. */
+  TEST_ASSERT (stats.size > 0 && stats.size <= 524288);
+#else /* !JMEM_HEAP_REGIONS */
   TEST_ASSERT (stats.size == 524280);
+#endif /* JMEM_HEAP_REGIONS */
 
   TEST_ASSERT (!jerry_get_memory_stats (NULL));
 
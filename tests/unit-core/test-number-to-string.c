@@ -18,6 +18,151 @@
 
 #include "test-common.h"
 
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+
+/**
+ * Number of random values checked against the C library
+ */
+#define RANDOM_CHECK_COUNT 100000
+
+/**
+ * Compute the shortest digits of a positive finite number with the C library: the shortest
+ * correctly rounded %e representation which is converted back to the same number.
+ *
+ * @return the number of digits
+ */
+static int
+reference_to_decimal (double num, /**< number */
+                      char *digits_p, /**< [out] digits */
+                      int *exp_p) /**< [out] decimal exponent (same as ecma_number_to_decimal) */
+{
+  char str[32];
+
+  for (int precision = 1; precision <= 17; precision++)
+  {
+    snprintf (str, sizeof (str), "%.*e", precision - 1, num);
+
+    if (strtod (str, NULL) == num)
+    {
+      int length = 0;
+
+      for (const char *str_p = str; *str_p != 'e'; str_p++)
+      {
+        if (*str_p != '.')
+        {
+          digits_p[length++] = *str_p;
+        }
+      }
+
+      /* Remove the trailing zeros. */
+      while (length > 1 && digits_p[length - 1] == '0')
+      {
+        length--;
+      }
+
+      *exp_p = atoi (strchr (str, 'e') + 1) + 1;
+      return length;
+    }
+  }
+
+  TEST_ASSERT (false);
+  return 0;
+} /* reference_to_decimal */
+
+/**
+ * Check the digits of a positive finite number.
+ */
+static void
+check_to_decimal (double num) /**< number */
+{
+  lit_utf8_byte_t digits[ECMA_MAX_CHARS_IN_STRINGIFIED_NUMBER];
+  int32_t exp;
+  lit_utf8_size_t length = ecma_number_to_decimal ((ecma_number_t) num, digits, &exp);
+
+  char reference_digits[32];
+  int reference_exp;
+  int reference_length = reference_to_decimal (num, reference_digits, &reference_exp);
+
+  /* The representation is never longer than the shortest correctly rounded one. */
+  TEST_ASSERT (length >= 1 && (int) length <= reference_length);
+  TEST_ASSERT (digits[0] != '0' && digits[length - 1] != '0');
+
+  if ((int) length == reference_length)
+  {
+    TEST_ASSERT (exp == reference_exp);
+    TEST_ASSERT (memcmp (digits, reference_digits, length) == 0);
+  }
+
+  /* Round trip. */
+  char str[48];
+  snprintf (str, sizeof (str), "0.%.*se%d", (int) length, (const char *) digits, (int) exp);
+  TEST_ASSERT (strtod (str, NULL) == num);
+} /* check_to_decimal */
+
+/**
+ * Create a double from its bits.
+ *
+ * @return double value
+ */
+static double
+double_from_bits (uint64_t bits) /**< bits */
+{
+  double num;
+  memcpy (&num, &bits, sizeof (num));
+  return num;
+} /* double_from_bits */
+
+/**
+ * Check random numbers, and numbers which are close to the boundaries of the ranges.
+ */
+static void
+check_random_numbers (void)
+{
+  const uint64_t special_bits[] =
+  {
+    0x0000000000000001ull, /* minimum subnormal */
+    0x000fffffffffffffull, /* maximum subnormal */
+    0x0010000000000000ull, /* minimum normal */
+    0x7fefffffffffffffull, /* maximum normal */
+    0x3ff0000000000001ull, /* next value after 1 */
+    0x3fefffffffffffffull, /* previous value before 1 */
+    0x4340000000000000ull, /* 2^53 */
+    0x44b52d02c7e14af6ull, /* 1e23 */
+    0x3fb999999999999aull, /* 0.1 */
+    0x3fd5555555555555ull, /* 1/3 */
+  };
+
+  for (uint32_t i = 0; i < sizeof (special_bits) / sizeof (special_bits[0]); i++)
+  {
+    check_to_decimal (double_from_bits (special_bits[i]));
+  }
+
+  for (uint32_t i = 0; i < RANDOM_CHECK_COUNT; i++)
+  {
+    uint64_t bits = 0;
+
+    for (int j = 0; j < 4; j++)
+    {
+      bits = (bits << 16) | (uint64_t) (rand () & 0xffff);
+    }
+
+    /* Positive, finite and non-zero. */
+    bits &= 0x7fffffffffffffffull;
+
+    if ((bits >> 52) == 0x7ff || bits == 0)
+    {
+      continue;
+    }
+
+    check_to_decimal (double_from_bits (bits));
+
+    /* Short decimal fractions, which have many representations of similar length. */
+    check_to_decimal ((double) (rand () % 1000000) / 1000.0 + 0.001);
+  }
+} /* check_random_numbers */
+
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+
 /**
  * Unit test's main function.
  */
@@ -70,5 +215,9 @@ main (void)
     }
   }
 
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+  check_random_numbers ();
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+
   return 0;
 } /* main */
@@ -0,0 +1,172 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/**
+ * Maximum size of the collapsed stacks output
+ */
+#define OUTPUT_BUFFER_SIZE 4096
+
+static jerry_char_t output_buffer[OUTPUT_BUFFER_SIZE + 1];
+
+static const jerry_char_t test_source[] = TEST_STRING_LITERAL (
+  "function f() {\n"
+  "  var s = 0;\n"
+  "  for (var i = 0; i < 100; i++) s += i;\n"
+  "  return s;\n"
+  "}\n"
+  "for (var j = 0; j < 10; j++) f();\n"
+);
+
+static void
+run_test_source (void)
+{
+  const jerry_char_t resource_name[] = "profile.js";
+  jerry_value_t parsed_code_val = jerry_parse (resource_name,
+                                               sizeof (resource_name) - 1,
+                                               test_source,
+                                               sizeof (test_source) - 1,
+                                               JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (parsed_code_val));
+
+  jerry_value_t res = jerry_run (parsed_code_val);
+  TEST_ASSERT (!jerry_value_is_error (res));
+
+  jerry_release_value (res);
+  jerry_release_value (parsed_code_val);
+} /* run_test_source */
+
+static size_t
+get_collapsed_stacks (void)
+{
+  size_t size = jerry_profiler_get_collapsed_stacks (output_buffer, OUTPUT_BUFFER_SIZE);
+  TEST_ASSERT (size <= OUTPUT_BUFFER_SIZE);
+
+  output_buffer[size] = '\0';
+  return size;
+} /* get_collapsed_stacks */
+
+static uint32_t
+get_sample_count (void)
+{
+  /* Sum the counts at the end of each line. */
+  uint32_t sample_count = 0;
+  char *line_p = (char *) output_buffer;
+
+  while (*line_p != '\0')
+  {
+    char *end_p = strchr (line_p, '\n');
+    TEST_ASSERT (end_p != NULL);
+
+    char *count_p = end_p;
+
+    while (count_p[-1] != ' ')
+    {
+      count_p--;
+    }
+
+    sample_count += (uint32_t) strtoul (count_p, NULL, 10);
+    line_p = end_p + 1;
+  }
+
+  return sample_count;
+} /* get_sample_count */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_PROFILER))
+  {
+    jerry_init (JERRY_INIT_EMPTY);
+    jerry_profiler_start (1);
+    run_test_source ();
+    TEST_ASSERT (jerry_profiler_get_collapsed_stacks (output_buffer, OUTPUT_BUFFER_SIZE) == 0);
+    jerry_cleanup ();
+    return 0;
+  }
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* No samples are taken before the profiler is started. */
+  jerry_profiler_request_sample ();
+  run_test_source ();
+  TEST_ASSERT (get_collapsed_stacks () == 0);
+
+  /* Sample every instruction. */
+  jerry_profiler_start (1);
+  run_test_source ();
+  jerry_profiler_stop ();
+
+  size_t size = get_collapsed_stacks ();
+  TEST_ASSERT (size > 0);
+  TEST_ASSERT (output_buffer[size - 1] == '\n');
+  TEST_ASSERT (strstr ((char *) output_buffer, "[dropped]") == NULL);
+
+  uint32_t sample_count = get_sample_count ();
+  TEST_ASSERT (sample_count > 1000);
+
+  if (jerry_is_feature_enabled (JERRY_FEATURE_LINE_INFO))
+  {
+    /* The loop of f called from the outer loop. */
+    TEST_ASSERT (strstr ((char *) output_buffer, "profile.js:6;profile.js:3 ") != NULL);
+  }
+  else
+  {
+    TEST_ASSERT (strchr ((char *) output_buffer, ';') != NULL);
+  }
+
+  /* Stopped profiler collects no samples. */
+  run_test_source ();
+  TEST_ASSERT (get_collapsed_stacks () == size);
+
+  /* The size of the whole output is returned even if the buffer is too small. */
+  output_buffer[4] = '\0';
+  TEST_ASSERT (jerry_profiler_get_collapsed_stacks (output_buffer, 4) == size);
+  TEST_ASSERT (output_buffer[4] == '\0');
+  TEST_ASSERT (jerry_profiler_get_collapsed_stacks (NULL, 0) == size);
+
+  /* Samples are accumulated until reset. */
+  jerry_profiler_start (1);
+  run_test_source ();
+  jerry_profiler_stop ();
+
+  get_collapsed_stacks ();
+  TEST_ASSERT (get_sample_count () == 2 * sample_count);
+
+  jerry_profiler_reset ();
+  TEST_ASSERT (get_collapsed_stacks () == 0);
+
+  /* Sampling on request only. */
+  jerry_profiler_start (0);
+  jerry_profiler_request_sample ();
+  run_test_source ();
+  jerry_profiler_stop ();
+
+  get_collapsed_stacks ();
+  TEST_ASSERT (get_sample_count () == 1);
+
+  /* Samples are freed by cleanup. */
+  jerry_profiler_start (7);
+  run_test_source ();
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
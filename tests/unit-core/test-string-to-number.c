@@ -19,6 +19,125 @@
 
 #include "test-common.h"
 
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+
+/**
+ * Number of random strings checked against the C library
+ */
+#define RANDOM_CHECK_COUNT 100000
+
+/**
+ * Check the conversion of a string against the correctly rounded strtod result.
+ */
+static void
+check_against_strtod (const char *str_p, /**< string to convert */
+                      const char *reference_str_p) /**< string for strtod (digits after the 20th are zero) */
+{
+  ecma_number_t num = ecma_utf8_string_to_number ((const lit_utf8_byte_t *) str_p, (lit_utf8_size_t) strlen (str_p));
+  double reference = strtod (reference_str_p, NULL);
+
+  /* Comparing the bits to distinguish the zeros. */
+  TEST_ASSERT (memcmp (&num, &reference, sizeof (double)) == 0);
+} /* check_against_strtod */
+
+/**
+ * Check random strings, and strings which are hard to round correctly.
+ */
+static void
+check_random_strings (void)
+{
+  const char *hard_strings[] =
+  {
+    "1e23",
+    "8.5e-323",
+    "9007199254740993",
+    "9007199254740992.5",
+    "2.2250738585072011e-308",
+    "2.2250738585072012e-308",
+    "2.4703282292062327e-324",
+    "2.4703282292062328e-324",
+    "1.7976931348623157e308",
+    "1.7976931348623158e308",
+    "1.7976931348623159e308",
+    "7.2057594037927933e16",
+    "-0.0000000000000000000000000000001",
+    "18446744073709551615",
+    "99999999999999999999e-343",
+    "0.1e309",
+    "123456789e-20",
+    "4.9e-324",
+  };
+
+  for (uint32_t i = 0; i < sizeof (hard_strings) / sizeof (hard_strings[0]); i++)
+  {
+    check_against_strtod (hard_strings[i], hard_strings[i]);
+  }
+
+  /* Only the first 20 significant digits are considered (ECMA-262 v5, 9.3.1). */
+  check_against_strtod ("1.00000000000000011102230246251565404236316680908203125",
+                        "1.0000000000000001110");
+  check_against_strtod ("9007199254740993000000000000000000001e-21", "9007199254740993");
+
+  char str[64];
+
+  for (uint32_t i = 0; i < RANDOM_CHECK_COUNT; i++)
+  {
+    uint64_t bits = ((uint64_t) rand () << 62) ^ ((uint64_t) rand () << 31) ^ (uint64_t) rand ();
+
+    switch (i % 4)
+    {
+      case 0:
+      {
+        /* Random integers up to 20 digits, including the halfway points above 2^53. */
+        snprintf (str, sizeof (str), "%llu", (unsigned long long) (bits >> (rand () % 64)));
+        break;
+      }
+      case 1:
+      {
+        /* Random digits with random exponents in the whole range. */
+        int length = 1 + rand () % 20;
+        int pos = 0;
+
+        for (int j = 0; j < length; j++)
+        {
+          str[pos++] = (char) ('0' + rand () % 10);
+        }
+
+        snprintf (str + pos, sizeof (str) - (size_t) pos, "e%d", rand () % 680 - 350);
+        break;
+      }
+      case 2:
+      {
+        /* Shortest and longer representations of random numbers. */
+        double num;
+        bits &= ~(1ull << 63);
+
+        /* Replacing Infinity and NaN with finite numbers. */
+        if ((bits >> 52) == 0x7ff)
+        {
+          bits >>= 1;
+        }
+
+        memcpy (&num, &bits, sizeof (num));
+
+        snprintf (str, sizeof (str), "%.*e", rand () % 20, num);
+        break;
+      }
+      default:
+      {
+        /* Numbers with few digits, which are mostly handled by the fast path. */
+        snprintf (str, sizeof (str), "-%u.%ue%d", (unsigned) (rand () % 100000), (unsigned) (rand () % 1000),
+                  rand () % 50 - 25);
+        break;
+      }
+    }
+
+    check_against_strtod (str, str);
+  }
+} /* check_random_strings */
+
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+
 /**
  * Unit test's main function.
  */
@@ -85,5 +204,9 @@ main (void)
     }
   }
 
+#if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
+  check_random_strings ();
+#endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64 */
+
   return 0;
 } /* main */
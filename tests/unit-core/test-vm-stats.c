@@ -0,0 +1,121 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include "jerryscript.h"
+
+#include "test-common.h"
+
+/**
+ * Maximum size of the JSON output
+ */
+#define OUTPUT_BUFFER_SIZE 16384
+
+static char output_buffer[OUTPUT_BUFFER_SIZE + 1];
+
+static void
+run_source (const char *source_p)
+{
+  const jerry_char_t resource_name[] = "stats.js";
+  jerry_value_t parsed_code_val = jerry_parse (resource_name,
+                                               sizeof (resource_name) - 1,
+                                               (const jerry_char_t *) source_p,
+                                               strlen (source_p),
+                                               JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (parsed_code_val));
+
+  jerry_value_t res = jerry_run (parsed_code_val);
+  TEST_ASSERT (!jerry_value_is_error (res));
+
+  jerry_release_value (res);
+  jerry_release_value (parsed_code_val);
+} /* run_source */
+
+static void
+get_vm_stats (void)
+{
+  size_t size = jerry_get_vm_stats_json ((jerry_char_t *) output_buffer, OUTPUT_BUFFER_SIZE);
+  TEST_ASSERT (size > 0 && size <= OUTPUT_BUFFER_SIZE);
+  TEST_ASSERT (jerry_get_vm_stats_json (NULL, 0) == size);
+
+  output_buffer[size] = '\0';
+} /* get_vm_stats */
+
+static uint64_t
+get_counter (const char *name_p)
+{
+  const char *counter_p = strstr (output_buffer, name_p);
+  TEST_ASSERT (counter_p != NULL);
+
+  return strtoull (counter_p + strlen (name_p), NULL, 10);
+} /* get_counter */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  if (!jerry_is_feature_enabled (JERRY_FEATURE_VM_STATS))
+  {
+    TEST_ASSERT (jerry_get_vm_stats_json ((jerry_char_t *) output_buffer, OUTPUT_BUFFER_SIZE) == 0);
+    jerry_cleanup ();
+    return 0;
+  }
+
+  jerry_reset_vm_stats ();
+
+  run_source (TEST_STRING_LITERAL (
+    "var o = { a: 1 };\n"
+    "function f() { return o.a; }\n"
+    "for (var i = 0; i < 10; i++) f();\n"
+  ));
+
+  get_vm_stats ();
+
+  TEST_ASSERT (output_buffer[0] == '{');
+  TEST_ASSERT (get_counter ("\"steps\": ") > 0);
+  TEST_ASSERT (get_counter ("\"CBC_CALL0_BLOCK\": ") == 10);
+  TEST_ASSERT (strstr (output_buffer, "\"groups\": [") != NULL);
+  TEST_ASSERT (strstr (output_buffer, "\"calls\": 10, ") != NULL);
+  TEST_ASSERT (get_counter ("\"lcache\": {\"lookups\": ") > 0);
+
+  if (jerry_is_feature_enabled (JERRY_FEATURE_LINE_INFO))
+  {
+    TEST_ASSERT (strstr (output_buffer, "\"resource\": \"stats.js\", \"line\": 2, \"calls\": 10") != NULL);
+  }
+
+  /* The statistics of freed byte codes are kept. */
+  run_source ("eval ('var y = 2')");
+  get_vm_stats ();
+  TEST_ASSERT (strstr (output_buffer, "\"freed\": true") != NULL);
+
+  jerry_reset_vm_stats ();
+  get_vm_stats ();
+  TEST_ASSERT (get_counter ("\"steps\": ") == 0);
+  TEST_ASSERT (strstr (output_buffer, "\"calls\"") == NULL);
+
+  /* Truncated output. */
+  size_t size = jerry_get_vm_stats_json (NULL, 0);
+  output_buffer[2] = 'x';
+  TEST_ASSERT (jerry_get_vm_stats_json ((jerry_char_t *) output_buffer, 2) == size);
+  TEST_ASSERT (output_buffer[2] == 'x');
+
+  run_source ("var x = 1;");
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -108,6 +108,10 @@ def get_arguments():
                          help='enable error messages (%(choices)s)')
     coregrp.add_argument('--external-context', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable external context (%(choices)s)')
+    coregrp.add_argument('--heap-image', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable saving and restoring heap images (%(choices)s)')
+    coregrp.add_argument('--heap-snapshot', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable heap snapshot export (%(choices)s)')
     coregrp.add_argument('--jerry-debugger', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable the jerry debugger (%(choices)s)')
     coregrp.add_argument('--js-parser', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -118,12 +122,24 @@ def get_arguments():
                          help='enable logging (%(choices)s)')
     coregrp.add_argument('--mem-heap', metavar='SIZE', type=int,
                          help='size of memory heap (in kilobytes)')
+    coregrp.add_argument('--mem-alloc-sites', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable allocation site tracking (%(choices)s)')
+    coregrp.add_argument('--mem-heap-regions', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='allocate the heap in regions on demand, up to the heap size (%(choices)s)')
+    coregrp.add_argument('--mem-heap-region-size', metavar='SIZE', type=int,
+                         help='size of memory heap regions (in kilobytes, power of two)')
+    coregrp.add_argument('--mem-release-pages', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='return free heap pages to the system after high severity gc (%(choices)s)')
     coregrp.add_argument('--mem-stats', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable memory statistics (%(choices)s)'))
     coregrp.add_argument('--mem-stress-test', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable mem-stress test (%(choices)s)'))
+    coregrp.add_argument('--parser-peephole', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable parser peephole optimizations (%(choices)s)')
     coregrp.add_argument('--profile', metavar='FILE',
                          help='specify profile file')
+    coregrp.add_argument('--profiler', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable sampling profiler (%(choices)s)')
     coregrp.add_argument('--regexp-strict-mode', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable regexp strict mode (%(choices)s)'))
     coregrp.add_argument('--regexp-recursion-limit', metavar='N', type=int,
@@ -136,12 +152,16 @@ def get_arguments():
                          help='enable executing snapshot files (%(choices)s)')
     coregrp.add_argument('--snapshot-save', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable saving snapshot files (%(choices)s)')
+    coregrp.add_argument('--structured-clone', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable structured clone serializer (%(choices)s)')
     coregrp.add_argument('--system-allocator', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable system allocator (%(choices)s)')
     coregrp.add_argument('--valgrind', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable Valgrind support (%(choices)s)'))
     coregrp.add_argument('--vm-exec-stop', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable VM execution stopping (%(choices)s)')
+    coregrp.add_argument('--vm-stats', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable VM execution statistics (%(choices)s)')
 
     maingrp = parser.add_argument_group('jerry-main options')
     maingrp.add_argument('--link-map', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -188,22 +208,32 @@ def generate_build_options(arguments):
     build_options_append('FEATURE_ERROR_MESSAGES', arguments.error_messages)
     build_options_append('FEATURE_EXTERNAL_CONTEXT', arguments.external_context)
     build_options_append('FEATURE_DEBUGGER', arguments.jerry_debugger)
+    build_options_append('FEATURE_HEAP_IMAGE', arguments.heap_image)
+    build_options_append('FEATURE_HEAP_SNAPSHOT', arguments.heap_snapshot)
     build_options_append('FEATURE_JS_PARSER', arguments.js_parser)
     build_options_append('FEATURE_LINE_INFO', arguments.line_info)
     build_options_append('FEATURE_LOGGING', arguments.logging)
     build_options_append('MEM_HEAP_SIZE_KB', arguments.mem_heap)
+    build_options_append('FEATURE_MEM_ALLOC_SITES', arguments.mem_alloc_sites)
+    build_options_append('FEATURE_MEM_HEAP_REGIONS', arguments.mem_heap_regions)
+    build_options_append('MEM_HEAP_REGION_SIZE_KB', arguments.mem_heap_region_size)
+    build_options_append('FEATURE_MEM_RELEASE_PAGES', arguments.mem_release_pages)
     build_options_append('FEATURE_MEM_STATS', arguments.mem_stats)
     build_options_append('FEATURE_MEM_STRESS_TEST', arguments.mem_stress_test)
+    build_options_append('FEATURE_PARSER_PEEPHOLE', arguments.parser_peephole)
     build_options_append('FEATURE_PROFILE', arguments.profile)
+    build_options_append('FEATURE_PROFILER', arguments.profiler)
     build_options_append('FEATURE_REGEXP_STRICT_MODE', arguments.regexp_strict_mode)
     build_options_append('REGEXP_RECURSION_LIMIT', arguments.regexp_recursion_limit)
     build_options_append('FEATURE_PARSER_DUMP', arguments.show_opcodes)
     build_options_append('FEATURE_REGEXP_DUMP', arguments.show_regexp_opcodes)
     build_options_append('FEATURE_SNAPSHOT_EXEC', arguments.snapshot_exec)
     build_options_append('FEATURE_SNAPSHOT_SAVE', arguments.snapshot_save)
+    build_options_append('FEATURE_STRUCTURED_CLONE', arguments.structured_clone)
     build_options_append('FEATURE_SYSTEM_ALLOCATOR', arguments.system_allocator)
     build_options_append('FEATURE_VALGRIND', arguments.valgrind)
     build_options_append('FEATURE_VM_EXEC_STOP', arguments.vm_exec_stop)
+    build_options_append('FEATURE_VM_STATS', arguments.vm_stats)
 
     # jerry-main options
     build_options_append('ENABLE_LINK_MAP', arguments.link_map)
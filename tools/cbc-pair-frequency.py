@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+
+# Copyright JS Foundation and other contributors, http://js.foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Count adjacent CBC opcode pairs in the final byte code of a JavaScript corpus.
+
+The engine must be built with byte-code dumps enabled (--show-opcodes=on).
+The most frequent pairs are the candidates for new superinstructions.
+"""
+
+from __future__ import print_function
+
+import argparse
+import collections
+import os
+import re
+import subprocess
+import sys
+
+TOOLS_PATH = os.path.dirname(os.path.realpath(__file__))
+BASE_PATH = os.path.join(TOOLS_PATH, '..')
+
+DEFAULT_ENGINE = os.path.join(BASE_PATH, 'build', 'bin', 'jerry')
+DEFAULT_CORPUS = [os.path.join(BASE_PATH, 'tests', 'benchmarks'),
+                  os.path.join(BASE_PATH, 'tests', 'jerry')]
+
+FINAL_DUMP_START = 'Final byte code dump:'
+FINAL_DUMP_END = 'Byte code size:'
+INSTRUCTION_RE = re.compile(r'^\s*\d+ : (CBC_[A-Z0-9_]+)')
+BRANCH_LENGTH_RE = re.compile(r'_[23]$')
+
+
+def get_arguments():
+    parser = argparse.ArgumentParser(description='Count adjacent CBC opcode pairs')
+    parser.add_argument('--engine', metavar='FILE', default=DEFAULT_ENGINE,
+                        help='jerry binary built with --show-opcodes=on (default: %(default)s)')
+    parser.add_argument('--top', metavar='N', type=int, default=40,
+                        help='number of pairs to print (default: %(default)s)')
+    parser.add_argument('--timeout', metavar='SEC', type=int, default=30,
+                        help='abort parsing a file after SEC seconds (default: %(default)s)')
+    parser.add_argument('paths', metavar='PATH', nargs='*', default=DEFAULT_CORPUS,
+                        help='JavaScript files or directories (default: benchmarks and jerry tests)')
+    return parser.parse_args()
+
+
+def collect_files(paths):
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, names in os.walk(path):
+                files.extend(os.path.join(root, name) for name in names if name.endswith('.js'))
+        else:
+            files.append(path)
+    return sorted(files)
+
+
+def normalize_opcode(name):
+    # Branch opcodes only differ in the length of their offset argument.
+    return BRANCH_LENGTH_RE.sub('', name)
+
+
+def count_pairs(dump, pairs, singles):
+    in_final_dump = False
+    previous = None
+
+    for line in dump.splitlines():
+        if line.startswith(FINAL_DUMP_START):
+            in_final_dump = True
+            previous = None
+            continue
+
+        if line.startswith(FINAL_DUMP_END):
+            in_final_dump = False
+            continue
+
+        if not in_final_dump:
+            continue
+
+        match = INSTRUCTION_RE.match(line)
+        if not match:
+            continue
+
+        opcode = normalize_opcode(match.group(1))
+        singles[opcode] += 1
+
+        if previous is not None:
+            pairs[(previous, opcode)] += 1
+        previous = opcode
+
+
+def main(args):
+    if not os.path.isfile(args.engine):
+        sys.exit('Engine not found: %s' % args.engine)
+
+    pairs = collections.Counter()
+    singles = collections.Counter()
+    files = collect_files(args.paths)
+
+    for js_file in files:
+        # The script is only parsed, the dump is printed even if it throws later.
+        cmd = ['timeout', str(args.timeout), args.engine, '--show-opcodes', '--parse-only', js_file]
+        process = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        output, _ = process.communicate()
+        count_pairs(output.decode('utf-8', 'ignore'), pairs, singles)
+
+    total = sum(pairs.values())
+    print('Files: %d, instructions: %d, pairs: %d\n' % (len(files), sum(singles.values()), total))
+    print('%8s %7s  %s' % ('count', 'share', 'pair'))
+
+    for (first, second), count in pairs.most_common(args.top):
+        share = 100.0 * count / total if total else 0.0
+        print('%8d %6.2f%%  %s + %s' % (count, share, first, second))
+
+
+if __name__ == '__main__':
+    main(get_arguments())
@@ -0,0 +1,172 @@
+#!/usr/bin/env python
+
+# Copyright JS Foundation and other contributors, http://js.foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Generator of the power of five tables which are used by the shortest round-trip
+number to string conversion (ecma-helpers-ryu.c).
+
+Only every POW5_TABLE_SIZE-th 128 bit power of five is stored, the others are
+computed from them by a multiplication with a small power of five. The result of
+this multiplication is smaller than the exact value by at most three, and these
+two bit corrections are stored in the offset tables. The script checks that the
+computed values are exact for every power used by the conversion.
+"""
+
+from __future__ import print_function
+
+import argparse
+import os
+
+from gen_c_source import LICENSE
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+PROJECT_DIR = os.path.normpath(os.path.join(TOOLS_DIR, '..'))
+OUTPUT_FILE = os.path.join(PROJECT_DIR, 'jerry-core', 'ecma', 'base', 'ecma-helpers-ryu-tables.inc.h')
+
+POW5_TABLE_SIZE = 26
+POW5_BITCOUNT = 125
+POW5_INV_BITCOUNT = 125
+POW5_COUNT = 326
+POW5_INV_COUNT = 342
+
+MASK64 = (1 << 64) - 1
+
+
+def pow5bits(exp):
+    return ((exp * 1217359) >> 19) + 1
+
+
+def exact_pow5(i):
+    """ 5^i normalized to POW5_BITCOUNT bits. """
+    pow5 = 5 ** i
+    shift = pow5.bit_length() - POW5_BITCOUNT
+    return pow5 >> shift if shift >= 0 else pow5 << -shift
+
+
+def exact_inv_pow5(i):
+    """ 2^(bitlength (5^i) - 1 + POW5_INV_BITCOUNT) / 5^i rounded up. """
+    pow5 = 5 ** i
+    return (1 << (pow5.bit_length() - 1 + POW5_INV_BITCOUNT)) // pow5 + 1
+
+
+def split(value):
+    return (value & MASK64, value >> 64)
+
+
+def mul_shift(mul, low_adjust, factor, delta):
+    """ Simulates the 64 bit arithmetic of the C code: the 192 bit product is shifted right
+        by delta, and the two 64 bit halves of the result are computed independently. """
+    low, high = split(mul)
+    product = factor * (((high << 64) | ((low + low_adjust) & MASK64)))
+    low0 = product & MASK64
+    middle = (product >> 64) & MASK64
+    high1 = product >> 128
+    result_low = ((middle << (64 - delta)) | (low0 >> delta)) & MASK64
+    result_high = ((high1 << (64 - delta)) | (middle >> delta)) & MASK64
+    return (result_low, result_high)
+
+
+def compute_offsets():
+    pow5_offsets = [0] * ((POW5_COUNT + 15) // 16)
+    pow5_inv_offsets = [0] * ((POW5_INV_COUNT + 15) // 16)
+
+    for i in range(POW5_COUNT):
+        base2 = (i // POW5_TABLE_SIZE) * POW5_TABLE_SIZE
+        if i == base2:
+            continue
+
+        low, high = mul_shift(exact_pow5(base2), 0, 5 ** (i - base2), pow5bits(i) - pow5bits(base2))
+        exact_low, exact_high = split(exact_pow5(i))
+        offset = (exact_low - low) & MASK64
+        assert exact_high == high and offset <= 3 and low + offset <= MASK64
+        pow5_offsets[i // 16] |= offset << ((i % 16) * 2)
+
+    for i in range(POW5_INV_COUNT):
+        base2 = ((i + POW5_TABLE_SIZE - 1) // POW5_TABLE_SIZE) * POW5_TABLE_SIZE
+        if i == base2:
+            continue
+
+        low, high = mul_shift(exact_inv_pow5(base2), -1, 5 ** (base2 - i), pow5bits(base2) - pow5bits(i))
+        exact_low, exact_high = split(exact_inv_pow5(i))
+        offset = (exact_low - low - 1) & MASK64
+        assert exact_high == high and offset <= 3 and low + 1 + offset <= MASK64
+        pow5_inv_offsets[i // 16] |= offset << ((i % 16) * 2)
+
+    return pow5_offsets, pow5_inv_offsets
+
+
+def format_table(c_type, name, comment, rows):
+    lines = ['/* %s */' % comment,
+             'static const %s %s JERRY_CONST_DATA =' % (c_type, name),
+             '{']
+    lines.append(',\n'.join('  ' + row for row in rows))
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def format_pairs(values):
+    return ['{ 0x%016xull, 0x%016xull }' % split(value) for value in values]
+
+
+def format_list(values, fmt, per_line):
+    groups = [values[i:i + per_line] for i in range(0, len(values), per_line)]
+    return [', '.join(fmt % value for value in group) for group in groups]
+
+
+def generate(output_file):
+    pow5_offsets, pow5_inv_offsets = compute_offsets()
+
+    pow5_split = [exact_pow5(i * POW5_TABLE_SIZE) for i in range((POW5_COUNT - 1) // POW5_TABLE_SIZE + 1)]
+    pow5_inv_split = [exact_inv_pow5(i * POW5_TABLE_SIZE)
+                      for i in range((POW5_INV_COUNT - 1 + POW5_TABLE_SIZE - 1) // POW5_TABLE_SIZE + 1)]
+
+    tables = [
+        format_table('uint64_t', 'ecma_number_pow5_table[%d]' % POW5_TABLE_SIZE,
+                     'Powers of five which fit into 64 bits.',
+                     format_list([5 ** i for i in range(POW5_TABLE_SIZE)], '0x%016xull', 3)),
+        format_table('uint64_t', 'ecma_number_pow5_split[%d][2]' % len(pow5_split),
+                     'Every %d-th power of five normalized to %d bits, low and high half.'
+                     % (POW5_TABLE_SIZE, POW5_BITCOUNT),
+                     format_pairs(pow5_split)),
+        format_table('uint32_t', 'ecma_number_pow5_offsets[%d]' % len(pow5_offsets),
+                     'Corrections of the computed powers of five, two bits per power.',
+                     format_list(pow5_offsets, '0x%08x', 6)),
+        format_table('uint64_t', 'ecma_number_pow5_inv_split[%d][2]' % len(pow5_inv_split),
+                     'Every %d-th inverse power of five normalized to %d bits, low and high half.'
+                     % (POW5_TABLE_SIZE, POW5_INV_BITCOUNT),
+                     format_pairs(pow5_inv_split)),
+        format_table('uint32_t', 'ecma_number_pow5_inv_offsets[%d]' % len(pow5_inv_offsets),
+                     'Corrections of the computed inverse powers of five, two bits per power.',
+                     format_list(pow5_inv_offsets, '0x%08x', 6)),
+    ]
+
+    with open(output_file, 'w') as output:
+        output.write(LICENSE)
+        output.write('\n\n/* This file is automatically generated by the gen-ryu-tables.py script. Do not edit! */\n')
+        output.write('\n\n'.join([''] + tables) + '\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='ecma-helpers-ryu-tables.inc.h generator')
+    parser.add_argument('--output', metavar='FILE', action='store', default=OUTPUT_FILE,
+                        help='specify the output file (default: %(default)s)')
+    script_args = parser.parse_args()
+
+    generate(script_args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,264 @@
+#!/usr/bin/env python
+
+# Copyright JS Foundation and other contributors, http://js.foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Convert a heap snapshot stream produced by jerry_heap_snapshot () or
+`jerry --heap-snapshot FILE` into the .heapsnapshot JSON format, which can be
+loaded into the Memory panel of the Chrome DevTools (and other tools which
+read V8 heap snapshots).
+
+Shared nodes may be repeated in the stream, so nodes are deduplicated by id
+and edges by (from, to, type, name). The GC roots are connected to a synthetic
+root node.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import sys
+
+NODE_TYPES = ['hidden', 'array', 'string', 'object', 'code', 'closure', 'regexp', 'number',
+              'native', 'synthetic', 'concatenated string', 'sliced string', 'symbol', 'bigint']
+
+EDGE_TYPES = ['context', 'element', 'property', 'internal', 'hidden', 'shortcut', 'weak']
+
+# Stream edge type -> DevTools edge type
+EDGE_TYPE_MAP = {
+    'property': 'property',
+    'element': 'element',
+    'variable': 'context',
+    'getter': 'property',
+    'setter': 'property',
+    'prototype': 'property',
+    'scope': 'internal',
+    'binding': 'internal',
+    'bytecode': 'internal',
+    'native': 'internal',
+    'internal': 'internal',
+}
+
+SNAPSHOT_HEADER = 'JERRY-HEAP-SNAPSHOT'
+SNAPSHOT_VERSION = 1
+
+
+class HeapSnapshot(object):
+    def __init__(self):
+        self.nodes = {}
+        self.node_order = []
+        self.edges = {}
+        self.edge_set = set()
+        self.roots = []
+
+    def add_node(self, node_id, node_type, size, name):
+        if node_id in self.nodes:
+            return
+        self.nodes[node_id] = (node_type, size, name)
+        self.node_order.append(node_id)
+        self.edges[node_id] = []
+
+    def add_edge(self, from_id, to_id, edge_type, name):
+        key = (from_id, to_id, edge_type, name)
+        if key in self.edge_set:
+            return
+        self.edge_set.add(key)
+        self.edges.setdefault(from_id, []).append((to_id, edge_type, name))
+
+    def add_root(self, node_id):
+        self.roots.append(node_id)
+
+
+def parse_name(text, line_number):
+    try:
+        return json.loads(text)
+    except ValueError:
+        sys.exit('line %d: invalid name: %s' % (line_number, text))
+
+
+def parse_snapshot(stream):
+    snapshot = HeapSnapshot()
+    lines = stream.decode('utf-8', 'replace').split('\n')
+
+    header = lines[0].split(' ')
+    if len(header) != 2 or header[0] != SNAPSHOT_HEADER:
+        sys.exit('not a heap snapshot stream')
+    if int(header[1]) != SNAPSHOT_VERSION:
+        sys.exit('unsupported heap snapshot version: %s' % header[1])
+
+    for line_number, line in enumerate(lines[1:], 2):
+        if not line:
+            continue
+
+        fields = line.split(' ', 4)
+        if fields[0] == 'N' and len(fields) == 5:
+            snapshot.add_node(int(fields[1]), fields[2], int(fields[3]), parse_name(fields[4], line_number))
+        elif fields[0] == 'E' and len(fields) == 5:
+            snapshot.add_edge(int(fields[1]), int(fields[2]), fields[3], parse_name(fields[4], line_number))
+        elif fields[0] == 'R' and len(fields) == 2:
+            snapshot.add_root(int(fields[1]))
+        else:
+            sys.exit('line %d: invalid record: %s' % (line_number, line))
+
+    return snapshot
+
+
+def get_node_type_and_name(node_type, name):
+    if node_type == 'object':
+        if name == 'Function':
+            return 'closure', 'Function'
+        if name == 'Array':
+            return 'object', 'Array'
+        if name == 'RegExp':
+            return 'regexp', 'RegExp'
+        return 'object', name
+    if node_type == 'scope':
+        return 'hidden', '(%s scope)' % name
+    if node_type == 'string':
+        return 'string', name
+    if node_type == 'symbol':
+        return 'symbol', name
+    if node_type == 'bytecode':
+        return 'code', '(%s bytecode)' % name
+    if node_type == 'native':
+        return 'native', '(native %s)' % hex(int(name))
+    return 'hidden', '(%s)' % node_type
+
+
+def get_edge_name(edge_type, name):
+    if edge_type == 'getter':
+        return 'get ' + name
+    if edge_type == 'setter':
+        return 'set ' + name
+    return name
+
+
+def convert_snapshot(snapshot):
+    strings = []
+    string_ids = {}
+
+    def get_string_id(string):
+        if string not in string_ids:
+            string_ids[string] = len(strings)
+            strings.append(string)
+        return string_ids[string]
+
+    node_field_count = 6
+    node_indices = {}
+    # The synthetic root is the first node, the DevTools use it as the root of the graph.
+    node_order = [None] + snapshot.node_order
+    for index, node_id in enumerate(node_order):
+        node_indices[node_id] = index * node_field_count
+
+    edges = {None: [(root_id, 'element', str(index)) for index, root_id in enumerate(snapshot.roots)]}
+    edges.update(snapshot.edges)
+
+    node_data = []
+    edge_data = []
+    dropped_edges = 0
+
+    for index, node_id in enumerate(node_order):
+        if node_id is None:
+            node_type, name, size = 'synthetic', '(GC roots)', 0
+        else:
+            stream_type, size, stream_name = snapshot.nodes[node_id]
+            node_type, name = get_node_type_and_name(stream_type, stream_name)
+
+        edge_count = 0
+        for to_id, stream_edge_type, edge_name in edges.get(node_id, []):
+            if to_id not in node_indices:
+                dropped_edges += 1
+                continue
+
+            edge_type = EDGE_TYPE_MAP.get(stream_edge_type, 'internal')
+            if edge_type == 'element':
+                name_or_index = int(edge_name)
+            else:
+                name_or_index = get_string_id(get_edge_name(stream_edge_type, edge_name))
+
+            edge_data.extend([EDGE_TYPES.index(edge_type), name_or_index, node_indices[to_id]])
+            edge_count += 1
+
+        # Odd ids are used for heap objects by the DevTools.
+        node_data.extend([NODE_TYPES.index(node_type), get_string_id(name), index * 2 + 1, size, edge_count, 0])
+
+    if dropped_edges:
+        print('warning: %d edges point to unknown nodes' % dropped_edges, file=sys.stderr)
+
+    return {
+        'snapshot': {
+            'meta': {
+                'node_fields': ['type', 'name', 'id', 'self_size', 'edge_count', 'trace_node_id'],
+                'node_types': [NODE_TYPES, 'string', 'number', 'number', 'number', 'number'],
+                'edge_fields': ['type', 'name_or_index', 'to_node'],
+                'edge_types': [EDGE_TYPES, 'string_or_number', 'node'],
+                'trace_function_info_fields': ['function_id', 'name', 'script_name', 'script_id', 'line', 'column'],
+                'trace_node_fields': ['id', 'function_info_index', 'count', 'size', 'children'],
+                'sample_fields': ['timestamp_us', 'last_assigned_id'],
+                'location_fields': ['object_index', 'script_id', 'line', 'column'],
+            },
+            'node_count': len(node_order),
+            'edge_count': len(edge_data) // 3,
+            'trace_function_count': 0,
+        },
+        'nodes': node_data,
+        'edges': edge_data,
+        'trace_function_infos': [],
+        'trace_tree': [],
+        'samples': [],
+        'locations': [],
+        'strings': strings,
+    }
+
+
+def print_summary(snapshot):
+    totals = {}
+    for node_type, size, name in snapshot.nodes.values():
+        key = (node_type, name if node_type == 'object' else '')
+        count, total_size = totals.get(key, (0, 0))
+        totals[key] = (count + 1, total_size + size)
+
+    print('%-10s %-24s %8s %10s' % ('type', 'class', 'count', 'size'))
+    for key, value in sorted(totals.items(), key=lambda item: -item[1][1]):
+        print('%-10s %-24s %8d %10d' % (key[0], key[1], value[0], value[1]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', metavar='FILE', help='heap snapshot stream')
+    parser.add_argument('-o', '--output', metavar='FILE',
+                        help='write the .heapsnapshot JSON into FILE (default: standard output)')
+    parser.add_argument('--summary', action='store_true',
+                        help='print the number and total size of the nodes grouped by type and class instead')
+    args = parser.parse_args()
+
+    with open(args.input, 'rb') as input_file:
+        snapshot = parse_snapshot(input_file.read())
+
+    if args.summary:
+        print_summary(snapshot)
+        return
+
+    result = convert_snapshot(snapshot)
+
+    if args.output:
+        with open(args.output, 'w') as output_file:
+            json.dump(result, output_file, separators=(',', ':'))
+    else:
+        json.dump(result, sys.stdout, separators=(',', ':'))
+
+
+if __name__ == '__main__':
+    main()
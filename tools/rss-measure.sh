@@ -14,8 +14,12 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+# Usage: rss-measure.sh JERRY TEST [--final]
+# Prints the maximum RSS of the engine (in kilobytes), and with --final the
+# last sampled RSS too, which shows the memory given back after a load spike.
 JERRY=$1
 TEST=$2
+FINAL=$3
 SLEEP=0.1
 OS=`uname -s | tr [:upper:] [:lower:]`
 
@@ -47,6 +51,14 @@ function print_entry()
   eval "echo -e \"\$$OUT\"" | awk -v entry="$1" '{ if ($1 != "") { n += 1; if ($1 > max) { max = $1; } } } END { if (n == 0) { exit; }; printf "%d\n",  max; }';
 }
 
+function print_final_entry()
+{
+  OUT_NAME="$1_OUT";
+  OUT=$OUT_NAME;
+
+  eval "echo -e \"\$$OUT\"" | awk '{ if ($1 != "") { last = $1; } } END { if (last == "") { exit; }; printf "%d\n", last; }';
+}
+
 function run_test()
 {
   $JERRY $TEST &
@@ -65,3 +77,8 @@ function run_test()
 run_test
 
 print_entry Rss
+
+if [ "$FINAL" == "--final" ]
+then
+  print_final_entry Rss
+fi
@@ -0,0 +1,403 @@
+#!/usr/bin/env python
+
+# Copyright JS Foundation and other contributors, http://js.foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Run the benchmark suite and compare the results against a stored baseline.
+
+Every benchmark is executed REPEATS times and the wall clock time of each run
+is recorded. A few extra runs sample the maximum resident set size and, when the
+engine is built with --mem-stats=on --logging=on, report the peak heap usage
+(jmem_heap_stats_t::peak_allocated_bytes) through --mem-stats. The results are
+printed as a table and can be written as JSON, which can be passed back as
+--baseline to a later run.
+
+A time difference only counts as a regression or improvement when it exceeds
+both --threshold and --noise times the combined relative standard deviation of
+the two measurements.
+"""
+
+from __future__ import print_function
+# force // operator to be integer division in Python 2
+from __future__ import division
+
+import argparse
+import json
+import math
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+import timeit
+
+TOOLS_PATH = os.path.dirname(os.path.realpath(__file__))
+BASE_PATH = os.path.join(TOOLS_PATH, '..')
+
+DEFAULT_ENGINE = os.path.join(BASE_PATH, 'build', 'bin', 'jerry')
+DEFAULT_SUITE = os.path.join(BASE_PATH, 'tests', 'benchmarks', 'suite', 'benchmarks.json')
+
+MEM_STATS_DISABLED = 'Ignoring \'--mem-stats\' option because this feature is disabled!'
+PEAK_HEAP_RE = re.compile(r'^\s*Peak allocated = (\d+) bytes', re.MULTILINE)
+
+MEMORY_RUNS = 3
+RSS_SAMPLE_INTERVAL = 0.0005
+
+STATUS_OK = 'ok'
+STATUS_FAILED = 'failed'
+STATUS_SKIPPED = 'skipped'
+
+
+def get_arguments():
+    parser = argparse.ArgumentParser(description='Run the benchmark suite and compare against a baseline')
+    parser.add_argument('--engine', metavar='FILE', default=DEFAULT_ENGINE,
+                        help='jerry binary to benchmark (default: %(default)s)')
+    parser.add_argument('--snapshot-tool', metavar='FILE',
+                        help='jerry-snapshot binary used for snapshot benchmarks (default: next to the engine)')
+    parser.add_argument('--suite', metavar='FILE', default=DEFAULT_SUITE,
+                        help='benchmark list (default: %(default)s)')
+    parser.add_argument('--repeats', metavar='N', type=int, default=5,
+                        help='number of measured runs per benchmark (default: %(default)s)')
+    parser.add_argument('--warmup', metavar='N', type=int, default=1,
+                        help='number of unmeasured runs per benchmark (default: %(default)s)')
+    parser.add_argument('--timeout', metavar='SEC', type=int, default=60,
+                        help='kill a run after SEC seconds (default: %(default)s)')
+    parser.add_argument('--output', metavar='FILE',
+                        help='write the results as JSON to FILE')
+    parser.add_argument('--baseline', metavar='FILE',
+                        help='compare the results against a JSON file written by --output')
+    parser.add_argument('--threshold', metavar='PERCENT', type=float, default=2.0,
+                        help='minimal relative time change reported (default: %(default)s)')
+    parser.add_argument('--noise', metavar='FACTOR', type=float, default=2.0,
+                        help='time changes within FACTOR standard deviations are ignored (default: %(default)s)')
+    parser.add_argument('--heap-threshold', metavar='PERCENT', type=float, default=1.0,
+                        help='minimal relative peak heap change reported (default: %(default)s)')
+    parser.add_argument('--rss-threshold', metavar='PERCENT', type=float, default=10.0,
+                        help='minimal relative RSS change reported (default: %(default)s)')
+    parser.add_argument('benchmarks', metavar='NAME', nargs='*',
+                        help='run only the named benchmarks (default: all)')
+
+    args = parser.parse_args()
+    if args.repeats < 1:
+        parser.error('--repeats must be greater than 0')
+    return args
+
+
+def read_peak_rss(pid, engine):
+    """ Return the resident set high water mark of a running engine process in KB or None. """
+    try:
+        # Until the forked child executes the engine, its memory is a copy of this script.
+        if os.path.realpath(os.readlink('/proc/%d/exe' % pid)) != engine:
+            return None
+        with open('/proc/%d/status' % pid) as status_file:
+            for line in status_file:
+                if line.startswith('VmHWM:'):
+                    return int(line.split()[1])
+    except (IOError, OSError, ValueError):
+        pass
+    return None
+
+
+def execute(cmd, timeout, sample_rss=False):
+    """ Run a command and return its exit code, wall time, maximum RSS in KB (or None) and output. """
+    output = tempfile.TemporaryFile()
+    max_rss = None
+    start = timeit.default_timer()
+    proc = subprocess.Popen(cmd, stdout=output, stderr=subprocess.STDOUT)
+    timer = threading.Timer(timeout, proc.kill)
+    timer.start()
+    try:
+        if sample_rss:
+            # The ru_maxrss value of a child also covers the Python process it was forked
+            # from, so the kernel maintained high water mark is sampled while the engine runs.
+            while proc.poll() is None:
+                max_rss = read_peak_rss(proc.pid, cmd[0]) or max_rss
+                time.sleep(RSS_SAMPLE_INTERVAL)
+        else:
+            proc.wait()
+        elapsed = timeit.default_timer() - start
+    finally:
+        timer.cancel()
+
+    output.seek(0)
+    text = output.read().decode('utf-8', 'replace')
+    output.close()
+    return proc.returncode, elapsed, max_rss, text
+
+
+def median(values):
+    ordered = sorted(values)
+    middle = len(ordered) // 2
+    if len(ordered) % 2:
+        return ordered[middle]
+    return (ordered[middle - 1] + ordered[middle]) / 2
+
+
+def summarize(samples):
+    mean = sum(samples) / len(samples)
+    if len(samples) > 1:
+        stdev = math.sqrt(sum((sample - mean) ** 2 for sample in samples) / (len(samples) - 1))
+    else:
+        stdev = 0.0
+    return {
+        'min': min(samples),
+        'median': median(samples),
+        'mean': mean,
+        'stdev': stdev,
+        'samples': samples
+    }
+
+
+class BenchmarkRunner(object):
+    def __init__(self, args):
+        self.args = args
+        self.engine = os.path.realpath(args.engine)
+        self.suite_dir = os.path.dirname(os.path.abspath(args.suite))
+        self.temp_dir = tempfile.mkdtemp(prefix='jerry-bench-')
+        self.snapshot_tool = args.snapshot_tool or os.path.join(os.path.dirname(self.engine), 'jerry-snapshot')
+        self.supported_globals = {}
+        self.has_mem_stats = self.check_mem_stats()
+
+    def cleanup(self):
+        shutil.rmtree(self.temp_dir, ignore_errors=True)
+
+    def run_engine(self, engine_args, sample_rss=False):
+        return execute([self.engine] + engine_args, self.args.timeout, sample_rss)
+
+    def write_temp_file(self, name, content):
+        path = os.path.join(self.temp_dir, name)
+        with open(path, 'w') as temp_file:
+            temp_file.write(content)
+        return path
+
+    def check_mem_stats(self):
+        probe = self.write_temp_file('mem-stats-probe.js', ';')
+        returncode, _, _, output = self.run_engine(['--mem-stats', probe])
+        return returncode == 0 and MEM_STATS_DISABLED not in output and PEAK_HEAP_RE.search(output) is not None
+
+    def missing_globals(self, names, options):
+        missing = []
+        for name in names:
+            key = (name, tuple(options))
+            if key not in self.supported_globals:
+                probe = self.write_temp_file('global-probe.js', 'assert (typeof %s !== "undefined");' % name)
+                self.supported_globals[key] = self.run_engine(options + [probe])[0] == 0
+            if not self.supported_globals[key]:
+                missing.append(name)
+        return missing
+
+    def prepare(self, benchmark):
+        """ Return the engine arguments of a benchmark or raise RuntimeError if it cannot run. """
+        source = os.path.join(self.suite_dir, benchmark['file'])
+        options = benchmark.get('engine_args', [])
+        loads = benchmark.get('snapshot_loads')
+        if not loads:
+            return options + [source]
+
+        if not os.path.isfile(self.snapshot_tool):
+            raise RuntimeError('snapshot tool not found: %s' % self.snapshot_tool)
+
+        snapshot = os.path.join(self.temp_dir, benchmark['name'] + '.snapshot')
+        returncode, _, _, output = execute([self.snapshot_tool, 'generate', '-o', snapshot, source],
+                                           self.args.timeout)
+        if returncode != 0:
+            raise RuntimeError('snapshot generation failed: %s' % output.strip().splitlines()[-1:])
+
+        probe_returncode, _, _, output = self.run_engine(options + ['--exec-snapshot', snapshot])
+        if probe_returncode != 0:
+            raise RuntimeError('snapshot execution is not supported by the engine')
+
+        return options + ['--exec-snapshot', snapshot] * loads
+
+    def run(self, benchmark):
+        missing = self.missing_globals(benchmark.get('requires', []), benchmark.get('engine_args', []))
+        if missing:
+            return {'status': STATUS_SKIPPED, 'reason': 'requires %s' % ', '.join(missing)}
+
+        try:
+            engine_args = self.prepare(benchmark)
+        except RuntimeError as err:
+            return {'status': STATUS_SKIPPED, 'reason': str(err)}
+
+        times = []
+        for index in range(self.args.warmup + self.args.repeats):
+            returncode, elapsed, _, output = self.run_engine(engine_args)
+            if returncode != 0:
+                lines = output.strip().splitlines()
+                return {'status': STATUS_FAILED,
+                        'reason': 'exit code %d%s' % (returncode, (': ' + lines[-1]) if lines else '')}
+            if index >= self.args.warmup:
+                times.append(elapsed)
+
+        # Sampling and the statistics slow the engine down, so memory is measured in separate runs.
+        # The RSS samples may miss the last moments of a run, so the largest of a few runs is kept.
+        if self.has_mem_stats:
+            engine_args = ['--mem-stats'] + engine_args
+        rss = []
+        peaks = []
+        for _ in range(MEMORY_RUNS):
+            _, _, max_rss, output = self.run_engine(engine_args, sample_rss=True)
+            if max_rss is not None:
+                rss.append(max_rss)
+            peaks.extend(int(peak) for peak in PEAK_HEAP_RE.findall(output))
+
+        return {
+            'status': STATUS_OK,
+            'time': summarize(times),
+            'max_rss_kb': max(rss) if rss else None,
+            'peak_heap_bytes': max(peaks) if peaks else None
+        }
+
+
+def relative_change(old, new):
+    if not old:
+        return 0.0
+    return (new - old) / old
+
+
+def compare_time(args, old, new):
+    change = relative_change(old['median'], new['median'])
+    noise = 0.0
+    if old['mean'] and new['mean']:
+        noise = math.sqrt((old['stdev'] / old['mean']) ** 2 + (new['stdev'] / new['mean']) ** 2)
+    limit = max(args.threshold / 100, args.noise * noise)
+    return change, limit
+
+
+def verdict(change, limit):
+    if change > limit:
+        return 'regression'
+    if change < -limit:
+        return 'improvement'
+    return 'unchanged'
+
+
+def compare(args, results, baseline):
+    """ Annotate the results with the changes relative to the baseline. Return the number of regressions. """
+    regressions = 0
+    for name, result in sorted(results.items()):
+        old = baseline.get(name)
+        if old is None or result['status'] == STATUS_SKIPPED or old['status'] == STATUS_SKIPPED:
+            continue
+
+        if result['status'] != STATUS_OK or old['status'] != STATUS_OK:
+            result['compare'] = {'status': 'regression' if result['status'] != STATUS_OK else 'improvement'}
+            regressions += result['status'] != STATUS_OK
+            continue
+
+        comparison = {}
+        change, limit = compare_time(args, old['time'], result['time'])
+        comparison['time'] = {'change': change, 'limit': limit, 'status': verdict(change, limit)}
+
+        if old.get('max_rss_kb') is not None and result['max_rss_kb'] is not None:
+            change = relative_change(old['max_rss_kb'], result['max_rss_kb'])
+            comparison['max_rss_kb'] = {'change': change, 'status': verdict(change, args.rss_threshold / 100)}
+
+        if old.get('peak_heap_bytes') is not None and result['peak_heap_bytes'] is not None:
+            change = relative_change(old['peak_heap_bytes'], result['peak_heap_bytes'])
+            comparison['peak_heap_bytes'] = {'change': change, 'status': verdict(change, args.heap_threshold / 100)}
+
+        regressions += sum(1 for value in comparison.values() if value['status'] == 'regression')
+        result['compare'] = comparison
+    return regressions
+
+
+def format_change(result, key):
+    comparison = result.get('compare', {}).get(key)
+    if comparison is None:
+        return ''
+    marks = {'regression': ' !', 'improvement': ' +', 'unchanged': ''}
+    return ' (%+.1f%%%s)' % (comparison['change'] * 100, marks[comparison['status']])
+
+
+def print_results(results):
+    print('%-20s %24s %24s %24s' % ('Benchmark', 'Time (median)', 'Peak heap', 'Max RSS'))
+    for name, result in sorted(results.items()):
+        if result['status'] != STATUS_OK:
+            status = result['status']
+            if 'compare' in result:
+                status += ' (%s)' % result['compare']['status']
+            print('%-20s %s: %s' % (name, status, result['reason']))
+            continue
+
+        time = '%.3fs +-%.1f%%%s' % (result['time']['median'],
+                                     100 * result['time']['stdev'] / result['time']['mean'],
+                                     format_change(result, 'time'))
+        if result['peak_heap_bytes'] is None:
+            heap = 'n/a'
+        else:
+            heap = '%d B%s' % (result['peak_heap_bytes'], format_change(result, 'peak_heap_bytes'))
+        if result['max_rss_kb'] is None:
+            rss = 'n/a'
+        else:
+            rss = '%d KB%s' % (result['max_rss_kb'], format_change(result, 'max_rss_kb'))
+        print('%-20s %24s %24s %24s' % (name, time, heap, rss))
+
+
+def main():
+    args = get_arguments()
+
+    if not os.path.isfile(args.engine):
+        sys.exit('Engine not found: %s' % args.engine)
+
+    with open(args.suite) as suite_file:
+        suite = json.load(suite_file)
+
+    if args.benchmarks:
+        unknown = set(args.benchmarks) - set(benchmark['name'] for benchmark in suite)
+        if unknown:
+            sys.exit('Unknown benchmarks: %s' % ', '.join(sorted(unknown)))
+        suite = [benchmark for benchmark in suite if benchmark['name'] in args.benchmarks]
+
+    runner = BenchmarkRunner(args)
+    results = {}
+    try:
+        for benchmark in suite:
+            print('Running %s...' % benchmark['name'], file=sys.stderr)
+            results[benchmark['name']] = runner.run(benchmark)
+    finally:
+        runner.cleanup()
+
+    regressions = 0
+    if args.baseline:
+        with open(args.baseline) as baseline_file:
+            regressions = compare(args, results, json.load(baseline_file)['benchmarks'])
+
+    print_results(results)
+
+    if args.output:
+        with open(args.output, 'w') as output_file:
+            json.dump({
+                'engine': runner.engine,
+                'repeats': args.repeats,
+                'mem_stats': runner.has_mem_stats,
+                'benchmarks': results
+            }, output_file, indent=2, sort_keys=True)
+            output_file.write('\n')
+
+    failures = sum(1 for result in results.values() if result['status'] == STATUS_FAILED)
+    if failures:
+        print('%d benchmark(s) failed' % failures)
+    if regressions:
+        print('%d regression(s) found' % regressions)
+    if failures or regressions:
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
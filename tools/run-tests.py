@@ -40,7 +40,12 @@ OPTIONS_DEBUG = ['--debug']
 OPTIONS_SNAPSHOT = ['--snapshot-save=on', '--snapshot-exec=on', '--jerry-cmdline-snapshot=on']
 OPTIONS_UNITTESTS = ['--unittests=on', '--jerry-cmdline=off', '--error-messages=on',
                      '--snapshot-save=on', '--snapshot-exec=on', '--vm-exec-stop=on',
-                     '--line-info=on', '--mem-stats=on']
+                     '--line-info=on', '--mem-stats=on', '--profiler=on',
+                     '--vm-stats=on', '--heap-snapshot=on', '--mem-alloc-sites=on',
+                     '--mem-release-pages=on', '--structured-clone=on', '--heap-image=on']
+OPTIONS_HEAP_REGIONS = ['--mem-heap-regions=on', '--mem-heap-region-size=16', '--mem-alloc-sites=off',
+                        '--heap-image=off', '--mem-release-pages=on']
+OPTIONS_HEAP_REGIONS_DEFAULT_SIZE = ['--mem-heap-regions=on', '--mem-alloc-sites=off', '--heap-image=off']
 OPTIONS_DOCTESTS = ['--doctests=on', '--jerry-cmdline=off', '--error-messages=on',
                     '--snapshot-save=on', '--snapshot-exec=on', '--vm-exec-stop=on']
 
@@ -58,6 +63,12 @@ JERRY_UNITTESTS_OPTIONS = [
             OPTIONS_UNITTESTS + OPTIONS_PROFILE_ES51),
     Options('unittests-es5.1-debug',
             OPTIONS_UNITTESTS + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG),
+    Options('unittests-es5.1-large_heap',
+            OPTIONS_UNITTESTS + OPTIONS_PROFILE_ES51 + ['--cpointer-32bit=on', '--mem-heap=32768']),
+    Options('unittests-es5.1-debug-heap_regions',
+            OPTIONS_UNITTESTS + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_HEAP_REGIONS),
+    Options('unittests-es5.1-debug-heap_regions_default_size',
+            OPTIONS_UNITTESTS + OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_HEAP_REGIONS_DEFAULT_SIZE),
     Options('doctests-es5.1',
             OPTIONS_DOCTESTS + OPTIONS_PROFILE_ES51),
     Options('doctests-es5.1-debug',
@@ -80,6 +91,10 @@ JERRY_TESTS_OPTIONS = [
             OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + ['--cpointer-32bit=on', '--mem-heap=1024']),
     Options('jerry_tests-es5.1-debug-external_context',
             OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + ['--external-context=on']),
+    Options('jerry_tests-es5.1-debug-heap_regions',
+            OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + OPTIONS_HEAP_REGIONS),
+    Options('jerry_tests-es5.1-debug-line_info',
+            OPTIONS_PROFILE_ES51 + OPTIONS_DEBUG + ['--line-info=on']),
     Options('jerry_tests-es2015_subset-debug',
             OPTIONS_PROFILE_ES2015 + OPTIONS_DEBUG),
 ]
@@ -146,6 +161,14 @@ JERRY_BUILDOPTIONS = [
             ['--jerry-libm=off', '--link-lib=m']),
     Options('buildoption_test-no_lcache_prophashmap',
             ['--compile-flag=-DCONFIG_ECMA_LCACHE_DISABLE', '--compile-flag=-DCONFIG_ECMA_PROPERTY_HASHMAP_DISABLE']),
+    Options('buildoption_test-no_global_cache',
+            ['--compile-flag=-DCONFIG_ECMA_GLOBAL_CACHE_DISABLE']),
+    Options('buildoption_test-no_enum_cache',
+            ['--compile-flag=-DCONFIG_ECMA_ENUM_CACHE_DISABLE']),
+    Options('buildoption_test-no_eval_cache',
+            ['--compile-flag=-DCONFIG_ECMA_EVAL_CACHE_DISABLE']),
+    Options('buildoption_test-no_builtin_rom',
+            ['--compile-flag=-DCONFIG_ECMA_BUILTIN_ROM_DISABLE']),
     Options('buildoption_test-external_context',
             ['--external-context=on']),
     Options('buildoption_test-shared_libs',
@@ -156,6 +179,26 @@ JERRY_BUILDOPTIONS = [
             ['--jerry-cmdline-snapshot=on']),
     Options('buildoption_test-regexp_recursion_limit',
             ['--regexp-recursion-limit=1000']),
+    Options('buildoption_test-profiler',
+            ['--profiler=on']),
+    Options('buildoption_test-vm_stats',
+            ['--vm-stats=on']),
+    Options('buildoption_test-heap_image',
+            ['--heap-image=on']),
+    Options('buildoption_test-heap_snapshot',
+            ['--heap-snapshot=on']),
+    Options('buildoption_test-mem_alloc_sites',
+            ['--mem-alloc-sites=on']),
+    Options('buildoption_test-mem_heap_regions',
+            ['--mem-heap-regions=on']),
+    Options('buildoption_test-mem_heap_regions_external_context',
+            ['--mem-heap-regions=on', '--external-context=on']),
+    Options('buildoption_test-mem_release_pages',
+            ['--mem-release-pages=on']),
+    Options('buildoption_test-mem_release_pages_heap_regions',
+            ['--mem-release-pages=on', '--mem-heap-regions=on']),
+    Options('buildoption_test-structured_clone',
+            ['--structured-clone=on']),
 ]
 
 def get_arguments():